@@ -226,6 +226,30 @@ macro(dune_probe_functions)
     "sys/mman.h;sys/types.h"
     DUNE_SYS_HAS_MMAP64)
 
+  dune_test_function(epoll_create1
+    "int"
+    "int"
+    "sys/epoll.h"
+    DUNE_SYS_HAS_EPOLL_CREATE1)
+
+  dune_test_function(eventfd
+    "int"
+    "unsigned int;int"
+    "sys/eventfd.h"
+    DUNE_SYS_HAS_EVENTFD)
+
+  dune_test_function(recvmmsg
+    "int"
+    "int;struct mmsghdr*;unsigned int;int;struct timespec*"
+    "sys/types.h;sys/socket.h"
+    DUNE_SYS_HAS_RECVMMSG)
+
+  dune_test_function(sendmmsg
+    "int"
+    "int;struct mmsghdr*;unsigned int;int"
+    "sys/types.h;sys/socket.h"
+    DUNE_SYS_HAS_SENDMMSG)
+
   dune_test_function(mlockall
     "int"
     "int"
@@ -700,6 +724,18 @@ macro(dune_probe_functions)
     ""
     DUNE_SYS_HAS___SYNC_SUB_AND_FETCH)
 
+  dune_test_function(__sync_bool_compare_and_swap
+    "bool"
+    "long*;long;long"
+    ""
+    DUNE_SYS_HAS___SYNC_BOOL_COMPARE_AND_SWAP)
+
+  dune_test_function(__sync_synchronize
+    "void"
+    ""
+    ""
+    DUNE_SYS_HAS___SYNC_SYNCHRONIZE)
+
   dune_test_function(fork
     "pid_t"
     ""
@@ -61,6 +61,12 @@ if(DUNE_PROGRAM_PYTHON)
       ${extra_flags}
       -x ${DUNE_IMC_XML} ${DUNE_IMC_FOLDER}
 
+      COMMAND ${DUNE_PROGRAM_PYTHON}
+      ${PROJECT_SOURCE_DIR}/programs/generators/imc_compact.py
+      ${extra_flags}
+      -x ${DUNE_IMC_XML}
+      -c ${PROJECT_SOURCE_DIR}/programs/generators/imc_compact.xml ${DUNE_IMC_FOLDER}
+
       COMMAND ${DUNE_PROGRAM_PYTHON}
       ${PROJECT_SOURCE_DIR}/programs/generators/imc_tests.py
       ${extra_flags}
@@ -77,4 +83,11 @@ if(DUNE_PROGRAM_PYTHON)
   dune_target_imc(imc "")
   dune_target_imc(imc_force "-f")
 
+  # Check generated sources.
+  add_custom_target(imc_check
+    COMMAND ${DUNE_PROGRAM_PYTHON}
+    ${PROJECT_SOURCE_DIR}/programs/generators/imc_check.py
+    -x ${DUNE_IMC_XML}
+    -c ${PROJECT_SOURCE_DIR}/programs/generators/imc_compact.xml ${DUNE_IMC_FOLDER})
+
 endif(DUNE_PROGRAM_PYTHON)
@@ -73,6 +73,23 @@ const float c_max_speed = 6.0;
 // Timestep
 const float c_timestep = 0.5;
 
+//! Check if a message is used by this program.
+static bool
+isRelevant(uint16_t id)
+{
+  switch (id)
+  {
+    case DUNE_IMC_ANNOUNCE:
+    case DUNE_IMC_LOGGINGCONTROL:
+    case DUNE_IMC_ESTIMATEDSTATE:
+    case DUNE_IMC_RPM:
+    case DUNE_IMC_SIMULATEDSTATE:
+      return true;
+    default:
+      return false;
+  }
+}
+
 int
 main(int32_t argc, char** argv)
 {
@@ -87,13 +104,6 @@ main(int32_t argc, char** argv)
 
   for (int32_t i = 1; i < argc; ++i)
   {
-    std::istream* is = 0;
-    Compression::Methods method = Compression::Factory::detect(argv[i]);
-    if (method == METHOD_UNKNOWN)
-      is = new std::ifstream(argv[i], std::ios::binary);
-    else
-      is = new Compression::FileInput(argv[i], method);
-
     IMC::Message* msg = NULL;
 
     uint16_t curr_rpm = 0;
@@ -117,8 +127,21 @@ main(int32_t argc, char** argv)
 
     try
     {
-      while ((msg = IMC::Packet::deserialize(*is)) != 0)
+      IMC::LogReader reader(argv[i]);
+      IMC::PacketView view;
+
+      while (reader.next(view))
       {
+        if (!isRelevant(view.getId()))
+          continue;
+
+        // Skip decoding states closer than the timestep.
+        if (view.getId() == DUNE_IMC_ESTIMATEDSTATE
+            && view.getTimeStamp() - estate.getTimeStamp() <= c_timestep)
+          continue;
+
+        msg = view.decode();
+
         if (msg->getId() == DUNE_IMC_ANNOUNCE)
         {
           IMC::Announce* ptr = static_cast<IMC::Announce*>(msg);
@@ -202,13 +225,11 @@ main(int32_t argc, char** argv)
         }
       }
     }
-    catch (std::runtime_error& e)
+    catch (std::exception& e)
     {
       std::cerr << "ERROR: " << e.what() << std::endl;
     }
 
-    delete is;
-
     if (ignore)
     {
       std::cerr << "... ignoring" << std::endl;
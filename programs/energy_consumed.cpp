@@ -50,6 +50,160 @@ const unsigned c_samples = 7;
 // Minimum number of samples before starting to count energy
 const unsigned c_min_samples = 20;
 
+//! Per log state.
+struct LogState
+{
+  std::string log_name;
+  bool got_name;
+  // Energy computation related data
+  Monitors::FuelLevel::BatteryData bdata;
+  bool volt_entity_set;
+  bool curr_entity_set;
+  bool entities_set;
+  unsigned eids[Monitors::FuelLevel::BatteryData::BM_TOTAL];
+  unsigned samples;
+  double last_timestamp;
+  double accum;
+  // Current rpm value
+  float rpm;
+  // Ignore simulated logs
+  bool ignore;
+
+  LogState(const unsigned* wsizes):
+    log_name("unknown"),
+    got_name(false),
+    bdata(wsizes),
+    volt_entity_set(false),
+    curr_entity_set(false),
+    entities_set(false),
+    samples(0),
+    last_timestamp(0.0),
+    accum(0.0),
+    rpm(0.0),
+    ignore(false)
+  {
+    for (unsigned k = 0; k < Monitors::FuelLevel::BatteryData::BM_TOTAL; k++)
+      eids[k] = 0;
+  }
+};
+
+//! Energy accounting, logs are processed in parallel and merged by
+//! timestamp.
+class EnergyConsumed: public DUNE::IMC::LogProcessor::Handler
+{
+public:
+  std::vector<LogState*> logs;
+  std::string volt_label;
+  std::string curr_label;
+  // Total energy spent while the motor was on
+  double motor_total_accum;
+
+  EnergyConsumed(void):
+    motor_total_accum(0.0)
+  { }
+
+  ~EnergyConsumed(void)
+  {
+    for (size_t i = 0; i < logs.size(); ++i)
+      delete logs[i];
+  }
+
+  bool
+  filter(const DUNE::IMC::PacketView& view)
+  {
+    switch (view.getId())
+    {
+      case DUNE_IMC_LOGGINGCONTROL:
+      case DUNE_IMC_ENTITYINFO:
+      case DUNE_IMC_VOLTAGE:
+      case DUNE_IMC_CURRENT:
+      case DUNE_IMC_RPM:
+      case DUNE_IMC_SIMULATEDSTATE:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  void
+  reduce(const DUNE::IMC::Message* msg, unsigned file)
+  {
+    LogState& log = *logs[file];
+
+    if (log.ignore)
+      return;
+
+    if (msg->getId() == DUNE_IMC_LOGGINGCONTROL)
+    {
+      if (!log.got_name)
+      {
+        const DUNE::IMC::LoggingControl* ptr = static_cast<const DUNE::IMC::LoggingControl*>(msg);
+
+        if (ptr->op == DUNE::IMC::LoggingControl::COP_STARTED)
+        {
+          log.log_name = ptr->name;
+          log.got_name = true;
+        }
+      }
+    }
+    else if (msg->getId() == DUNE_IMC_ENTITYINFO)
+    {
+      const DUNE::IMC::EntityInfo* ptr = static_cast<const DUNE::IMC::EntityInfo*>(msg);
+
+      if (ptr->label.compare(volt_label) == 0)
+      {
+        log.eids[Monitors::FuelLevel::BatteryData::BM_VOLTAGE] = ptr->id;
+        log.volt_entity_set = true;
+      }
+
+      if (ptr->label.compare(curr_label) == 0)
+      {
+        log.eids[Monitors::FuelLevel::BatteryData::BM_CURRENT] = ptr->id;
+        log.curr_entity_set = true;
+      }
+
+      if (!log.entities_set && log.volt_entity_set && log.curr_entity_set)
+      {
+        log.bdata.setEntities(log.eids);
+        log.entities_set = true;
+      }
+    }
+    else if (msg->getId() == DUNE_IMC_VOLTAGE)
+    {
+      if (log.entities_set)
+      {
+        log.bdata.update(static_cast<const DUNE::IMC::Voltage*>(msg));
+        ++log.samples;
+
+        if (log.samples > c_min_samples)
+        {
+          float drop = log.bdata.getEnergyDrop(msg->getTimeStamp() - log.last_timestamp);
+          log.accum += drop;
+
+          if (log.rpm > c_min_rpm)
+            motor_total_accum += drop;
+        }
+      }
+
+      log.last_timestamp = msg->getTimeStamp();
+    }
+    else if (msg->getId() == DUNE_IMC_CURRENT)
+    {
+      if (log.entities_set)
+        log.bdata.update(static_cast<const DUNE::IMC::Current*>(msg));
+    }
+    else if (msg->getId() == DUNE_IMC_RPM)
+    {
+      log.rpm = static_cast<const DUNE::IMC::Rpm*>(msg)->value;
+    }
+    else if (msg->getId() == DUNE_IMC_SIMULATEDSTATE)
+    {
+      // since it has simulated state let us ignore this log
+      log.ignore = true;
+    }
+  }
+};
+
 int
 main(int32_t argc, char** argv)
 {
@@ -86,148 +240,54 @@ main(int32_t argc, char** argv)
     curr_label = c_label;
   }
 
-  // Total of energy spent
-  double total_accum = 0.0;
-  // Total energy spent while the motor was on
-  double motor_total_accum = 0.0;
-
   // Moving average window sizes
   unsigned wsizes[Monitors::FuelLevel::BatteryData::BM_TOTAL];
 
   for (unsigned k = 0; k < Monitors::FuelLevel::BatteryData::BM_TOTAL; k++)
     wsizes[k] = c_samples;
 
+  EnergyConsumed handler;
+  handler.volt_label = volt_label;
+  handler.curr_label = curr_label;
+
+  DUNE::IMC::LogProcessor proc;
+
   for (int32_t i = start_index; i < argc; ++i)
   {
-    std::istream* is = 0;
-    DUNE::Compression::Methods method = DUNE::Compression::Factory::detect(argv[i]);
-    if (method == DUNE::Compression::METHOD_UNKNOWN)
-      is = new std::ifstream(argv[i], std::ios::binary);
-    else
-      is = new DUNE::Compression::FileInput(argv[i], method);
-
-    DUNE::IMC::Message* msg = NULL;
-
-    bool got_name = false;
-    std::string log_name = "unknown";
-
-    // Energy computation related data
-    Monitors::FuelLevel::BatteryData bdata(wsizes);
-    bool volt_entity_set = false;
-    bool curr_entity_set = false;
-    bool entities_set = false;
-    unsigned eids[Monitors::FuelLevel::BatteryData::BM_TOTAL] = {0};
-    unsigned samples = 0;
-    double last_timestamp = 0.0;
-    double accum = 0.0;
-
-    // Current rpm value
-    float rpm = 0.0;
-
-    // Ignore some logs
-    bool ignore = false;
-
-    try
-    {
-      while ((msg = DUNE::IMC::Packet::deserialize(*is)) != 0)
-      {
+    proc.addFile(argv[i]);
+    handler.logs.push_back(new LogState(wsizes));
+  }
 
-        if (msg->getId() == DUNE_IMC_LOGGINGCONTROL)
-        {
-          if (!got_name)
-          {
-            DUNE::IMC::LoggingControl* ptr = static_cast<DUNE::IMC::LoggingControl*>(msg);
-
-            if (ptr->op == DUNE::IMC::LoggingControl::COP_STARTED)
-            {
-              log_name = ptr->name;
-              got_name = true;
-            }
-          }
-        }
-        else if (msg->getId() == DUNE_IMC_ENTITYINFO)
-        {
-          DUNE::IMC::EntityInfo* ptr = static_cast<DUNE::IMC::EntityInfo*>(msg);
-
-          if (ptr->label.compare(volt_label) == 0)
-          {
-            eids[Monitors::FuelLevel::BatteryData::BM_VOLTAGE] = ptr->id;
-            volt_entity_set = true;
-          }
-
-          if (ptr->label.compare(curr_label) == 0)
-          {
-            eids[Monitors::FuelLevel::BatteryData::BM_CURRENT] = ptr->id;
-            curr_entity_set = true;
-          }
-
-          if (!entities_set && volt_entity_set && curr_entity_set)
-          {
-            bdata.setEntities(eids);
-            entities_set = true;
-          }
-        }
-        else if (msg->getId() == DUNE_IMC_VOLTAGE)
-        {
-          if (entities_set)
-          {
-            DUNE::IMC::Voltage* ptr = static_cast<DUNE::IMC::Voltage*>(msg);
-            bdata.update(ptr);
-            ++samples;
-
-            if (samples > c_min_samples)
-            {
-              float drop = bdata.getEnergyDrop(msg->getTimeStamp() - last_timestamp);
-              accum += drop;
-
-              if (rpm > c_min_rpm)
-                motor_total_accum += drop;
-            }
-          }
-
-          last_timestamp = msg->getTimeStamp();
-        }
-        else if (msg->getId() == DUNE_IMC_CURRENT)
-        {
-          if (entities_set)
-          {
-            DUNE::IMC::Current* ptr = static_cast<DUNE::IMC::Current*>(msg);
-            bdata.update(ptr);
-          }
-        }
-        else if (msg->getId() == DUNE_IMC_RPM)
-        {
-          DUNE::IMC::Rpm* ptr = static_cast<DUNE::IMC::Rpm*>(msg);
-          rpm = ptr->value;
-        }
-        else if (msg->getId() == DUNE_IMC_SIMULATEDSTATE)
-        {
-          // since it has simulated state let us ignore this log
-          ignore = true;
-          delete msg;
-          std::cerr << "this is a simulated log";
-          break;
-        }
+  try
+  {
+    proc.run(handler);
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+  }
 
-        delete msg;
-      }
-    }
-    catch (std::runtime_error& e)
-    {
-      std::cerr << "ERROR: " << e.what() << std::endl;
-    }
+  for (size_t i = 0; i < proc.getErrors().size(); ++i)
+    std::cerr << "ERROR: " << proc.getErrors()[i] << std::endl;
 
-    delete is;
+  // Total of energy spent
+  double total_accum = 0.0;
+  // Total energy spent while the motor was on
+  double motor_total_accum = handler.motor_total_accum;
+
+  for (size_t i = 0; i < handler.logs.size(); ++i)
+  {
+    const LogState& log = *handler.logs[i];
 
-    if (ignore)
+    if (log.ignore)
     {
-      std::cerr << "... ignoring" << std::endl;
+      std::cerr << "this is a simulated log... ignoring" << std::endl;
       continue;
     }
 
-    std::cerr << "Consumed " << accum << " in " << log_name << "." << std::endl;
+    std::cerr << "Consumed " << log.accum << " in " << log.log_name << "." << std::endl;
 
-    total_accum += accum;
+    total_accum += log.accum;
   }
 
   std::cerr << "Total energy consumed is " << total_accum << "Wh" << std::endl
@@ -65,6 +65,7 @@ main(int32_t argc, char** argv)
   bool done_first = false;
 
   std::set<uint32_t> ids;
+  IMC::LogIndex::Query query;
   std::vector<std::string> msgs;
   Utils::String::split(argv[1], ",", msgs);
 
@@ -72,16 +73,37 @@ main(int32_t argc, char** argv)
   {
     uint32_t got = IMC::Factory::getIdFromAbbrev(Utils::String::trim(msgs[k]));
     ids.insert(got);
+    query.ids.insert(got);
   }
 
   for (uint32_t j = 2; j < (uint32_t)argc; ++j)
   {
     std::istream* is = 0;
+    std::string index_file = IMC::LogIndex::getPath(argv[j]);
     Compression::Methods method = Compression::Factory::detect(argv[j]);
-    if (method == METHOD_UNKNOWN)
-      is = new std::ifstream(argv[j], std::ios::binary);
-    else
-      is = new Compression::FileInput(argv[j], method);
+
+    if (Path(index_file).isFile())
+    {
+      // Only read chunks holding the requested messages.
+      try
+      {
+        IMC::LogIndex index;
+        index.load(index_file);
+        is = new IMC::IndexedInput(argv[j], index, query);
+      }
+      catch (std::runtime_error& e)
+      {
+        std::cerr << "WARNING: ignoring index: " << e.what() << std::endl;
+      }
+    }
+
+    if (is == 0)
+    {
+      if (method == METHOD_UNKNOWN)
+        is = new std::ifstream(argv[j], std::ios::binary);
+      else
+        is = new Compression::FileInput(argv[j], method);
+    }
 
     uint32_t i = 0;
 
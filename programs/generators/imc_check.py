@@ -0,0 +1,93 @@
+# -*- coding: utf-8 -*-
+############################################################################
+# Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      #
+# Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  #
+############################################################################
+# This file is part of DUNE: Unified Navigation Environment.               #
+#                                                                          #
+# Commercial Licence Usage                                                 #
+# Licencees holding valid commercial DUNE licences may use this file in    #
+# accordance with the commercial licence agreement provided with the       #
+# Software or, alternatively, in accordance with the terms contained in a  #
+# written agreement between you and Faculdade de Engenharia da             #
+# Universidade do Porto. For licensing terms, conditions, and further      #
+# information contact lsts@fe.up.pt.                                       #
+#                                                                          #
+# Modified European Union Public Licence - EUPL v.1.1 Usage                #
+# Alternatively, this file may be used under the terms of the Modified     #
+# EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md #
+# included in the packaging of this file. You may not use this work        #
+# except in compliance with the Licence. Unless required by applicable     #
+# law or agreed to in writing, software distributed under the Licence is   #
+# distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     #
+# ANY KIND, either express or implied. See the Licence for the specific    #
+# language governing permissions and limitations at                        #
+# https://github.com/LSTS/dune/blob/master/LICENCE.md and                  #
+# http://ec.europa.eu/idabc/eupl.html.                                     #
+############################################################################
+# Author: Ricardo Martins                                                  #
+############################################################################
+
+# Regenerate the IMC sources in a temporary folder and compare them with
+# the ones in the source tree. Lines that depend on the XML file itself
+# (MD5 sums and Git information) are not compared.
+
+import os
+import sys
+import shutil
+import difflib
+import tempfile
+import subprocess
+
+# Parse command line arguments.
+import argparse
+parser = argparse.ArgumentParser(
+    description="Check generated IMC sources against IMC.xml.")
+parser.add_argument('src_folder', metavar='SRC_FOLDER',
+                    help="folder with the generated sources")
+parser.add_argument('-x', '--xml', metavar='IMC_XML',
+                    help="IMC XML file")
+parser.add_argument('-c', '--compact', metavar='COMPACT_XML',
+                    help="compact encoding table")
+args = parser.parse_args()
+
+generators = os.path.dirname(os.path.abspath(__file__))
+ignored = ['// IMC XML MD5:', '#define DUNE_IMC_CONST_MD5 ',
+           '#define DUNE_IMC_CONST_GIT_INFO ']
+
+def read(path):
+    lines = []
+    for line in open(path).read().splitlines(True):
+        if not [i for i in ignored if line.startswith(i)]:
+            lines.append(line)
+    return lines
+
+tmp = tempfile.mkdtemp()
+try:
+    devnull = open(os.devnull, 'w')
+    subprocess.check_call([sys.executable, os.path.join(generators, 'imc_code.py'),
+                           '-f', '-x', args.xml, tmp], stdout = devnull)
+    cmd = [sys.executable, os.path.join(generators, 'imc_compact.py'),
+           '-f', '-x', args.xml, tmp]
+    if args.compact is not None:
+        cmd += ['-c', args.compact]
+    subprocess.check_call(cmd, stdout = devnull)
+
+    differ = 0
+    for name in sorted(os.listdir(tmp)):
+        src = os.path.join(args.src_folder, name)
+        new = read(os.path.join(tmp, name))
+        old = []
+        if os.path.exists(src):
+            old = read(src)
+        if old != new:
+            differ += 1
+            sys.stdout.writelines(difflib.unified_diff(old, new, src, name + ' (generated)'))
+        else:
+            print('* ' + src + ' [OK]')
+finally:
+    shutil.rmtree(tmp)
+
+if differ > 0:
+    sys.stderr.write('ERROR: %d generated file(s) differ from %s\n' % (differ, args.xml))
+    sys.exit(1)
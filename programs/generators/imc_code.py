@@ -211,6 +211,11 @@ class Message:
 
         subid = node.find("field/[@abbrev='id']")
         if subid is not None and subid.get('type') in consts['fixed_types']:
+            # hasSubId()
+            f = Function('hasSubId', 'bool', const = True)
+            f.body('return true;')
+            public.append(f)
+
             # getSubId()
             f = Function('getSubId', 'uint16_t', const = True)
             f.body('return id;')
@@ -239,6 +244,15 @@ class Message:
             f.add_body(self.fields_to_json())
             public.append(f)
 
+            f = Function('fieldsToJSON', 'void', [Var('w__', 'JSONWriter&')], const = True)
+            f.add_body(self.fields_to_json_writer())
+            public.append(f)
+
+            # fieldFromJSON()
+            f = Function('fieldFromJSON', 'bool', [Var('key__', 'const char*'), Var('size__', 'unsigned'), Var('r__', 'JSONReader&')])
+            f.add_body(self.field_from_json())
+            public.append(f)
+
         # Nested functions.
         if self.count_nested() > 0:
             funcs = [('TimeStamp', 'double'), ('Source', 'uint16_t'),
@@ -323,6 +337,30 @@ class Message:
                 lines.append('IMC::toJSON(os__, "{0}", {0}, nindent__);'.format(get_name(field)))
         return '\n'.join(lines)
 
+    def fields_to_json_writer(self):
+        lines = []
+        for field in self._node.findall('field'):
+            key = '",\\"{0}\\":"'.format(get_name(field))
+            if field.get('type').startswith('message'):
+                lines.append('{0}.toJSON(w__, {1});'.format(get_name(field), key))
+            else:
+                lines.append('w__.field({1}, {0});'.format(get_name(field), key))
+        return '\n'.join(lines)
+
+    def field_from_json(self):
+        lines = []
+        for field in self._node.findall('field'):
+            cond = 'if (JSONReader::match(key__, size__, "{0}"))'.format(get_name(field))
+            if len(lines) > 0:
+                cond = 'else ' + cond
+            if field.get('type').startswith('message'):
+                lines.append('{0} {1}.fromJSON(r__);'.format(cond, get_name(field)))
+            else:
+                lines.append('{0} r__.read({1});'.format(cond, get_name(field)))
+        lines.append('else return false;')
+        lines.append('return true;')
+        return '\n'.join(lines)
+
     def validate(field):
         min_value = field.get('min', None)
         cond = ''
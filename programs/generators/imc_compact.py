@@ -0,0 +1,273 @@
+# -*- coding: utf-8 -*-
+############################################################################
+# Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      #
+# Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  #
+############################################################################
+# This file is part of DUNE: Unified Navigation Environment.               #
+#                                                                          #
+# Commercial Licence Usage                                                 #
+# Licencees holding valid commercial DUNE licences may use this file in    #
+# accordance with the commercial licence agreement provided with the       #
+# Software or, alternatively, in accordance with the terms contained in a  #
+# written agreement between you and Faculdade de Engenharia da             #
+# Universidade do Porto. For licensing terms, conditions, and further      #
+# information contact lsts@fe.up.pt.                                       #
+#                                                                          #
+# Modified European Union Public Licence - EUPL v.1.1 Usage                #
+# Alternatively, this file may be used under the terms of the Modified     #
+# EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md #
+# included in the packaging of this file. You may not use this work        #
+# except in compliance with the Licence. Unless required by applicable     #
+# law or agreed to in writing, software distributed under the Licence is   #
+# distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     #
+# ANY KIND, either express or implied. See the Licence for the specific    #
+# language governing permissions and limitations at                        #
+# https://github.com/LSTS/dune/blob/master/LICENCE.md and                  #
+# http://ec.europa.eu/idabc/eupl.html.                                     #
+############################################################################
+# Author: Pedro Seruca                                                     #
+############################################################################
+# Generate quantised bit-packed (compact) encoders/decoders.               #
+############################################################################
+
+import sys
+import math
+import hashlib
+import os.path
+
+from imc.utils import *
+from imc.file import *
+from imc.code import *
+
+HPP = 'Compact.hpp'
+CXX = 'Compact.cpp'
+
+INTEGER_TYPES = ['uint8_t', 'int8_t', 'uint16_t', 'int16_t',
+                 'uint32_t', 'int32_t', 'uint64_t', 'int64_t']
+REAL_TYPES = ['fp32_t', 'fp64_t']
+
+# Parse command line arguments.
+import argparse
+parser = argparse.ArgumentParser(
+    description="Generate compact IMC encoders/decoders.")
+parser.add_argument('dest_folder', metavar='DEST_FOLDER',
+                    help="destination folder")
+parser.add_argument('-x', '--xml', metavar='IMC_XML',
+                    help="IMC XML file")
+parser.add_argument('-c', '--compact', metavar='COMPACT_XML',
+                    default=os.path.join(os.path.dirname(os.path.abspath(__file__)), 'imc_compact.xml'),
+                    help="compact encoding table")
+parser.add_argument('-f', '--force', action='store_true', required=False,
+                    help="Force creation of files")
+args = parser.parse_args()
+
+m = hashlib.md5()
+m.update(compute_md5(args.xml).encode())
+m.update(compute_md5(args.compact).encode())
+xml_md5 = m.hexdigest()
+dest_folder = args.dest_folder
+
+if not args.force:
+    if file_md5_matches(os.path.join(dest_folder, CXX), xml_md5):
+        print('* ' + os.path.join(dest_folder, CXX) + ' [Skipped]')
+        sys.exit(0)
+
+# Parse XML specifications.
+import xml.etree.ElementTree as ET
+root = ET.parse(args.xml).getroot()
+table = ET.parse(args.compact).getroot()
+
+def error(text):
+    sys.stderr.write('ERROR: %s: %s\n' % (args.compact, text))
+    sys.exit(1)
+
+# Format a floating point literal.
+def literal(value):
+    text = repr(float(value))
+    if 'e' not in text and '.' not in text:
+        text += '.0'
+    return text
+
+# Compute field encoding parameters.
+class Field:
+    def __init__(self, msg_abbrev, node, imc_node):
+        self.name = get_name(node)
+        self.type = imc_node.get('type')
+        if self.type not in INTEGER_TYPES and self.type not in REAL_TYPES:
+            error('%s.%s: unsupported type %s' % (msg_abbrev, self.name, self.type))
+
+        try:
+            self.min = float(node.get('min'))
+            self.max = float(node.get('max'))
+        except:
+            error('%s.%s: invalid or missing range' % (msg_abbrev, self.name))
+
+        if self.type in INTEGER_TYPES:
+            self.precision = float(node.get('precision', '1'))
+        elif node.get('precision') is None:
+            error('%s.%s: missing precision' % (msg_abbrev, self.name))
+        else:
+            self.precision = float(node.get('precision'))
+
+        if self.max <= self.min or self.precision <= 0:
+            error('%s.%s: invalid range or precision' % (msg_abbrev, self.name))
+
+        steps = int(math.ceil((self.max - self.min) / self.precision - 1e-9))
+        self.bits = max(1, steps.bit_length())
+        if self.bits > 32:
+            error('%s.%s: more than 32 bits required' % (msg_abbrev, self.name))
+
+        self.delta = int(node.get('delta', '0'))
+        if self.delta < 0 or self.delta >= self.bits:
+            error('%s.%s: delta must be smaller than %d bits' % (msg_abbrev, self.name, self.bits))
+
+    def args(self):
+        return '%s, %s, %d, %d' % (literal(self.min), literal(self.precision), self.bits, self.delta)
+
+    def encoder(self):
+        return 'w__.put(msg->%s, ref ? &ref->%s : NULL, %s);' % (self.name, self.name, self.args())
+
+    def decoder(self):
+        return 'r__.get(msg->%s, ref ? &ref->%s : NULL, %s);' % (self.name, self.name, self.args())
+
+class Compact:
+    def __init__(self, node):
+        self.abbrev = node.get('abbrev')
+        self.code = int(node.get('code', '0'))
+        if self.code < 1 or self.code > 255:
+            error('%s: code must be between 1 and 255' % self.abbrev)
+
+        imc_node = root.find("message[@abbrev='%s']" % self.abbrev)
+        if imc_node is None:
+            error('%s: unknown message' % self.abbrev)
+
+        self.macro = 'DUNE_IMC_' + self.abbrev.upper()
+        self.fields = []
+        for field in node.findall('field'):
+            imc_field = imc_node.find("field[@abbrev='%s']" % field.get('abbrev'))
+            if imc_field is None:
+                error('%s: unknown field %s' % (self.abbrev, field.get('abbrev')))
+            self.fields.append(Field(self.abbrev, field, imc_field))
+
+        self.max_bits = sum([f.bits + (f.delta > 0 and 2 or 1) for f in self.fields])
+
+messages = [Compact(node) for node in table.findall('message')]
+
+codes = [msg.code for msg in messages]
+if len(codes) != len(set(codes)):
+    error('duplicated message codes')
+
+################################################################################
+# Compact.hpp                                                                  #
+################################################################################
+
+hpp = File(HPP, dest_folder, md5 = xml_md5)
+hpp.add_dune_headers('Config.hpp', 'IMC/Message.hpp', 'IMC/BitPacking.hpp')
+
+f = Function('getCompactCode', 'unsigned', [Var('id', 'uint16_t')])
+hpp.append(comment('Get the compact code of a message.\n'
+                   '//! @param[in] id message identification number.\n'
+                   '//! @return compact code or 0 if the message has no compact encoding'))
+hpp.append(f.decl())
+
+f = Function('getCompactId', 'uint16_t', [Var('code', 'unsigned')])
+hpp.append(comment('Get the message identification number of a compact code.\n'
+                   '//! @param[in] code compact code.\n'
+                   '//! @return message identification number'))
+hpp.append(f.decl())
+
+f = Function('getCompactMaximumBits', 'unsigned', [Var('id', 'uint16_t')])
+hpp.append(comment('Get the maximum number of bits of the compact encoding of a\n'
+                   '//! message, excluding framing.\n'
+                   '//! @param[in] id message identification number.\n'
+                   '//! @return number of bits or 0 if the message has no compact encoding'))
+hpp.append(f.decl())
+
+f = Function('encodeCompact', 'void', [Var('msg', 'const Message*'), Var('ref', 'const Message*'),
+                                        Var('w__', 'BitWriter&')])
+hpp.append(comment('Encode the fields of a message.\n'
+                   '//! @param[in] msg message.\n'
+                   '//! @param[in] ref reference message of the same type or NULL.\n'
+                   '//! @param[in] w__ bit writer.\n'
+                   '//! @throw InvalidMessageId if the message has no compact encoding'))
+hpp.append(f.decl())
+
+f = Function('decodeCompact', 'Message*', [Var('code', 'unsigned'), Var('ref', 'const Message*'),
+                                            Var('r__', 'BitReader&')])
+hpp.append(comment('Decode the fields of a message.\n'
+                   '//! @param[in] code compact code.\n'
+                   '//! @param[in] ref reference message of the same type or NULL.\n'
+                   '//! @param[in] r__ bit reader.\n'
+                   '//! @return new message.\n'
+                   '//! @throw InvalidMessageId if the compact code is unknown'))
+hpp.append(f.decl())
+
+hpp.write()
+
+################################################################################
+# Compact.cpp                                                                  #
+################################################################################
+
+cxx = File(CXX, dest_folder, md5 = xml_md5)
+cxx.add_dune_headers('IMC/Compact.hpp', 'IMC/Macros.hpp', 'IMC/Definitions.hpp',
+                     'IMC/Exceptions.hpp')
+
+for msg in messages:
+    f = Function('encode' + msg.abbrev, 'void',
+                 [Var('msg', 'const %s*' % msg.abbrev), Var('ref', 'const %s*' % msg.abbrev),
+                  Var('w__', 'BitWriter&')], static = True)
+    f.body('\n'.join([field.encoder() for field in msg.fields]))
+    cxx.append(f)
+
+    f = Function('decode' + msg.abbrev, 'void',
+                 [Var('msg', '%s*' % msg.abbrev), Var('ref', 'const %s*' % msg.abbrev),
+                  Var('r__', 'BitReader&')], static = True)
+    f.body('\n'.join([field.decoder() for field in msg.fields]))
+    cxx.append(f)
+
+f = Function('getCompactCode', 'unsigned', [Var('id', 'uint16_t')])
+f.add_body('switch (id)\n{')
+for msg in messages:
+    f.add_body('case %s:\nreturn %d;' % (msg.macro, msg.code))
+f.add_body('default:\nreturn 0;\n}')
+cxx.append(f)
+
+f = Function('getCompactId', 'uint16_t', [Var('code', 'unsigned')])
+f.add_body('switch (code)\n{')
+for msg in messages:
+    f.add_body('case %d:\nreturn %s;' % (msg.code, msg.macro))
+f.add_body('default:\nthrow InvalidMessageId(code);\n}')
+cxx.append(f)
+
+f = Function('getCompactMaximumBits', 'unsigned', [Var('id', 'uint16_t')])
+f.add_body('switch (id)\n{')
+for msg in messages:
+    f.add_body('case %s:\nreturn %d;' % (msg.macro, msg.max_bits))
+f.add_body('default:\nreturn 0;\n}')
+cxx.append(f)
+
+f = Function('encodeCompact', 'void', [Var('msg', 'const Message*'), Var('ref', 'const Message*'),
+                                        Var('w__', 'BitWriter&')])
+f.add_body('switch (msg->getId())\n{')
+for msg in messages:
+    f.add_body('case %s:' % msg.macro)
+    f.add_body('encode%s(static_cast<const %s*>(msg), static_cast<const %s*>(ref), w__);'
+               % (msg.abbrev, msg.abbrev, msg.abbrev))
+    f.add_body('break;')
+f.add_body('default:\nthrow InvalidMessageId(msg->getId());\n}')
+cxx.append(f)
+
+f = Function('decodeCompact', 'Message*', [Var('code', 'unsigned'), Var('ref', 'const Message*'),
+                                            Var('r__', 'BitReader&')])
+f.add_body('switch (code)\n{')
+for msg in messages:
+    f.add_body('case %d:\n{' % msg.code)
+    f.add_body('%s* msg = new %s;' % (msg.abbrev, msg.abbrev))
+    f.add_body('try\n{')
+    f.add_body('decode%s(msg, static_cast<const %s*>(ref), r__);' % (msg.abbrev, msg.abbrev))
+    f.add_body('}\ncatch (...)\n{\ndelete msg;\nthrow;\n}')
+    f.add_body('return msg;\n}')
+f.add_body('default:\nthrow InvalidMessageId(code);\n}')
+cxx.append(f)
+
+cxx.write()
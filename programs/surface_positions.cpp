@@ -54,17 +54,10 @@ main(int32_t argc, char** argv)
     return 1;
   }
 
-  std::istream* is = 0;
-  Compression::Methods method = Compression::Factory::detect(argv[1]);
-  if (method == METHOD_UNKNOWN)
-    is = new std::ifstream(argv[1], std::ios::binary);
-  else
-    is = new Compression::FileInput(argv[1], method);
-
   ByteBuffer buffer;
   std::ofstream lsf("SurfaceData.lsf", std::ios::binary);
 
-  IMC::Message* msg;
+  IMC::GpsFix fix;
 
   unsigned i = 0;
 
@@ -75,29 +68,30 @@ main(int32_t argc, char** argv)
 
   try
   {
-    while ((msg = IMC::Packet::deserialize(*is)) != 0)
+    IMC::LogReader reader(argv[1]);
+    IMC::PacketView view;
+
+    while (reader.next(view))
     {
-      if (msg->getId() == DUNE_IMC_GPSFIX)
-      {
-        IMC::GpsFix* fix = static_cast<IMC::GpsFix*>(msg);
+      if (view.getId() != DUNE_IMC_GPSFIX)
+        continue;
 
-        if ((fix->hacc <= MIN_HACC) &&
-            (fix->validity & IMC::GpsFix::GFV_VALID_POS) &&
-            (fix->getTimeStamp() >= timestamp))
-        {
-          timestamp = fix->getTimeStamp();
+      view.decode(fix);
 
-          IMC::Packet::serialize(msg, buffer);
-          lsf.write(buffer.getBufferSigned(), buffer.getSize());
+      if ((fix.hacc <= MIN_HACC) &&
+          (fix.validity & IMC::GpsFix::GFV_VALID_POS) &&
+          (fix.getTimeStamp() >= timestamp))
+      {
+        timestamp = fix.getTimeStamp();
 
-          ++i;
-        }
-      }
+        // The packet is already serialized, copy it verbatim.
+        lsf.write((const char*)view.getData(), view.getSize());
 
-      delete msg;
+        ++i;
+      }
     }
   }
-  catch (std::runtime_error& e)
+  catch (std::exception& e)
   {
     std::cerr << "ERROR: " << e.what() << std::endl;
     return -1;
@@ -105,8 +99,6 @@ main(int32_t argc, char** argv)
 
   lsf.close();
 
-  delete is;
-
   std::cerr << "Got " << i << " GpsFix messages." << std::endl;
 
   return 0;
@@ -0,0 +1,197 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdarg>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+class FakeTask: public Tasks::AbstractTask
+{
+public:
+  FakeTask(const char* name):
+    m_name(name),
+    m_count(0),
+    m_backlog(0)
+  { }
+
+  void
+  receive(const IMC::SharedMessage& msg)
+  {
+    m_last = msg;
+    m_count.add(1);
+  }
+
+  const char*
+  getName(void) const
+  {
+    return m_name;
+  }
+
+  int
+  getCount(void)
+  {
+    return m_count.add(0);
+  }
+
+  unsigned
+  getBacklog(void) const
+  {
+    return m_backlog;
+  }
+
+  void inf(const char*, ...) { }
+  void war(const char*, ...) { }
+  void err(const char*, ...) { }
+  void cri(const char*, ...) { }
+  void debug(const char*, ...) { }
+  void trace(const char*, ...) { }
+  void spew(const char*, ...) { }
+
+private:
+  const char* m_name;
+  Concurrency::AtomicCounter m_count;
+
+public:
+  IMC::SharedMessage m_last;
+  unsigned m_backlog;
+
+  void
+  run(void)
+  { }
+};
+
+class Dispatcher: public Concurrency::Thread
+{
+public:
+  Dispatcher(IMC::Bus& bus, unsigned count):
+    m_bus(bus),
+    m_count(count)
+  { }
+
+private:
+  IMC::Bus& m_bus;
+  unsigned m_count;
+
+  void
+  run(void)
+  {
+    IMC::EstimatedState msg;
+    for (unsigned i = 0; i < m_count; ++i)
+      m_bus.dispatch(&msg);
+  }
+};
+
+int
+main(void)
+{
+  Test test("IMC::Bus");
+
+  {
+    IMC::Bus bus;
+    FakeTask a("a");
+    FakeTask b("b");
+    IMC::Heartbeat hbeat;
+    IMC::Abort abort;
+
+    bus.registerRecipient(&a, hbeat.getId());
+    bus.registerRecipient(&b, hbeat.getId());
+    bus.registerRecipient(&b, hbeat.getId());
+    test.boolean("registerRecipient()", bus.getRecipientCount(hbeat.getId()) == 2);
+    test.boolean("getRecipientCount() (none)", bus.getRecipientCount(abort.getId()) == 0);
+
+    bus.dispatch(&hbeat);
+    test.boolean("dispatch()", a.getCount() == 1 && b.getCount() == 1);
+    test.boolean("dispatch() (shared copy)", a.m_last.get() == b.m_last.get()
+                 && a.m_last.get() != &hbeat);
+
+    {
+      IMC::SharedMessage copy = a.m_last;
+      IMC::Heartbeat* mut = copy.getMutable<IMC::Heartbeat>();
+      test.boolean("getMutable() (copy-on-write)", mut != a.m_last.get()
+                   && a.m_last.get() == b.m_last.get() && copy.unique());
+    }
+
+    bus.dispatch(&hbeat, &a);
+    test.boolean("dispatch() (excluded)", a.getCount() == 1 && b.getCount() == 2);
+
+    bus.dispatch(&abort);
+    test.boolean("dispatch() (no recipients)", a.getCount() == 1 && b.getCount() == 2);
+
+    bus.unregisterRecipient(&a, hbeat.getId());
+    bus.dispatch(&hbeat);
+    test.boolean("unregisterRecipient()", a.getCount() == 1 && b.getCount() == 3);
+
+    a.m_backlog = 7;
+    b.m_backlog = 3;
+    test.boolean("getBacklog()", bus.getBacklog(hbeat.getId()) == 3);
+    bus.registerRecipient(&a, hbeat.getId());
+    test.boolean("getBacklog() (largest)", bus.getBacklog(hbeat.getId()) == 7);
+    test.boolean("getBacklog() (excluded)", bus.getBacklog(hbeat.getId(), &a) == 3);
+    test.boolean("getBacklog() (no recipients)", bus.getBacklog(abort.getId()) == 0);
+    bus.unregisterRecipient(&a, hbeat.getId());
+
+    bus.pause();
+    bus.dispatch(&hbeat);
+    test.boolean("pause()", b.getCount() == 3);
+    bus.resume();
+    test.boolean("resume()", b.getCount() == 4);
+  }
+
+  {
+    IMC::Bus bus;
+    FakeTask a("a");
+    FakeTask b("b");
+    const unsigned count = 100000;
+    uint16_t id = IMC::EstimatedState::getIdStatic();
+
+    bus.registerRecipient(&a, id);
+
+    Dispatcher dispatcher(bus, count);
+    dispatcher.start();
+
+    for (unsigned i = 0; i < 1000; ++i)
+    {
+      bus.registerRecipient(&b, id);
+      bus.unregisterRecipient(&b, id);
+    }
+
+    dispatcher.stopAndJoin();
+    a.m_last.reset();
+    test.boolean("dispatch() (concurrent registration)", a.getCount() == (int)count);
+  }
+
+  return test.getReturnValue();
+}
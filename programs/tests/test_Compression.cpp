@@ -0,0 +1,238 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Build a mildly compressible test pattern.
+static void
+fillPattern(ByteBuffer& bfr, unsigned size)
+{
+  bfr.setSize(size);
+  uint8_t* ptr = bfr.getBuffer();
+  uint32_t seed = 12345;
+  for (unsigned i = 0; i < size; ++i)
+  {
+    seed = seed * 1103515245 + 12345;
+    ptr[i] = (i % 64 < 48) ? (uint8_t)('a' + (i % 26)) : (uint8_t)(seed >> 24);
+  }
+}
+
+//! Decompress a stream feeding input and output in small chunks.
+static bool
+streamDecompress(Compression::Decompressor& dec, ByteBuffer& src, ByteBuffer& dst,
+                 unsigned in_chunk, unsigned out_chunk)
+{
+  unsigned src_idx = 0;
+  char out[4096];
+  dst.setSize(0);
+
+  while (src_idx < src.getSize() || dec.pending() > 0)
+  {
+    unsigned in_len = std::min(in_chunk, src.getSize() - src_idx);
+    dec.decompress(out, out_chunk, src.getBufferSigned() + src_idx, in_len);
+    src_idx += dec.processed();
+    dst.appendSigned(out, dec.decompressed());
+
+    if (dec.processed() == 0 && dec.decompressed() == 0)
+      return false;
+  }
+
+  return true;
+}
+
+static bool
+equal(ByteBuffer& a, ByteBuffer& b)
+{
+  return a.getSize() == b.getSize()
+  && std::memcmp(a.getBuffer(), b.getBuffer(), a.getSize()) == 0;
+}
+
+int
+main(void)
+{
+  Test test("Compression");
+
+  {
+    test.boolean("Factory::method(lz4)", Compression::Factory::method("lz4") == Compression::METHOD_LZ4);
+    test.boolean("Factory::method(lz4hc)", Compression::Factory::method("lz4hc") == Compression::METHOD_LZ4HC);
+    test.boolean("Factory::method(METHOD_LZ4HC)", Compression::Factory::method(Compression::METHOD_LZ4HC) == "lz4hc");
+    test.boolean("Factory::extension(lz4hc)", Compression::Factory::extension("lz4hc") == ".lz4");
+  }
+
+  ByteBuffer raw;
+  fillPattern(raw, 300 * 1024);
+
+  {
+    Compression::Lz4Compressor com;
+    ByteBuffer packed;
+    com.compress(packed, raw);
+    test.boolean("Lz4Compressor::compress() (compressed)", packed.getSize() < raw.getSize());
+
+    ByteBuffer unpacked;
+    unpacked.setSize(raw.getSize());
+    Compression::Lz4Decompressor dec;
+    dec.decompress(unpacked, packed);
+    test.boolean("Lz4Decompressor::decompress() (single call)", equal(raw, unpacked)
+                 && dec.processed() == packed.getSize());
+  }
+
+  {
+    Compression::Lz4Compressor com;
+    Compression::Lz4Compressor com_hc(true);
+    ByteBuffer packed;
+    ByteBuffer packed_hc;
+    com.compress(packed, raw);
+    com_hc.compress(packed_hc, raw);
+    test.boolean("Lz4Compressor::compress() (high compression)", packed_hc.getSize() <= packed.getSize());
+
+    ByteBuffer unpacked;
+    Compression::Lz4Decompressor dec;
+    test.boolean("Lz4Decompressor::decompress() (high compression)",
+                 streamDecompress(dec, packed_hc, unpacked, 65536, 4096) && equal(raw, unpacked));
+  }
+
+  {
+    // Several blocks, split at odd offsets on both sides.
+    Compression::Lz4Compressor com;
+    ByteBuffer stream;
+    ByteBuffer expected;
+    for (unsigned i = 0; i < 3; ++i)
+    {
+      unsigned len = 1000 + i * 50000;
+      ByteBuffer packed;
+      com.compress(packed, raw.getBufferSigned(), len);
+      stream.append(packed.getBuffer(), packed.getSize());
+      expected.append(raw.getBuffer(), len);
+    }
+
+    ByteBuffer unpacked;
+    Compression::Lz4Decompressor dec;
+    test.boolean("Lz4Decompressor::decompress() (streaming)",
+                 streamDecompress(dec, stream, unpacked, 7, 777) && equal(expected, unpacked));
+  }
+
+  {
+    Compression::Lz4Compressor com;
+    ByteBuffer packed;
+    com.compress(packed, raw);
+    packed.getBuffer()[0] ^= 0xff;
+
+    bool thrown = false;
+    try
+    {
+      ByteBuffer unpacked;
+      Compression::Lz4Decompressor dec;
+      streamDecompress(dec, packed, unpacked, 4096, 4096);
+    }
+    catch (Compression::CorruptedData&)
+    {
+      thrown = true;
+    }
+    test.boolean("Lz4Decompressor::decompress() (corrupted)", thrown);
+  }
+
+  {
+    // Frame written by the reference lz4 tool (block and content
+    // checksums) followed by a skippable frame.
+    static const uint8_t c_frame[] =
+    {
+      0x04, 0x22, 0x4d, 0x18, 0x74, 0x40, 0xbd, 0x10, 0x00, 0x00, 0x00, 0x6f,
+      0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x06, 0x00, 0x06, 0x50, 0x65, 0x6c,
+      0x6c, 0x6f, 0x0a, 0x1f, 0x7a, 0xf8, 0x92, 0x00, 0x00, 0x00, 0x00, 0x53,
+      0xce, 0x99, 0x36, 0x50, 0x2a, 0x4d, 0x18, 0x03, 0x00, 0x00, 0x00, 0x01,
+      0x02, 0x03
+    };
+
+    ByteBuffer packed;
+    packed.append(c_frame, sizeof(c_frame));
+    ByteBuffer unpacked;
+    Compression::Lz4Decompressor dec;
+    bool ok = streamDecompress(dec, packed, unpacked, 5, 64);
+    std::string text((const char*)unpacked.getBuffer(), unpacked.getSize());
+    test.boolean("Lz4Decompressor::decompress() (reference frame)",
+                 ok && text == "hello hello hello hello hello hello\n");
+  }
+
+  {
+    // Incompressible data is stored as is.
+    ByteBuffer noise;
+    noise.setSize(100000);
+    uint32_t seed = 1;
+    for (unsigned i = 0; i < noise.getSize(); ++i)
+    {
+      seed = seed * 1103515245 + 12345;
+      noise.getBuffer()[i] = (uint8_t)(seed >> 16);
+    }
+
+    Compression::Lz4Compressor com;
+    ByteBuffer packed;
+    com.compress(packed, noise);
+
+    ByteBuffer unpacked;
+    Compression::Lz4Decompressor dec;
+    test.boolean("Lz4Compressor::compress() (incompressible)",
+                 packed.getSize() <= noise.getSize() + 32
+                 && streamDecompress(dec, packed, unpacked, 4096, 4096) && equal(noise, unpacked));
+  }
+
+  {
+    Path file = Path("/tmp") / "test_Compression.lsf.lz4";
+
+    {
+      Compression::FileOutput ofs(file.c_str(), Compression::METHOD_LZ4HC);
+      for (unsigned i = 0; i < raw.getSize(); i += 1000)
+        ofs.write(raw.getBufferSigned() + i, std::min(1000U, raw.getSize() - i));
+    }
+
+    test.boolean("Factory::detect() (lz4)", Compression::Factory::detect(file.c_str()) == Compression::METHOD_LZ4);
+
+    ByteBuffer unpacked;
+    unpacked.setSize(raw.getSize());
+    {
+      Compression::FileInput ifs(file.c_str(), Compression::METHOD_LZ4);
+      ifs.read(unpacked.getBufferSigned(), unpacked.getSize());
+    }
+    test.boolean("FileInput::read() (lz4)", equal(raw, unpacked));
+    file.remove();
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,277 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <fstream>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+// Task headers.
+#define DUNE_TASK
+#include <Transports/DataStore/Task.cpp>
+
+using DUNE_NAMESPACES;
+using Transports::DataStore::DataSample;
+using Transports::DataStore::Storage;
+
+//! Size after which a new segment is started.
+static const uint32_t c_segment_limit = 4096;
+
+//! Path of a segment file.
+static Path
+segmentPath(const Path& folder, unsigned segment)
+{
+  return folder / String::str("%08u.dsl", segment);
+}
+
+//! Store a temperature sample.
+static void
+addSample(Storage& store, int priority, float value)
+{
+  IMC::Temperature* msg = new IMC::Temperature;
+  msg->value = value;
+
+  DataSample sample;
+  sample.timestamp = 1000.0 + value;
+  sample.priority = priority;
+  sample.source = 0x1234;
+  sample.sample = msg;
+  store.addSample(&sample);
+}
+
+//! Retrieve all samples of a storage.
+static void
+pollAll(Storage& store, std::vector<DataSample*>& samples)
+{
+  store.pollSamples(1 << 30, samples);
+}
+
+//! Release polled samples.
+static void
+release(std::vector<DataSample*>& samples)
+{
+  for (size_t i = 0; i < samples.size(); ++i)
+    delete samples[i];
+  samples.clear();
+}
+
+//! Create and open the storage of a task.
+static Transports::DataStore::Task*
+createTask(Tasks::Context& ctx)
+{
+  Transports::DataStore::Task* task = new Transports::DataStore::Task("DataStore", ctx);
+  task->loadConfig();
+  task->onResourceAcquisition();
+  return task;
+}
+
+//! Drive the task through its message handlers.
+static void
+testTask(Test& test, const Path& folder)
+{
+  Tasks::Context ctx;
+  ctx.dir_db = folder;
+  ctx.config.set("DataStore", "Messages", "Temperature:1");
+  ctx.config.set("DataStore", "Any Mean Gateway", "gateway");
+  ctx.config.set("DataStore", "Variable priorities", "false");
+
+  unsigned system = ctx.resolver.id();
+  Transports::DataStore::Task* task = createTask(ctx);
+
+  // Samples are only stored once the position is known.
+  IMC::Temperature temp;
+  temp.setSource(system);
+  task->consume(&temp);
+
+  IMC::EstimatedState state;
+  state.setSource(system);
+  state.lat = Angles::radians(41.18);
+  state.lon = Angles::radians(-8.70);
+  task->consume(&state);
+
+  for (unsigned i = 0; i < 10; ++i)
+  {
+    temp.value = i;
+    temp.setTimeStamp(1000.0 + i);
+    task->consume(&temp);
+  }
+
+  test.boolean("Task (store)", task->m_store.getSampleCount() == 10);
+
+  delete task;
+  task = createTask(ctx);
+  test.boolean("Task (replay)", task->m_store.getSampleCount() == 10);
+
+  // Data handed to a peer is only dropped once the peer clears it.
+  IMC::HistoricDataQuery query;
+  query.setSource(system + 1);
+  query.type = IMC::HistoricDataQuery::HRTYPE_QUERY;
+  query.max_size = 120;
+  task->consume(&query);
+  size_t count = task->m_store.getSampleCount();
+  task->consume(&query);
+  bool ok = count > 0 && count < 10 && task->m_store.getSampleCount() == count;
+  query.type = IMC::HistoricDataQuery::HRTYPE_CLEAR;
+  task->consume(&query);
+  test.boolean("Task (query)", ok && task->m_sending.empty());
+
+  // A failed transmission puts the data back into the store.
+  task->anyMeanRouting();
+  ok = task->m_transmission_requests.size() == 1
+    && task->m_store.getSampleCount() < count;
+
+  IMC::TransmissionRequest* req = task->m_transmission_requests.begin()->second;
+  ok = ok && req->comm_mean == IMC::TransmissionRequest::CMEAN_SATELLITE;
+
+  IMC::TransmissionStatus status;
+  status.setDestination(system);
+  status.setDestinationEntity(task->getEntityId());
+  status.req_id = req->req_id;
+  status.status = IMC::TransmissionStatus::TSTAT_TEMPORARY_FAILURE;
+  task->consume(&status);
+  test.boolean("Task (any mean)", ok && task->m_transmission_requests.empty()
+               && task->m_store.getSampleCount() == count);
+
+  delete task;
+  task = createTask(ctx);
+  test.boolean("Task (replay after requeue)", task->m_store.getSampleCount() == count);
+  delete task;
+}
+
+int
+main(void)
+{
+  Test test("Transports::DataStore");
+
+  Path folder = Path("/tmp") / "test_DataStore";
+  if (folder.exists())
+    folder.remove(Path::MODE_RECURSIVE);
+
+  Storage store;
+  std::vector<DataSample*> samples;
+
+  // Low priority samples fill the first segments, high priority ones
+  // the following segments.
+  store.open(folder, 0, c_segment_limit);
+  for (unsigned i = 0; i < 100; ++i)
+    addSample(store, 0, i);
+  for (unsigned i = 0; i < 300; ++i)
+    addSample(store, 1, 1000 + i);
+
+  test.boolean("addSample()", store.getSampleCount() == 400);
+
+  // Poll only the high priority samples.
+  {
+    DataSample probe;
+    probe.sample = new IMC::Temperature;
+    store.pollSamples(probe.serializationSize() * 300 + MINIMUM_SAMPLE_SIZE, samples);
+
+    bool ok = samples.size() == 300;
+    for (size_t i = 0; ok && i < samples.size(); ++i)
+    {
+      const IMC::Temperature* t = static_cast<const IMC::Temperature*>(samples[i]->sample);
+      ok = samples[i]->priority == 1 && samples[i]->source == 0x1234
+        && t->value >= 1000 && t->value < 1300;
+    }
+    test.boolean("pollSamples()", ok && store.getSampleCount() == 100);
+    release(samples);
+  }
+
+  // The first segment is still in use, but must not prevent the
+  // removal of the dead segments after it.
+  test.boolean("compaction (live segment kept)", segmentPath(folder, 0).exists());
+  test.boolean("compaction (dead segment removed)", !segmentPath(folder, 3).exists());
+
+  // Replay: tombstones must cancel the polled samples.
+  store.close();
+  store.open(folder, 0, c_segment_limit);
+  test.boolean("replay", store.getSampleCount() == 100);
+
+  // Truncated record at the end of the last segment.
+  store.close();
+  {
+    unsigned last = 0;
+    for (unsigned i = 0; i < 64; ++i)
+    {
+      if (segmentPath(folder, i).exists())
+        last = i;
+    }
+
+    std::ofstream ofs(segmentPath(folder, last).c_str(), std::ios::binary | std::ios::app);
+    uint32_t length = 200;
+    uint8_t type = 1;
+    ofs.write((const char*)&length, sizeof(length));
+    ofs.write((const char*)&type, sizeof(type));
+    ofs.write("torn", 4);
+  }
+
+  store.open(folder, 0, c_segment_limit);
+  addSample(store, 2, 5000);
+  test.boolean("replay (torn record)", store.getSampleCount() == 101);
+
+  store.close();
+  store.open(folder, 0, c_segment_limit);
+  pollAll(store, samples);
+  {
+    bool ok = samples.size() == 101 && samples[0]->priority == 2;
+    for (size_t i = 1; ok && i < samples.size(); ++i)
+    {
+      const IMC::Temperature* t = static_cast<const IMC::Temperature*>(samples[i]->sample);
+      ok = samples[i]->priority == 0 && t->value < 100;
+    }
+    test.boolean("replay (after torn record)", ok);
+    release(samples);
+  }
+
+  // Everything was polled: all but the current segment are reclaimed.
+  store.close();
+  store.open(folder, 0, c_segment_limit);
+  {
+    unsigned count = 0;
+    for (unsigned i = 0; i < 64; ++i)
+    {
+      if (segmentPath(folder, i).exists())
+        ++count;
+    }
+    test.boolean("compaction (empty)", store.getSampleCount() == 0 && count == 1);
+  }
+
+  store.close();
+  folder.remove(Path::MODE_RECURSIVE);
+
+  testTask(test, folder);
+  folder.remove(Path::MODE_RECURSIVE);
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,152 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Check if a fixed matrix holds the same values as a dynamic one.
+template <unsigned R, unsigned C>
+static bool
+equal(const FixedMatrix<R, C>& a, const Matrix& b)
+{
+  if (b.rows() != (int)R || b.columns() != (int)C)
+    return false;
+
+  for (unsigned i = 0; i < R; ++i)
+  {
+    for (unsigned j = 0; j < C; ++j)
+    {
+      if (std::fabs(a(i, j) - b(i, j)) > 1e-9)
+        return false;
+    }
+  }
+
+  return true;
+}
+
+int
+main(void)
+{
+  Test test("Math::FixedMatrix");
+
+  double va[12] = {1, -2, 3, 0.5, 4, 7, -1, 2, 3, 9, -6, 0.25};
+  double vb[12] = {2, 0, -1, 3, 1, 5, -2, 4, 0.5, 1, 1, -3};
+  double vp[9] = {4, 1, 0.5, 1, 3, -0.2, 0.5, -0.2, 2};
+
+  FixedMatrix<3, 4> a(va);
+  FixedMatrix<4, 3> b(vb);
+  FixedMatrix<3, 4> c(vb);
+  Matrix3 p(vp);
+  Matrix ma(va, 3, 4);
+  Matrix mb(vb, 4, 3);
+  Matrix mc(vb, 3, 4);
+  Matrix mp(vp, 3, 3);
+
+  {
+    Matrix m;
+    a.get(m);
+    FixedMatrix<3, 4> back(m);
+    test.boolean("Matrix conversion", equal(a, ma) && equal(back, m) && back == a);
+  }
+
+  {
+    bool ok = false;
+    try
+    {
+      FixedMatrix<4, 3> bad(ma);
+    }
+    catch (Matrix::Error& e)
+    {
+      ok = true;
+    }
+    test.boolean("Matrix conversion (dimension mismatch)", ok);
+  }
+
+  test.boolean("operator+", equal(a + c, ma + mc));
+  test.boolean("operator-", equal(a - c, ma - mc));
+  test.boolean("operator* (scalar)", equal(2.5 * a - a / 4.0, 2.5 * ma - ma / 4.0));
+  test.boolean("operator* (matrix)", equal(a * b, ma * mb));
+  test.boolean("transpose()", equal(transpose(a), transpose(ma)));
+  test.boolean("multiplyTranspose()", equal(multiplyTranspose(a, c), ma * transpose(mc)));
+  test.boolean("transposeMultiply()", equal(transposeMultiply(a, c), transpose(ma) * mc));
+  test.boolean("quadratic()", equal(quadratic(b, p), mb * mp * transpose(mb)));
+  test.boolean("inverse()", equal(inverse(p), inverse(mp)));
+
+  {
+    Matrix3 id;
+    id.identity();
+    Matrix3 r = inverse(p) * p - id;
+    test.boolean("inverse() (identity)", r.norm_2() < 1e-12);
+  }
+
+  {
+    bool ok = false;
+    try
+    {
+      inverse(Matrix3(1.0));
+    }
+    catch (Matrix::Error& e)
+    {
+      ok = true;
+    }
+    test.boolean("inverse() (singular)", ok);
+  }
+
+  {
+    double v1[3] = {1, 2, 3};
+    double v2[3] = {-4, 0.5, 2};
+    Vector3 x(v1);
+    Vector3 y(v2);
+    Matrix mx(v1, 3, 1);
+    Matrix my(v2, 3, 1);
+
+    test.boolean("dot()", std::fabs(dot(x, y) - Matrix::dot(mx, my)) < 1e-12);
+    test.boolean("cross()", equal(cross(x, y), Matrix::cross(mx, my)));
+    test.boolean("skew()", equal(skew(x), skew(mx)) && equal(skew(x) * y, Matrix::cross(mx, my)));
+    test.boolean("norm_2()", std::fabs(x.norm_2() - mx.norm_2()) < 1e-12);
+  }
+
+  test.boolean("expmts()", equal(expmts(p * 0.1), (mp * 0.1).expmts()));
+  test.boolean("expmts() (scaling and squaring)", equal(expmts(p), mp.expmts()));
+
+  {
+    double e[3] = {0.3, -0.2, 2.5};
+    test.boolean("toDCM()", equal(toDCM(Vector3(e)), Matrix(e, 3, 1).toDCM()));
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,286 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Encode one message into a frame and decode it with another codec.
+static IMC::Message*
+transfer(IMC::CompactCodec& tx, IMC::CompactCodec& rx, const IMC::Message& msg,
+         unsigned* bits = NULL, unsigned* seq = NULL)
+{
+  Utils::BitBuffer bfr(32);
+  IMC::BitWriter writer(bfr);
+  if (!tx.encode(&msg, writer, seq))
+    return NULL;
+
+  if (bits != NULL)
+    *bits = (unsigned)writer.getBits();
+
+  IMC::BitReader reader(bfr);
+  return rx.decode(reader);
+}
+
+static IMC::EstimatedState
+makeState(void)
+{
+  IMC::EstimatedState msg;
+  msg.lat = 0.71234567891234;
+  msg.lon = -0.15;
+  msg.height = 120.3f;
+  msg.x = 153.27f;
+  msg.y = -2000.5f;
+  msg.z = 5.0f;
+  msg.phi = 0.1f;
+  msg.theta = -0.05f;
+  msg.psi = 2.5f;
+  msg.u = 1.5f;
+  msg.depth = 5.0f;
+  msg.alt = 12.3f;
+  return msg;
+}
+
+static bool
+isClose(const IMC::EstimatedState& a, const IMC::EstimatedState& b)
+{
+  return std::fabs(a.lat - b.lat) <= 0.5e-7
+  && std::fabs(a.lon - b.lon) <= 0.5e-7
+  && std::fabs(a.height - b.height) <= 0.25
+  && std::fabs(a.x - b.x) <= 0.051
+  && std::fabs(a.y - b.y) <= 0.051
+  && std::fabs(a.psi - b.psi) <= 0.0051
+  && std::fabs(a.u - b.u) <= 0.011
+  && std::fabs(a.depth - b.depth) <= 0.051
+  && std::fabs(a.alt - b.alt) <= 0.051
+  && b.vx == 0.0f && b.r == 0.0f;
+}
+
+int
+main(void)
+{
+  Test test("IMC Compact");
+
+  {
+    Utils::BitBuffer bfr(8);
+    IMC::BitWriter writer(bfr);
+    writer.putBits(5, 3);
+    writer.putBits(0xabcdef, 24);
+    writer.putBits(1, 1);
+    writer.putBits(0xffffffff, 32);
+    test.boolean("bits written", writer.getBits() == 60 && writer.getSize() == 8);
+
+    IMC::BitReader reader(bfr);
+    bool ok = reader.getBits(3) == 5;
+    ok = ok && reader.getBits(24) == 0xabcdef;
+    ok = ok && reader.getBits(1) == 1;
+    ok = ok && reader.getBits(32) == 0xffffffff;
+    test.boolean("bits read back", ok && reader.getRemaining() == 0);
+
+    bool thrown = false;
+    try
+    {
+      writer.putBits(0, 8);
+    }
+    catch (IMC::InternalBufferTooShort&)
+    {
+      thrown = true;
+    }
+    test.boolean("writer overflow", thrown);
+  }
+
+  {
+    test.boolean("quantize rounds", IMC::quantize(1.26, 0.0, 0.1, 8) == 13);
+    test.boolean("quantize clamps below", IMC::quantize(-5.0, 0.0, 0.1, 8) == 0);
+    test.boolean("quantize clamps above", IMC::quantize(100.0, 0.0, 0.1, 8) == 255);
+    test.boolean("quantize NaN", IMC::quantize(std::sqrt(-1.0), 0.0, 0.1, 8) == 0);
+
+    int16_t value = 0;
+    IMC::dequantize(1000, -4000.0, 1.0, value);
+    test.boolean("dequantize integer", value == -3000);
+  }
+
+  {
+    test.boolean("supported", IMC::CompactCodec::isSupported(DUNE_IMC_ESTIMATEDSTATE));
+    test.boolean("unsupported", !IMC::CompactCodec::isSupported(DUNE_IMC_ENTITYINFO));
+    test.boolean("maximum bits fit 32 bytes",
+                 IMC::getCompactMaximumBits(DUNE_IMC_ESTIMATEDSTATE) + 17 <= 32 * 8);
+
+    IMC::CompactCodec tx;
+    IMC::EntityInfo info;
+    Utils::BitBuffer bfr(32);
+    IMC::BitWriter writer(bfr);
+    bool thrown = false;
+    try
+    {
+      tx.encode(&info, writer);
+    }
+    catch (IMC::InvalidMessageId&)
+    {
+      thrown = true;
+    }
+    test.boolean("unsupported message throws", thrown);
+  }
+
+  {
+    IMC::CompactCodec tx;
+    IMC::CompactCodec rx;
+    IMC::EstimatedState msg = makeState();
+
+    unsigned bits = 0;
+    IMC::Message* rv = transfer(tx, rx, msg, &bits);
+    test.boolean("absolute EstimatedState",
+                 rv != NULL && rv->getId() == DUNE_IMC_ESTIMATEDSTATE
+                 && isClose(msg, *static_cast<IMC::EstimatedState*>(rv)));
+    test.boolean("absolute EstimatedState fits 32 bytes", bits <= 32 * 8);
+    delete rv;
+
+    // Out of range values are clamped.
+    msg.depth = 5000.0f;
+    msg.u = -20.0f;
+    rv = transfer(tx, rx, msg);
+    IMC::EstimatedState* es = static_cast<IMC::EstimatedState*>(rv);
+    test.boolean("clamped fields", rv != NULL && std::fabs(es->depth - 1638.3f) < 0.01
+                 && std::fabs(es->u + 10.0f) < 0.01);
+    delete rv;
+  }
+
+  {
+    IMC::CompactCodec tx;
+    IMC::CompactCodec rx;
+    IMC::EstimatedState msg = makeState();
+
+    unsigned abs_bits = 0;
+    unsigned seq = 0;
+    IMC::Message* rv = transfer(tx, rx, msg, &abs_bits, &seq);
+    delete rv;
+    tx.acknowledge(msg.getId(), seq);
+
+    // Small change: deltas.
+    msg.lat += 3e-6;
+    msg.x += 1.2f;
+    msg.psi += 0.03f;
+    msg.depth += 0.4f;
+
+    unsigned delta_bits = 0;
+    rv = transfer(tx, rx, msg, &delta_bits, &seq);
+    test.boolean("delta EstimatedState",
+                 rv != NULL && isClose(msg, *static_cast<IMC::EstimatedState*>(rv)));
+    test.boolean("delta is smaller", delta_bits < abs_bits / 2);
+    delete rv;
+
+    // Large change: absolute fallback within delta frame.
+    msg.x += 500.0f;
+    rv = transfer(tx, rx, msg);
+    test.boolean("delta with absolute fields",
+                 rv != NULL && isClose(msg, *static_cast<IMC::EstimatedState*>(rv)));
+    delete rv;
+
+    // Receiver without the reference drops the message.
+    IMC::CompactCodec other;
+    rv = transfer(tx, other, msg);
+    test.boolean("unknown reference dropped", rv == NULL);
+  }
+
+  {
+    IMC::CompactCodec tx;
+    IMC::CompactCodec rx;
+    IMC::EstimatedState msg = makeState();
+
+    unsigned abs_bits = 0;
+    unsigned seq = 0;
+    delete transfer(tx, rx, msg, &abs_bits, &seq);
+    tx.acknowledge(msg.getId(), seq);
+
+    unsigned bits = 0;
+    for (unsigned i = 1; i < IMC::CompactCodec::c_window; ++i)
+      delete transfer(tx, rx, msg, &bits);
+    test.boolean("unchanged within window", bits < 40);
+
+    delete transfer(tx, rx, msg, &bits);
+    test.boolean("absolute outside window", bits == abs_bits);
+  }
+
+  {
+    IMC::CompactCodec tx;
+    IMC::CompactCodec rx;
+
+    IMC::Voltage volt;
+    volt.value = 24.37f;
+    IMC::Rpm rpm;
+    rpm.value = -1200;
+    IMC::PlanControlState pcs;
+    pcs.state = IMC::PlanControlState::PCS_EXECUTING;
+    pcs.plan_eta = 1234;
+    pcs.plan_progress = 42.5f;
+    pcs.man_eta = -1;
+
+    Utils::BitBuffer bfr(32);
+    IMC::BitWriter writer(bfr);
+    bool ok = tx.encode(&volt, writer);
+    ok = ok && tx.encode(&rpm, writer);
+    ok = ok && tx.encode(&pcs, writer);
+    test.boolean("several messages in one frame", ok);
+
+    IMC::EstimatedState state = makeState();
+    uint64_t before = writer.getBits();
+    test.boolean("message does not fit", !tx.encode(&state, writer) && writer.getBits() == before);
+
+    IMC::BitReader reader(bfr);
+    std::vector<IMC::Message*> msgs;
+    IMC::Message* msg = NULL;
+    while ((msg = rx.decode(reader)) != NULL)
+      msgs.push_back(msg);
+
+    test.boolean("decoded messages", msgs.size() == 3);
+    if (msgs.size() == 3)
+    {
+      IMC::Voltage* v = static_cast<IMC::Voltage*>(msgs[0]);
+      IMC::Rpm* r = static_cast<IMC::Rpm*>(msgs[1]);
+      IMC::PlanControlState* p = static_cast<IMC::PlanControlState*>(msgs[2]);
+      test.boolean("Voltage", std::fabs(v->value - 24.37f) < 0.006);
+      test.boolean("Rpm", r->value == -1200);
+      test.boolean("PlanControlState", p->state == IMC::PlanControlState::PCS_EXECUTING
+                   && p->plan_eta == 1234 && p->plan_progress == 42.5f && p->man_eta == -1);
+    }
+
+    for (unsigned i = 0; i < msgs.size(); ++i)
+      delete msgs[i];
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,236 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Write a message to compact JSON and read it back.
+static IMC::Message*
+roundTrip(const IMC::Message& msg)
+{
+  IMC::JSONWriter w;
+  msg.toJSON(w);
+  IMC::JSONReader r(w.data(), w.size());
+  IMC::Message* rv = r.readMessage();
+  return r.isDone() ? rv : NULL;
+}
+
+int
+main(void)
+{
+  Test test("IMC JSON");
+
+  {
+    IMC::EstimatedState msg;
+    msg.setTimeStamp(1500000000.123456);
+    msg.setSource(0x2000);
+    msg.setSourceEntity(7);
+    msg.setDestination(0x4001);
+    msg.setDestinationEntity(255);
+    msg.lat = 0.71234567891234;
+    msg.lon = -0.15;
+    msg.x = 1.0f / 3.0f;
+    msg.depth = 12.5f;
+    msg.psi = -3.1f;
+
+    IMC::Message* rv = roundTrip(msg);
+    test.boolean("EstimatedState round trip", rv != NULL && msg == *rv);
+    delete rv;
+
+    IMC::JSONWriter w;
+    msg.toJSON(w);
+    std::string text = w.str();
+    test.boolean("compact output", text.find('\n') == std::string::npos && text.find(": ") == std::string::npos);
+    test.boolean("numbers are not quoted", text.find("\"depth\":12.5") != std::string::npos);
+    test.boolean("integral values are integers", text.find("\"src\":8192") != std::string::npos);
+  }
+
+  {
+    IMC::EntityInfo msg;
+    msg.id = 12;
+    msg.label = "Quote \" backslash \\ tab \t newline \n control \x01";
+    msg.component = "\xc3\xa9";
+
+    IMC::Message* rv = roundTrip(msg);
+    test.boolean("string escapes", rv != NULL && msg == *rv);
+    delete rv;
+  }
+
+  {
+    IMC::DevDataBinary msg;
+    for (unsigned i = 0; i < 256; ++i)
+      msg.value.push_back(static_cast<char>(i));
+
+    IMC::Message* rv = roundTrip(msg);
+    test.boolean("raw data", rv != NULL && msg == *rv);
+    delete rv;
+  }
+
+  {
+    IMC::Goto man;
+    man.lat = 0.7;
+    man.speed = 1.5;
+    man.z = 2;
+
+    IMC::PlanManeuver pman;
+    pman.maneuver_id = "1";
+    pman.data.set(man);
+
+    IMC::PlanSpecification spec;
+    spec.plan_id = "plan";
+    spec.maneuvers.push_back(pman);
+    spec.start_man_id = "1";
+    spec.start_actions.push_back(NULL);
+
+    IMC::PlanControl msg;
+    msg.setSource(0x2000);
+    msg.op = IMC::PlanControl::PC_START;
+    msg.plan_id = "plan";
+    msg.arg.set(spec);
+
+    IMC::Message* rv = roundTrip(msg);
+    test.boolean("nested messages", rv != NULL && msg == *rv);
+    delete rv;
+
+    IMC::PlanControl empty;
+    rv = roundTrip(empty);
+    test.boolean("null inline message", rv != NULL && empty == *rv);
+    delete rv;
+  }
+
+  {
+    IMC::Temperature msg;
+    msg.setSourceEntity(3);
+    msg.value = 21.5f;
+
+    // Indented output, with quoted numbers.
+    std::ostringstream os;
+    msg.toJSON(os);
+    std::string text = os.str();
+    IMC::JSONReader r(text.c_str(), text.size());
+    IMC::Message* rv = r.readMessage();
+    test.boolean("indented format", rv != NULL && msg == *rv);
+    delete rv;
+  }
+
+  {
+    const char* text = " { \"value\" : 4.25e1, \"unknown\": {\"a\": [1, \"]\", {}]}, \"abbrev\": \"Depth\" }\n"
+      "{\"abbrev\":\"Depth\",\"value\":null}";
+    IMC::JSONReader r(text, std::strlen(text));
+
+    IMC::Message* rv = r.readMessage();
+    test.boolean("abbreviation after fields", rv != NULL && rv->getId() == IMC::Depth::getIdStatic());
+    test.boolean("unknown fields are skipped", rv != NULL && static_cast<IMC::Depth*>(rv)->value == 42.5f);
+    delete rv;
+
+    rv = r.readMessage();
+    test.boolean("null reads as NaN", rv != NULL && static_cast<IMC::Depth*>(rv)->value != static_cast<IMC::Depth*>(rv)->value);
+    delete rv;
+    test.boolean("end of input", r.isDone());
+  }
+
+  {
+    const char* bad[] =
+    {
+      "{\"value\":1}",
+      "{\"abbrev\":\"NoSuchMessage\"}",
+      "{\"abbrev\":\"Depth\",\"value\":}",
+      "{\"abbrev\":\"Depth\",\"value\":1",
+      "{\"abbrev\":\"EntityInfo\",\"label\":\"abc"
+    };
+
+    for (unsigned i = 0; i < sizeof(bad) / sizeof(bad[0]); ++i)
+    {
+      bool thrown = false;
+      try
+      {
+        IMC::JSONReader r(bad[i], std::strlen(bad[i]));
+        delete r.readMessage();
+      }
+      catch (std::runtime_error& e)
+      {
+        thrown = true;
+      }
+
+      test.boolean((std::string("invalid input #") + (char)('0' + i)).c_str(), thrown);
+    }
+  }
+
+  {
+    // Deeply nested values are rejected before exhausting the stack.
+    std::string deep = "{\"abbrev\":\"Depth\",\"extra\":";
+    std::string shallow = deep;
+    deep += std::string(100000, '[') + std::string(100000, ']') + "}";
+    shallow += std::string(16, '[') + std::string(16, ']') + ",\"value\":1}";
+
+    bool thrown = false;
+    try
+    {
+      IMC::JSONReader r(deep.c_str(), deep.size());
+      delete r.readMessage();
+    }
+    catch (IMC::InvalidJSON& e)
+    {
+      thrown = true;
+    }
+    test.boolean("deep nesting", thrown);
+
+    IMC::JSONReader r(shallow.c_str(), shallow.size());
+    IMC::Message* rv = r.readMessage();
+    test.boolean("shallow nesting", rv != NULL && static_cast<IMC::Depth*>(rv)->value == 1.0f);
+    delete rv;
+  }
+
+  {
+    IMC::JSONWriter w;
+    w.writeReal(0.1, false);
+    w.put(' ');
+    w.writeReal(0.1f, true);
+    w.put(' ');
+    w.writeReal(-1e300, false);
+    w.put(' ');
+    w.writeReal(HUGE_VAL, false);
+    w.put(' ');
+    w.writeSigned(-9223372036854775807LL - 1);
+    test.boolean("number formatting", w.str() == "0.1 0.1 -1e+300 null -9223372036854775808");
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,175 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Append a serialized message to a stream.
+static void
+append(std::vector<uint8_t>& stream, const IMC::Message& msg)
+{
+  Utils::ByteBuffer bfr;
+  IMC::Packet::serialize(&msg, bfr);
+  stream.insert(stream.end(), bfr.getBuffer(), bfr.getBuffer() + bfr.getSize());
+}
+
+//! Feed a stream in blocks of a given size and decode all messages.
+static std::vector<float>
+decode(const std::vector<uint8_t>& stream, unsigned block)
+{
+  IMC::Parser parser;
+  std::vector<float> values;
+
+  for (unsigned i = 0; i < stream.size(); i += block)
+  {
+    unsigned n = std::min(block, (unsigned)stream.size() - i);
+    std::vector<uint8_t> data(stream.begin() + i, stream.begin() + i + n);
+    parser.feed(&data[0], n);
+
+    IMC::Message* m = NULL;
+    while ((m = parser.nextMessage()) != NULL)
+    {
+      values.push_back((float)m->getValueFP());
+      delete m;
+    }
+  }
+
+  return values;
+}
+
+int
+main(void)
+{
+  Test test("IMC::Parser");
+
+  std::vector<uint8_t> stream;
+  std::vector<float> expected;
+  Random::Generator* prng = Random::Factory::create(Random::Factory::c_default, 7);
+
+  for (unsigned i = 0; i < 50; ++i)
+  {
+    // Noise, including lone bytes of synchronization numbers.
+    stream.push_back(0x00);
+    stream.push_back(0x54);
+    for (unsigned j = 0; j <= i % 7; ++j)
+    {
+      uint8_t byte = (uint8_t)prng->random();
+      stream.push_back((byte == 0xfe || byte == 0x54) ? 0 : byte);
+    }
+    stream.push_back(0xfe);
+    stream.push_back(0x00);
+
+    IMC::Voltage voltage;
+    voltage.value = (float)i;
+    append(stream, voltage);
+    expected.push_back((float)i);
+
+    // Corrupted packet.
+    if (i % 5 == 0)
+    {
+      std::vector<uint8_t> bad;
+      append(bad, voltage);
+      bad[bad.size() - 1] ^= 0x5a;
+      stream.insert(stream.end(), bad.begin(), bad.end());
+    }
+  }
+
+  delete prng;
+
+  test.boolean("nextMessage() (single block)", decode(stream, stream.size()) == expected);
+  test.boolean("nextMessage() (1 byte blocks)", decode(stream, 1) == expected);
+  test.boolean("nextMessage() (7 byte blocks)", decode(stream, 7) == expected);
+  test.boolean("nextMessage() (64 byte blocks)", decode(stream, 64) == expected);
+
+  {
+    IMC::Parser parser;
+    std::vector<float> values;
+    for (unsigned i = 0; i < stream.size(); ++i)
+    {
+      IMC::Message* m = parser.parse(stream[i]);
+      if (m != NULL)
+      {
+        values.push_back((float)m->getValueFP());
+        delete m;
+      }
+    }
+
+    test.boolean("parse()", values == expected);
+  }
+
+  {
+    IMC::Parser parser;
+    parser.feed(&stream[0], stream.size());
+
+    IMC::Header hdr;
+    const uint8_t* packet = NULL;
+    unsigned size = 0;
+    unsigned count = 0;
+    bool views = true;
+    while (parser.nextPacket(hdr, packet, size))
+    {
+      views = views && hdr.mgid == IMC::Voltage::getIdStatic()
+      && packet >= &stream[0] && packet + size <= &stream[0] + stream.size();
+      ++count;
+    }
+
+    test.boolean("nextPacket() (zero-copy)", views && count == expected.size());
+  }
+
+  {
+    // A valid packet hidden inside a frame with a bogus size.
+    std::vector<uint8_t> data;
+    data.push_back(0x54);
+    data.push_back(0xfe);
+    data.push_back(0x00);
+    data.push_back(0x01);
+    data.push_back(0x10);
+    data.push_back(0x00);
+    for (unsigned i = 0; i < 14; ++i)
+      data.push_back(0);
+
+    IMC::Voltage voltage;
+    voltage.value = 42.0f;
+    append(data, voltage);
+    data.resize(data.size() + 20, 0);
+
+    std::vector<float> values = decode(data, 3);
+    test.boolean("nextMessage() (resynchronization)", values.size() == 1 && values[0] == 42.0f);
+  }
+
+  return test.getReturnValue();
+}
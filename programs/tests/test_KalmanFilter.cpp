@@ -0,0 +1,248 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+static const short c_states = 6;
+static const short c_outputs = 3;
+
+//! Check if two matrices hold the same values.
+static bool
+equal(const Matrix& a, const Matrix& b, double tolerance = 1e-9)
+{
+  if (a.rows() != b.rows() || a.columns() != b.columns())
+    return false;
+
+  for (int i = 0; i < a.rows(); ++i)
+  {
+    for (int j = 0; j < a.columns(); ++j)
+    {
+      if (std::fabs(a(i, j) - b(i, j)) > tolerance)
+        return false;
+    }
+  }
+
+  return true;
+}
+
+//! Set up a constant velocity model with three observed states.
+static void
+setup(KalmanFilter& kal)
+{
+  kal.reset(c_states, c_outputs);
+
+  Matrix a(c_states);
+  for (short i = 0; i < 3; ++i)
+    a(i, i + 3) = 0.1;
+  kal.setTransitions(a);
+
+  for (short i = 0; i < c_states; ++i)
+  {
+    for (short j = 0; j < c_states; ++j)
+      kal.setCovariance(i, j, (i == j) ? 2.0 + i : 0.1 * (i + j) / c_states);
+  }
+
+  kal.setProcessNoise(0.01);
+  kal.setMeasurementNoise(0.5);
+
+  kal.setObservation(0, 0, 1.0);
+  kal.setObservation(1, 1, 1.0);
+  kal.setObservation(2, 0, 0.6);
+  kal.setObservation(2, 2, 0.8);
+
+  kal.setInnovation(0, 0.3);
+  kal.setInnovation(1, -0.4);
+  kal.setInnovation(2, 0.25);
+}
+
+//! Batch update equations.
+static void
+reference(const KalmanFilter& kal, const Matrix& r, Matrix& x, Matrix& p)
+{
+  Matrix c = kal.getObservation();
+  Matrix v(c_outputs, 1);
+  for (short i = 0; i < c_outputs; ++i)
+    v(i) = kal.getInnovation(i);
+
+  p = kal.getCovariance();
+  Matrix s = c * p * transpose(c) + r;
+  Matrix k = p * transpose(c) * inverse(s);
+
+  x = kal.getState() + k * v;
+  p = p - k * c * p;
+}
+
+int
+main(void)
+{
+  Test test("Navigation::KalmanFilter");
+
+  {
+    KalmanFilter kal;
+    setup(kal);
+    for (short i = 0; i < c_states; ++i)
+      kal.setState(i, i * 0.5);
+
+    Matrix a = kal.getStateTransition();
+    Matrix x = a * kal.getState();
+    Matrix p = a * kal.getCovariance() * transpose(a) + Matrix(c_states) * 0.01;
+
+    kal.predict();
+    test.boolean("predict()", equal(kal.getState(), x) && equal(kal.getCovariance(), p));
+  }
+
+  {
+    KalmanFilter kal;
+    setup(kal);
+
+    Matrix x;
+    Matrix p;
+    reference(kal, Matrix(c_outputs) * 0.5, x, p);
+
+    test.boolean("update() (diagonal noise)", kal.update(0) == 0
+                 && equal(kal.getState(), x) && equal(kal.getCovariance(), p));
+  }
+
+  {
+    KalmanFilter kal;
+    setup(kal);
+    kal.setMeasurementNoise(0, 2, 0.2);
+    kal.setMeasurementNoise(2, 0, 0.2);
+
+    Matrix r = Matrix(c_outputs) * 0.5;
+    r(0, 2) = 0.2;
+    r(2, 0) = 0.2;
+
+    Matrix x;
+    Matrix p;
+    reference(kal, r, x, p);
+
+    test.boolean("update() (correlated noise)", kal.update(0) == 0
+                 && equal(kal.getState(), x) && equal(kal.getCovariance(), p));
+  }
+
+  {
+    KalmanFilter kal;
+    setup(kal);
+    kal.setObservation(1, 1, 0.0);
+    kal.setMeasurementNoise(1, 0.0);
+
+    Matrix r = Matrix(c_outputs) * 0.5;
+    r(1, 1) = 1.0;
+
+    Matrix x;
+    Matrix p;
+    reference(kal, r, x, p);
+
+    test.boolean("update() (unobserved output)", kal.update(0) == 0
+                 && equal(kal.getState(), x) && equal(kal.getCovariance(), p));
+  }
+
+  {
+    KalmanFilter kal;
+    setup(kal);
+
+    Matrix c = kal.getObservation();
+    Matrix v(c_outputs, 1);
+    for (short i = 0; i < c_outputs; ++i)
+      v(i) = kal.getInnovation(i);
+    Matrix s = c * kal.getCovariance() * transpose(c) + Matrix(c_outputs) * 0.5;
+    double level = (transpose(v) * inverse(s) * v)(0);
+
+    Matrix p = kal.getCovariance();
+    bool ok = kal.update(level * 0.99) == -1 && equal(kal.getCovariance(), p);
+    ok = ok && kal.update(level * 1.01) == 0 && !equal(kal.getCovariance(), p);
+    test.boolean("update() (innovation threshold)", ok);
+  }
+
+  {
+    KalmanFilter kal;
+    setup(kal);
+
+    bool ok = true;
+    for (unsigned i = 0; i < 1000 && ok; ++i)
+    {
+      kal.predict();
+      ok = kal.update(0) == 0;
+    }
+
+    Matrix p = kal.getCovariance();
+    for (short i = 0; i < c_states && ok; ++i)
+    {
+      ok = p(i, i) > 0;
+      for (short j = 0; j < c_states && ok; ++j)
+        ok = p(i, j) == p(j, i);
+    }
+
+    test.boolean("update() (symmetric covariance)", ok);
+  }
+
+  {
+    KalmanFilter kal;
+    setup(kal);
+
+    FixedMatrix<c_states, c_states> ax;
+    FixedMatrix<c_states, c_states> ap;
+    for (unsigned i = 0; i < c_states * c_states; ++i)
+    {
+      ax(i) = 0.1 * i;
+      ap(i) = -0.2 * i;
+    }
+
+    kal.setStateTransition(ax);
+    kal.setCovarianceTransition(ap);
+    bool ok = equal(kal.getStateTransition(), ax.toMatrix())
+      && equal(kal.getCovarianceTransition(), ap.toMatrix());
+
+    kal.setTransitions(ax);
+    ok = ok && equal(kal.getStateTransition(), ax.toMatrix())
+      && equal(kal.getCovarianceTransition(), ax.toMatrix());
+
+    try
+    {
+      kal.setStateTransition(FixedMatrix<c_outputs, c_outputs>());
+      ok = false;
+    }
+    catch (std::runtime_error&)
+    { }
+
+    test.boolean("setTransitions() (fixed size)", ok);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,238 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <fstream>
+#include <sstream>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Write a chunked LSF file with one chunk per message type and
+//! second, returning the number of chunks.
+static unsigned
+writeLog(const Path& file, Compression::Methods method)
+{
+  std::ofstream data(file.c_str(), std::ios::binary);
+  std::ofstream index(IMC::LogIndex::getPath(file.str()).c_str(), std::ios::binary);
+  IMC::LogIndex::writeHeader(index, method);
+
+  Compression::Compressor* com = Compression::Factory::compressor(method);
+  uint64_t offset = 0;
+  unsigned chunks = 0;
+
+  for (unsigned t = 0; t < 10; ++t)
+  {
+    for (unsigned kind = 0; kind < 2; ++kind)
+    {
+      ByteBuffer raw;
+      ByteBuffer msg_bfr;
+      IMC::LogIndex::Chunk chunk;
+
+      for (unsigned i = 0; i < 50; ++i)
+      {
+        IMC::Message* msg = NULL;
+        if (kind == 0)
+          msg = new IMC::Voltage;
+        else
+          msg = new IMC::Temperature;
+
+        msg->setTimeStamp(t + i / 50.0);
+        msg->setSource(0x2000 + kind);
+        msg->setSourceEntity(kind + 1);
+        IMC::Packet::serialize(msg, msg_bfr);
+        raw.append(msg_bfr.getBuffer(), msg_bfr.getSize());
+
+        if (chunk.count == 0)
+          chunk.time_start = msg->getTimeStamp();
+        chunk.time_end = msg->getTimeStamp();
+        ++chunk.count;
+        chunk.ids.assign(1, msg->getId());
+        chunk.sources.assign(1, IMC::LogIndex::Source(msg->getSource(), msg->getSourceEntity()));
+        delete msg;
+      }
+
+      ByteBuffer packed;
+      if (com == NULL)
+        packed.append(raw.getBuffer(), raw.getSize());
+      else
+        com->compress(packed, raw);
+      data.write(packed.getBufferSigned(), packed.getSize());
+
+      chunk.offset = offset;
+      chunk.length = packed.getSize();
+      chunk.size = raw.getSize();
+      offset += packed.getSize();
+      IMC::LogIndex::writeChunk(index, chunk);
+      ++chunks;
+    }
+  }
+
+  delete com;
+  return chunks;
+}
+
+//! Count messages read from a stream.
+static unsigned
+countMessages(std::istream& is, uint16_t id, double& time_min, double& time_max)
+{
+  unsigned count = 0;
+  IMC::Message* msg = NULL;
+  time_min = 1e9;
+  time_max = -1e9;
+
+  while ((msg = IMC::Packet::deserialize(is)) != NULL)
+  {
+    if (msg->getId() == id)
+    {
+      ++count;
+      time_min = std::min(time_min, msg->getTimeStamp());
+      time_max = std::max(time_max, msg->getTimeStamp());
+    }
+    delete msg;
+  }
+
+  return count;
+}
+
+int
+main(void)
+{
+  Test test("IMC::LogIndex");
+
+  Path file = Path("/tmp") / "test_LogIndex.lsf.lz4";
+  unsigned chunks = writeLog(file, Compression::METHOD_LZ4);
+
+  IMC::LogIndex index;
+  index.load(IMC::LogIndex::getPath(file.str()));
+  test.boolean("LogIndex::load()", index.getChunks().size() == chunks
+               && index.getMethod() == Compression::METHOD_LZ4);
+
+  {
+    // The data file is a regular LZ4 stream as well.
+    Compression::FileInput fi(file.c_str(), Compression::Factory::detect(file.c_str()));
+    double t0, t1;
+    test.boolean("FileInput (whole file)", countMessages(fi, DUNE_IMC_TEMPERATURE, t0, t1) == 500);
+  }
+
+  {
+    IMC::LogIndex::Query query;
+    query.ids.insert(DUNE_IMC_TEMPERATURE);
+    IMC::IndexedInput is(file.str(), index, query);
+    double t0, t1;
+    unsigned count = countMessages(is, DUNE_IMC_TEMPERATURE, t0, t1);
+    test.boolean("IndexedInput (by id)", is.getChunkCount() == chunks / 2 && count == 500);
+  }
+
+  {
+    IMC::LogIndex::Query query;
+    query.time_start = 4.5;
+    query.time_end = 6.5;
+    query.sources.insert(IMC::LogIndex::Source(IMC::LogIndex::Source::c_any_system, 1));
+    IMC::IndexedInput is(file.str(), index, query);
+    double t0, t1;
+    unsigned count = countMessages(is, DUNE_IMC_VOLTAGE, t0, t1);
+    test.boolean("IndexedInput (by time and entity)", is.getChunkCount() == 3 && count == 150
+                 && t0 >= 4.0 && t1 < 7.0);
+  }
+
+  {
+    // Entity 1 belongs to system 0x2000 only.
+    IMC::LogIndex::Query query;
+    query.sources.insert(IMC::LogIndex::Source(0x2001, 1));
+    std::vector<const IMC::LogIndex::Chunk*> selected;
+    index.select(query, selected);
+    bool none = selected.empty();
+    query.sources.insert(IMC::LogIndex::Source(0x2001, 2));
+    index.select(query, selected);
+    test.boolean("LogIndex::select() (by source)", none && selected.size() == chunks / 2);
+  }
+
+  {
+    std::ostringstream os;
+    IMC::LogIndex::writeHeader(os, Compression::METHOD_UNKNOWN);
+    size_t header = os.str().size();
+    IMC::LogIndex::Chunk chunk;
+    chunk.offset = 0x0102030405060708ULL;
+    IMC::LogIndex::writeChunk(os, chunk);
+    std::string bytes = os.str().substr(header, 8);
+    test.boolean("LogIndex::writeChunk() (little endian)",
+                 bytes == std::string("\x08\x07\x06\x05\x04\x03\x02\x01", 8));
+  }
+
+  {
+    std::ifstream ifs(IMC::LogIndex::getPath(file.str()).c_str(), std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    std::istringstream truncated(content.substr(0, content.size() - 3));
+    IMC::LogIndex partial;
+    partial.load(truncated);
+    test.boolean("LogIndex::load() (truncated)", partial.getChunks().size() == chunks - 1);
+  }
+
+  {
+    std::istringstream garbage("not an index");
+    IMC::LogIndex bad;
+    bool thrown = false;
+    try
+    {
+      bad.load(garbage);
+    }
+    catch (IMC::InvalidFormat&)
+    {
+      thrown = true;
+    }
+    test.boolean("LogIndex::load() (invalid)", thrown);
+  }
+
+  {
+    Path raw_file = Path("/tmp") / "test_LogIndex.lsf";
+    writeLog(raw_file, Compression::METHOD_UNKNOWN);
+    IMC::LogIndex raw_index;
+    raw_index.load(IMC::LogIndex::getPath(raw_file.str()));
+
+    IMC::LogIndex::Query query;
+    query.ids.insert(DUNE_IMC_VOLTAGE);
+    IMC::IndexedInput is(raw_file.str(), raw_index, query);
+    double t0, t1;
+    test.boolean("IndexedInput (uncompressed)", countMessages(is, DUNE_IMC_VOLTAGE, t0, t1) == 500);
+
+    raw_file.remove();
+    Path(IMC::LogIndex::getPath(raw_file.str())).remove();
+  }
+
+  file.remove();
+  Path(IMC::LogIndex::getPath(file.str())).remove();
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,225 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <fstream>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+static const unsigned c_count = 5000;
+
+//! Write a log with timestamps first, first + step, ...,
+//! alternating Voltage and Temperature messages.
+static void
+writeLog(std::ostream& os, double first, double step)
+{
+  ByteBuffer bfr;
+  for (unsigned i = 0; i < c_count; ++i)
+  {
+    if (i % 2)
+    {
+      IMC::Temperature msg;
+      msg.value = (float)i;
+      msg.setTimeStamp(first + i * step);
+      IMC::Packet::serialize(&msg, bfr);
+    }
+    else
+    {
+      IMC::Voltage msg;
+      msg.value = (float)i;
+      msg.setTimeStamp(first + i * step);
+      IMC::Packet::serialize(&msg, bfr);
+    }
+
+    os.write(bfr.getBufferSigned(), bfr.getSize());
+  }
+}
+
+//! Checks the merged order and counts messages per file.
+class Checker: public IMC::LogProcessor::Handler
+{
+public:
+  std::vector<unsigned> counts;
+  double last;
+  bool ordered;
+  bool temperature_only;
+
+  Checker(void):
+    counts(4, 0),
+    last(-1),
+    ordered(true),
+    temperature_only(false)
+  { }
+
+  bool
+  filter(const IMC::PacketView& view)
+  {
+    return !temperature_only || view.getId() == DUNE_IMC_TEMPERATURE;
+  }
+
+  void
+  reduce(const IMC::Message* msg, unsigned file)
+  {
+    ordered = ordered && msg->getTimeStamp() >= last;
+    last = msg->getTimeStamp();
+    ++counts[file];
+  }
+};
+
+//! Reduce stage that fails.
+class Failing: public IMC::LogProcessor::Handler
+{
+public:
+  void
+  reduce(const IMC::Message* msg, unsigned file)
+  {
+    (void)file;
+    if (msg->getTimeStamp() > 100)
+      throw std::runtime_error("failed");
+  }
+};
+
+int
+main(void)
+{
+  Test test("IMC::LogProcessor");
+
+  std::vector<Path> files;
+  files.push_back(Path("/tmp") / "test_LogProcessor_0.lsf");
+  files.push_back(Path("/tmp") / "test_LogProcessor_1.lsf.gz");
+  files.push_back(Path("/tmp") / "test_LogProcessor_2.lsf.lz4");
+  files.push_back(Path("/tmp") / "test_LogProcessor_3.lsf");
+
+  {
+    std::ofstream ofs(files[0].c_str(), std::ios::binary);
+    writeLog(ofs, 0, 3);
+  }
+
+  {
+    Compression::FileOutput ofs(files[1].c_str(), Compression::METHOD_GZIP);
+    writeLog(ofs, 1, 3);
+  }
+
+  {
+    Compression::FileOutput ofs(files[2].c_str(), Compression::METHOD_LZ4);
+    writeLog(ofs, 2, 3);
+  }
+
+  {
+    // Starts after the others end.
+    std::ofstream ofs(files[3].c_str(), std::ios::binary);
+    writeLog(ofs, 3 * c_count, 1);
+  }
+
+  IMC::LogProcessor proc(3);
+  // Add in reverse order of start time.
+  for (size_t i = files.size(); i > 0; --i)
+    proc.addFile(files[i - 1].str());
+
+  {
+    Checker checker;
+    uint64_t count = proc.run(checker);
+
+    bool ok = count == 4 * c_count && checker.ordered && proc.getErrors().empty();
+    for (unsigned i = 0; i < 4; ++i)
+      ok = ok && checker.counts[i] == c_count;
+    test.boolean("LogProcessor::run() (merge)", ok);
+  }
+
+  {
+    Checker checker;
+    checker.temperature_only = true;
+    std::set<uint16_t> ids;
+    ids.insert(DUNE_IMC_TEMPERATURE);
+    ids.insert(DUNE_IMC_VOLTAGE);
+    proc.setMessages(ids);
+    proc.setTimeRange(0, 3 * c_count - 1);
+    uint64_t count = proc.run(checker);
+
+    bool ok = count == 3 * c_count / 2 && checker.ordered && checker.counts[0] == 0;
+    test.boolean("LogProcessor::run() (filter)", ok);
+    proc.setMessages(std::set<uint16_t>());
+    proc.setTimeRange(-1, 1e9);
+  }
+
+  {
+    Failing failing;
+    bool thrown = false;
+    try
+    {
+      proc.run(failing);
+    }
+    catch (std::runtime_error&)
+    {
+      thrown = true;
+    }
+    test.boolean("LogProcessor::run() (reduce error)", thrown);
+  }
+
+  {
+    IMC::LogProcessor missing(2);
+    missing.addFile(files[0].str());
+    missing.addFile("/tmp/test_LogProcessor_missing.lsf");
+
+    Checker checker;
+    uint64_t count = missing.run(checker);
+    test.boolean("LogProcessor::run() (missing file)",
+                 count == c_count && missing.getErrors().size() == 1);
+  }
+
+  {
+    // Sequential logs are decoded ahead of the merge front.
+    IMC::LogProcessor sequential(2);
+    for (unsigned i = 0; i < 3; ++i)
+    {
+      files.push_back(Path("/tmp") / String::str("test_LogProcessor_seq_%u.lsf", i));
+      std::ofstream ofs(files.back().c_str(), std::ios::binary);
+      writeLog(ofs, i * c_count, 1);
+      sequential.addFile(files.back().str());
+    }
+
+    Checker checker;
+    uint64_t count = sequential.run(checker);
+    bool ok = count == 3 * c_count && checker.ordered && sequential.getErrors().empty();
+    for (unsigned i = 0; i < 3; ++i)
+      ok = ok && checker.counts[i] == c_count;
+    test.boolean("LogProcessor::run() (sequential)", ok);
+  }
+
+  for (size_t i = 0; i < files.size(); ++i)
+    files[i].remove();
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,179 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <fstream>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+static const unsigned c_count = 20000;
+
+//! Write a log alternating Voltage and Temperature messages.
+static void
+writeLog(std::ostream& os)
+{
+  ByteBuffer bfr;
+  for (unsigned i = 0; i < c_count; ++i)
+  {
+    if (i % 2)
+    {
+      IMC::Temperature msg;
+      msg.value = (float)i;
+      msg.setTimeStamp(i);
+      IMC::Packet::serialize(&msg, bfr);
+    }
+    else
+    {
+      IMC::Voltage msg;
+      msg.value = (float)i;
+      msg.setTimeStamp(i);
+      IMC::Packet::serialize(&msg, bfr);
+    }
+
+    os.write(bfr.getBufferSigned(), bfr.getSize());
+  }
+}
+
+//! Read a log, decoding only Temperature messages.
+static bool
+readLog(const std::string& file, bool& mapped)
+{
+  IMC::LogReader reader(file);
+  IMC::PacketView view;
+  IMC::Temperature temp;
+  unsigned count = 0;
+  bool ok = true;
+
+  while (reader.next(view))
+  {
+    ok = ok && view.getTimeStamp() == count;
+
+    if (view.getId() == DUNE_IMC_TEMPERATURE)
+    {
+      view.decode(temp);
+      ok = ok && temp.value == (float)count && temp.getTimeStamp() == count;
+    }
+    else
+    {
+      IMC::Message* msg = view.decode();
+      ok = ok && msg->getId() == DUNE_IMC_VOLTAGE;
+      delete msg;
+    }
+
+    ++count;
+  }
+
+  mapped = reader.isMapped();
+  return ok && count == c_count;
+}
+
+int
+main(void)
+{
+  Test test("IMC::LogReader");
+
+  Path raw = Path("/tmp") / "test_LogReader.lsf";
+  Path packed = Path("/tmp") / "test_LogReader.lsf.gz";
+
+  {
+    std::ofstream ofs(raw.c_str(), std::ios::binary);
+    writeLog(ofs);
+  }
+
+  {
+    Compression::FileOutput ofs(packed.c_str(), Compression::METHOD_GZIP);
+    writeLog(ofs);
+  }
+
+  bool mapped = false;
+  bool ok = readLog(raw.str(), mapped);
+#if defined(DUNE_SYS_HAS_MMAP)
+  test.boolean("LogReader::next() (mapped)", ok && mapped);
+#else
+  test.boolean("LogReader::next() (buffered)", ok);
+#endif
+
+  ok = readLog(packed.str(), mapped);
+  test.boolean("LogReader::next() (compressed)", ok && !mapped);
+
+  {
+    IMC::LogReader reader(raw.str());
+    IMC::PacketView view;
+    reader.next(view);
+
+    IMC::Temperature temp;
+    bool thrown = false;
+    try
+    {
+      view.decode(temp);
+    }
+    catch (IMC::InvalidMessageId&)
+    {
+      thrown = true;
+    }
+    test.boolean("PacketView::decode() (wrong type)", thrown);
+  }
+
+  {
+    // Cut the last packet short.
+    std::ifstream ifs(raw.c_str(), std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    ifs.close();
+
+    std::ofstream ofs(raw.c_str(), std::ios::binary);
+    ofs.write(content.c_str(), content.size() - 5);
+    ofs.close();
+
+    IMC::LogReader reader(raw.str());
+    IMC::PacketView view;
+    unsigned count = 0;
+    bool thrown = false;
+    try
+    {
+      while (reader.next(view))
+        ++count;
+    }
+    catch (IMC::BufferTooShort&)
+    {
+      thrown = true;
+    }
+    test.boolean("LogReader::next() (truncated)", thrown && count == c_count - 1);
+  }
+
+  raw.remove();
+  packed.remove();
+
+  return test.getReturnValue();
+}
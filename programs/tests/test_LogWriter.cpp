@@ -0,0 +1,190 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+// Task headers.
+#include <Transports/Logging/Writer.hpp>
+
+using DUNE_NAMESPACES;
+using Transports::Logging::Writer;
+
+//! Size of each write block.
+static const size_t c_block_size = 4096;
+
+//! Write messages until a number of blocks are handed over.
+//! @return number of bytes written.
+static size_t
+fill(Writer& writer, unsigned blocks)
+{
+  IMC::EstimatedState msg;
+  size_t size = msg.getSerializationSize();
+  size_t count = (c_block_size / size) * blocks + 1;
+
+  for (size_t i = 0; i < count; ++i)
+    writer.write(&msg);
+
+  return count * size;
+}
+
+//! Write messages in several compressed chunks and read them back
+//! with the stream decompressor.
+//! @return true if all messages were read back in order.
+static bool
+roundTrip(const Path& path, Compression::Methods method)
+{
+  const unsigned c_count = 500;
+
+  {
+    Writer writer(c_block_size, 2, 16);
+    writer.open(path, method, true);
+    for (unsigned i = 0; i < c_count; ++i)
+    {
+      IMC::EstimatedState msg;
+      msg.setTimeStamp(i);
+      msg.x = i;
+      writer.write(&msg);
+    }
+    writer.close();
+    writer.sync();
+  }
+
+  Compression::FileInput input(path.c_str(), method);
+  unsigned count = 0;
+  bool ordered = true;
+  IMC::Message* msg = NULL;
+  while ((msg = IMC::Packet::deserialize(input)) != NULL)
+  {
+    IMC::EstimatedState* state = dynamic_cast<IMC::EstimatedState*>(msg);
+    if (state == NULL || state->x != count)
+      ordered = false;
+    ++count;
+    delete msg;
+  }
+
+  IMC::LogIndex index;
+  index.load(IMC::LogIndex::getPath(path.str()));
+  bool chunked = index.getChunks().size() > 1;
+
+  Path(IMC::LogIndex::getPath(path.str())).remove();
+  Path(path).remove();
+  return chunked && ordered && count == c_count;
+}
+
+//! Write a large amount of compressed data with a virtual clock
+//! installed.
+//! @param[out] elapsed virtual time taken by the writes.
+//! @return number of dropped blocks.
+static unsigned
+writeVirtual(const Path& path, double& elapsed)
+{
+  Time::VirtualClock clock(1000.0);
+  Time::Clock::setSource(&clock);
+  Time::Clock::attach();
+
+  unsigned drops = 0;
+
+  {
+    Writer writer(c_block_size, 2, 4);
+    writer.start();
+    writer.open(path, Compression::METHOD_BZIP2, false);
+
+    double start = Time::Clock::get();
+    fill(writer, 200);
+    writer.flush();
+    writer.sync();
+    elapsed = Time::Clock::get() - start;
+
+    uint64_t lost = 0;
+    drops = writer.takeDrops(lost);
+  }
+
+  Time::Clock::detach();
+  Time::Clock::setSource(NULL);
+  return drops;
+}
+
+int
+main(void)
+{
+  Test test("Transports::Logging::Writer");
+
+  Path path = Path("/tmp") / "test_LogWriter.lsf";
+
+  // The writer thread is not started, so no block is ever released.
+  {
+    Writer writer(c_block_size, 2, 5);
+    writer.open(path, Compression::METHOD_UNKNOWN, false);
+    size_t bytes = fill(writer, 3);
+
+    uint64_t lost = 0;
+    test.boolean("grows before dropping", writer.takeOverruns() == 2);
+    test.boolean("nothing dropped while growing", writer.takeDrops(lost) == 0 && lost == 0);
+
+    writer.close();
+    writer.sync();
+    test.boolean("all data written", path.size() == (int64_t)bytes);
+  }
+
+  {
+    Writer writer(c_block_size, 2, 2);
+    writer.open(path, Compression::METHOD_UNKNOWN, false);
+    size_t bytes = fill(writer, 3);
+
+    uint64_t lost = 0;
+    test.boolean("drops when exhausted", writer.takeDrops(lost) == 2);
+
+    uint64_t lost_close = 0;
+    writer.close();
+    writer.sync();
+    writer.takeDrops(lost_close);
+    test.boolean("lost bytes counted", (int64_t)(bytes - lost - lost_close) == path.size());
+
+    test.boolean("drops cleared", writer.takeDrops(lost) == 0 && lost == 0);
+  }
+
+  path.remove();
+
+  {
+    double elapsed = -1.0;
+    unsigned drops = writeVirtual(path, elapsed);
+    test.boolean("virtual time holds while writing", elapsed == 0 && drops == 0);
+    path.remove();
+  }
+
+  test.boolean("chunked gzip round trip", roundTrip(Path("/tmp") / "test_LogWriter.lsf.gz", Compression::METHOD_GZIP));
+  test.boolean("chunked bzip2 round trip", roundTrip(Path("/tmp") / "test_LogWriter.lsf.bz2", Compression::METHOD_BZIP2));
+  test.boolean("chunked lz4 round trip", roundTrip(Path("/tmp") / "test_LogWriter.lsf.lz4", Compression::METHOD_LZ4));
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,235 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+class Producer: public Concurrency::Thread
+{
+public:
+  Producer(Concurrency::BoundedQueue<unsigned>& queue, unsigned base, unsigned count):
+    m_queue(queue),
+    m_base(base),
+    m_count(count)
+  { }
+
+private:
+  Concurrency::BoundedQueue<unsigned>& m_queue;
+  unsigned m_base;
+  unsigned m_count;
+
+  void
+  run(void)
+  {
+    for (unsigned i = 0; i < m_count; ++i)
+    {
+      while (!m_queue.push(m_base + i))
+        Concurrency::Scheduler::yield();
+    }
+  }
+};
+
+static IMC::SharedMessage
+makeVoltage(float value)
+{
+  IMC::Voltage* msg = new IMC::Voltage;
+  msg->value = value;
+  return IMC::SharedMessage(msg);
+}
+
+int
+main(void)
+{
+  Test test("Tasks::Mailbox");
+
+  {
+    Concurrency::BoundedQueue<unsigned> queue(5);
+    test.boolean("BoundedQueue::getCapacity()", queue.getCapacity() == 8);
+
+    unsigned i = 0;
+    while (queue.push(i))
+      ++i;
+    test.boolean("BoundedQueue::push() (full)", i == 8 && queue.size() == 8);
+
+    unsigned value = 0;
+    bool ordered = true;
+    for (i = 0; queue.pop(value); ++i)
+      ordered = ordered && (value == i);
+    test.boolean("BoundedQueue::pop()", ordered && i == 8 && queue.empty());
+  }
+
+  {
+    const unsigned count = 50000;
+    Concurrency::BoundedQueue<unsigned> queue(64);
+    Producer a(queue, 0, count);
+    Producer b(queue, count, count);
+    a.start();
+    b.start();
+
+    unsigned received = 0;
+    unsigned last_a = 0;
+    unsigned last_b = count;
+    bool ordered = true;
+    while (received < 2 * count)
+    {
+      unsigned value = 0;
+      if (!queue.pop(value))
+      {
+        Concurrency::Scheduler::yield();
+        continue;
+      }
+
+      unsigned& last = (value < count) ? last_a : last_b;
+      ordered = ordered && (value == last);
+      last = value + 1;
+      ++received;
+    }
+
+    a.stopAndJoin();
+    b.stopAndJoin();
+    test.boolean("BoundedQueue (two producers)", ordered && queue.empty());
+  }
+
+  {
+    Tasks::Mailbox mbox(4);
+    IMC::SharedMessage msgs[8];
+    uint16_t id = IMC::Voltage::getIdStatic();
+
+    bool ordered = true;
+    for (unsigned i = 0; i < 6; ++i)
+      mbox.push(makeVoltage(i));
+
+    unsigned n = mbox.pop(msgs, 8);
+    for (unsigned i = 0; i < n; ++i)
+      ordered = ordered && msgs[i]->getValueFP() == i;
+    test.boolean("push() (grow)", n == 6 && ordered && mbox.empty()
+                 && mbox.takeDropCount() == 0 && mbox.takeOverflowCount() == 2);
+
+    // Messages queued behind overflowed ones keep their order.
+    for (unsigned i = 0; i < 6; ++i)
+      mbox.push(makeVoltage(i));
+    n = mbox.pop(msgs, 3);
+    mbox.push(makeVoltage(6));
+    n += mbox.pop(msgs + 3, 8);
+    ordered = true;
+    for (unsigned i = 0; i < n; ++i)
+      ordered = ordered && msgs[i]->getValueFP() == i;
+    test.boolean("pop() (grow)", n == 7 && ordered && mbox.empty());
+    mbox.takeOverflowCount();
+
+    // Lossless messages are set aside, not dropped, to make room.
+    uint16_t tid = IMC::Temperature::getIdStatic();
+    mbox.setOverflowPolicy(id, Tasks::Mailbox::OP_DROP_OLDEST);
+    for (unsigned i = 0; i < 4; ++i)
+    {
+      IMC::Temperature* t = new IMC::Temperature;
+      t->value = i;
+      mbox.push(IMC::SharedMessage(t));
+    }
+    mbox.push(makeVoltage(10));
+    mbox.push(makeVoltage(11));
+    n = mbox.pop(msgs, 8);
+    ordered = n == 6;
+    for (unsigned i = 0; ordered && i < 4; ++i)
+      ordered = msgs[i]->getId() == tid && msgs[i]->getValueFP() == i;
+    test.boolean("push() (drop oldest keeps lossless)", ordered
+                 && msgs[4]->getValueFP() == 10 && msgs[5]->getValueFP() == 11
+                 && mbox.takeDropCount() == 0);
+
+    mbox.setOverflowPolicy(id, Tasks::Mailbox::OP_DROP_NEWEST);
+    for (unsigned i = 0; i < 6; ++i)
+      mbox.push(makeVoltage(i));
+
+    n = mbox.pop(msgs, 8);
+    test.boolean("push() (drop newest)", n == 4 && msgs[0]->getValueFP() == 0
+                 && msgs[3]->getValueFP() == 3 && mbox.takeDropCount() == 2);
+
+    mbox.setOverflowPolicy(id, Tasks::Mailbox::OP_DROP_OLDEST);
+    for (unsigned i = 0; i < 6; ++i)
+      mbox.push(makeVoltage(i));
+
+    n = mbox.pop(msgs, 8);
+    test.boolean("push() (drop oldest)", n == 4 && msgs[0]->getValueFP() == 2
+                 && msgs[3]->getValueFP() == 5 && mbox.takeDropCount() == 2);
+
+    mbox.setOverflowPolicy(id, Tasks::Mailbox::OP_COALESCE_LATEST);
+    for (unsigned i = 0; i < 6; ++i)
+      mbox.push(makeVoltage(i));
+
+    test.boolean("push() (coalesce latest)", mbox.size() == 1);
+    n = mbox.pop(msgs, 8);
+    test.boolean("pop() (coalesce latest)", n == 1 && msgs[0]->getValueFP() == 5);
+
+    mbox.setOverflowPolicy(id, Tasks::Mailbox::OP_COALESCE_LATEST_BY_SOURCE);
+    for (unsigned i = 0; i < 6; ++i)
+    {
+      IMC::SharedMessage msg = makeVoltage(i);
+      msg.getMutable()->setSourceEntity(i % 2);
+      mbox.push(msg);
+    }
+
+    n = mbox.pop(msgs, 8);
+    test.boolean("pop() (coalesce latest by source)", n == 2
+                 && msgs[0]->getSourceEntity() == 0 && msgs[0]->getValueFP() == 4
+                 && msgs[1]->getSourceEntity() == 1 && msgs[1]->getValueFP() == 5);
+
+    mbox.setOverflowPolicy(id, Tasks::Mailbox::OP_DROP_NEWEST);
+    mbox.push(makeVoltage(1));
+    mbox.setCapacity(16);
+    mbox.push(makeVoltage(2));
+    n = mbox.pop(msgs, 8);
+    test.boolean("setCapacity()", mbox.getCapacity() == 16 && n == 2
+                 && msgs[0]->getValueFP() == 1 && msgs[1]->getValueFP() == 2);
+
+    ordered = true;
+    for (unsigned i = 0; i < 100; ++i)
+    {
+      mbox.push(makeVoltage(i));
+      mbox.push(makeVoltage(i + 1));
+      mbox.setCapacity(8 + (i % 2) * 8);
+      mbox.push(makeVoltage(i + 2));
+      n = mbox.pop(msgs, 2);
+      n += mbox.pop(msgs + 2, 1);
+      ordered = ordered && n == 3 && msgs[0]->getValueFP() == i
+      && msgs[1]->getValueFP() == i + 1 && msgs[2]->getValueFP() == i + 2;
+    }
+    test.boolean("setCapacity() (repeated)", ordered && mbox.empty());
+
+    test.boolean("wait() (timeout)", !mbox.wait(0.01));
+    mbox.push(makeVoltage(3));
+    test.boolean("wait()", mbox.wait(0.01));
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,170 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+class Waker: public Concurrency::Thread
+{
+public:
+  Waker(IO::Reactor& reactor):
+    m_reactor(reactor)
+  { }
+
+private:
+  IO::Reactor& m_reactor;
+
+  void
+  run(void)
+  {
+    Time::Delay::wait(0.05);
+    m_reactor.wakeUp();
+  }
+};
+
+int
+main(void)
+{
+  Test test("IO::Reactor");
+
+  {
+    IO::Reactor reactor;
+    double start = Time::Clock::get();
+    bool rv = reactor.wait(0.05);
+    double elapsed = Time::Clock::get() - start;
+    test.boolean("wait() (timeout)", !rv && elapsed >= 0.04 && !reactor.wasWokenUp());
+
+    reactor.wakeUp();
+    reactor.wakeUp();
+    rv = reactor.wait(1.0);
+    test.boolean("wakeUp() (before wait)", rv && reactor.wasWokenUp()
+                 && reactor.getTriggeredCount() == 0);
+    test.boolean("wakeUp() (coalesced)", !reactor.wait(0.0));
+
+    Waker waker(reactor);
+    start = Time::Clock::get();
+    waker.start();
+    rv = reactor.wait(5.0);
+    elapsed = Time::Clock::get() - start;
+    waker.stopAndJoin();
+    test.boolean("wakeUp() (other thread)", rv && reactor.wasWokenUp() && elapsed < 1.0);
+  }
+
+  {
+    IO::Reactor reactor;
+    Network::UDPSocket rx;
+    Network::UDPSocket tx;
+    uint16_t port = 40000;
+    while (true)
+    {
+      try
+      {
+        rx.bind(port, Network::Address::Loopback, false);
+        break;
+      }
+      catch (std::runtime_error&)
+      {
+        ++port;
+      }
+    }
+
+    reactor.add(rx);
+    test.boolean("add()", reactor.size() == 1 && !reactor.wait(0.01));
+
+    uint8_t data[4] = {1, 2, 3, 4};
+    tx.write(data, sizeof(data), Network::Address::Loopback, port);
+    bool rv = reactor.wait(1.0);
+    test.boolean("wait() (readable)", rv && reactor.wasTriggered(rx)
+                 && !reactor.wasWokenUp());
+
+    uint8_t bfr[4];
+    rx.read(bfr, sizeof(bfr));
+    test.boolean("wait() (drained)", !reactor.wait(0.01));
+
+    tx.write(data, sizeof(data), Network::Address::Loopback, port);
+    reactor.remove(rx);
+    test.boolean("remove()", reactor.size() == 0 && !reactor.wait(0.01));
+  }
+
+  {
+    Network::TCPSocket server;
+    server.bind(0, Network::Address::Loopback);
+    server.listen(1);
+    Network::TCPSocket client;
+    client.connect(Network::Address::Loopback, server.getBoundPort());
+    Network::TCPSocket* peer = server.accept();
+
+    IO::Reactor reactor;
+    reactor.add(*peer);
+    reactor.setWriteInterest(*peer, true);
+    test.boolean("setWriteInterest() (enabled)", reactor.wait(1.0)
+                 && reactor.wasWritable(*peer) && !reactor.wasTriggered(*peer));
+
+    // Fill the send buffer without blocking.
+    std::vector<uint8_t> data(65536, 0xaa);
+    const uint8_t* bfrs[2] = {&data[0], &data[0]};
+    size_t sizes[2] = {data.size(), data.size()};
+    size_t total = 0;
+    size_t rv = 0;
+    while ((rv = peer->writeNonBlocking(bfrs, sizes, 2)) > 0)
+      total += rv;
+    test.boolean("TCPSocket::writeNonBlocking()", total > 0);
+
+    reactor.setWriteInterest(*peer, false);
+    uint8_t bfr[65536];
+    while (total > 0)
+      total -= client.read(bfr, sizeof(bfr));
+    test.boolean("setWriteInterest() (disabled)", !reactor.wait(0.01));
+
+    reactor.remove(*peer);
+    delete peer;
+  }
+
+  {
+    Tasks::Mailbox mbox(4);
+    IO::Reactor reactor;
+    mbox.setReactor(&reactor);
+    mbox.push(IMC::SharedMessage(new IMC::Voltage));
+    test.boolean("Mailbox::push() wakes reactor", reactor.wait(1.0) && reactor.wasWokenUp());
+
+    mbox.setReactor(NULL);
+    mbox.push(IMC::SharedMessage(new IMC::Voltage));
+    test.boolean("Mailbox::setReactor(NULL)", !reactor.wait(0.01));
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,200 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <sstream>
+#include <unistd.h>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Writes a record after a delay.
+class DelayedWriter: public Concurrency::Thread
+{
+public:
+  DelayedWriter(SharedRing& ring):
+    m_ring(ring)
+  { }
+
+  void
+  run(void)
+  {
+    Delay::wait(0.2);
+    uint8_t value = 42;
+    m_ring.write(&value, 1);
+  }
+
+private:
+  SharedRing& m_ring;
+};
+
+int
+main(void)
+{
+  Test test("Concurrency::SharedRing");
+
+  std::ostringstream name;
+  name << "test-ring-" << getpid();
+
+  try
+  {
+    SharedRing writer(name.str().c_str());
+    writer.create(1000);
+    test.boolean("capacity", writer.getMaximumRecordSize() == 1024 / 4 - 4);
+
+    SharedRing reader(name.str().c_str());
+    reader.open();
+
+    uint8_t bfr[256];
+    test.boolean("empty", reader.read(bfr, sizeof(bfr)) == 0);
+    test.boolean("wait timeout", !reader.wait(0.05));
+
+    // Records written in place and copied.
+    uint8_t* rec = writer.reserve(100);
+    std::memcpy(rec, "hello", 5);
+    writer.commit(5);
+    writer.write((const uint8_t*)"world!", 6);
+
+    test.boolean("wait", reader.wait(0.05));
+    unsigned size = reader.read(bfr, sizeof(bfr));
+    test.boolean("read in place record", size == 5 && std::memcmp(bfr, "hello", 5) == 0);
+    size = reader.read(bfr, sizeof(bfr));
+    test.boolean("read copied record", size == 6 && std::memcmp(bfr, "world!", 6) == 0);
+    test.boolean("drained", reader.read(bfr, sizeof(bfr)) == 0);
+
+    // Wrap around the end of the ring many times.
+    bool ok = true;
+    for (unsigned i = 0; i < 200; ++i)
+    {
+      uint8_t data[200];
+      unsigned len = 1 + (i * 37) % sizeof(data);
+      std::memset(data, i, len);
+      writer.write(data, len);
+
+      size = reader.read(bfr, sizeof(bfr));
+      if (size != len || std::memcmp(bfr, data, len) != 0)
+        ok = false;
+    }
+    test.boolean("wrap around", ok && reader.getOverruns() == 0);
+
+    // A second reader attached late sees only new records.
+    SharedRing late(name.str().c_str());
+    late.open();
+    test.boolean("late reader", late.read(bfr, sizeof(bfr)) == 0 && late.getSession() == reader.getSession());
+
+    // Slow readers lose old records and resume at the newest.
+    for (unsigned i = 0; i < 50; ++i)
+      writer.write(bfr, 200);
+    test.boolean("overrun", reader.read(bfr, sizeof(bfr)) == 0 && reader.getOverruns() == 1);
+    writer.write((const uint8_t*)"new", 3);
+    size = reader.read(bfr, sizeof(bfr));
+    test.boolean("resume after overrun", size == 3 && std::memcmp(bfr, "new", 3) == 0);
+
+    // Records larger than the read buffer are skipped.
+    SharedRing small(name.str().c_str());
+    small.open();
+    uint8_t large[200] = {0};
+    writer.write(large, sizeof(large));
+    writer.write((const uint8_t*)"x", 1);
+    size = small.read(bfr, 100);
+    test.boolean("large record skipped", size == 1 && bfr[0] == 'x' && small.getOverruns() == 1);
+
+    // Readers are woken up by the writer.
+    while (reader.read(bfr, sizeof(bfr)) != 0);
+    DelayedWriter thread(writer);
+    double start = Clock::get();
+    thread.start();
+    bool woken = reader.wait(5.0);
+    double elapsed = Clock::get() - start;
+    thread.stopAndJoin();
+    test.boolean("wake up", woken && elapsed < 2.0 && reader.read(bfr, sizeof(bfr)) == 1 && bfr[0] == 42);
+
+    bool thrown = false;
+    try
+    {
+      writer.reserve(writer.getMaximumRecordSize() + 1);
+    }
+    catch (std::runtime_error& e)
+    {
+      thrown = true;
+    }
+    test.boolean("record too large", thrown);
+
+  }
+  catch (std::exception& e)
+  {
+    test.failed(String::str("run: %s", e.what()).c_str());
+  }
+
+  {
+    bool thrown = false;
+    try
+    {
+      SharedRing missing("test-ring-missing");
+      missing.open();
+    }
+    catch (std::exception& e)
+    {
+      thrown = true;
+    }
+    test.boolean("missing ring", thrown);
+  }
+
+  try
+  {
+    // A new writer replaces the ring, readers of the old one are
+    // told when it goes away.
+    SharedRing* writer = new SharedRing(name.str().c_str());
+    writer->create(1024);
+    SharedRing reader(name.str().c_str());
+    reader.open();
+    uint64_t session = reader.getSession();
+    delete writer;
+    test.boolean("closed", reader.isClosed() && !reader.wait(1.0));
+
+    writer = new SharedRing(name.str().c_str());
+    writer->create(1024);
+    SharedRing replacement(name.str().c_str());
+    replacement.open();
+    test.boolean("new session", !replacement.isClosed() && replacement.getSession() != session);
+    delete writer;
+  }
+  catch (std::exception& e)
+  {
+    test.failed(String::str("run: %s", e.what()).c_str());
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,199 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Create a state.
+static IMC::EstimatedState
+makeState(double time, double x, double psi = 0.0)
+{
+  IMC::EstimatedState state;
+  state.setTimeStamp(time);
+  state.lat = 0.71;
+  state.lon = -0.15;
+  state.x = x;
+  state.u = x;
+  state.psi = psi;
+  state.alt = 10.0;
+  return state;
+}
+
+//! Check if two values are close.
+static bool
+near(double a, double b, double tolerance = 1e-4)
+{
+  return std::fabs(a - b) <= tolerance;
+}
+
+//! Adds states whose position is equal to their timestamp.
+class Writer: public Concurrency::Thread
+{
+public:
+  Writer(Navigation::StateHistory& history, unsigned count):
+    m_history(history),
+    m_count(count)
+  { }
+
+private:
+  Navigation::StateHistory& m_history;
+  unsigned m_count;
+
+  void
+  run(void)
+  {
+    for (unsigned i = 1; i <= m_count; ++i)
+      m_history.push(makeState(i, i));
+  }
+};
+
+int
+main(void)
+{
+  Test test("Navigation::StateHistory");
+
+  {
+    Navigation::StateHistory history(16);
+    IMC::EstimatedState state;
+    double delta = 0;
+    test.boolean("interpolate() (empty)", !history.interpolate(1.0, state) && history.empty());
+    test.boolean("nearest() (empty)", !history.nearest(1.0, state, delta));
+
+    history.push(makeState(10.0, 0.0));
+    history.push(makeState(10.5, 5.0));
+    history.push(makeState(11.0, 6.0));
+    test.boolean("push() (out of order)", !history.push(makeState(10.8, 0.0))
+                 && !history.push(makeState(11.0, 0.0)) && history.size() == 3);
+
+    test.boolean("interpolate()", history.interpolate(10.25, state)
+                 && near(state.x, 2.5) && near(state.u, 2.5)
+                 && near(state.getTimeStamp(), 10.25) && near(state.lat, 0.71));
+    test.boolean("interpolate() (exact)", history.interpolate(10.5, state) && near(state.x, 5.0));
+    test.boolean("interpolate() (newest)", history.interpolate(11.0, state) && near(state.x, 6.0));
+    test.boolean("interpolate() (no extrapolation)", !history.interpolate(9.9, state)
+                 && !history.interpolate(11.1, state));
+
+    test.boolean("nearest()", history.nearest(10.7, state, delta)
+                 && near(state.x, 5.0) && near(delta, -0.2));
+    test.boolean("nearest() (after newest)", history.nearest(11.5, state, delta)
+                 && near(state.x, 6.0) && near(delta, -0.5));
+    test.boolean("nearest() (maximum gap)", !history.nearest(12.5, state, delta));
+
+    history.push(makeState(13.0, 7.0));
+    test.boolean("interpolate() (maximum gap)", !history.interpolate(12.0, state));
+
+    history.clear();
+    test.boolean("clear()", history.empty() && !history.interpolate(10.5, state)
+                 && history.push(makeState(1.0, 0.0)));
+  }
+
+  {
+    Navigation::StateHistory history(16);
+    IMC::EstimatedState state;
+    history.push(makeState(1.0, 0.0, Math::c_pi - 0.1));
+    history.push(makeState(2.0, 0.0, -Math::c_pi + 0.1));
+    history.interpolate(1.5, state);
+    test.boolean("interpolate() (yaw wrap)", near(std::fabs(state.psi), Math::c_pi, 1e-3));
+
+    history.clear();
+    IMC::EstimatedState a = makeState(3.0, 0.0, 1.0);
+    IMC::EstimatedState b = makeState(4.0, 0.0, 1.0);
+    a.phi = 0.2;
+    b.phi = 0.6;
+    a.theta = 0.1;
+    b.theta = 0.1;
+    history.push(a);
+    history.push(b);
+    history.interpolate(3.75, state);
+    test.boolean("interpolate() (attitude)", near(state.phi, 0.5)
+                 && near(state.theta, 0.1) && near(state.psi, 1.0));
+  }
+
+  {
+    Navigation::StateHistory history(16);
+    IMC::EstimatedState state;
+    IMC::EstimatedState a = makeState(1.0, 0.0);
+    IMC::EstimatedState b = makeState(2.0, 0.0);
+    Coordinates::WGS84::displace(10.0, 0.0, &b.lat, &b.lon);
+    history.push(a);
+    history.push(b);
+    test.boolean("interpolate() (new reference)", history.interpolate(1.5, state)
+                 && near(state.x, 5.0, 0.01) && near(state.y, 0.0, 0.01)
+                 && state.lat == a.lat);
+  }
+
+  {
+    Navigation::StateHistory history(16);
+    IMC::EstimatedState state;
+    for (unsigned i = 1; i <= 1000; ++i)
+      history.push(makeState(i, i));
+
+    test.boolean("size() (bounded)", history.size() == 16);
+    test.boolean("interpolate() (dropped)", !history.interpolate(900.5, state)
+                 && history.interpolate(990.5, state) && near(state.x, 990.5));
+  }
+
+  {
+    const unsigned count = 200000;
+    Navigation::StateHistory history(64);
+    Writer writer(history, count);
+    writer.start();
+
+    bool consistent = true;
+    unsigned lookups = 0;
+    while (!writer.isDead() || lookups == 0)
+    {
+      IMC::EstimatedState state;
+      double delta = 0;
+      if (!history.nearest(count, state, delta))
+        continue;
+
+      double time = state.getTimeStamp() - 10.5;
+      if (time < 1.0)
+        continue;
+
+      ++lookups;
+      if (history.interpolate(time, state) && !near(state.x, time))
+        consistent = false;
+    }
+
+    writer.join();
+    test.boolean("interpolate() (concurrent writer)", consistent && lookups > 0);
+  }
+
+  return test.getReturnValue();
+}
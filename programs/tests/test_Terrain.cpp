@@ -0,0 +1,167 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+#include <DUNE/Simulation/Terrain.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Sloped bottom, depth grows northwards.
+static double
+slope(double x, double y)
+{
+  (void)y;
+  return 10.0 + 0.1 * x;
+}
+
+int
+main(void)
+{
+  Test test("Simulation::Terrain");
+
+  // Regular samples every meter over 100 x 50 m, with a 3 m hole.
+  std::vector<Simulation::Terrain::Sample> samples;
+  for (int x = 0; x <= 100; ++x)
+  {
+    for (int y = 0; y <= 50; ++y)
+    {
+      if (x >= 40 && x <= 42 && y >= 20 && y <= 22)
+        continue;
+
+      Simulation::Terrain::Sample sample;
+      sample.x = x;
+      sample.y = y;
+      sample.depth = slope(x, y);
+      samples.push_back(sample);
+    }
+  }
+
+  Simulation::Terrain terrain;
+  terrain.build(samples, 1.0, 2.0);
+  terrain.setReference(0.7, -0.15);
+
+  {
+    bool ok = true;
+    double depth = 0;
+    for (double x = 0; x <= 100; x += 0.37)
+    {
+      ok = ok && terrain.depthAt(x, 7.3, depth)
+      && std::fabs(depth - slope(x, 7.3)) < 1e-4;
+    }
+    test.boolean("depthAt() (bilinear)", ok);
+  }
+
+  {
+    double depth = 0;
+    bool ok = terrain.depthAt(41.0, 21.0, depth) && std::fabs(depth - slope(41.0, 21.0)) <= 0.2 + 1e-4;
+    test.boolean("depthAt() (filled hole)", ok);
+  }
+
+  {
+    double depth = 0;
+    test.boolean("depthAt() (out of bounds)",
+                 !terrain.depthAt(-5.0, 10.0, depth) && !terrain.depthAt(10.0, 60.0, depth));
+  }
+
+  {
+    // Horizontal ray at 15 m depth heading south meets the bottom
+    // 50 m away.
+    double range = 0;
+    bool hit = terrain.rayCast(100, 10, 15, -1, 0, 0, 100, range);
+    test.boolean("rayCast() (hit)", hit && std::fabs(range - 50.0) < 0.05);
+
+    hit = terrain.rayCast(100, 10, 15, -1, 0, 0, 30, range);
+    test.boolean("rayCast() (out of range)", !hit);
+  }
+
+  Path file = Path("/tmp") / "test_Terrain.dtr";
+  terrain.save(file.str());
+
+  {
+    Simulation::Terrain loaded;
+    loaded.load(file.str());
+
+    bool ok = loaded.getRows() == terrain.getRows()
+    && loaded.getColumns() == terrain.getColumns()
+    && loaded.getReferenceLatitude() == 0.7
+    && loaded.getReferenceLongitude() == -0.15
+    && loaded.getRequestedCellSize() == 1.0
+    && loaded.getInterpolationRadius() == 2.0
+    && !Path(file.str() + ".tmp").exists();
+
+    double a = 0;
+    double b = 0;
+    for (double x = 0; x <= 100; x += 3.1)
+    {
+      ok = ok && loaded.depthAt(x, 33.3, a) && terrain.depthAt(x, 33.3, b) && a == b;
+    }
+
+#if defined(DUNE_SYS_HAS_MMAP)
+    ok = ok && loaded.isMapped();
+#endif
+    test.boolean("load()", ok);
+  }
+
+  {
+    // Keep the header and part of the nodes.
+    std::ifstream ifs(file.c_str(), std::ios::binary);
+    std::vector<char> data(1000);
+    ifs.read(&data[0], data.size());
+    ifs.close();
+
+    std::ofstream ofs(file.c_str(), std::ios::binary);
+    ofs.write(&data[0], data.size());
+    ofs.close();
+
+    bool thrown = false;
+    try
+    {
+      Simulation::Terrain loaded;
+      loaded.load(file.str());
+    }
+    catch (Simulation::Terrain::Error&)
+    {
+      thrown = true;
+    }
+    test.boolean("load() (truncated)", thrown);
+  }
+
+  file.remove();
+
+  return test.getReturnValue();
+}
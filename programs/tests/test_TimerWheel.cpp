@@ -0,0 +1,331 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+//! Timer that records its expirations.
+class Recorder: public Tasks::TimerWheel::Timer
+{
+public:
+  Recorder(double period = -1.0):
+    m_period(period),
+    m_count(0),
+    m_early(false),
+    m_time(0)
+  { }
+
+  int
+  getCount(void)
+  {
+    return m_count.value();
+  }
+
+  bool
+  expiredEarly(void) const
+  {
+    return m_early;
+  }
+
+  double
+  getTime(void) const
+  {
+    return m_time;
+  }
+
+private:
+  double m_period;
+  Concurrency::AtomicCounter m_count;
+  bool m_early;
+  double m_time;
+
+  double
+  onExpiry(double deadline)
+  {
+    m_time = Time::Clock::get();
+    if (m_time < deadline)
+      m_early = true;
+
+    m_count.add(1);
+    return (m_period > 0) ? (deadline + m_period) : -1.0;
+  }
+};
+
+//! Timer that schedules another timer on the same wheel.
+class Chainer: public Tasks::TimerWheel::Timer
+{
+public:
+  Chainer(Tasks::TimerWheel& wheel, Tasks::TimerWheel::Timer& next):
+    m_wheel(wheel),
+    m_next(next)
+  { }
+
+private:
+  Tasks::TimerWheel& m_wheel;
+  Tasks::TimerWheel::Timer& m_next;
+
+  double
+  onExpiry(double deadline)
+  {
+    m_wheel.schedule(&m_next, deadline + 0.05);
+    return -1.0;
+  }
+};
+
+//! Timer that takes a while to expire.
+class Sleeper: public Tasks::TimerWheel::Timer
+{
+public:
+  Sleeper(void):
+    m_started(0),
+    m_finished(0)
+  { }
+
+  bool
+  isStarted(void)
+  {
+    return m_started.value() != 0;
+  }
+
+  bool
+  isFinished(void)
+  {
+    return m_finished.value() != 0;
+  }
+
+private:
+  Concurrency::AtomicCounter m_started;
+  Concurrency::AtomicCounter m_finished;
+
+  double
+  onExpiry(double deadline)
+  {
+    m_started.add(1);
+    Time::Delay::wait(0.2);
+    m_finished.add(1);
+    return deadline + 0.01;
+  }
+};
+
+//! Periodic task that counts cycles and messages.
+class Ticker: public Tasks::Periodic
+{
+public:
+  Ticker(Tasks::Context& ctx, const std::string& name, double stall = 0):
+    Tasks::Periodic(name, ctx),
+    m_msg_time(0),
+    m_stall(stall)
+  {
+    bind<IMC::Voltage>(this);
+  }
+
+  void
+  consume(const IMC::Voltage* msg)
+  {
+    (void)msg;
+    m_msg_time = Time::Clock::get();
+  }
+
+  void
+  task(void)
+  {
+    if (m_stall > 0)
+    {
+      Time::Delay::wait(m_stall);
+      m_stall = 0;
+    }
+  }
+
+  double
+  getMessageTime(void) const
+  {
+    return m_msg_time;
+  }
+
+private:
+  double m_msg_time;
+  double m_stall;
+};
+
+int
+main(void)
+{
+  Test test("Tasks::TimerWheel");
+
+  {
+    Tasks::TimerWheel wheel;
+    double now = Time::Clock::get();
+
+    // Deadlines spanning the first two levels of the wheel.
+    std::vector<Recorder*> timers;
+    for (unsigned i = 0; i < 20; ++i)
+    {
+      timers.push_back(new Recorder);
+      wheel.schedule(timers.back(), now + 0.05 * i);
+    }
+
+    Recorder cancelled;
+    wheel.schedule(&cancelled, now + 0.2);
+    wheel.schedule(&cancelled, now + 0.3);
+    test.boolean("getCount()", wheel.getCount() == 21);
+    wheel.cancel(&cancelled);
+
+    Time::Delay::wait(1.2);
+
+    bool all = true;
+    bool early = false;
+    bool order = true;
+    for (unsigned i = 0; i < timers.size(); ++i)
+    {
+      all = all && (timers[i]->getCount() == 1);
+      early = early || timers[i]->expiredEarly();
+      if (i > 0 && timers[i]->getTime() < timers[i - 1]->getTime())
+        order = false;
+    }
+
+    test.boolean("schedule() (all expired once)", all);
+    test.boolean("schedule() (never early)", !early);
+    test.boolean("schedule() (in order)", order);
+    test.boolean("cancel()", cancelled.getCount() == 0);
+    test.boolean("getCount() (empty)", wheel.getCount() == 0);
+
+    for (unsigned i = 0; i < timers.size(); ++i)
+      delete timers[i];
+  }
+
+  {
+    Tasks::TimerWheel wheel;
+    Recorder periodic(0.01);
+    wheel.schedule(&periodic, Time::Clock::get() + 0.01);
+    Time::Delay::wait(0.5);
+    wheel.cancel(&periodic);
+
+    int count = periodic.getCount();
+    test.boolean("periodic timer", count >= 45 && count <= 50);
+  }
+
+  {
+    Tasks::TimerWheel wheel;
+    Recorder far;
+    wheel.schedule(&far, Time::Clock::get() + 3600.0);
+    Time::Delay::wait(0.3);
+    test.boolean("distant deadline", far.getCount() == 0 && wheel.getCount() == 1);
+    wheel.cancel(&far);
+  }
+
+  {
+    Tasks::TimerWheel wheel;
+    Recorder last;
+    Chainer first(wheel, last);
+    wheel.schedule(&first, Time::Clock::get() + 0.01);
+    Time::Delay::wait(0.3);
+    test.boolean("schedule() (from a timer)", last.getCount() == 1);
+  }
+
+  {
+    Tasks::TimerWheel wheel;
+    Sleeper slow;
+    Recorder fast(0.01);
+    wheel.schedule(&slow, Time::Clock::get() + 0.01);
+    wheel.schedule(&fast, Time::Clock::get() + 0.02);
+
+    while (!slow.isStarted())
+      Time::Delay::wait(0.001);
+
+    wheel.cancel(&fast);
+    wheel.cancel(&slow);
+    test.boolean("cancel() (waits for expiry)", slow.isFinished());
+    test.boolean("cancel() (not rearmed)", wheel.getCount() == 0);
+  }
+
+  Tasks::Context ctx;
+  Tasks::TimerWheel timers;
+  ctx.timers = &timers;
+  ctx.config.set("Ticker", "Execution Frequency", "50");
+  ctx.config.set("Waker", "Execution Frequency", "1");
+  ctx.config.set("Waker", "Wake On Messages", "true");
+  ctx.config.set("Catcher", "Execution Frequency", "50");
+  ctx.config.set("Catcher", "Skip Late Cycles", "false");
+
+  {
+    Ticker task(ctx, "Ticker");
+    task.loadConfig();
+    task.start();
+    Time::Delay::wait(0.5);
+    task.stopAndJoin();
+
+    unsigned count = task.getRunCount();
+    test.boolean("Periodic (rate)", count >= 20 && count <= 25);
+
+    Tasks::Periodic::Jitter jitter = task.takeJitter();
+    test.boolean("Periodic (jitter)", jitter.count >= count && jitter.max >= jitter.mean);
+  }
+
+  {
+    Ticker task(ctx, "Waker");
+    task.loadConfig();
+    task.start();
+    Time::Delay::wait(0.1);
+
+    IMC::Voltage msg;
+    double sent = Time::Clock::get();
+    ctx.mbus.dispatch(&msg);
+    Time::Delay::wait(0.2);
+    task.stopAndJoin();
+
+    double latency = task.getMessageTime() - sent;
+    test.boolean("Periodic (wake on messages)", latency >= 0 && latency < 0.1);
+    test.boolean("Periodic (wake on messages, rate)", task.getRunCount() == 0);
+  }
+
+  {
+    Ticker task(ctx, "Catcher", 0.1);
+    task.loadConfig();
+    task.start();
+    Time::Delay::wait(0.5);
+    task.stopAndJoin();
+
+    unsigned count = task.getRunCount();
+    Tasks::Periodic::Jitter jitter = task.takeJitter();
+    test.boolean("Periodic (catch up)", count >= 20 && count <= 25 && jitter.overruns == 0);
+  }
+
+  ctx.timers = NULL;
+
+  return test.getReturnValue();
+}
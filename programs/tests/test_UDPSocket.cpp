@@ -0,0 +1,133 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <stdexcept>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/IO/Poll.hpp>
+#include <DUNE/Network.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+using namespace DUNE::Network;
+
+//! Bind a socket to the first free loopback port.
+static uint16_t
+bindLoopback(UDPSocket& sock, uint16_t port)
+{
+  while (true)
+  {
+    try
+    {
+      sock.bind(port, Address::Loopback, false);
+      return port;
+    }
+    catch (std::runtime_error&)
+    {
+      ++port;
+    }
+  }
+}
+
+int
+main(void)
+{
+  Test test("Network::UDPSocket");
+
+  UDPSocket tx;
+  UDPSocket rx_a;
+  UDPSocket rx_b;
+  uint16_t port_tx = bindLoopback(tx, 41000);
+  uint16_t port_a = bindLoopback(rx_a, port_tx + 1);
+  uint16_t port_b = bindLoopback(rx_b, port_a + 1);
+
+  {
+    uint8_t data[3] = {7, 8, 9};
+    Address addrs[3] = {Address::Loopback, Address::Loopback, Address::Loopback};
+    uint16_t ports[3] = {port_a, port_b, port_a};
+    unsigned sent = tx.writeMultiple(data, sizeof(data), addrs, ports, 3);
+    test.boolean("writeMultiple()", sent == 3);
+  }
+
+  {
+    std::vector<uint8_t> storage(4 * 16);
+    uint8_t* bfrs[4];
+    size_t sizes[4];
+    Address addrs[4];
+    uint16_t ports[4];
+    for (unsigned i = 0; i < 4; ++i)
+      bfrs[i] = &storage[i * 16];
+
+    IO::Poll::poll(rx_a, 1.0);
+    unsigned count = 0;
+    for (unsigned i = 0; i < 10 && count < 2; ++i)
+    {
+      count += rx_a.readMultiple(bfrs + count, 16, sizes + count, addrs + count, ports + count, 4 - count);
+      if (count < 2)
+        IO::Poll::poll(rx_a, 0.1);
+    }
+
+    test.boolean("readMultiple() (count)", count == 2);
+    test.boolean("readMultiple() (data)", sizes[0] == 3 && bfrs[0][0] == 7 && bfrs[1][2] == 9);
+    test.boolean("readMultiple() (source)", ports[0] == port_tx && addrs[1] == Address::Loopback);
+    test.boolean("readMultiple() (empty)", rx_a.readMultiple(bfrs, 16, sizes, NULL, NULL, 4) == 0);
+
+    IO::Poll::poll(rx_b, 1.0);
+    test.boolean("readMultiple() (single)", rx_b.readMultiple(bfrs, 16, sizes, NULL, NULL, 4) == 1);
+  }
+
+  {
+    UDPSocket rx;
+    uint16_t port = bindLoopback(rx, port_b + 1);
+    bool counter = rx.enableDropCounter();
+
+    // Overflow the receive buffer.
+    std::vector<uint8_t> data(8192, 0);
+    for (unsigned i = 0; i < 4096; ++i)
+      tx.write(&data[0], data.size(), Address::Loopback, port);
+
+    uint8_t* bfrs[1] = {&data[0]};
+    size_t sizes[1];
+    while (rx.readMultiple(bfrs, data.size(), sizes, NULL, NULL, 1) > 0)
+    { }
+
+    // The count is reported with datagrams queued after the drops.
+    tx.write(&data[0], 1, Address::Loopback, port);
+    IO::Poll::poll(rx, 1.0);
+    rx.readMultiple(bfrs, data.size(), sizes, NULL, NULL, 1);
+
+    test.boolean("getDropCount()", !counter || rx.getDropCount() > 0);
+  }
+
+  return test.getReturnValue();
+}
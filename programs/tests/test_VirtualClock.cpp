@@ -0,0 +1,278 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Periodic participant.
+class Sleeper: public Concurrency::Thread
+{
+public:
+  Sleeper(double period, unsigned count):
+    m_period(period),
+    m_count(count),
+    m_end(0)
+  {
+    Time::Clock::reserve();
+  }
+
+  double
+  getEnd(void) const
+  {
+    return m_end;
+  }
+
+private:
+  double m_period;
+  unsigned m_count;
+  double m_end;
+
+  void
+  run(void)
+  {
+    Time::Clock::attach();
+
+    for (unsigned i = 0; i < m_count; ++i)
+      Time::Delay::wait(m_period);
+
+    m_end = Time::Clock::get();
+    Time::Clock::detach();
+  }
+};
+
+//! Participant waiting for a condition with a timeout.
+class Waiter: public Concurrency::Thread
+{
+public:
+  Waiter(Concurrency::Condition& cond, double timeout):
+    signaled(false),
+    end(0),
+    m_cond(cond),
+    m_timeout(timeout)
+  {
+    Time::Clock::reserve();
+  }
+
+  bool signaled;
+  double end;
+
+private:
+  Concurrency::Condition& m_cond;
+  double m_timeout;
+
+  void
+  run(void)
+  {
+    Time::Clock::attach();
+
+    m_cond.lock();
+    signaled = m_cond.wait(m_timeout);
+    m_cond.unlock();
+
+    end = Time::Clock::get();
+    Time::Clock::detach();
+  }
+};
+
+//! Participant signaling a condition after a delay.
+class Signaler: public Concurrency::Thread
+{
+public:
+  Signaler(Concurrency::Condition& cond, double delay):
+    m_cond(cond),
+    m_delay(delay)
+  {
+    Time::Clock::reserve();
+  }
+
+private:
+  Concurrency::Condition& m_cond;
+  double m_delay;
+
+  void
+  run(void)
+  {
+    Time::Clock::attach();
+    Time::Delay::wait(m_delay);
+
+    m_cond.lock();
+    m_cond.signal();
+    m_cond.unlock();
+
+    Time::Clock::detach();
+  }
+};
+
+//! Participant waiting on an I/O reactor with a timeout.
+class ReactorWaiter: public Concurrency::Thread
+{
+public:
+  ReactorWaiter(IO::Reactor& reactor, double timeout):
+    woken(false),
+    end(0),
+    m_reactor(reactor),
+    m_timeout(timeout)
+  {
+    Time::Clock::reserve();
+  }
+
+  bool woken;
+  double end;
+
+private:
+  IO::Reactor& m_reactor;
+  double m_timeout;
+
+  void
+  run(void)
+  {
+    Time::Clock::attach();
+    woken = m_reactor.wait(m_timeout) && m_reactor.wasWokenUp();
+    end = Time::Clock::get();
+    Time::Clock::detach();
+  }
+};
+
+//! Participant waking up an I/O reactor after a delay.
+class ReactorSignaler: public Concurrency::Thread
+{
+public:
+  ReactorSignaler(IO::Reactor& reactor, double delay):
+    m_reactor(reactor),
+    m_delay(delay)
+  {
+    Time::Clock::reserve();
+  }
+
+private:
+  IO::Reactor& m_reactor;
+  double m_delay;
+
+  void
+  run(void)
+  {
+    Time::Clock::attach();
+    Time::Delay::wait(m_delay);
+    m_reactor.wakeUp();
+    Time::Clock::detach();
+  }
+};
+
+int
+main(void)
+{
+  Test test("Time::VirtualClock");
+
+  Time::VirtualClock clock(1000.0);
+  Time::Clock::setSource(&clock);
+
+  double real = Time::Clock::getSystemNsec() / Time::c_nsec_per_sec_fp;
+
+  {
+    double start = Time::Clock::get();
+    Time::Delay::wait(3600.0);
+    double elapsed = Time::Clock::get() - start;
+    test.boolean("Delay::wait() (no participants)", elapsed >= 3600.0 && elapsed < 3600.001);
+    test.boolean("Clock::getSinceEpoch()", Time::Clock::getSinceEpoch() >= 4600.0);
+  }
+
+  {
+    double start = Time::Clock::get();
+    Sleeper a(0.1, 1000);
+    Sleeper b(0.25, 200);
+    a.start();
+    b.start();
+    a.join();
+    b.join();
+
+    test.boolean("Delay::wait() (participants)",
+                 std::fabs(a.getEnd() - start - 100.0) < 0.01
+                 && std::fabs(b.getEnd() - start - 50.0) < 0.01);
+  }
+
+  {
+    Concurrency::Condition cond;
+    double start = Time::Clock::get();
+
+    Waiter waiter(cond, 10.0);
+    Signaler signaler(cond, 1.0);
+    waiter.start();
+    signaler.start();
+    waiter.join();
+    signaler.join();
+
+    test.boolean("Condition::wait() (signaled)",
+                 waiter.signaled && std::fabs(waiter.end - start - 1.0) < 0.01);
+
+    Waiter timeout(cond, 5.0);
+    start = Time::Clock::get();
+    timeout.start();
+    timeout.join();
+
+    test.boolean("Condition::wait() (timeout)",
+                 !timeout.signaled && std::fabs(timeout.end - start - 5.0) < 0.01);
+  }
+
+  {
+    IO::Reactor reactor;
+    double start = Time::Clock::get();
+
+    ReactorWaiter waiter(reactor, 10.0);
+    ReactorSignaler signaler(reactor, 2.0);
+    waiter.start();
+    signaler.start();
+    waiter.join();
+    signaler.join();
+
+    test.boolean("Reactor::wait() (woken up)",
+                 waiter.woken && std::fabs(waiter.end - start - 2.0) < 0.01);
+
+    ReactorWaiter timeout(reactor, 30.0);
+    start = Time::Clock::get();
+    timeout.start();
+    timeout.join();
+
+    test.boolean("Reactor::wait() (timeout)",
+                 !timeout.woken && std::fabs(timeout.end - start - 30.0) < 0.01);
+  }
+
+  test.boolean("VirtualClock::getBusyCount()", clock.getBusyCount() == 0);
+
+  real = Time::Clock::getSystemNsec() / Time::c_nsec_per_sec_fp - real;
+  test.boolean("faster than real time", real < 10.0);
+
+  Time::Clock::setSource(NULL);
+
+  return test.getReturnValue();
+}
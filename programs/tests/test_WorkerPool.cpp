@@ -0,0 +1,201 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+//! Task that counts received messages.
+class Counter: public Tasks::Task
+{
+public:
+  Counter(Tasks::Context& ctx):
+    Tasks::Task("Counter", ctx),
+    m_count(0)
+  {
+    bind<IMC::Voltage>(this);
+  }
+
+  void
+  consume(const IMC::Voltage* msg)
+  {
+    (void)msg;
+    m_count.add(1);
+  }
+
+  int
+  getCount(void)
+  {
+    return m_count.value();
+  }
+
+private:
+  Concurrency::AtomicCounter m_count;
+
+  bool
+  isPoolable(void) const
+  {
+    return true;
+  }
+
+  void
+  onMain(void)
+  {
+    while (!stopping())
+      waitForMessages(1.0);
+  }
+};
+
+//! Periodic task that counts cycles.
+class Ticker: public Tasks::Periodic
+{
+public:
+  Ticker(Tasks::Context& ctx):
+    Tasks::Periodic("Ticker", ctx)
+  { }
+
+  void
+  task(void)
+  { }
+};
+
+//! Wait until a task received a given number of messages.
+static bool
+waitCount(Counter& task, int count)
+{
+  for (unsigned i = 0; i < 500; ++i)
+  {
+    if (task.getCount() >= count)
+      return true;
+    Time::Delay::wait(0.01);
+  }
+
+  return false;
+}
+
+int
+main(void)
+{
+  Test test("Tasks::WorkerPool");
+
+  Tasks::Context ctx;
+  ctx.config.set("Counter", "Execution Mode", "Pool");
+  ctx.config.set("Ticker", "Execution Mode", "Pool");
+  ctx.config.set("Ticker", "Execution Frequency", "50");
+
+  {
+    Counter task(ctx);
+    task.loadConfig();
+    test.boolean("no pool: dedicated thread", !task.isPooled());
+  }
+
+  Tasks::TimerWheel timers;
+  ctx.timers = &timers;
+
+  Tasks::WorkerPool* pool = new Tasks::WorkerPool(2, timers);
+  ctx.workers = pool;
+  test.boolean("getSize()", pool->getSize() == 2);
+
+  {
+    Counter task(ctx);
+    task.loadConfig();
+    test.boolean("pool mode", task.isPooled());
+
+    task.start();
+    test.boolean("running", task.isRunning());
+
+    IMC::Voltage msg;
+    for (unsigned i = 0; i < 100; ++i)
+      ctx.mbus.dispatch(&msg);
+    test.boolean("message events", waitCount(task, 100));
+
+    Tasks::Task::QueueLatency latency = task.takeQueueLatency();
+    test.boolean("queue latency", latency.count > 0 && latency.max >= latency.mean);
+    test.boolean("queue latency reset", task.takeQueueLatency().count == 0);
+
+    task.stopAndJoin();
+    test.boolean("stopped", task.isDead());
+
+    ctx.mbus.dispatch(&msg);
+    Time::Delay::wait(0.1);
+    test.boolean("no steps after stop", task.getCount() == 100);
+  }
+
+  {
+    Ticker task(ctx);
+    task.loadConfig();
+    test.boolean("periodic: pool mode", task.isPooled());
+
+    task.start();
+    Time::Delay::wait(0.5);
+    task.stopAndJoin();
+
+    unsigned count = task.getRunCount();
+    test.boolean("periodic: timer events", count >= 15 && count <= 30);
+  }
+
+  {
+    std::vector<Counter*> tasks;
+    for (unsigned i = 0; i < 8; ++i)
+    {
+      tasks.push_back(new Counter(ctx));
+      tasks.back()->loadConfig();
+      tasks.back()->start();
+    }
+
+    IMC::Voltage msg;
+    for (unsigned i = 0; i < 1000; ++i)
+      ctx.mbus.dispatch(&msg);
+
+    bool ok = true;
+    for (unsigned i = 0; i < tasks.size(); ++i)
+      ok = waitCount(*tasks[i], 1000) && ok;
+    test.boolean("many tasks", ok);
+
+    for (unsigned i = 0; i < tasks.size(); ++i)
+      tasks[i]->stop();
+
+    for (unsigned i = 0; i < tasks.size(); ++i)
+    {
+      tasks[i]->join();
+      delete tasks[i];
+    }
+  }
+
+  ctx.workers = NULL;
+  delete pool;
+  ctx.timers = NULL;
+
+  return test.getReturnValue();
+}
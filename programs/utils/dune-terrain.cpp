@@ -0,0 +1,131 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+#include <DUNE/Simulation/Terrain.hpp>
+
+using DUNE_NAMESPACES;
+
+//! Read scattered samples from a text file, one "x y depth" triplet
+//! per line.
+static void
+readXYZ(const char* file, std::vector<Simulation::Terrain::Sample>& samples)
+{
+  std::ifstream ifs(file);
+  if (!ifs.is_open())
+    throw std::runtime_error(String::str("failed to open %s", file));
+
+  std::string line;
+  while (std::getline(ifs, line))
+  {
+    if (line.empty() || line[0] == '#')
+      continue;
+
+    Simulation::Terrain::Sample sample;
+    if (std::sscanf(line.c_str(), "%lf %lf %lf", &sample.x, &sample.y, &sample.depth) != 3)
+      throw std::runtime_error(String::str("invalid line: %s", line.c_str()));
+
+    samples.push_back(sample);
+  }
+}
+
+//! Read scattered samples and reference from a bathymetry INI file.
+static void
+readINI(const char* file, std::vector<Simulation::Terrain::Sample>& samples,
+        double& lat, double& lon)
+{
+  Parsers::Config cfg(file);
+  std::vector<std::string> lines;
+  cfg.get("Bathymetry", "Data", "", lines);
+  cfg.get("Bathymetry", "Latitude (degrees)", "", lat);
+  cfg.get("Bathymetry", "Longitude (degrees)", "", lon);
+
+  samples.resize(lines.size());
+  for (size_t i = 0; i < lines.size(); ++i)
+  {
+    if (std::sscanf(lines[i].c_str(), "%lf %lf %lf", &samples[i].x,
+                    &samples[i].y, &samples[i].depth) != 3)
+      throw std::runtime_error(String::str("invalid line: %s", lines[i].c_str()));
+  }
+}
+
+int
+main(int argc, char** argv)
+{
+  if (argc < 3)
+  {
+    std::cerr << "Usage: " << argv[0]
+              << " <bathymetry.ini|samples.xyz> <terrain.dtr> [cell size] [radius]"
+              << " [latitude longitude]" << std::endl
+              << "  cell size  grid spacing in meters, 0 to derive it from the data (default 0)" << std::endl
+              << "  radius     maximum distance between a node and its sample (default 10)" << std::endl
+              << "  latitude   reference in degrees, XYZ input only" << std::endl
+              << "  longitude  reference in degrees, XYZ input only" << std::endl;
+    return 1;
+  }
+
+  double cell = (argc > 3) ? std::atof(argv[3]) : 0.0;
+  double radius = (argc > 4) ? std::atof(argv[4]) : 10.0;
+  double lat = (argc > 6) ? std::atof(argv[5]) : 0.0;
+  double lon = (argc > 6) ? std::atof(argv[6]) : 0.0;
+
+  try
+  {
+    std::vector<Simulation::Terrain::Sample> samples;
+    if (String::endsWith(argv[1], ".ini"))
+      readINI(argv[1], samples, lat, lon);
+    else
+      readXYZ(argv[1], samples);
+
+    Simulation::Terrain terrain;
+    terrain.build(samples, cell, radius);
+    terrain.setReference(Angles::radians(lat), Angles::radians(lon));
+    terrain.save(argv[2]);
+
+    std::cerr << samples.size() << " samples, " << terrain.getRows() << " x "
+              << terrain.getColumns() << " nodes of " << terrain.getCellSize()
+              << " m" << std::endl;
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -78,6 +78,8 @@ namespace Control
       {
         //! Desired actuation torque vector.
         IMC::DesiredControl m_torques;
+        //! Gain matrix used by the control loop.
+        FixedMatrix<3, 12> m_gain;
         //! Heading controller heading rate reference
         IMC::DesiredHeadingRate m_hrate_ref;
         //! Depth controller pitch reference
@@ -152,6 +154,8 @@ namespace Control
             throw std::runtime_error(str);
           }
 
+          m_gain.set(m_args.k_gain);
+
           std::stringstream ss;
           ss << m_args.k_gain;
           spew("%s", ss.str().c_str());
@@ -225,8 +229,7 @@ namespace Control
 
           double heading_error = Angles::normalizeRadian(msg->psi - getYawRef());
 
-          Matrix u(3, 1, 0.0);
-          Matrix x(12, 1, 0.0);
+          FixedMatrix<12, 1> x;
           x(0) = msg->u;
           x(1) = msg->v;
           x(2) = msg->w;
@@ -240,7 +243,7 @@ namespace Control
           x(10) = pitch_error; // msg->theta; // wondering what happens here...
           x(11) = heading_error;
 
-          u = m_args.k_gain * x;
+          FixedMatrix<3, 1> u = m_gain * x;
 
           if (m_args.roll_control_enabled)
             m_torques.k = trimValue(u(0), -m_args.max_fin_rot, m_args.max_fin_rot);
@@ -95,6 +95,15 @@ namespace DUNE
         return m_unprocessed;
       }
 
+      //! Get the number of decompressed bytes held back by the
+      //! decompressor because they did not fit the last destination.
+      //! @return number of pending bytes.
+      virtual unsigned long
+      pending(void) const
+      {
+        return 0;
+      }
+
     protected:
       virtual unsigned long
       decompressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len, unsigned long& unprocessed_len) = 0;
@@ -0,0 +1,118 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Utils/ByteCopy.hpp>
+#include <DUNE/Compression/Exceptions.hpp>
+#include <DUNE/Compression/Lz4Compressor.hpp>
+
+// LZ4 headers.
+#include <lz4/lz4.h>
+#include <lz4/lz4hc.h>
+#include <lz4/xxhash.h>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    //! Frame descriptor flags: version 01, independent blocks and
+    //! content size present.
+    static const uint8_t c_flags = 0x68;
+    //! Block descriptor: 4 MiB maximum block size.
+    static const uint8_t c_block_desc = 0x70;
+    //! Size of the frame header (magic and descriptor).
+    static const unsigned c_header_size = 4 + 2 + 8 + 1;
+    //! Flag of blocks stored uncompressed.
+    static const uint32_t c_uncompressed = 0x80000000;
+
+    unsigned long
+    Lz4Compressor::compressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len)
+    {
+      // Empty input produces no frame at all.
+      if (src_len == 0)
+        return 0;
+
+      if (dst_len < compressBound(src_len))
+        throw BufferTooShort(dst_len);
+
+      uint8_t* ptr = (uint8_t*)dst;
+      Utils::ByteCopy::toLE(c_magic, ptr);
+      ptr[4] = c_flags;
+      ptr[5] = c_block_desc;
+      Utils::ByteCopy::toLE((uint32_t)((uint64_t)src_len & 0xffffffff), ptr + 6);
+      Utils::ByteCopy::toLE((uint32_t)((uint64_t)src_len >> 32), ptr + 10);
+      ptr[14] = (uint8_t)((XXH32(ptr + 4, 10, 0) >> 8) & 0xff);
+      ptr += c_header_size;
+
+      for (unsigned long done = 0; done < src_len; )
+      {
+        int len = (int)std::min(src_len - done, (unsigned long)c_block_size);
+        char* data = (char*)ptr + 4;
+        int rv = 0;
+
+        // Incompressible blocks are stored as is.
+        if (m_hc)
+          rv = LZ4_compressHC_limitedOutput(src + done, data, len, len - 1);
+        else
+          rv = LZ4_compress_limitedOutput(src + done, data, len, len - 1);
+
+        if (rv > 0)
+        {
+          Utils::ByteCopy::toLE((uint32_t)rv, ptr);
+        }
+        else
+        {
+          std::memcpy(data, src + done, len);
+          Utils::ByteCopy::toLE((uint32_t)len | c_uncompressed, ptr);
+          rv = len;
+        }
+
+        ptr += 4 + rv;
+        done += len;
+      }
+
+      // End mark.
+      Utils::ByteCopy::toLE((uint32_t)0, ptr);
+      ptr += 4;
+
+      return (char*)ptr - dst;
+    }
+
+    unsigned long
+    Lz4Compressor::compressBound(unsigned long length) const
+    {
+      unsigned long blocks = (length + c_block_size - 1) / c_block_size;
+      return c_header_size + 4 + blocks * 4 + length;
+    }
+  }
+}
@@ -24,94 +24,54 @@
 // https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
 // http://ec.europa.eu/idabc/eupl.html.                                     *
 //***************************************************************************
-// Author: Eduardo Marques                                                  *
+// Author: Pedro Seruca                                                     *
 //***************************************************************************
 
-#ifndef SIMULATORS_ENVIRONMENT_QUAD_TREE_HPP_INCLUDED_
-#define SIMULATORS_ENVIRONMENT_QUAD_TREE_HPP_INCLUDED_
-
-// ISO C++ 98 headers.
-#include <iomanip>
-#include <iostream>
-#include <vector>
+#ifndef DUNE_COMPRESSION_LZ4_COMPRESSOR_HPP_INCLUDED_
+#define DUNE_COMPRESSION_LZ4_COMPRESSOR_HPP_INCLUDED_
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
+#include <DUNE/Compression/Compressor.hpp>
 
-// Local headers.
-#include "Point.hpp"
-#include "Bounds.hpp"
-
-namespace Simulators
+namespace DUNE
 {
-  namespace Environment
+  namespace Compression
   {
-    //! Forward declaration.
-    struct Node;
-
-    //! "Quad-tree" structure used to index spatial data in two dimensions.
-    class QuadTree
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Lz4Compressor;
+
+    //! LZ4 compressor. Every call to compress() produces one
+    //! standard LZ4 frame (independent blocks, content size, no
+    //! checksums). Concatenated frames are a valid LZ4 stream that
+    //! the reference lz4 tools can decode.
+    class Lz4Compressor: public Compressor
     {
     public:
-      //! Item datum.
-      struct Item
-      {
-        double x, y, value;
-      };
-
-      //! Iteration handle.
-      class Iteration
-      {
-      public:
-        virtual void
-        process(const Item& item) = 0;
-
-        virtual
-        ~Iteration(){ }
-      };
+      //! Frame magic number.
+      static const uint32_t c_magic = 0x184d2204;
+      //! Maximum size of the uncompressed data of one block.
+      static const unsigned c_block_size = 4 * 1024 * 1024;
 
       //! Constructor.
-      QuadTree(const Bounds& bounds);
-
-      ~QuadTree();
+      //! @param[in] high_compression true to use the slower LZ4HC
+      //! encoder, which produces the same block format.
+      Lz4Compressor(bool high_compression = false):
+        Compressor(-1),
+        m_hc(high_compression)
+      { }
 
-      //! Insert an item.
-      //! Returns 'false' if item is out-of-bounds.
-      bool
-      insert(const Item& item);
+    protected:
+      virtual unsigned long
+      compressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len);
 
-      //! Iterate tree.
-      void
-      iterate(Iteration& iteration) const;
-
-      //! Iterate tree over a given area.
-      void
-      iterate(Iteration& iteration, const Bounds& area) const;
-
-      //! Clear entire tree.
-      void
-      clear(void);
-
-      //! Remove items in a given area.
-      void
-      remove(const Bounds& area);
-
-      //! Search for items in a given area.
-      //! If any are found returns 'true' and adds results to 'item' vector.
-      bool
-      search(const Bounds& area, std::vector<Item>& items) const;
-
-      //! Get number of elements in a given area.
-      uint32_t
-      size(const Bounds& area) const;
+      virtual unsigned long
+      compressBound(unsigned long length) const;
 
     private:
-      Bounds m_bounds;     //!< Bounds.
-      Node* m_root;     //!< Node handle providing actual implementation.
+      //! True to use the high compression encoder.
+      bool m_hc;
     };
-
-    std::ostream&
-    operator<<(std::ostream& os, const QuadTree& tree);
   }
 }
 
@@ -0,0 +1,257 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Utils/ByteCopy.hpp>
+#include <DUNE/Compression/Exceptions.hpp>
+#include <DUNE/Compression/Lz4Compressor.hpp>
+#include <DUNE/Compression/Lz4Decompressor.hpp>
+
+// LZ4 headers.
+#include <lz4/lz4.h>
+#include <lz4/xxhash.h>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    //! Magic number of skippable frames (low nibble ignored).
+    static const uint32_t c_skippable_magic = 0x184d2a50;
+    //! Flag of blocks stored uncompressed.
+    static const uint32_t c_uncompressed = 0x80000000;
+
+    Lz4Decompressor::Lz4Decompressor(void):
+      Decompressor(),
+      m_flags(0),
+      m_block_max(0),
+      m_stored(false),
+      m_skip(0),
+      m_input_fill(0),
+      m_output_idx(0),
+      m_output_rem(0)
+    {
+      enter(ST_MAGIC, 4);
+    }
+
+    void
+    Lz4Decompressor::enter(State state, unsigned header_size)
+    {
+      m_state = state;
+      m_header_size = header_size;
+
+      // Descriptor fields are checksummed together.
+      if (state != ST_DESCRIPTOR_REST)
+        m_header_fill = 0;
+    }
+
+    void
+    Lz4Decompressor::parseHeader(void)
+    {
+      uint32_t value = 0;
+
+      switch (m_state)
+      {
+        case ST_MAGIC:
+          Utils::ByteCopy::fromLE(value, m_header);
+          if (value == Lz4Compressor::c_magic)
+            enter(ST_DESCRIPTOR, 2);
+          else if ((value & 0xfffffff0) == c_skippable_magic)
+            enter(ST_SKIP_SIZE, 4);
+          else
+            throw CorruptedData();
+          break;
+
+        case ST_DESCRIPTOR:
+        {
+          m_flags = m_header[0];
+          unsigned block_id = (m_header[1] >> 4) & 0x07;
+
+          // Version 01, independent blocks, no reserved bits.
+          if ((m_flags & 0xc0) != 0x40 || (m_flags & 0x20) == 0 || (m_flags & 0x02) != 0
+              || (m_header[1] & 0x8f) != 0 || block_id < 4)
+            throw CorruptedData();
+
+          m_block_max = 1u << (8 + 2 * block_id);
+
+          unsigned rest = 1;
+          if (m_flags & 0x08)
+            rest += 8;
+          if (m_flags & 0x01)
+            rest += 4;
+          enter(ST_DESCRIPTOR_REST, 2 + rest);
+          break;
+        }
+
+        case ST_DESCRIPTOR_REST:
+          if (m_header[m_header_size - 1] != ((XXH32(m_header, m_header_size - 1, 0) >> 8) & 0xff))
+            throw CorruptedData();
+          enter(ST_BLOCK_SIZE, 4);
+          break;
+
+        case ST_BLOCK_SIZE:
+          Utils::ByteCopy::fromLE(value, m_header);
+          if (value == 0)
+          {
+            if (m_flags & 0x04)
+              enter(ST_CONTENT_CHECKSUM, 4);
+            else
+              enter(ST_MAGIC, 4);
+            break;
+          }
+
+          m_stored = (value & c_uncompressed) != 0;
+          value &= ~c_uncompressed;
+          if (value == 0 || value > m_block_max)
+            throw CorruptedData();
+
+          m_input.setSize(value);
+          m_input_fill = 0;
+          enter(ST_BLOCK_DATA, 0);
+          break;
+
+        case ST_BLOCK_CHECKSUM:
+          enter(ST_BLOCK_SIZE, 4);
+          break;
+
+        case ST_CONTENT_CHECKSUM:
+          enter(ST_MAGIC, 4);
+          break;
+
+        case ST_SKIP_SIZE:
+          Utils::ByteCopy::fromLE(m_skip, m_header);
+          if (m_skip == 0)
+            enter(ST_MAGIC, 4);
+          else
+            enter(ST_SKIP, 0);
+          break;
+
+        default:
+          break;
+      }
+    }
+
+    void
+    Lz4Decompressor::decodeInput(void)
+    {
+      uint32_t size = m_input.getSize();
+
+      if (m_stored)
+      {
+        m_output.setSize(size);
+        std::memcpy(m_output.getBuffer(), m_input.getBuffer(), size);
+      }
+      else
+      {
+        if (m_output.getSize() < m_block_max)
+          m_output.setSize(m_block_max);
+
+        int rv = LZ4_decompress_safe(m_input.getBufferSigned(), m_output.getBufferSigned(),
+                                     (int)size, (int)m_block_max);
+        if (rv < 0)
+          throw CorruptedData();
+
+        size = rv;
+      }
+
+      m_output_idx = 0;
+      m_output_rem = size;
+
+      if (m_flags & 0x10)
+        enter(ST_BLOCK_CHECKSUM, 4);
+      else
+        enter(ST_BLOCK_SIZE, 4);
+    }
+
+    unsigned long
+    Lz4Decompressor::decompressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len, unsigned long& unprocessed_len)
+    {
+      unsigned long dst_idx = 0;
+      unsigned long src_idx = 0;
+
+      while (true)
+      {
+        // Deliver decoded data first.
+        if (m_output_rem > 0)
+        {
+          unsigned long n = std::min((unsigned long)m_output_rem, dst_len - dst_idx);
+          std::memcpy(dst + dst_idx, m_output.getBuffer() + m_output_idx, n);
+          dst_idx += n;
+          m_output_idx += n;
+          m_output_rem -= n;
+
+          if (m_output_rem > 0)
+            break;
+        }
+
+        if (src_idx == src_len)
+          break;
+
+        unsigned long avail = src_len - src_idx;
+
+        if (m_state == ST_SKIP)
+        {
+          unsigned long n = std::min((unsigned long)m_skip, avail);
+          m_skip -= n;
+          src_idx += n;
+
+          if (m_skip == 0)
+            enter(ST_MAGIC, 4);
+          continue;
+        }
+
+        if (m_state == ST_BLOCK_DATA)
+        {
+          unsigned long n = std::min((unsigned long)(m_input.getSize() - m_input_fill), avail);
+          std::memcpy(m_input.getBuffer() + m_input_fill, src + src_idx, n);
+          m_input_fill += n;
+          src_idx += n;
+
+          if (m_input_fill == m_input.getSize())
+            decodeInput();
+          continue;
+        }
+
+        unsigned long n = std::min((unsigned long)(m_header_size - m_header_fill), avail);
+        std::memcpy(m_header + m_header_fill, src + src_idx, n);
+        m_header_fill += n;
+        src_idx += n;
+
+        if (m_header_fill == m_header_size)
+          parseHeader();
+      }
+
+      unprocessed_len = src_len - src_idx;
+      return dst_idx;
+    }
+  }
+}
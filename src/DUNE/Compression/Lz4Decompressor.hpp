@@ -0,0 +1,134 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef DUNE_COMPRESSION_LZ4_DECOMPRESSOR_HPP_INCLUDED_
+#define DUNE_COMPRESSION_LZ4_DECOMPRESSOR_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Utils/ByteBuffer.hpp>
+#include <DUNE/Compression/Decompressor.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Lz4Decompressor;
+
+    //! Streaming decoder of standard LZ4 frames, as produced by
+    //! Lz4Compressor and the reference lz4 tools (independent
+    //! blocks only). Input may be split at arbitrary offsets; partial
+    //! headers and blocks are kept until complete and decoded data
+    //! that does not fit the destination is held back for the next
+    //! call. Skippable frames are ignored.
+    class Lz4Decompressor: public Decompressor
+    {
+    public:
+      Lz4Decompressor(void);
+
+      virtual unsigned long
+      pending(void) const
+      {
+        return m_output_rem;
+      }
+
+    protected:
+      virtual unsigned long
+      decompressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len, unsigned long& unprocessed_len);
+
+    private:
+      //! Parser states.
+      enum State
+      {
+        //! Frame magic number.
+        ST_MAGIC,
+        //! Frame flags and block descriptor.
+        ST_DESCRIPTOR,
+        //! Optional descriptor fields and header checksum.
+        ST_DESCRIPTOR_REST,
+        //! Block size or end mark.
+        ST_BLOCK_SIZE,
+        //! Block data.
+        ST_BLOCK_DATA,
+        //! Block checksum.
+        ST_BLOCK_CHECKSUM,
+        //! Content checksum.
+        ST_CONTENT_CHECKSUM,
+        //! Size of a skippable frame.
+        ST_SKIP_SIZE,
+        //! Data of a skippable frame.
+        ST_SKIP
+      };
+
+      //! Current state.
+      State m_state;
+      //! Header field being assembled.
+      uint8_t m_header[16];
+      //! Number of header bytes received.
+      unsigned m_header_fill;
+      //! Number of header bytes needed by the current state.
+      unsigned m_header_size;
+      //! Frame flags.
+      uint8_t m_flags;
+      //! Maximum uncompressed block size of the current frame.
+      uint32_t m_block_max;
+      //! True if the current block is stored uncompressed.
+      bool m_stored;
+      //! Bytes left to skip.
+      uint32_t m_skip;
+      //! Compressed data of the current block.
+      Utils::ByteBuffer m_input;
+      //! Number of compressed bytes received.
+      uint32_t m_input_fill;
+      //! Decoded data of the last block.
+      Utils::ByteBuffer m_output;
+      //! Index of the first undelivered decoded byte.
+      uint32_t m_output_idx;
+      //! Number of undelivered decoded bytes.
+      uint32_t m_output_rem;
+
+      //! Change state.
+      //! @param[in] state new state.
+      //! @param[in] header_size number of header bytes to collect.
+      void
+      enter(State state, unsigned header_size);
+
+      //! Process a complete header field.
+      void
+      parseHeader(void);
+
+      //! Decode a complete block.
+      void
+      decodeInput(void);
+    };
+  }
+}
+
+#endif
@@ -39,6 +39,8 @@ namespace DUNE
       METHOD_ZLIB,
       METHOD_GZIP,
       METHOD_BZIP2,
+      METHOD_LZ4,
+      METHOD_LZ4HC,
       METHOD_UNKNOWN
     };
   }
@@ -37,7 +37,8 @@
 #include <DUNE/Concurrency/ScopedMutex.hpp>
 
 // Check if we can use GCC's atomic functions.
-#if defined(DUNE_SYS_HAS___SYNC_ADD_AND_FETCH) && defined(DUNE_SYS_HAS___SYNC_SUB_AND_FETCH)
+#if defined(DUNE_SYS_HAS___SYNC_ADD_AND_FETCH) && defined(DUNE_SYS_HAS___SYNC_SUB_AND_FETCH) \
+  && defined(DUNE_SYS_HAS___SYNC_BOOL_COMPARE_AND_SWAP)
 #  ifndef DUNE_CONCURRENCY_ATOMIC_COUNTER_GCC
 #    define DUNE_CONCURRENCY_ATOMIC_COUNTER_GCC
 #  endif
@@ -96,6 +97,36 @@ namespace DUNE
 #endif
       }
 
+      //! Retrieve the current value.
+      //! @return current value.
+      inline int
+      value(void)
+      {
+        return add(0);
+      }
+
+      //! Atomically replace the current value if it matches an
+      //! expected value.
+      //! @param expected expected value.
+      //! @param value new value.
+      //! @return true if the value was replaced, false otherwise.
+      inline bool
+      compareAndSwap(int expected, int value)
+      {
+        // GCC implementation.
+#if defined(DUNE_CONCURRENCY_ATOMIC_COUNTER_GCC)
+        return __sync_bool_compare_and_swap(&m_value, expected, value);
+
+        // Generic implementation.
+#else
+        ScopedMutex lock(m_lock);
+        if (m_value != expected)
+          return false;
+        m_value = value;
+        return true;
+#endif
+      }
+
     private:
       //! Internal value.
       volatile int m_value;
@@ -0,0 +1,150 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef DUNE_CONCURRENCY_ATOMIC_POINTER_HPP_INCLUDED_
+#define DUNE_CONCURRENCY_ATOMIC_POINTER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+
+// Check if we can use GCC's atomic functions.
+#if defined(DUNE_SYS_HAS___SYNC_BOOL_COMPARE_AND_SWAP) && defined(DUNE_SYS_HAS___SYNC_SYNCHRONIZE)
+#  ifndef DUNE_CONCURRENCY_ATOMIC_POINTER_GCC
+#    define DUNE_CONCURRENCY_ATOMIC_POINTER_GCC
+#  endif
+#endif
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    //! Pointer with atomic load, store and compare-and-swap
+    //! operations. Stores have release semantics and loads have
+    //! acquire semantics, which makes this class suitable to publish
+    //! immutable objects to concurrent readers without locking.
+    template <typename T>
+    class AtomicPointer
+    {
+    public:
+      //! Constructor.
+      //! @param ptr initial pointer value.
+      AtomicPointer(T* ptr = NULL):
+        m_ptr(ptr)
+      { }
+
+      //! Retrieve the current pointer value.
+      //! @return pointer value.
+      inline T*
+      get(void) const
+      {
+#if defined(DUNE_CONCURRENCY_ATOMIC_POINTER_GCC)
+        T* ptr = m_ptr;
+        __sync_synchronize();
+        return ptr;
+#else
+        ScopedMutex l(m_lock);
+        return m_ptr;
+#endif
+      }
+
+      //! Publish a new pointer value. Everything written before this
+      //! call is visible to threads that load the new value.
+      //! @param ptr new pointer value.
+      inline void
+      set(T* ptr)
+      {
+#if defined(DUNE_CONCURRENCY_ATOMIC_POINTER_GCC)
+        __sync_synchronize();
+        m_ptr = ptr;
+        __sync_synchronize();
+#else
+        ScopedMutex l(m_lock);
+        m_ptr = ptr;
+#endif
+      }
+
+      //! Replace the current pointer value if it matches an expected
+      //! value.
+      //! @param expected expected value.
+      //! @param ptr new pointer value.
+      //! @return true if the value was replaced, false otherwise.
+      inline bool
+      compareAndSwap(T* expected, T* ptr)
+      {
+#if defined(DUNE_CONCURRENCY_ATOMIC_POINTER_GCC)
+        return __sync_bool_compare_and_swap(&m_ptr, expected, ptr);
+#else
+        ScopedMutex l(m_lock);
+        if (m_ptr != expected)
+          return false;
+        m_ptr = ptr;
+        return true;
+#endif
+      }
+
+      //! Replace the current pointer value and return the previous
+      //! one.
+      //! @param ptr new pointer value.
+      //! @return previous pointer value.
+      inline T*
+      swap(T* ptr)
+      {
+        while (true)
+        {
+          T* old = get();
+          if (compareAndSwap(old, ptr))
+            return old;
+        }
+      }
+
+    private:
+      //! Pointer value.
+      T* volatile m_ptr;
+
+#if !defined(DUNE_CONCURRENCY_ATOMIC_POINTER_GCC)
+      //! Explicit lock for generic implementation.
+      mutable Mutex m_lock;
+#endif
+
+      //! Non - copyable.
+      AtomicPointer(AtomicPointer const&);
+
+      //! Non - assignable.
+      AtomicPointer&
+      operator=(AtomicPointer const&);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,249 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef DUNE_CONCURRENCY_BOUNDED_QUEUE_HPP_INCLUDED_
+#define DUNE_CONCURRENCY_BOUNDED_QUEUE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+
+// Check if we can use GCC's atomic functions.
+#if defined(DUNE_SYS_HAS___SYNC_BOOL_COMPARE_AND_SWAP) && defined(DUNE_SYS_HAS___SYNC_SYNCHRONIZE)
+#  ifndef DUNE_CONCURRENCY_BOUNDED_QUEUE_GCC
+#    define DUNE_CONCURRENCY_BOUNDED_QUEUE_GCC
+#  endif
+#endif
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    //! Bounded lock-free FIFO queue. Any number of threads may push
+    //! and pop elements concurrently, push() fails instead of
+    //! growing the queue when it is full. The capacity is rounded up
+    //! to a power of two. This is an implementation of Dmitry
+    //! Vyukov's bounded MPMC queue, where each cell carries a
+    //! sequence number that tells producers and consumers whether
+    //! the cell is free or holds a value for them.
+    template <typename T>
+    class BoundedQueue
+    {
+    public:
+      //! Constructor.
+      //! @param[in] capacity minimum number of elements.
+      BoundedQueue(unsigned capacity):
+        m_cells(NULL),
+        m_mask(0),
+        m_head(0),
+        m_tail(0)
+      {
+        size_t size = 2;
+        while (size < capacity)
+          size <<= 1;
+
+        m_mask = size - 1;
+        m_cells = new Cell[size];
+        for (size_t i = 0; i < size; ++i)
+          m_cells[i].sequence = i;
+      }
+
+      //! Destructor.
+      ~BoundedQueue(void)
+      {
+        delete [] m_cells;
+      }
+
+      //! Retrieve the maximum number of elements.
+      //! @return queue capacity.
+      unsigned
+      getCapacity(void) const
+      {
+        return m_mask + 1;
+      }
+
+      //! Retrieve the number of elements in the queue. The value is
+      //! only a snapshot when other threads use the queue.
+      //! @return number of elements.
+      unsigned
+      size(void) const
+      {
+        size_t tail = m_tail;
+        size_t head = m_head;
+        return (head > tail) ? (head - tail) : 0;
+      }
+
+      //! Test if the queue has no elements.
+      //! @return true if the queue is empty, false otherwise.
+      bool
+      empty(void) const
+      {
+        return size() == 0;
+      }
+
+      //! Add an element to the end of the queue.
+      //! @param[in] value element.
+      //! @return true if the element was added, false if the queue
+      //! is full.
+      bool
+      push(const T& value)
+      {
+#if defined(DUNE_CONCURRENCY_BOUNDED_QUEUE_GCC)
+        Cell* cell = NULL;
+        size_t pos = m_head;
+
+        while (true)
+        {
+          cell = &m_cells[pos & m_mask];
+          size_t seq = cell->sequence;
+          __sync_synchronize();
+          ptrdiff_t dif = (ptrdiff_t)seq - (ptrdiff_t)pos;
+
+          if (dif == 0)
+          {
+            if (__sync_bool_compare_and_swap(&m_head, pos, pos + 1))
+              break;
+          }
+          else if (dif < 0)
+          {
+            return false;
+          }
+
+          pos = m_head;
+        }
+
+        cell->data = value;
+        __sync_synchronize();
+        cell->sequence = pos + 1;
+        return true;
+#else
+        ScopedMutex l(m_lock);
+        Cell* cell = &m_cells[m_head & m_mask];
+        if (cell->sequence != m_head)
+          return false;
+
+        cell->data = value;
+        cell->sequence = m_head + 1;
+        ++m_head;
+        return true;
+#endif
+      }
+
+      //! Remove the first element of the queue.
+      //! @param[out] value element.
+      //! @return true if an element was removed, false if the queue
+      //! is empty.
+      bool
+      pop(T& value)
+      {
+#if defined(DUNE_CONCURRENCY_BOUNDED_QUEUE_GCC)
+        Cell* cell = NULL;
+        size_t pos = m_tail;
+
+        while (true)
+        {
+          cell = &m_cells[pos & m_mask];
+          size_t seq = cell->sequence;
+          __sync_synchronize();
+          ptrdiff_t dif = (ptrdiff_t)seq - (ptrdiff_t)(pos + 1);
+
+          if (dif == 0)
+          {
+            if (__sync_bool_compare_and_swap(&m_tail, pos, pos + 1))
+              break;
+          }
+          else if (dif < 0)
+          {
+            return false;
+          }
+
+          pos = m_tail;
+        }
+
+        value = cell->data;
+        cell->data = T();
+        __sync_synchronize();
+        cell->sequence = pos + m_mask + 1;
+        return true;
+#else
+        ScopedMutex l(m_lock);
+        Cell* cell = &m_cells[m_tail & m_mask];
+        if (cell->sequence != m_tail + 1)
+          return false;
+
+        value = cell->data;
+        cell->data = T();
+        cell->sequence = m_tail + m_mask + 1;
+        ++m_tail;
+        return true;
+#endif
+      }
+
+    private:
+      //! Queue cell.
+      struct Cell
+      {
+        //! Sequence number.
+        volatile size_t sequence;
+        //! Element.
+        T data;
+      };
+
+      //! Cells.
+      Cell* m_cells;
+      //! Index mask.
+      size_t m_mask;
+      //! Position of the next push, kept apart from the position of
+      //! the next pop to avoid false sharing.
+      volatile size_t m_head;
+      //! Padding.
+      char m_pad[64];
+      //! Position of the next pop.
+      volatile size_t m_tail;
+
+#if !defined(DUNE_CONCURRENCY_BOUNDED_QUEUE_GCC)
+      //! Explicit lock for generic implementation.
+      Mutex m_lock;
+#endif
+
+      //! Non - copyable.
+      BoundedQueue(BoundedQueue const&);
+
+      //! Non - assignable.
+      BoundedQueue&
+      operator=(BoundedQueue const&);
+    };
+  }
+}
+
+#endif
@@ -28,6 +28,7 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <cmath>
 #include <cstddef>
 
 // DUNE headers.
@@ -40,6 +41,56 @@ namespace DUNE
 {
   namespace Concurrency
   {
+#if defined(DUNE_SYS_HAS_PTHREAD_COND)
+    //! Waiter blocked on a condition variable while a clock source is
+    //! installed. The source wakes it up directly, through a private
+    //! flag, since it cannot take the condition mutex.
+    class ConditionWaiter: public Time::ClockSource::Waiter
+    {
+    public:
+      ConditionWaiter(const void* obj, uint64_t dl):
+        Time::ClockSource::Waiter(obj, dl),
+        m_woken(false)
+      {
+        pthread_mutex_init(&m_mutex, NULL);
+        pthread_cond_init(&m_cond, NULL);
+      }
+
+      ~ConditionWaiter(void)
+      {
+        pthread_cond_destroy(&m_cond);
+        pthread_mutex_destroy(&m_mutex);
+      }
+
+      void
+      wake(void)
+      {
+        pthread_mutex_lock(&m_mutex);
+        m_woken = true;
+        pthread_cond_signal(&m_cond);
+        pthread_mutex_unlock(&m_mutex);
+      }
+
+      //! Block until wake() is called.
+      void
+      block(void)
+      {
+        pthread_mutex_lock(&m_mutex);
+        while (!m_woken)
+          pthread_cond_wait(&m_cond, &m_mutex);
+        pthread_mutex_unlock(&m_mutex);
+      }
+
+    private:
+      //! True once woken up.
+      bool m_woken;
+      //! Guards m_woken.
+      pthread_mutex_t m_mutex;
+      //! Signaled by wake().
+      pthread_cond_t m_cond;
+    };
+#endif
+
     Condition::Condition(void):
       m_clock_monotonic(false)
     {
@@ -92,11 +143,15 @@ namespace DUNE
     Condition::wait(double t)
     {
 #if defined(DUNE_SYS_HAS_PTHREAD_COND)
+      Time::ClockSource* source = Time::Clock::getSource();
+      if (source != NULL)
+        return waitSource(source, t);
+
       int rv = 0;
 
       if (t > 0)
       {
-        t += m_clock_monotonic ? Time::Clock::get() : Time::Clock::getSinceEpoch();
+        t += getSystemTime();
 
         timespec ts = DUNE_TIMESPEC_INIT_SEC_FP(t);
         rv = pthread_cond_timedwait(&m_cond, &m_mutex, &ts);
@@ -117,6 +172,37 @@ namespace DUNE
       return false;
     }
 
+#if defined(DUNE_SYS_HAS_PTHREAD_COND)
+    double
+    Condition::getSystemTime(void) const
+    {
+      uint64_t now = m_clock_monotonic ? Time::Clock::getSystemNsec() : Time::Clock::getSystemSinceEpochNsec();
+      return now / Time::c_nsec_per_sec_fp;
+    }
+
+    bool
+    Condition::waitSource(Time::ClockSource* source, double t)
+    {
+      uint64_t deadline = ConditionWaiter::c_forever;
+      if (t > 0)
+        deadline = source->getNsec() + static_cast<uint64_t>(std::ceil(t * Time::c_nsec_per_sec_fp));
+
+      ConditionWaiter waiter(this, deadline);
+      source->addWaiter(waiter);
+
+      // Waiters are registered with the condition mutex held, so a
+      // notify() issued after this point cannot be missed.
+      if (source->getState(waiter) == ConditionWaiter::WS_PENDING)
+      {
+        pthread_mutex_unlock(&m_mutex);
+        waiter.block();
+        pthread_mutex_lock(&m_mutex);
+      }
+
+      return source->removeWaiter(waiter) == ConditionWaiter::WS_NOTIFIED;
+    }
+#endif
+
     void
     Condition::lock(void)
     {
@@ -137,6 +223,14 @@ namespace DUNE
     Condition::broadcast(void)
     {
 #if defined(DUNE_SYS_HAS_PTHREAD_COND)
+      Time::ClockSource* source = Time::Clock::getSource();
+      if (source != NULL)
+      {
+        // Waiters must count as busy before this call returns.
+        source->notify(this);
+        return;
+      }
+
       int rv = pthread_cond_broadcast(&m_cond);
 
       if (rv != 0)
@@ -148,6 +242,14 @@ namespace DUNE
     Condition::signal(void)
     {
 #if defined(DUNE_SYS_HAS_PTHREAD_COND)
+      Time::ClockSource* source = Time::Clock::getSource();
+      if (source != NULL)
+      {
+        // Waiters must count as busy before this call returns.
+        source->notify(this);
+        return;
+      }
+
       int rv = pthread_cond_signal(&m_cond);
 
       if (rv != 0)
@@ -41,6 +41,11 @@
 
 namespace DUNE
 {
+  namespace Time
+  {
+    class ClockSource;
+  }
+
   namespace Concurrency
   {
     // Export DLL Symbol.
@@ -77,6 +82,18 @@ namespace DUNE
       pthread_condattr_t m_cond_attr;
       pthread_mutex_t m_mutex;
       bool m_clock_monotonic;
+
+      //! Get the current time of the clock used by timed waits.
+      //! @return time in seconds.
+      double
+      getSystemTime(void) const;
+
+      //! Wait with a timeout measured by a clock source.
+      //! @param[in] source clock source.
+      //! @param[in] t timeout in seconds.
+      //! @return true if signaled, false on timeout.
+      bool
+      waitSource(Time::ClockSource* source, double t);
 #endif
 
       // Non - copyable.
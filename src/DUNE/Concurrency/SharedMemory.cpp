@@ -133,10 +133,22 @@ namespace DUNE
       if (fd == -1)
         throw System::Error(errno, "failed to open shared memory area");
 
-      if (ftruncate(fd, m_size) == -1)
+      // The area belongs to its creator, resizing it here would
+      // corrupt it.
+      struct stat st;
+      if (fstat(fd, &st) == -1)
       {
         ::close(fd);
-        throw System::Error(errno, "failed to initialize shared memory area");
+        throw System::Error(errno, "failed to query shared memory area");
+      }
+
+      if (m_size == 0)
+        m_size = st.st_size;
+
+      if (m_size == 0 || (unsigned)st.st_size < m_size)
+      {
+        ::close(fd);
+        throw System::Error(EINVAL, "shared memory area is too small");
       }
 
       m_ptr = mmap(0, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
@@ -60,9 +60,19 @@ namespace DUNE
       void
       create(void);
 
+      //! Open an existing memory area. If the size given to the
+      //! constructor is zero the size of the existing area is used.
       void
       open(void);
 
+      //! Get size of memory area.
+      //! @return size in bytes.
+      unsigned
+      getSize(void) const
+      {
+        return m_size;
+      }
+
       //! Get name of memory area.
       //! @return memory area's name.
       const char*
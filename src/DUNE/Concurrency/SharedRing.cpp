@@ -0,0 +1,406 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <cerrno>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/SharedRing.hpp>
+#include <DUNE/System/Error.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/Delay.hpp>
+
+// Check if we can use GCC's atomic functions.
+#if defined(DUNE_SYS_HAS___SYNC_ADD_AND_FETCH) && defined(DUNE_SYS_HAS___SYNC_SUB_AND_FETCH)
+#  define DUNE_CONCURRENCY_SHARED_RING_GCC
+#endif
+
+#if defined(DUNE_OS_LINUX) && defined(DUNE_CONCURRENCY_SHARED_RING_GCC)
+#  define DUNE_CONCURRENCY_SHARED_RING_FUTEX
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#  include <climits>
+#  include <ctime>
+#endif
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    //! Identifies an initialized ring.
+    static const uint32_t c_magic = 0x44524e47;
+    //! Size of the record header.
+    static const unsigned c_record_header = 4;
+    //! Record size marking padding up to the end of the ring.
+    static const uint32_t c_padding = 0xffffffff;
+    //! Polling interval when futexes are not available (s).
+    static const double c_poll_period = 0.001;
+
+    //! Ring header, at the start of the shared memory area. Positions
+    //! are byte offsets that never wrap.
+    struct SharedRing::Header
+    {
+      //! Set to c_magic once the ring is initialized.
+      volatile uint32_t magic;
+      //! Capacity of the ring in bytes.
+      uint32_t capacity;
+      //! Writer session.
+      uint64_t session;
+      //! End of the space the writer may be overwriting.
+      volatile uint64_t claimed;
+      //! End of the last committed record.
+      volatile uint64_t committed;
+      //! Incremented on every commit, readers sleep on it.
+      volatile uint32_t signal;
+      //! Number of sleeping readers.
+      volatile uint32_t waiters;
+      //! True once the writer is gone.
+      volatile uint32_t closed;
+      //! Padding to keep data aligned.
+      uint32_t reserved[5];
+    };
+
+    //! Round a record size up to a multiple of eight bytes.
+    //! @param[in] size record size.
+    //! @return space taken in the ring.
+    static inline unsigned
+    align(unsigned size)
+    {
+      return (size + c_record_header + 7) & ~7U;
+    }
+
+    //! Load a value written by another process.
+    //! @param[in] value value.
+    //! @return value.
+    template <typename Type>
+    static inline Type
+    load(volatile Type& value)
+    {
+#if defined(DUNE_CONCURRENCY_SHARED_RING_GCC)
+      return __sync_add_and_fetch(&value, 0);
+#else
+      return value;
+#endif
+    }
+
+    //! Store a value read by another process.
+    //! @param[in] dst destination.
+    //! @param[in] value value.
+    template <typename Type>
+    static inline void
+    store(volatile Type& dst, Type value)
+    {
+#if defined(DUNE_CONCURRENCY_SHARED_RING_GCC)
+      __sync_synchronize();
+      dst = value;
+      __sync_synchronize();
+#else
+      dst = value;
+#endif
+    }
+
+    SharedRing::SharedRing(const char* name):
+      m_name(name),
+      m_shm(NULL),
+      m_hdr(NULL),
+      m_data(NULL),
+      m_capacity(0),
+      m_pos(0),
+      m_reserved(0),
+      m_writer(false),
+      m_overruns(0)
+    { }
+
+    SharedRing::~SharedRing(void)
+    {
+      detach();
+    }
+
+    void
+    SharedRing::detach(void)
+    {
+      if (m_hdr != NULL && m_writer)
+      {
+        store(m_hdr->closed, (uint32_t)1);
+#if defined(DUNE_CONCURRENCY_SHARED_RING_GCC)
+        __sync_add_and_fetch(&m_hdr->signal, 1);
+#endif
+#if defined(DUNE_CONCURRENCY_SHARED_RING_FUTEX)
+        syscall(SYS_futex, &m_hdr->signal, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+#endif
+      }
+
+      delete m_shm;
+      m_shm = NULL;
+      m_hdr = NULL;
+      m_data = NULL;
+    }
+
+    void
+    SharedRing::create(unsigned capacity)
+    {
+#if !defined(DUNE_CONCURRENCY_SHARED_RING_GCC)
+      throw std::runtime_error(DTR("shared rings are not supported on this platform"));
+#endif
+
+      detach();
+
+      m_capacity = 64;
+      while (m_capacity < capacity)
+        m_capacity <<= 1;
+
+      m_shm = new SharedMemory(m_name.c_str(), sizeof(Header) + m_capacity);
+      try
+      {
+        m_shm->create();
+      }
+      catch (...)
+      {
+        delete m_shm;
+        m_shm = NULL;
+        throw;
+      }
+
+      m_hdr = static_cast<Header*>(**m_shm);
+      m_data = static_cast<uint8_t*>(**m_shm) + sizeof(Header);
+      m_writer = true;
+      m_pos = 0;
+
+      std::memset(m_hdr, 0, sizeof(Header));
+      m_hdr->capacity = m_capacity;
+      m_hdr->session = Time::Clock::getSinceEpochNsec();
+
+      // Readers ignore the ring until it is fully initialized.
+      store(m_hdr->magic, c_magic);
+    }
+
+    void
+    SharedRing::open(void)
+    {
+#if !defined(DUNE_CONCURRENCY_SHARED_RING_GCC)
+      throw std::runtime_error(DTR("shared rings are not supported on this platform"));
+#endif
+
+      detach();
+
+      m_shm = new SharedMemory(m_name.c_str(), 0);
+      try
+      {
+        m_shm->open();
+
+        if (m_shm->getSize() < sizeof(Header))
+          throw System::Error(EINVAL, "shared ring is too small");
+
+        Header* hdr = static_cast<Header*>(**m_shm);
+        if (load(hdr->magic) != c_magic || m_shm->getSize() < sizeof(Header) + hdr->capacity)
+          throw System::Error(EAGAIN, "shared ring is not initialized");
+
+        m_hdr = hdr;
+      }
+      catch (...)
+      {
+        delete m_shm;
+        m_shm = NULL;
+        throw;
+      }
+
+      m_data = static_cast<uint8_t*>(**m_shm) + sizeof(Header);
+      m_capacity = m_hdr->capacity;
+      m_writer = false;
+      m_pos = load(m_hdr->committed);
+    }
+
+    unsigned
+    SharedRing::getMaximumRecordSize(void) const
+    {
+      return m_capacity / 4 - c_record_header;
+    }
+
+    uint8_t*
+    SharedRing::reserve(unsigned size)
+    {
+      if (!m_writer)
+        throw std::runtime_error(DTR("shared ring is not open for writing"));
+
+      if (size > getMaximumRecordSize())
+        throw std::runtime_error(DTR("record is too large for shared ring"));
+
+      unsigned offset = m_pos & (m_capacity - 1);
+      uint64_t pos = m_pos;
+
+      // Records are contiguous: skip to the start of the ring if
+      // the record does not fit before the end.
+      if (offset + align(size) > m_capacity)
+        pos += m_capacity - offset;
+
+      // Readers must know what is about to be overwritten before
+      // it is.
+      store(m_hdr->claimed, pos + align(size));
+
+      if (pos != m_pos)
+        std::memcpy(m_data + offset, &c_padding, sizeof(c_padding));
+
+      m_reserved = pos;
+      return m_data + (pos & (m_capacity - 1)) + c_record_header;
+    }
+
+    void
+    SharedRing::commit(unsigned size)
+    {
+      uint32_t rsize = size;
+      std::memcpy(m_data + (m_reserved & (m_capacity - 1)), &rsize, sizeof(rsize));
+      m_pos = m_reserved + align(size);
+
+      store(m_hdr->committed, m_pos);
+
+#if defined(DUNE_CONCURRENCY_SHARED_RING_GCC)
+      __sync_add_and_fetch(&m_hdr->signal, 1);
+#endif
+
+#if defined(DUNE_CONCURRENCY_SHARED_RING_FUTEX)
+      if (load(m_hdr->waiters) > 0)
+        syscall(SYS_futex, &m_hdr->signal, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+#endif
+    }
+
+    void
+    SharedRing::write(const uint8_t* data, unsigned size)
+    {
+      std::memcpy(reserve(size), data, size);
+      commit(size);
+    }
+
+    unsigned
+    SharedRing::read(uint8_t* bfr, unsigned size)
+    {
+      while (true)
+      {
+        uint64_t committed = load(m_hdr->committed);
+        if (committed == m_pos)
+          return 0;
+
+        if (committed - m_pos > m_capacity)
+        {
+          m_pos = committed;
+          ++m_overruns;
+          return 0;
+        }
+
+        unsigned offset = m_pos & (m_capacity - 1);
+        uint32_t rsize = 0;
+        std::memcpy(&rsize, m_data + offset, sizeof(rsize));
+
+        unsigned length = 0;
+        if (rsize == c_padding)
+          length = m_capacity - offset;
+        else if (offset + align(rsize) <= m_capacity && rsize <= size)
+          std::memcpy(bfr, m_data + offset + c_record_header, rsize);
+
+#if defined(DUNE_CONCURRENCY_SHARED_RING_GCC)
+        __sync_synchronize();
+#endif
+
+        // The data is valid only if the writer did not start
+        // overwriting it while it was being copied.
+        if (load(m_hdr->claimed) - m_pos > m_capacity)
+        {
+          m_pos = load(m_hdr->committed);
+          ++m_overruns;
+          return 0;
+        }
+
+        if (rsize == c_padding)
+        {
+          m_pos += length;
+          continue;
+        }
+
+        m_pos += align(rsize);
+
+        if (rsize > size)
+        {
+          ++m_overruns;
+          continue;
+        }
+
+        return rsize;
+      }
+    }
+
+    bool
+    SharedRing::wait(double timeout)
+    {
+#if defined(DUNE_CONCURRENCY_SHARED_RING_FUTEX)
+      uint32_t signal = load(m_hdr->signal);
+      if (load(m_hdr->committed) != m_pos)
+        return true;
+
+      if (load(m_hdr->closed))
+        return false;
+
+      timespec ts;
+      ts.tv_sec = (time_t)timeout;
+      ts.tv_nsec = (long)((timeout - ts.tv_sec) * 1e9);
+
+      __sync_add_and_fetch(&m_hdr->waiters, 1);
+      syscall(SYS_futex, &m_hdr->signal, FUTEX_WAIT, signal, &ts, NULL, 0);
+      __sync_sub_and_fetch(&m_hdr->waiters, 1);
+
+      return load(m_hdr->committed) != m_pos;
+#else
+      double deadline = Time::Clock::get() + timeout;
+      while (load(m_hdr->committed) == m_pos && !load(m_hdr->closed))
+      {
+        if (Time::Clock::get() >= deadline)
+          return false;
+
+        Time::Delay::wait(c_poll_period);
+      }
+
+      return load(m_hdr->committed) != m_pos;
+#endif
+    }
+
+    bool
+    SharedRing::isClosed(void) const
+    {
+      return load(m_hdr->closed) != 0;
+    }
+
+    uint64_t
+    SharedRing::getSession(void) const
+    {
+      return m_hdr->session;
+    }
+  }
+}
@@ -0,0 +1,176 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef DUNE_CONCURRENCY_SHARED_RING_HPP_INCLUDED_
+#define DUNE_CONCURRENCY_SHARED_RING_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/SharedMemory.hpp>
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM SharedRing;
+
+    //! Ring buffer of variable size records in a shared memory area,
+    //! written by one process and read by any number of processes.
+    //! The writer never waits for readers: a reader that falls more
+    //! than the ring capacity behind loses the records that were
+    //! overwritten and resumes at the newest one. Readers keep their
+    //! position privately, so they can attach and detach at any
+    //! time. On Linux readers sleep on a futex until the writer
+    //! commits a record; elsewhere they poll.
+    class SharedRing
+    {
+    public:
+      //! Constructor.
+      //! @param[in] name name of the ring.
+      SharedRing(const char* name);
+
+      //! Destructor. Rings created by this instance are marked as
+      //! closed and their readers are woken up.
+      ~SharedRing(void);
+
+      //! Create the ring, replacing any existing ring with the same
+      //! name. This instance becomes the writer.
+      //! @param[in] capacity minimum capacity in bytes, rounded up
+      //! to a power of two.
+      void
+      create(unsigned capacity);
+
+      //! Attach to an existing ring as a reader. Reading starts at
+      //! the next record committed by the writer.
+      void
+      open(void);
+
+      //! Get the largest record that can be written.
+      //! @return size in bytes.
+      unsigned
+      getMaximumRecordSize(void) const;
+
+      //! Reserve space for the next record, so that it can be
+      //! written in place. The record is visible to readers only
+      //! after commit().
+      //! @param[in] size maximum size of the record.
+      //! @return pointer to the record.
+      uint8_t*
+      reserve(unsigned size);
+
+      //! Make the record returned by reserve() visible to readers and
+      //! wake them up.
+      //! @param[in] size actual size of the record, not larger than
+      //! the reserved size.
+      void
+      commit(unsigned size);
+
+      //! Write a record.
+      //! @param[in] data record.
+      //! @param[in] size size of record.
+      void
+      write(const uint8_t* data, unsigned size);
+
+      //! Read the next record. Records larger than the buffer are
+      //! skipped and counted as lost.
+      //! @param[out] bfr buffer.
+      //! @param[in] size size of the buffer.
+      //! @return size of the record, zero if there are no records.
+      unsigned
+      read(uint8_t* bfr, unsigned size);
+
+      //! Wait until there are records to read.
+      //! @param[in] timeout maximum amount of time to wait (s).
+      //! @return true if there are records to read, false otherwise.
+      bool
+      wait(double timeout);
+
+      //! Check if the writer closed the ring.
+      //! @return true if the ring was closed, false otherwise.
+      bool
+      isClosed(void) const;
+
+      //! Get the identifier of the writer session, which changes
+      //! every time the ring is created.
+      //! @return session identifier.
+      uint64_t
+      getSession(void) const;
+
+      //! Get the number of times this reader lost records, either
+      //! because it fell behind the writer or because they did not
+      //! fit the read buffer.
+      //! @return number of overruns.
+      unsigned
+      getOverruns(void) const
+      {
+        return m_overruns;
+      }
+
+    private:
+      struct Header;
+
+      //! Ring name.
+      std::string m_name;
+      //! Shared memory area.
+      SharedMemory* m_shm;
+      //! Ring header.
+      Header* m_hdr;
+      //! Ring data.
+      uint8_t* m_data;
+      //! Ring capacity.
+      unsigned m_capacity;
+      //! Position of the next record (writer or reader).
+      uint64_t m_pos;
+      //! Position of the reserved record.
+      uint64_t m_reserved;
+      //! True if this instance is the writer.
+      bool m_writer;
+      //! Number of overruns.
+      unsigned m_overruns;
+
+      //! Release the shared memory area.
+      void
+      detach(void);
+
+      //! Non-copyable.
+      SharedRing(const SharedRing&);
+
+      //! Non-assignable.
+      SharedRing&
+      operator=(const SharedRing&);
+    };
+  }
+}
+
+#endif
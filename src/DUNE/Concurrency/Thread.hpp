@@ -90,6 +90,12 @@ namespace DUNE
       unsigned
       getPriorityImpl(void);
 
+      void
+      setStateImpl(Runnable::State state);
+
+      Runnable::State
+      getStateImpl(void);
+
     private:
       //! Thread state.
       Runnable::State m_state;
@@ -117,12 +123,6 @@ namespace DUNE
       std::string m_proc_file;
 #endif
 
-      void
-      setStateImpl(Runnable::State state);
-
-      Runnable::State
-      getStateImpl(void);
-
       //! Non - copyable.
       Thread(const Thread&);
 
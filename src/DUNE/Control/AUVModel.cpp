@@ -56,8 +56,14 @@ namespace DUNE
       m_lift(param.lift),
       m_fin_lift(param.fin_lift)
     {
+      Vector3 cog;
+      for (unsigned i = 0; i < 3; ++i)
+        cog(i) = m_cog(i);
+      m_skew_cog = skew(cog);
+
       // compute matrix M which does not change with time
       m_matrix_mass = computeM();
+      m_matrix_mass_inv = inverse(m_matrix_mass);
     }
 
     //! Destructor.
@@ -67,13 +73,17 @@ namespace DUNE
     Matrix
     AUVModel::step(const Matrix& nu_dot, const Matrix& nu, const Matrix& eta)
     {
-      return m_matrix_mass * nu_dot + computeC(nu) * nu + computeD(nu) * nu + computeL(nu) * nu + computeG(eta);
+      Vector6 v(nu);
+      Vector6 tau = m_matrix_mass * Vector6(nu_dot) + computeCoefficients(v) * v + computeG(eta);
+      return tau.toMatrix();
     }
 
     Matrix
     AUVModel::stepInv(const Matrix& tau, const Matrix& nu, const Matrix& eta)
     {
-      return inverse(m_matrix_mass) * (tau - computeC(nu) * nu - computeD(nu) * nu - computeL(nu) * nu - computeG(eta));
+      Vector6 v(nu);
+      Vector6 f = Vector6(tau) - computeCoefficients(v) * v - computeG(eta);
+      return (m_matrix_mass_inv * f).toMatrix();
     }
 
     Matrix
@@ -100,56 +110,89 @@ namespace DUNE
     }
 
     //! Computes matrix of added mass and inertia
-    Matrix
+    Matrix6
     AUVModel::computeM(void)
     {
-      // added mass matrix
-      Matrix Ma = -Matrix(&m_addedmass(0), 6);
+      Matrix6 m;
 
-      // mass and cog submatrix
-      Matrix cog = -skew(m_cog) * m_mass;
+      // rigid body: mass, cog coupling and inertia
+      Matrix3 cog = -m_mass * m_skew_cog;
+      for (unsigned i = 0; i < 3; ++i)
+      {
+        m(i, i) = m_mass;
+        m(i + 3, i + 3) = m_inertia(i);
 
-      // inertia submatrix
-      Matrix I(&m_inertia(0), 3);
+        for (unsigned j = 0; j < 3; ++j)
+        {
+          m(i + 3, j) = -cog(i, j);
+          m(i, j + 3) = cog(i, j);
+        }
+      }
 
-      Matrix Mrb = Matrix(3) * m_mass;
-      Mrb.vertCat(-cog);
-      Mrb.horzCat(cog.vertCat(I));
+      // added mass
+      for (unsigned i = 0; i < 6; ++i)
+        m(i, i) -= m_addedmass(i);
 
-      return Mrb + Ma;
+      return m;
     }
 
-    //! Computes coriolis and centripetal matrix in the skew symmetric form
-    Matrix
-    AUVModel::computeC(const Matrix& nu)
+    //! Computes the sum of coriolis, damping and lift matrices.
+    Matrix6
+    AUVModel::computeCoefficients(const Vector6& nu)
     {
-      // CA
-      Matrix a = (m_addedmass & nu).get(0, 2, 0, 0);
-      Matrix b = (m_addedmass & nu).get(3, 5, 0, 0);
-
-      Matrix ca = Matrix(3, 3, 0.0).horzCat(skew(a));
-      ca.vertCat(skew(a).horzCat(skew(b)));
-
-      // CRB
-      Matrix skew_cog = skew(m_cog);
-
-      Matrix skew_v1 = skew(nu.get(0, 2, 0, 0));
-      Matrix skew_v2 = skew(nu.get(3, 5, 0, 0));
+      Matrix6 c = computeC(nu);
+      c += computeD(nu);
+      c += computeL(nu);
+      return c;
+    }
 
-      Matrix crb(3, 3, 0.0);
-      crb.vertCat(-m_mass * skew_v1 + m_mass * skew_cog * skew_v2);
+    //! Computes coriolis and centripetal matrix in the skew symmetric form
+    Matrix6
+    AUVModel::computeC(const Vector6& nu)
+    {
+      Vector3 a;
+      Vector3 b;
+      Vector3 v1;
+      Vector3 v2;
+      Vector3 iv2;
 
-      Matrix crb2 = -m_mass * skew_v1 - m_mass * skew_v2 * skew_cog;
-      crb2.vertCat(-skew(Matrix(&m_inertia(0), 3) * nu.get(3, 5, 0, 0)));
+      for (unsigned i = 0; i < 3; ++i)
+      {
+        a(i) = m_addedmass(i) * nu(i);
+        b(i) = m_addedmass(i + 3) * nu(i + 3);
+        v1(i) = nu(i);
+        v2(i) = nu(i + 3);
+        iv2(i) = m_inertia(i) * nu(i + 3);
+      }
 
-      crb.horzCat(crb2);
+      // CA
+      Matrix3 skew_a = skew(a);
+      Matrix3 skew_b = skew(b);
 
-      return ca + crb;
+      // CRB
+      Matrix3 skew_v1 = skew(v1);
+      Matrix3 skew_v2 = skew(v2);
+      Matrix3 crb21 = -m_mass * skew_v1 + m_mass * (m_skew_cog * skew_v2);
+      Matrix3 crb12 = -m_mass * skew_v1 - m_mass * (skew_v2 * m_skew_cog);
+      Matrix3 crb22 = -skew(iv2);
+
+      Matrix6 c;
+      for (unsigned i = 0; i < 3; ++i)
+      {
+        for (unsigned j = 0; j < 3; ++j)
+        {
+          c(i, j + 3) = skew_a(i, j) + crb12(i, j);
+          c(i + 3, j) = skew_a(i, j) + crb21(i, j);
+          c(i + 3, j + 3) = skew_b(i, j) + crb22(i, j);
+        }
+      }
+
+      return c;
     }
 
     //! Routine to compute matrix D using state nu
-    Matrix
-    AUVModel::computeD(const Matrix& nu)
+    Matrix6
+    AUVModel::computeD(const Vector6& nu)
     {
       double u = nu(0);
       double v = nu(1);
@@ -158,38 +201,39 @@ namespace DUNE
       double q = nu(4);
       double r = nu(5);
 
-      // initialize linear drag matrix with diagonal terms
-      Matrix dl = Matrix(&m_ldrag(0), 6);
-      // initialize quadratic drag matrix
-      Matrix dq = Matrix(6);
+      Matrix6 d;
+
+      // linear drag diagonal terms
+      for (unsigned i = 0; i < 6; ++i)
+        d(i, i) = m_ldrag(i);
 
       // linear drag coupling terms
-      dl(1, 5) = m_ldrag(6);
-      dl(2, 4) = m_ldrag(7);
-      dl(4, 2) = m_ldrag(8);
-      dl(5, 1) = m_ldrag(9);
+      d(1, 5) = m_ldrag(6);
+      d(2, 4) = m_ldrag(7);
+      d(4, 2) = m_ldrag(8);
+      d(5, 1) = m_ldrag(9);
 
       // quadratic diagonal terms
-      dq(0, 0) = m_qdrag(0) * std::abs(u);
-      dq(1, 1) = m_qdrag(1) * std::abs(v);
-      dq(2, 2) = m_qdrag(2) * std::abs(w);
-      dq(3, 3) = m_qdrag(3) * std::abs(p);
-      dq(4, 4) = m_qdrag(4) * std::abs(q);
-      dq(5, 5) = m_qdrag(5) * std::abs(r);
+      d(0, 0) += m_qdrag(0) * std::abs(u);
+      d(1, 1) += m_qdrag(1) * std::abs(v);
+      d(2, 2) += m_qdrag(2) * std::abs(w);
+      d(3, 3) += m_qdrag(3) * std::abs(p);
+      d(4, 4) += m_qdrag(4) * std::abs(q);
+      d(5, 5) += m_qdrag(5) * std::abs(r);
       // quadratic coupling terms
-      dq(1, 5) = m_qdrag(6) * std::abs(v);
-      dq(2, 4) = m_qdrag(7) * std::abs(w);
-      dq(4, 2) = m_qdrag(8) * std::abs(q);
-      dq(5, 1) = m_qdrag(9) * std::abs(r);
+      d(1, 5) += m_qdrag(6) * std::abs(v);
+      d(2, 4) += m_qdrag(7) * std::abs(w);
+      d(4, 2) += m_qdrag(8) * std::abs(q);
+      d(5, 1) += m_qdrag(9) * std::abs(r);
 
-      return -(dl + dq);
+      return -d;
     }
 
     //! Routine to compute lift forces matrix
-    Matrix
-    AUVModel::computeL(const Matrix& nu)
+    Matrix6
+    AUVModel::computeL(const Vector6& nu)
     {
-      Matrix lift(6, 6, 0.0);
+      Matrix6 lift;
 
       lift(1, 1) = m_lift(0);
       lift(2, 2) = m_lift(1);
@@ -204,7 +248,7 @@ namespace DUNE
     }
 
     //! Routine to compute vector of restoring forces g
-    Matrix
+    Vector6
     AUVModel::computeG(const Matrix& eta)
     {
       double phi = eta(3);
@@ -221,14 +265,14 @@ namespace DUNE
         -m_cog(0) * W * cos(theta) * sin(phi) - m_cog(1) * W * sin(theta)
       };
 
-      return Matrix(g, 6, 1);
+      return Vector6(g);
     }
 
     Matrix
     AUVModel::computeTau(double speed_u, double thruster_act, const Matrix& servo_pos)
     {
       Matrix tau(6, 1, 0.0);
-      Matrix deflections(3, 1, 0.0);
+      Vector3 deflections;
 
       deflections(0) = servo_pos(3) - servo_pos(0) + servo_pos(1) - servo_pos(2);
       deflections(1) = servo_pos(1) + servo_pos(2);
@@ -110,24 +110,28 @@ namespace DUNE
 
     private:
       //! Computes added mass and inertia
-      Math::Matrix
+      Math::Matrix6
       computeM(void);
 
+      //! Computes the sum of coriolis, damping and lift matrices
+      Math::Matrix6
+      computeCoefficients(const Math::Vector6& nu);
+
       //! Computes quadratic damping matrix
-      Math::Matrix
-      computeD(const Math::Matrix& nu);
+      Math::Matrix6
+      computeD(const Math::Vector6& nu);
 
       //! Computes lift matrix
-      Math::Matrix
-      computeL(const Math::Matrix& nu);
+      Math::Matrix6
+      computeL(const Math::Vector6& nu);
 
       //! Computes vector of restoring forces g
-      Math::Matrix
+      Math::Vector6
       computeG(const Math::Matrix& eta);
 
       //! Computes rigid body coriolis and centripetal matrix
-      Math::Matrix
-      computeC(const Math::Matrix& nu);
+      Math::Matrix6
+      computeC(const Math::Vector6& nu);
 
       //! Compute the resulting tau using thruster actuation and servo positions
       Math::Matrix
@@ -150,8 +154,12 @@ namespace DUNE
       Math::Matrix m_addedmass;
       //! Intertia coeficients
       Math::Matrix m_inertia;
+      //! Skew-symmetric matrix of the center of gravity
+      Math::Matrix3 m_skew_cog;
       //! Model's matrix of mass moments and added inertia
-      Math::Matrix m_matrix_mass;
+      Math::Matrix6 m_matrix_mass;
+      //! Inverse of the mass matrix
+      Math::Matrix6 m_matrix_mass_inv;
       //! Model's linear damping coefficients
       Math::Matrix m_ldrag;
       //! Model's quadratic drag
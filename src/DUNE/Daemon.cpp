@@ -296,6 +296,7 @@ namespace DUNE
   Daemon::dispatchPeriodic(void)
   {
     measureCpuUsage();
+    m_tman->reportQueueLatency();
 
     // Dispatch available storage.
     if (m_fs_capacity > 0)
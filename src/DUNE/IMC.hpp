@@ -42,14 +42,22 @@ namespace DUNE
 #include <DUNE/IMC/InlineMessage.hpp>
 #include <DUNE/IMC/MessageList.hpp>
 #include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/SharedMessage.hpp>
 #include <DUNE/IMC/Factory.hpp>
 #include <DUNE/IMC/Packet.hpp>
 #include <DUNE/IMC/Macros.hpp>
 #include <DUNE/IMC/AddressResolver.hpp>
 #include <DUNE/IMC/Parser.hpp>
+#include <DUNE/IMC/LogIndex.hpp>
+#include <DUNE/IMC/IndexedInput.hpp>
+#include <DUNE/IMC/LogReader.hpp>
+#include <DUNE/IMC/LogProcessor.hpp>
 #include <DUNE/IMC/Exceptions.hpp>
 #include <DUNE/IMC/Definitions.hpp>
 #include <DUNE/IMC/Blob.hpp>
 #include <DUNE/IMC/IridiumMessageDefinitions.hpp>
+#include <DUNE/IMC/BitPacking.hpp>
+#include <DUNE/IMC/Compact.hpp>
+#include <DUNE/IMC/CompactCodec.hpp>
 
 #endif
@@ -0,0 +1,289 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef DUNE_IMC_BIT_PACKING_HPP_INCLUDED_
+#define DUNE_IMC_BIT_PACKING_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <limits>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Utils/BitBuffer.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Quantise a value to an unsigned integer of a given number of
+    //! bits. Out of range values (and NaN) are clamped.
+    //! @param[in] value value.
+    //! @param[in] min minimum representable value.
+    //! @param[in] precision quantisation step.
+    //! @param[in] bits number of bits (at most 32).
+    //! @return quantised value.
+    inline uint32_t
+    quantize(double value, double min, double precision, unsigned bits)
+    {
+      double top = (double)((((uint64_t)1) << bits) - 1);
+      double q = (value - min) / precision;
+
+      if (!(q > 0.0))
+        return 0;
+
+      if (q >= top)
+        return (uint32_t)top;
+
+      return (uint32_t)(q + 0.5);
+    }
+
+    //! Convert a quantised value back to its original scale.
+    //! @param[in] q quantised value.
+    //! @param[in] min minimum representable value.
+    //! @param[in] precision quantisation step.
+    //! @param[out] value destination field.
+    template <typename T>
+    inline void
+    dequantize(uint32_t q, double min, double precision, T& value)
+    {
+      double v = min + q * precision;
+
+      if (std::numeric_limits<T>::is_integer)
+        value = static_cast<T>(v < 0 ? v - 0.5 : v + 0.5);
+      else
+        value = static_cast<T>(v);
+    }
+
+    //! Bit-packed writer of quantised fields backed by a
+    //! Utils::BitBuffer.
+    //!
+    //! When a reference value is given, a field is written as a
+    //! single zero bit if its quantised value did not change, as a
+    //! signed delta of 'delta_bits' bits if it fits or as an absolute
+    //! value otherwise.
+    class BitWriter
+    {
+    public:
+      //! Constructor.
+      //! @param[in] bfr destination buffer.
+      BitWriter(Utils::BitBuffer& bfr):
+        m_bfr(bfr)
+      { }
+
+      //! Append the least significant bits of a value.
+      //! @param[in] value value.
+      //! @param[in] bits number of bits (at most 32).
+      void
+      putBits(uint32_t value, unsigned bits)
+      {
+        if (bits > getRemaining())
+          throw InternalBufferTooShort();
+
+        while (bits > 0)
+        {
+          unsigned n = bits < 8 ? bits : 8;
+          m_bfr.appendData((uint8_t)(value & 0xff), (uint8_t)n);
+          value >>= n;
+          bits -= n;
+        }
+      }
+
+      //! Append a quantised field.
+      //! @param[in] value field value.
+      //! @param[in] ref reference value or NULL to write an absolute
+      //! value.
+      //! @param[in] min minimum representable value.
+      //! @param[in] precision quantisation step.
+      //! @param[in] bits number of bits of absolute values.
+      //! @param[in] delta_bits number of bits of deltas (0 to disable).
+      template <typename T>
+      void
+      put(T value, const T* ref, double min, double precision, unsigned bits, unsigned delta_bits)
+      {
+        uint32_t q = quantize(value, min, precision, bits);
+
+        if (ref == NULL)
+        {
+          putBits(q, bits);
+          return;
+        }
+
+        uint32_t q_ref = quantize(*ref, min, precision, bits);
+        if (q == q_ref)
+        {
+          putBits(0, 1);
+          return;
+        }
+
+        putBits(1, 1);
+
+        if (delta_bits > 0)
+        {
+          int64_t delta = (int64_t)q - (int64_t)q_ref;
+          int64_t limit = ((int64_t)1) << (delta_bits - 1);
+          if (delta >= -limit && delta < limit)
+          {
+            putBits(0, 1);
+            putBits((uint32_t)(delta + limit), delta_bits);
+            return;
+          }
+
+          putBits(1, 1);
+        }
+
+        putBits(q, bits);
+      }
+
+      //! Get number of bits written to the buffer.
+      //! @return number of bits.
+      uint64_t
+      getBits(void)
+      {
+        return m_bfr.getBitsize();
+      }
+
+      //! Get number of bytes needed to hold the written bits.
+      //! @return number of bytes.
+      size_t
+      getSize(void)
+      {
+        return (size_t)((m_bfr.getBitsize() + 7) / 8);
+      }
+
+      //! Get number of bits that can still be written.
+      //! @return number of bits.
+      uint64_t
+      getRemaining(void)
+      {
+        return (uint64_t)m_bfr.getCapacity() * 8 - m_bfr.getBitsize();
+      }
+
+    private:
+      //! Destination buffer.
+      Utils::BitBuffer& m_bfr;
+    };
+
+    //! Bit-packed reader of fields written by BitWriter.
+    class BitReader
+    {
+    public:
+      //! Constructor.
+      //! @param[in] bfr source buffer.
+      BitReader(Utils::BitBuffer& bfr):
+        m_bfr(bfr),
+        m_index(0)
+      {
+        m_limit = (uint64_t)bfr.getSize() * 8;
+        if (bfr.getBitsize() > m_limit)
+          m_limit = bfr.getBitsize();
+      }
+
+      //! Read a value of a given number of bits.
+      //! @param[in] bits number of bits (at most 32).
+      //! @return value.
+      uint32_t
+      getBits(unsigned bits)
+      {
+        if (bits > getRemaining())
+          throw BufferTooShort();
+
+        uint32_t value = 0;
+        unsigned shift = 0;
+        while (shift < bits)
+        {
+          unsigned n = (bits - shift) < 8 ? (bits - shift) : 8;
+          value |= (uint32_t)m_bfr.getData(m_index, (uint8_t)n) << shift;
+          m_index += n;
+          shift += n;
+        }
+
+        return value;
+      }
+
+      //! Read a quantised field.
+      //! @param[out] value field value.
+      //! @param[in] ref reference value or NULL to read an absolute
+      //! value.
+      //! @param[in] min minimum representable value.
+      //! @param[in] precision quantisation step.
+      //! @param[in] bits number of bits of absolute values.
+      //! @param[in] delta_bits number of bits of deltas (0 to disable).
+      template <typename T>
+      void
+      get(T& value, const T* ref, double min, double precision, unsigned bits, unsigned delta_bits)
+      {
+        if (ref == NULL)
+        {
+          dequantize(getBits(bits), min, precision, value);
+          return;
+        }
+
+        if (getBits(1) == 0)
+        {
+          value = *ref;
+          return;
+        }
+
+        if (delta_bits > 0 && getBits(1) == 0)
+        {
+          int64_t limit = ((int64_t)1) << (delta_bits - 1);
+          int64_t delta = (int64_t)getBits(delta_bits) - limit;
+          int64_t q = (int64_t)quantize(*ref, min, precision, bits) + delta;
+          if (q < 0 || q >= (((int64_t)1) << bits))
+            throw InvalidFormat();
+
+          dequantize((uint32_t)q, min, precision, value);
+          return;
+        }
+
+        dequantize(getBits(bits), min, precision, value);
+      }
+
+      //! Get number of bits left to read.
+      //! @return number of bits.
+      uint64_t
+      getRemaining(void)
+      {
+        return m_limit - m_index;
+      }
+
+    private:
+      //! Source buffer.
+      Utils::BitBuffer& m_bfr;
+      //! Index of the next bit.
+      uint64_t m_index;
+      //! Number of readable bits.
+      uint64_t m_limit;
+    };
+  }
+}
+
+#endif
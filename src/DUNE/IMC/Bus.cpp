@@ -44,18 +44,13 @@ namespace DUNE
   {
     struct BackLogEntry
     {
-      BackLogEntry(const Message* msg, Tasks::AbstractTask* exc):
-        message(msg->clone()),
+      BackLogEntry(const SharedMessage& msg, Tasks::AbstractTask* exc):
+        message(msg),
         exclude(exc)
       {  }
 
-      ~BackLogEntry(void)
-      {
-        delete message;
-      }
-
       //! Message.
-      Message* message;
+      SharedMessage message;
       //! Exclude this task.
       Tasks::AbstractTask* exclude;
     };
@@ -75,6 +70,63 @@ namespace DUNE
 
       for (unsigned i = 0; i < m_bind_msgs.size(); ++i)
         delete m_bind_msgs[i];
+
+      for (unsigned i = 0; i < c_page_count; ++i)
+      {
+        Page* page = m_table[i].get();
+        if (page == NULL)
+          continue;
+
+        for (unsigned j = 0; j < c_page_size; ++j)
+          delete page->lists[j].get();
+
+        delete page;
+      }
+
+      for (unsigned i = 0; i < m_retired.size(); ++i)
+        delete m_retired[i];
+    }
+
+    void
+    Bus::publish(uint16_t id, const RecipientList* list)
+    {
+      Page* page = m_table[id / c_page_size].get();
+      if (page == NULL)
+      {
+        page = new Page;
+        m_table[id / c_page_size].set(page);
+      }
+
+      // Readers might still be traversing the old list, it can only
+      // be freed once they are gone.
+      const RecipientList* old = page->lists[id % c_page_size].swap(list);
+      if (old == NULL)
+        return;
+
+      {
+        Concurrency::ScopedMutex l(m_retired_lock);
+        m_retired.push_back(old);
+        m_retired_count.add(1);
+      }
+
+      reclaim();
+    }
+
+    void
+    Bus::reclaim(void) const
+    {
+      Concurrency::ScopedMutex l(m_retired_lock);
+
+      // Lists are retired after being unpublished, a thread that
+      // enters a read scope from now on cannot reach them.
+      if (m_readers.value() != 0)
+        return;
+
+      for (unsigned i = 0; i < m_retired.size(); ++i)
+        delete m_retired[i];
+
+      m_retired_count.sub(m_retired.size());
+      m_retired.clear();
     }
 
     void
@@ -86,23 +138,55 @@ namespace DUNE
       bind->consumer = task->getName();
       bind->message_id = id;
 
-      Concurrency::ScopedRWLock l(m_lock, true);
+      Concurrency::ScopedMutex l(m_lock);
       m_bind_msgs.push_back(bind);
-      TransportList::iterator itr = std::find(m_recipients[id].begin(), m_recipients[id].end(), task);
-      if (itr == m_recipients[id].end())
-        m_recipients[id].push_back(task);
+
+      const RecipientList* list = lookup(id);
+      if (list != NULL && std::find(list->begin(), list->end(), task) != list->end())
+        return;
+
+      RecipientList* nlist = (list == NULL) ? new RecipientList : new RecipientList(*list);
+      nlist->push_back(task);
+      publish(id, nlist);
     }
 
     void
     Bus::unregisterRecipient(Tasks::AbstractTask* task, uint16_t id)
     {
-      Concurrency::ScopedRWLock l(m_lock, true);
-      m_recipients[id].remove(task);
+      Concurrency::ScopedMutex l(m_lock);
+
+      const RecipientList* list = lookup(id);
+      if (list == NULL || std::find(list->begin(), list->end(), task) == list->end())
+        return;
+
+      RecipientList* nlist = new RecipientList;
+      nlist->reserve(list->size() - 1);
+      for (RecipientList::const_iterator itr = list->begin(); itr != list->end(); ++itr)
+      {
+        if (*itr != task)
+          nlist->push_back(*itr);
+      }
+
+      publish(id, nlist);
     }
 
     void
     Bus::dispatch(const Message* msg, Tasks::AbstractTask* task)
     {
+      if (!m_paused)
+      {
+        ReadScope scope(*this);
+        if (!hasRecipients(lookup(msg->getId()), task))
+          return;
+      }
+
+      dispatch(SharedMessage::copy(*msg), task);
+    }
+
+    void
+    Bus::dispatch(const SharedMessage& msg, Tasks::AbstractTask* task)
+    {
+      if (m_paused)
       {
         Concurrency::ScopedMutex lock(m_paused_lock);
         if (m_paused)
@@ -112,16 +196,40 @@ namespace DUNE
         }
       }
 
-      uint16_t id = msg->getId();
-      Concurrency::ScopedRWLock l(m_lock);
-      TransportList& dlst(m_recipients[id]);
-      for (TransportList::iterator itr = dlst.begin(); itr != dlst.end(); ++itr)
+      ReadScope scope(*this);
+      const RecipientList* list = lookup(msg->getId());
+      if (list == NULL)
+        return;
+
+      for (RecipientList::const_iterator itr = list->begin(); itr != list->end(); ++itr)
       {
         if (*itr != task)
           (*itr)->receive(msg);
       }
     }
 
+    unsigned
+    Bus::getBacklog(uint16_t id, Tasks::AbstractTask* task) const
+    {
+      ReadScope scope(*this);
+      const RecipientList* list = lookup(id);
+      if (list == NULL)
+        return 0;
+
+      unsigned backlog = 0;
+      for (RecipientList::const_iterator itr = list->begin(); itr != list->end(); ++itr)
+      {
+        if (*itr == task)
+          continue;
+
+        unsigned count = (*itr)->getBacklog();
+        if (count > backlog)
+          backlog = count;
+      }
+
+      return backlog;
+    }
+
     void
     Bus::resume(void)
     {
@@ -143,6 +251,7 @@ namespace DUNE
     const std::vector<TransportBindings*>
     Bus::getBindings(void)
     {
+      Concurrency::ScopedMutex l(m_lock);
       return m_bind_msgs;
     }
   }
@@ -40,10 +40,12 @@
 #include <queue>
 
 // DUNE headers.
+#include <DUNE/IMC/SharedMessage.hpp>
 #include <DUNE/Tasks/AbstractTask.hpp>
 #include <DUNE/Concurrency/TSQueue.hpp>
+#include <DUNE/Concurrency/AtomicPointer.hpp>
+#include <DUNE/Concurrency/AtomicCounter.hpp>
 #include <DUNE/Concurrency/ScopedMutex.hpp>
-#include <DUNE/Concurrency/ScopedRWLock.hpp>
 
 namespace DUNE
 {
@@ -56,6 +58,14 @@ namespace DUNE
     // Export DLL Symbol.
     class DUNE_DLL_SYM Bus;
 
+    //! The message bus delivers messages to the tasks that registered
+    //! interest in their identification numbers. Recipients are kept
+    //! in a table indexed by message identification number, where
+    //! each entry is an immutable list of tasks. Registration builds
+    //! and publishes a new list (copy-on-write) and retires the old
+    //! one, so dispatching takes no locks and performs no memory
+    //! allocation. Retired lists are freed as soon as no reader is
+    //! traversing the table.
     class Bus
     {
     public:
@@ -79,12 +89,41 @@ namespace DUNE
       void
       unregisterRecipient(Tasks::AbstractTask* task, uint16_t id);
 
-      //! Dispatches a message to registered listeners.
+      //! Dispatches a message to registered listeners. The message
+      //! is copied once and the copy is shared by all listeners.
       //! @param msg message to dispatch.
       //! @param task do not deliver message to this task.
       void
       dispatch(const Message* msg, Tasks::AbstractTask* task = NULL);
 
+      //! Dispatches a shared message to registered listeners without
+      //! copying it.
+      //! @param msg message to dispatch.
+      //! @param task do not deliver message to this task.
+      void
+      dispatch(const SharedMessage& msg, Tasks::AbstractTask* task = NULL);
+
+      //! Retrieve the number of tasks registered as recipients of a
+      //! given message identification number.
+      //! @param id message identification number.
+      //! @return number of recipients.
+      unsigned
+      getRecipientCount(uint16_t id) const
+      {
+        ReadScope scope(*this);
+        const RecipientList* list = lookup(id);
+        return (list == NULL) ? 0 : list->size();
+      }
+
+      //! Retrieve the largest number of messages waiting to be
+      //! consumed by a recipient of a given message identification
+      //! number. Producers may use it to wait for slow consumers.
+      //! @param id message identification number.
+      //! @param task ignore this task.
+      //! @return approximate number of queued messages.
+      unsigned
+      getBacklog(uint16_t id, Tasks::AbstractTask* task = NULL) const;
+
       inline void
       pause(void)
       {
@@ -99,13 +138,35 @@ namespace DUNE
       getBindings(void);
 
     private:
-      typedef std::list<Tasks::AbstractTask*> TransportList;
-      //! Table of recipients.
-      std::map<uint16_t, TransportList> m_recipients;
-      //! Internal list lock.
-      Concurrency::RWLock m_lock;
+      //! Immutable list of recipients.
+      typedef std::vector<Tasks::AbstractTask*> RecipientList;
+      //! Number of message identifiers per table page.
+      static const unsigned c_page_size = 256;
+      //! Number of table pages.
+      static const unsigned c_page_count = 65536 / c_page_size;
+
+      //! Page of the table of recipients.
+      struct Page
+      {
+        //! Recipient lists.
+        Concurrency::AtomicPointer<const RecipientList> lists[c_page_size];
+      };
+
+      //! Table of recipients. Pages are allocated on first
+      //! registration and never freed while the bus exists.
+      Concurrency::AtomicPointer<Page> m_table[c_page_count];
+      //! Lists replaced by newer ones, waiting to be freed.
+      mutable std::vector<const RecipientList*> m_retired;
+      //! Number of retired lists.
+      mutable Concurrency::AtomicCounter m_retired_count;
+      //! Retired lists lock.
+      mutable Concurrency::Mutex m_retired_lock;
+      //! Number of threads traversing the table of recipients.
+      mutable Concurrency::AtomicCounter m_readers;
+      //! Writer lock, serializes (un)registration.
+      Concurrency::Mutex m_lock;
       //! Bus is paused.
-      bool m_paused;
+      volatile bool m_paused;
       //! Pause lock.
       Concurrency::Mutex m_paused_lock;
       //! List containing all generated TransportBindings for future logging/reference.
@@ -113,6 +174,70 @@ namespace DUNE
       //! Back log queue. Saves messages when Bus is paused.
       Concurrency::TSQueue<BackLogEntry*> m_back_log;
 
+      //! Marks the scope in which a thread may hold pointers to
+      //! recipient lists. The last reader to leave frees retired
+      //! lists.
+      class ReadScope
+      {
+      public:
+        ReadScope(const Bus& bus):
+          m_bus(bus)
+        {
+          m_bus.m_readers.add(1);
+        }
+
+        ~ReadScope(void)
+        {
+          if (m_bus.m_readers.sub(1) == 0 && m_bus.m_retired_count.value() > 0)
+            m_bus.reclaim();
+        }
+
+      private:
+        //! Bus.
+        const Bus& m_bus;
+      };
+
+      friend class ReadScope;
+
+      //! Retrieve the list of recipients of a given message
+      //! identification number. Must be called inside a ReadScope.
+      //! @param id message identification number.
+      //! @return list of recipients or NULL if there are none.
+      const RecipientList*
+      lookup(uint16_t id) const
+      {
+        const Page* page = m_table[id / c_page_size].get();
+        if (page == NULL)
+          return NULL;
+
+        return page->lists[id % c_page_size].get();
+      }
+
+      //! Test if a message would be delivered to at least one task.
+      //! @param list list of recipients.
+      //! @param task task excluded from delivery.
+      //! @return true if there is at least one recipient, false otherwise.
+      static bool
+      hasRecipients(const RecipientList* list, Tasks::AbstractTask* task)
+      {
+        if (list == NULL || list->empty())
+          return false;
+
+        return (list->size() > 1) || (list->front() != task);
+      }
+
+      //! Replace the list of recipients of a given message
+      //! identification number. Must be called with the writer
+      //! lock held.
+      //! @param id message identification number.
+      //! @param list new list of recipients.
+      void
+      publish(uint16_t id, const RecipientList* list);
+
+      //! Free retired lists if no thread is traversing the table.
+      void
+      reclaim(void) const;
+
       //! Non - copyable.
       Bus(Bus const&);
 
@@ -0,0 +1,385 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+// Automatically generated.                                                 *
+//***************************************************************************
+// IMC XML MD5: f6949699028e223e632a47085b7afe9f                            *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/IMC/Compact.hpp>
+#include <DUNE/IMC/Macros.hpp>
+#include <DUNE/IMC/Definitions.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    static void
+    encodeEstimatedState(const EstimatedState* msg, const EstimatedState* ref, BitWriter& w__)
+    {
+      w__.put(msg->lat, ref ? &ref->lat : NULL, -1.5707963267948966, 1e-07, 25, 12);
+      w__.put(msg->lon, ref ? &ref->lon : NULL, -3.141592653589793, 1e-07, 26, 12);
+      w__.put(msg->height, ref ? &ref->height : NULL, -500.0, 0.5, 15, 6);
+      w__.put(msg->x, ref ? &ref->x : NULL, -10000.0, 0.1, 18, 10);
+      w__.put(msg->y, ref ? &ref->y : NULL, -10000.0, 0.1, 18, 10);
+      w__.put(msg->z, ref ? &ref->z : NULL, -1000.0, 0.1, 15, 8);
+      w__.put(msg->phi, ref ? &ref->phi : NULL, -3.141592653589793, 0.01, 10, 5);
+      w__.put(msg->theta, ref ? &ref->theta : NULL, -3.141592653589793, 0.01, 10, 5);
+      w__.put(msg->psi, ref ? &ref->psi : NULL, -3.141592653589793, 0.01, 10, 6);
+      w__.put(msg->u, ref ? &ref->u : NULL, -10.0, 0.02, 10, 5);
+      w__.put(msg->v, ref ? &ref->v : NULL, -10.0, 0.02, 10, 5);
+      w__.put(msg->w, ref ? &ref->w : NULL, -10.0, 0.02, 10, 5);
+      w__.put(msg->depth, ref ? &ref->depth : NULL, 0.0, 0.1, 14, 8);
+      w__.put(msg->alt, ref ? &ref->alt : NULL, -1.0, 0.1, 14, 8);
+    }
+
+    static void
+    decodeEstimatedState(EstimatedState* msg, const EstimatedState* ref, BitReader& r__)
+    {
+      r__.get(msg->lat, ref ? &ref->lat : NULL, -1.5707963267948966, 1e-07, 25, 12);
+      r__.get(msg->lon, ref ? &ref->lon : NULL, -3.141592653589793, 1e-07, 26, 12);
+      r__.get(msg->height, ref ? &ref->height : NULL, -500.0, 0.5, 15, 6);
+      r__.get(msg->x, ref ? &ref->x : NULL, -10000.0, 0.1, 18, 10);
+      r__.get(msg->y, ref ? &ref->y : NULL, -10000.0, 0.1, 18, 10);
+      r__.get(msg->z, ref ? &ref->z : NULL, -1000.0, 0.1, 15, 8);
+      r__.get(msg->phi, ref ? &ref->phi : NULL, -3.141592653589793, 0.01, 10, 5);
+      r__.get(msg->theta, ref ? &ref->theta : NULL, -3.141592653589793, 0.01, 10, 5);
+      r__.get(msg->psi, ref ? &ref->psi : NULL, -3.141592653589793, 0.01, 10, 6);
+      r__.get(msg->u, ref ? &ref->u : NULL, -10.0, 0.02, 10, 5);
+      r__.get(msg->v, ref ? &ref->v : NULL, -10.0, 0.02, 10, 5);
+      r__.get(msg->w, ref ? &ref->w : NULL, -10.0, 0.02, 10, 5);
+      r__.get(msg->depth, ref ? &ref->depth : NULL, 0.0, 0.1, 14, 8);
+      r__.get(msg->alt, ref ? &ref->alt : NULL, -1.0, 0.1, 14, 8);
+    }
+
+    static void
+    encodeVehicleState(const VehicleState* msg, const VehicleState* ref, BitWriter& w__)
+    {
+      w__.put(msg->op_mode, ref ? &ref->op_mode : NULL, 0.0, 1.0, 3, 0);
+      w__.put(msg->error_count, ref ? &ref->error_count : NULL, 0.0, 1.0, 8, 0);
+      w__.put(msg->maneuver_type, ref ? &ref->maneuver_type : NULL, 0.0, 1.0, 16, 0);
+      w__.put(msg->maneuver_eta, ref ? &ref->maneuver_eta : NULL, 0.0, 1.0, 16, 8);
+      w__.put(msg->flags, ref ? &ref->flags : NULL, 0.0, 1.0, 8, 0);
+    }
+
+    static void
+    decodeVehicleState(VehicleState* msg, const VehicleState* ref, BitReader& r__)
+    {
+      r__.get(msg->op_mode, ref ? &ref->op_mode : NULL, 0.0, 1.0, 3, 0);
+      r__.get(msg->error_count, ref ? &ref->error_count : NULL, 0.0, 1.0, 8, 0);
+      r__.get(msg->maneuver_type, ref ? &ref->maneuver_type : NULL, 0.0, 1.0, 16, 0);
+      r__.get(msg->maneuver_eta, ref ? &ref->maneuver_eta : NULL, 0.0, 1.0, 16, 8);
+      r__.get(msg->flags, ref ? &ref->flags : NULL, 0.0, 1.0, 8, 0);
+    }
+
+    static void
+    encodePlanControlState(const PlanControlState* msg, const PlanControlState* ref, BitWriter& w__)
+    {
+      w__.put(msg->state, ref ? &ref->state : NULL, 0.0, 1.0, 2, 0);
+      w__.put(msg->plan_eta, ref ? &ref->plan_eta : NULL, -1.0, 1.0, 18, 8);
+      w__.put(msg->plan_progress, ref ? &ref->plan_progress : NULL, -1.0, 0.5, 8, 4);
+      w__.put(msg->man_type, ref ? &ref->man_type : NULL, 0.0, 1.0, 16, 0);
+      w__.put(msg->man_eta, ref ? &ref->man_eta : NULL, -1.0, 1.0, 16, 8);
+      w__.put(msg->last_outcome, ref ? &ref->last_outcome : NULL, 0.0, 1.0, 2, 0);
+    }
+
+    static void
+    decodePlanControlState(PlanControlState* msg, const PlanControlState* ref, BitReader& r__)
+    {
+      r__.get(msg->state, ref ? &ref->state : NULL, 0.0, 1.0, 2, 0);
+      r__.get(msg->plan_eta, ref ? &ref->plan_eta : NULL, -1.0, 1.0, 18, 8);
+      r__.get(msg->plan_progress, ref ? &ref->plan_progress : NULL, -1.0, 0.5, 8, 4);
+      r__.get(msg->man_type, ref ? &ref->man_type : NULL, 0.0, 1.0, 16, 0);
+      r__.get(msg->man_eta, ref ? &ref->man_eta : NULL, -1.0, 1.0, 16, 8);
+      r__.get(msg->last_outcome, ref ? &ref->last_outcome : NULL, 0.0, 1.0, 2, 0);
+    }
+
+    static void
+    encodeFuelLevel(const FuelLevel* msg, const FuelLevel* ref, BitWriter& w__)
+    {
+      w__.put(msg->value, ref ? &ref->value : NULL, 0.0, 0.5, 8, 4);
+      w__.put(msg->confidence, ref ? &ref->confidence : NULL, 0.0, 1.0, 7, 0);
+    }
+
+    static void
+    decodeFuelLevel(FuelLevel* msg, const FuelLevel* ref, BitReader& r__)
+    {
+      r__.get(msg->value, ref ? &ref->value : NULL, 0.0, 0.5, 8, 4);
+      r__.get(msg->confidence, ref ? &ref->confidence : NULL, 0.0, 1.0, 7, 0);
+    }
+
+    static void
+    encodeVoltage(const Voltage* msg, const Voltage* ref, BitWriter& w__)
+    {
+      w__.put(msg->value, ref ? &ref->value : NULL, 0.0, 0.01, 14, 6);
+    }
+
+    static void
+    decodeVoltage(Voltage* msg, const Voltage* ref, BitReader& r__)
+    {
+      r__.get(msg->value, ref ? &ref->value : NULL, 0.0, 0.01, 14, 6);
+    }
+
+    static void
+    encodeTemperature(const Temperature* msg, const Temperature* ref, BitWriter& w__)
+    {
+      w__.put(msg->value, ref ? &ref->value : NULL, -5.0, 0.01, 13, 6);
+    }
+
+    static void
+    decodeTemperature(Temperature* msg, const Temperature* ref, BitReader& r__)
+    {
+      r__.get(msg->value, ref ? &ref->value : NULL, -5.0, 0.01, 13, 6);
+    }
+
+    static void
+    encodeRpm(const Rpm* msg, const Rpm* ref, BitWriter& w__)
+    {
+      w__.put(msg->value, ref ? &ref->value : NULL, -4000.0, 1.0, 13, 6);
+    }
+
+    static void
+    decodeRpm(Rpm* msg, const Rpm* ref, BitReader& r__)
+    {
+      r__.get(msg->value, ref ? &ref->value : NULL, -4000.0, 1.0, 13, 6);
+    }
+
+    unsigned
+    getCompactCode(uint16_t id)
+    {
+      switch (id)
+      {
+        case DUNE_IMC_ESTIMATEDSTATE:
+        return 1;
+        case DUNE_IMC_VEHICLESTATE:
+        return 2;
+        case DUNE_IMC_PLANCONTROLSTATE:
+        return 3;
+        case DUNE_IMC_FUELLEVEL:
+        return 4;
+        case DUNE_IMC_VOLTAGE:
+        return 5;
+        case DUNE_IMC_TEMPERATURE:
+        return 6;
+        case DUNE_IMC_RPM:
+        return 7;
+        default:
+        return 0;
+      }
+    }
+
+    uint16_t
+    getCompactId(unsigned code)
+    {
+      switch (code)
+      {
+        case 1:
+        return DUNE_IMC_ESTIMATEDSTATE;
+        case 2:
+        return DUNE_IMC_VEHICLESTATE;
+        case 3:
+        return DUNE_IMC_PLANCONTROLSTATE;
+        case 4:
+        return DUNE_IMC_FUELLEVEL;
+        case 5:
+        return DUNE_IMC_VOLTAGE;
+        case 6:
+        return DUNE_IMC_TEMPERATURE;
+        case 7:
+        return DUNE_IMC_RPM;
+        default:
+        throw InvalidMessageId(code);
+      }
+    }
+
+    unsigned
+    getCompactMaximumBits(uint16_t id)
+    {
+      switch (id)
+      {
+        case DUNE_IMC_ESTIMATEDSTATE:
+        return 233;
+        case DUNE_IMC_VEHICLESTATE:
+        return 57;
+        case DUNE_IMC_PLANCONTROLSTATE:
+        return 71;
+        case DUNE_IMC_FUELLEVEL:
+        return 18;
+        case DUNE_IMC_VOLTAGE:
+        return 16;
+        case DUNE_IMC_TEMPERATURE:
+        return 15;
+        case DUNE_IMC_RPM:
+        return 15;
+        default:
+        return 0;
+      }
+    }
+
+    void
+    encodeCompact(const Message* msg, const Message* ref, BitWriter& w__)
+    {
+      switch (msg->getId())
+      {
+        case DUNE_IMC_ESTIMATEDSTATE:
+        encodeEstimatedState(static_cast<const EstimatedState*>(msg), static_cast<const EstimatedState*>(ref), w__);
+        break;
+        case DUNE_IMC_VEHICLESTATE:
+        encodeVehicleState(static_cast<const VehicleState*>(msg), static_cast<const VehicleState*>(ref), w__);
+        break;
+        case DUNE_IMC_PLANCONTROLSTATE:
+        encodePlanControlState(static_cast<const PlanControlState*>(msg), static_cast<const PlanControlState*>(ref), w__);
+        break;
+        case DUNE_IMC_FUELLEVEL:
+        encodeFuelLevel(static_cast<const FuelLevel*>(msg), static_cast<const FuelLevel*>(ref), w__);
+        break;
+        case DUNE_IMC_VOLTAGE:
+        encodeVoltage(static_cast<const Voltage*>(msg), static_cast<const Voltage*>(ref), w__);
+        break;
+        case DUNE_IMC_TEMPERATURE:
+        encodeTemperature(static_cast<const Temperature*>(msg), static_cast<const Temperature*>(ref), w__);
+        break;
+        case DUNE_IMC_RPM:
+        encodeRpm(static_cast<const Rpm*>(msg), static_cast<const Rpm*>(ref), w__);
+        break;
+        default:
+        throw InvalidMessageId(msg->getId());
+      }
+    }
+
+    Message*
+    decodeCompact(unsigned code, const Message* ref, BitReader& r__)
+    {
+      switch (code)
+      {
+        case 1:
+        {
+          EstimatedState* msg = new EstimatedState;
+          try
+          {
+            decodeEstimatedState(msg, static_cast<const EstimatedState*>(ref), r__);
+          }
+          catch (...)
+          {
+            delete msg;
+            throw;
+          }
+          return msg;
+        }
+        case 2:
+        {
+          VehicleState* msg = new VehicleState;
+          try
+          {
+            decodeVehicleState(msg, static_cast<const VehicleState*>(ref), r__);
+          }
+          catch (...)
+          {
+            delete msg;
+            throw;
+          }
+          return msg;
+        }
+        case 3:
+        {
+          PlanControlState* msg = new PlanControlState;
+          try
+          {
+            decodePlanControlState(msg, static_cast<const PlanControlState*>(ref), r__);
+          }
+          catch (...)
+          {
+            delete msg;
+            throw;
+          }
+          return msg;
+        }
+        case 4:
+        {
+          FuelLevel* msg = new FuelLevel;
+          try
+          {
+            decodeFuelLevel(msg, static_cast<const FuelLevel*>(ref), r__);
+          }
+          catch (...)
+          {
+            delete msg;
+            throw;
+          }
+          return msg;
+        }
+        case 5:
+        {
+          Voltage* msg = new Voltage;
+          try
+          {
+            decodeVoltage(msg, static_cast<const Voltage*>(ref), r__);
+          }
+          catch (...)
+          {
+            delete msg;
+            throw;
+          }
+          return msg;
+        }
+        case 6:
+        {
+          Temperature* msg = new Temperature;
+          try
+          {
+            decodeTemperature(msg, static_cast<const Temperature*>(ref), r__);
+          }
+          catch (...)
+          {
+            delete msg;
+            throw;
+          }
+          return msg;
+        }
+        case 7:
+        {
+          Rpm* msg = new Rpm;
+          try
+          {
+            decodeRpm(msg, static_cast<const Rpm*>(ref), r__);
+          }
+          catch (...)
+          {
+            delete msg;
+            throw;
+          }
+          return msg;
+        }
+        default:
+        throw InvalidMessageId(code);
+      }
+    }
+  }
+}
@@ -0,0 +1,89 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+// Automatically generated.                                                 *
+//***************************************************************************
+// IMC XML MD5: f6949699028e223e632a47085b7afe9f                            *
+//***************************************************************************
+
+#ifndef DUNE_IMC_COMPACT_HPP_INCLUDED_
+#define DUNE_IMC_COMPACT_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/BitPacking.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Get the compact code of a message.
+    //! @param[in] id message identification number.
+    //! @return compact code or 0 if the message has no compact encoding.
+
+    unsigned
+    getCompactCode(uint16_t id);
+
+    //! Get the message identification number of a compact code.
+    //! @param[in] code compact code.
+    //! @return message identification number.
+
+    uint16_t
+    getCompactId(unsigned code);
+
+    //! Get the maximum number of bits of the compact encoding of a
+    //! message, excluding framing.
+    //! @param[in] id message identification number.
+    //! @return number of bits or 0 if the message has no compact encoding.
+
+    unsigned
+    getCompactMaximumBits(uint16_t id);
+
+    //! Encode the fields of a message.
+    //! @param[in] msg message.
+    //! @param[in] ref reference message of the same type or NULL.
+    //! @param[in] w__ bit writer.
+    //! @throw InvalidMessageId if the message has no compact encoding.
+
+    void
+    encodeCompact(const Message* msg, const Message* ref, BitWriter& w__);
+
+    //! Decode the fields of a message.
+    //! @param[in] code compact code.
+    //! @param[in] ref reference message of the same type or NULL.
+    //! @param[in] r__ bit reader.
+    //! @return new message.
+    //! @throw InvalidMessageId if the compact code is unknown.
+
+    Message*
+    decodeCompact(unsigned code, const Message* ref, BitReader& r__);
+  }
+}
+
+#endif
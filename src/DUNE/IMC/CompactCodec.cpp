@@ -0,0 +1,245 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/IMC/CompactCodec.hpp>
+#include <DUNE/IMC/Compact.hpp>
+#include <DUNE/IMC/Factory.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Number of bits of the compact code.
+    static const unsigned c_code_bits = 8;
+    //! Number of bits of sequence numbers.
+    static const unsigned c_seq_bits = 4;
+    //! Capacity of the scratch buffer in bytes.
+    static const unsigned c_scratch_size = 512;
+
+    CompactCodec::CompactCodec(void):
+      m_scratch(c_scratch_size)
+    { }
+
+    CompactCodec::~CompactCodec(void)
+    {
+      reset();
+    }
+
+    bool
+    CompactCodec::isSupported(uint16_t id)
+    {
+      return getCompactCode(id) != 0;
+    }
+
+    bool
+    CompactCodec::encode(const Message* msg, BitWriter& writer, unsigned* seq)
+    {
+      unsigned code = getCompactCode(msg->getId());
+      if (code == 0)
+        throw InvalidMessageId(msg->getId());
+
+      Outgoing& tx = getOutgoing(msg->getId());
+      unsigned n = tx.count % c_window;
+
+      // The reference must not have been overwritten on the peer.
+      const Message* ref = NULL;
+      if (tx.acked != NULL && tx.count - tx.acked_count < c_window)
+        ref = tx.acked;
+
+      m_scratch.resetBuffer();
+      BitWriter w(m_scratch);
+      w.putBits(code, c_code_bits);
+      w.putBits(n, c_seq_bits);
+      w.putBits(ref != NULL, 1);
+      if (ref != NULL)
+        w.putBits(tx.acked_count % c_window, c_seq_bits);
+      encodeCompact(msg, ref, w);
+
+      unsigned bits = (unsigned)w.getBits();
+      if (bits > writer.getRemaining())
+        return false;
+
+      // Keep the message as the peer will see it, so that deltas are
+      // computed against exactly the same quantised values.
+      BitReader r(m_scratch);
+      r.getBits(c_code_bits + c_seq_bits + 1 + (ref != NULL ? c_seq_bits : 0));
+      Message* sent = decodeCompact(code, ref, r);
+
+      delete tx.sent[n];
+      tx.sent[n] = sent;
+      tx.sent_count[n] = tx.count++;
+
+      BitReader copy(m_scratch);
+      while (bits > 0)
+      {
+        unsigned count = bits < 32 ? bits : 32;
+        writer.putBits(copy.getBits(count), count);
+        bits -= count;
+      }
+
+      if (seq != NULL)
+        *seq = n;
+
+      return true;
+    }
+
+    void
+    CompactCodec::acknowledge(uint16_t id, unsigned seq)
+    {
+      std::map<uint16_t, Outgoing*>::iterator itr = m_tx.find(id);
+      if (itr == m_tx.end())
+        return;
+
+      Outgoing* tx = itr->second;
+      unsigned n = seq % c_window;
+      if (tx->sent[n] == NULL)
+        return;
+
+      // Ignore late acknowledgements of older messages.
+      if (tx->acked != NULL && tx->sent_count[n] < tx->acked_count)
+        return;
+
+      delete tx->acked;
+      tx->acked = tx->sent[n];
+      tx->acked_count = tx->sent_count[n];
+      tx->sent[n] = NULL;
+    }
+
+    Message*
+    CompactCodec::decode(BitReader& reader, unsigned* seq)
+    {
+      while (reader.getRemaining() >= c_code_bits)
+      {
+        unsigned code = reader.getBits(c_code_bits);
+        if (code == 0)
+          return NULL;
+
+        Incoming& rx = getIncoming(getCompactId(code));
+        unsigned n = reader.getBits(c_seq_bits);
+
+        const Message* ref = NULL;
+        Message* blank = NULL;
+        if (reader.getBits(1))
+        {
+          ref = rx.received[reader.getBits(c_seq_bits)];
+
+          // Reference is unknown: decode against an empty message to
+          // skip the fields and drop the result.
+          if (ref == NULL)
+          {
+            blank = Factory::produce(getCompactId(code));
+            ref = blank;
+          }
+        }
+
+        Message* msg = NULL;
+        try
+        {
+          msg = decodeCompact(code, ref, reader);
+        }
+        catch (...)
+        {
+          delete blank;
+          throw;
+        }
+
+        if (blank != NULL)
+        {
+          delete blank;
+          delete msg;
+          continue;
+        }
+
+        delete rx.received[n];
+        rx.received[n] = msg->clone();
+
+        if (seq != NULL)
+          *seq = n;
+
+        return msg;
+      }
+
+      return NULL;
+    }
+
+    void
+    CompactCodec::reset(void)
+    {
+      std::map<uint16_t, Outgoing*>::iterator tx = m_tx.begin();
+      for (; tx != m_tx.end(); ++tx)
+      {
+        for (unsigned i = 0; i < c_window; ++i)
+          delete tx->second->sent[i];
+        delete tx->second->acked;
+        delete tx->second;
+      }
+      m_tx.clear();
+
+      std::map<uint16_t, Incoming*>::iterator rx = m_rx.begin();
+      for (; rx != m_rx.end(); ++rx)
+      {
+        for (unsigned i = 0; i < c_window; ++i)
+          delete rx->second->received[i];
+        delete rx->second;
+      }
+      m_rx.clear();
+    }
+
+    CompactCodec::Outgoing&
+    CompactCodec::getOutgoing(uint16_t id)
+    {
+      std::map<uint16_t, Outgoing*>::iterator itr = m_tx.find(id);
+      if (itr != m_tx.end())
+        return *itr->second;
+
+      Outgoing* tx = new Outgoing;
+      std::memset(tx, 0, sizeof(Outgoing));
+      m_tx[id] = tx;
+      return *tx;
+    }
+
+    CompactCodec::Incoming&
+    CompactCodec::getIncoming(uint16_t id)
+    {
+      std::map<uint16_t, Incoming*>::iterator itr = m_rx.find(id);
+      if (itr != m_rx.end())
+        return *itr->second;
+
+      Incoming* rx = new Incoming;
+      std::memset(rx, 0, sizeof(Incoming));
+      m_rx[id] = rx;
+      return *rx;
+    }
+  }
+}
@@ -0,0 +1,174 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef DUNE_IMC_COMPACT_CODEC_HPP_INCLUDED_
+#define DUNE_IMC_COMPACT_CODEC_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <map>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Utils/BitBuffer.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/BitPacking.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM CompactCodec;
+
+    //! Stateful compact codec for narrowband links (acoustic modems,
+    //! Iridium SBD). Messages are quantised and bit-packed using the
+    //! generated encoders (see Compact.hpp) and, once the peer has
+    //! acknowledged a message of a given type, subsequent messages of
+    //! that type are delta-encoded against it.
+    //!
+    //! Each encoded message is framed as:
+    //! - compact code (8 bits, 0 marks the end of the frame).
+    //! - sequence number (4 bits).
+    //! - delta flag (1 bit).
+    //! - sequence number of the reference (4 bits, delta only).
+    //! - fields.
+    //!
+    //! One instance should be used per peer. The caller is
+    //! responsible for calling acknowledge() when the peer confirms
+    //! the reception of a message; messages delta-encoded against a
+    //! reference the receiver does not hold are dropped on decoding.
+    //!
+    //! Usage:
+    //! @code
+    //! Utils::BitBuffer bfr(32);
+    //! IMC::BitWriter writer(bfr);
+    //! while (codec.encode(next_message, writer, &seq))
+    //!   ...
+    //! frame.data.assign(bfr.getBuffer(), bfr.getBuffer() + writer.getSize());
+    //!
+    //! IMC::BitReader reader(bfr);
+    //! Message* msg = NULL;
+    //! while ((msg = codec.decode(reader, &seq)) != NULL)
+    //! {
+    //!   ...
+    //!   delete msg;
+    //! }
+    //! @endcode
+    class CompactCodec
+    {
+    public:
+      //! Number of distinct sequence numbers.
+      static const unsigned c_window = 16;
+
+      //! Constructor.
+      CompactCodec(void);
+
+      //! Destructor.
+      ~CompactCodec(void);
+
+      //! Test if a message type has a compact encoding.
+      //! @param[in] id message identification number.
+      //! @return true if supported, false otherwise.
+      static bool
+      isSupported(uint16_t id);
+
+      //! Encode a message.
+      //! @param[in] msg message.
+      //! @param[in] writer destination.
+      //! @param[out] seq sequence number assigned to the message.
+      //! @return true if the message was written, false if it does
+      //! not fit in the writer's buffer (nothing is written).
+      //! @throw InvalidMessageId if the message has no compact encoding.
+      bool
+      encode(const Message* msg, BitWriter& writer, unsigned* seq = NULL);
+
+      //! Acknowledge the reception of a message by the peer, making
+      //! it the reference of subsequent messages of the same type.
+      //! @param[in] id message identification number.
+      //! @param[in] seq sequence number.
+      void
+      acknowledge(uint16_t id, unsigned seq);
+
+      //! Decode the next message.
+      //! @param[in] reader source.
+      //! @param[out] seq sequence number of the message.
+      //! @return new message or NULL if there are no more messages.
+      Message*
+      decode(BitReader& reader, unsigned* seq = NULL);
+
+      //! Discard all references.
+      void
+      reset(void);
+
+    private:
+      //! State of outgoing messages of one type.
+      struct Outgoing
+      {
+        //! Number of messages sent.
+        uint32_t count;
+        //! Messages sent, as decoded by the peer, by sequence number.
+        Message* sent[c_window];
+        //! Count of each sent message.
+        uint32_t sent_count[c_window];
+        //! Last acknowledged message.
+        Message* acked;
+        //! Count of last acknowledged message.
+        uint32_t acked_count;
+      };
+
+      //! State of incoming messages of one type.
+      struct Incoming
+      {
+        //! Messages received by sequence number.
+        Message* received[c_window];
+      };
+
+      //! Outgoing state by message identification number.
+      std::map<uint16_t, Outgoing*> m_tx;
+      //! Incoming state by message identification number.
+      std::map<uint16_t, Incoming*> m_rx;
+      //! Scratch buffer.
+      Utils::BitBuffer m_scratch;
+
+      Outgoing&
+      getOutgoing(uint16_t id);
+
+      Incoming&
+      getIncoming(uint16_t id);
+
+      // Non-copyable.
+      CompactCodec(const CompactCodec&);
+
+      CompactCodec&
+      operator=(const CompactCodec&);
+    };
+  }
+}
+
+#endif
@@ -118,6 +118,24 @@ namespace DUNE
       IMC::toJSON(os__, "description", description, nindent__);
     }
 
+    void
+    EntityState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"state\":", state);
+      w__.field(",\"flags\":", flags);
+      w__.field(",\"description\":", description);
+    }
+
+    bool
+    EntityState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "state")) r__.read(state);
+      else if (JSONReader::match(key__, size__, "flags")) r__.read(flags);
+      else if (JSONReader::match(key__, size__, "description")) r__.read(description);
+      else return false;
+      return true;
+    }
+
     QueryEntityState::QueryEntityState(void)
     {
       m_header.mgid = 2;
@@ -227,6 +245,12 @@ namespace DUNE
       return bfr__ - start__;
     }
 
+    bool
+    EntityInfo::hasSubId(void) const
+    {
+      return true;
+    }
+
     uint16_t
     EntityInfo::getSubId(void) const
     {
@@ -249,6 +273,28 @@ namespace DUNE
       IMC::toJSON(os__, "deact_time", deact_time, nindent__);
     }
 
+    void
+    EntityInfo::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"id\":", id);
+      w__.field(",\"label\":", label);
+      w__.field(",\"component\":", component);
+      w__.field(",\"act_time\":", act_time);
+      w__.field(",\"deact_time\":", deact_time);
+    }
+
+    bool
+    EntityInfo::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "id")) r__.read(id);
+      else if (JSONReader::match(key__, size__, "label")) r__.read(label);
+      else if (JSONReader::match(key__, size__, "component")) r__.read(component);
+      else if (JSONReader::match(key__, size__, "act_time")) r__.read(act_time);
+      else if (JSONReader::match(key__, size__, "deact_time")) r__.read(deact_time);
+      else return false;
+      return true;
+    }
+
     QueryEntityInfo::QueryEntityInfo(void)
     {
       m_header.mgid = 4;
@@ -299,6 +345,12 @@ namespace DUNE
       return bfr__ - start__;
     }
 
+    bool
+    QueryEntityInfo::hasSubId(void) const
+    {
+      return true;
+    }
+
     uint16_t
     QueryEntityInfo::getSubId(void) const
     {
@@ -317,6 +369,20 @@ namespace DUNE
       IMC::toJSON(os__, "id", id, nindent__);
     }
 
+    void
+    QueryEntityInfo::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"id\":", id);
+    }
+
+    bool
+    QueryEntityInfo::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "id")) r__.read(id);
+      else return false;
+      return true;
+    }
+
     EntityList::EntityList(void)
     {
       m_header.mgid = 5;
@@ -379,6 +445,22 @@ namespace DUNE
       IMC::toJSON(os__, "list", list, nindent__);
     }
 
+    void
+    EntityList::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"op\":", op);
+      w__.field(",\"list\":", list);
+    }
+
+    bool
+    EntityList::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "list")) r__.read(list);
+      else return false;
+      return true;
+    }
+
     CpuUsage::CpuUsage(void)
     {
       m_header.mgid = 7;
@@ -448,6 +530,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    CpuUsage::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    CpuUsage::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     TransportBindings::TransportBindings(void)
     {
       m_header.mgid = 8;
@@ -510,6 +606,22 @@ namespace DUNE
       IMC::toJSON(os__, "message_id", message_id, nindent__);
     }
 
+    void
+    TransportBindings::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"consumer\":", consumer);
+      w__.field(",\"message_id\":", message_id);
+    }
+
+    bool
+    TransportBindings::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "consumer")) r__.read(consumer);
+      else if (JSONReader::match(key__, size__, "message_id")) r__.read(message_id);
+      else return false;
+      return true;
+    }
+
     RestartSystem::RestartSystem(void)
     {
       m_header.mgid = 9;
@@ -566,6 +678,20 @@ namespace DUNE
       IMC::toJSON(os__, "type", type, nindent__);
     }
 
+    void
+    RestartSystem::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"type\":", type);
+    }
+
+    bool
+    RestartSystem::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else return false;
+      return true;
+    }
+
     DevCalibrationControl::DevCalibrationControl(void)
     {
       m_header.mgid = 12;
@@ -622,6 +748,20 @@ namespace DUNE
       IMC::toJSON(os__, "op", op, nindent__);
     }
 
+    void
+    DevCalibrationControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"op\":", op);
+    }
+
+    bool
+    DevCalibrationControl::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else return false;
+      return true;
+    }
+
     DevCalibrationState::DevCalibrationState(void)
     {
       m_header.mgid = 13;
@@ -696,6 +836,26 @@ namespace DUNE
       IMC::toJSON(os__, "flags", flags, nindent__);
     }
 
+    void
+    DevCalibrationState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"total_steps\":", total_steps);
+      w__.field(",\"step_number\":", step_number);
+      w__.field(",\"step\":", step);
+      w__.field(",\"flags\":", flags);
+    }
+
+    bool
+    DevCalibrationState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "total_steps")) r__.read(total_steps);
+      else if (JSONReader::match(key__, size__, "step_number")) r__.read(step_number);
+      else if (JSONReader::match(key__, size__, "step")) r__.read(step);
+      else if (JSONReader::match(key__, size__, "flags")) r__.read(flags);
+      else return false;
+      return true;
+    }
+
     EntityActivationState::EntityActivationState(void)
     {
       m_header.mgid = 14;
@@ -758,6 +918,22 @@ namespace DUNE
       IMC::toJSON(os__, "error", error, nindent__);
     }
 
+    void
+    EntityActivationState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"state\":", state);
+      w__.field(",\"error\":", error);
+    }
+
+    bool
+    EntityActivationState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "state")) r__.read(state);
+      else if (JSONReader::match(key__, size__, "error")) r__.read(error);
+      else return false;
+      return true;
+    }
+
     QueryEntityActivationState::QueryEntityActivationState(void)
     {
       m_header.mgid = 15;
@@ -970,6 +1146,54 @@ namespace DUNE
       IMC::toJSON(os__, "rpm_rate_max", rpm_rate_max, nindent__);
     }
 
+    void
+    VehicleOperationalLimits::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"op\":", op);
+      w__.field(",\"speed_min\":", speed_min);
+      w__.field(",\"speed_max\":", speed_max);
+      w__.field(",\"long_accel\":", long_accel);
+      w__.field(",\"alt_max_msl\":", alt_max_msl);
+      w__.field(",\"dive_fraction_max\":", dive_fraction_max);
+      w__.field(",\"climb_fraction_max\":", climb_fraction_max);
+      w__.field(",\"bank_max\":", bank_max);
+      w__.field(",\"p_max\":", p_max);
+      w__.field(",\"pitch_min\":", pitch_min);
+      w__.field(",\"pitch_max\":", pitch_max);
+      w__.field(",\"q_max\":", q_max);
+      w__.field(",\"g_min\":", g_min);
+      w__.field(",\"g_max\":", g_max);
+      w__.field(",\"g_lat_max\":", g_lat_max);
+      w__.field(",\"rpm_min\":", rpm_min);
+      w__.field(",\"rpm_max\":", rpm_max);
+      w__.field(",\"rpm_rate_max\":", rpm_rate_max);
+    }
+
+    bool
+    VehicleOperationalLimits::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "speed_min")) r__.read(speed_min);
+      else if (JSONReader::match(key__, size__, "speed_max")) r__.read(speed_max);
+      else if (JSONReader::match(key__, size__, "long_accel")) r__.read(long_accel);
+      else if (JSONReader::match(key__, size__, "alt_max_msl")) r__.read(alt_max_msl);
+      else if (JSONReader::match(key__, size__, "dive_fraction_max")) r__.read(dive_fraction_max);
+      else if (JSONReader::match(key__, size__, "climb_fraction_max")) r__.read(climb_fraction_max);
+      else if (JSONReader::match(key__, size__, "bank_max")) r__.read(bank_max);
+      else if (JSONReader::match(key__, size__, "p_max")) r__.read(p_max);
+      else if (JSONReader::match(key__, size__, "pitch_min")) r__.read(pitch_min);
+      else if (JSONReader::match(key__, size__, "pitch_max")) r__.read(pitch_max);
+      else if (JSONReader::match(key__, size__, "q_max")) r__.read(q_max);
+      else if (JSONReader::match(key__, size__, "g_min")) r__.read(g_min);
+      else if (JSONReader::match(key__, size__, "g_max")) r__.read(g_max);
+      else if (JSONReader::match(key__, size__, "g_lat_max")) r__.read(g_lat_max);
+      else if (JSONReader::match(key__, size__, "rpm_min")) r__.read(rpm_min);
+      else if (JSONReader::match(key__, size__, "rpm_max")) r__.read(rpm_max);
+      else if (JSONReader::match(key__, size__, "rpm_rate_max")) r__.read(rpm_rate_max);
+      else return false;
+      return true;
+    }
+
     MsgList::MsgList(void)
     {
       m_header.mgid = 20;
@@ -1027,6 +1251,20 @@ namespace DUNE
       msgs.toJSON(os__, "msgs", nindent__);
     }
 
+    void
+    MsgList::fieldsToJSON(JSONWriter& w__) const
+    {
+      msgs.toJSON(w__, ",\"msgs\":");
+    }
+
+    bool
+    MsgList::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "msgs")) msgs.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     MsgList::setTimeStampNested(double value__)
     {
@@ -1223,6 +1461,54 @@ namespace DUNE
       IMC::toJSON(os__, "svz", svz, nindent__);
     }
 
+    void
+    SimulatedState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"height\":", height);
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+      w__.field(",\"phi\":", phi);
+      w__.field(",\"theta\":", theta);
+      w__.field(",\"psi\":", psi);
+      w__.field(",\"u\":", u);
+      w__.field(",\"v\":", v);
+      w__.field(",\"w\":", w);
+      w__.field(",\"p\":", p);
+      w__.field(",\"q\":", q);
+      w__.field(",\"r\":", r);
+      w__.field(",\"svx\":", svx);
+      w__.field(",\"svy\":", svy);
+      w__.field(",\"svz\":", svz);
+    }
+
+    bool
+    SimulatedState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "height")) r__.read(height);
+      else if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "phi")) r__.read(phi);
+      else if (JSONReader::match(key__, size__, "theta")) r__.read(theta);
+      else if (JSONReader::match(key__, size__, "psi")) r__.read(psi);
+      else if (JSONReader::match(key__, size__, "u")) r__.read(u);
+      else if (JSONReader::match(key__, size__, "v")) r__.read(v);
+      else if (JSONReader::match(key__, size__, "w")) r__.read(w);
+      else if (JSONReader::match(key__, size__, "p")) r__.read(p);
+      else if (JSONReader::match(key__, size__, "q")) r__.read(q);
+      else if (JSONReader::match(key__, size__, "r")) r__.read(r);
+      else if (JSONReader::match(key__, size__, "svx")) r__.read(svx);
+      else if (JSONReader::match(key__, size__, "svy")) r__.read(svy);
+      else if (JSONReader::match(key__, size__, "svz")) r__.read(svz);
+      else return false;
+      return true;
+    }
+
     LeakSimulation::LeakSimulation(void)
     {
       m_header.mgid = 51;
@@ -1285,6 +1571,22 @@ namespace DUNE
       IMC::toJSON(os__, "entities", entities, nindent__);
     }
 
+    void
+    LeakSimulation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"op\":", op);
+      w__.field(",\"entities\":", entities);
+    }
+
+    bool
+    LeakSimulation::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "entities")) r__.read(entities);
+      else return false;
+      return true;
+    }
+
     UASimulation::UASimulation(void)
     {
       m_header.mgid = 52;
@@ -1353,6 +1655,24 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    UASimulation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"type\":", type);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"data\":", data);
+    }
+
+    bool
+    UASimulation::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "data")) r__.read(data);
+      else return false;
+      return true;
+    }
+
     DynamicsSimParam::DynamicsSimParam(void)
     {
       m_header.mgid = 53;
@@ -1421,6 +1741,24 @@ namespace DUNE
       IMC::toJSON(os__, "bank2p_pgain", bank2p_pgain, nindent__);
     }
 
+    void
+    DynamicsSimParam::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"op\":", op);
+      w__.field(",\"tas2acc_pgain\":", tas2acc_pgain);
+      w__.field(",\"bank2p_pgain\":", bank2p_pgain);
+    }
+
+    bool
+    DynamicsSimParam::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "tas2acc_pgain")) r__.read(tas2acc_pgain);
+      else if (JSONReader::match(key__, size__, "bank2p_pgain")) r__.read(bank2p_pgain);
+      else return false;
+      return true;
+    }
+
     StorageUsage::StorageUsage(void)
     {
       m_header.mgid = 100;
@@ -1496,6 +1834,22 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    StorageUsage::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"available\":", available);
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    StorageUsage::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "available")) r__.read(available);
+      else if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     CacheControl::CacheControl(void)
     {
       m_header.mgid = 101;
@@ -1565,6 +1919,24 @@ namespace DUNE
       message.toJSON(os__, "message", nindent__);
     }
 
+    void
+    CacheControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"op\":", op);
+      w__.field(",\"snapshot\":", snapshot);
+      message.toJSON(w__, ",\"message\":");
+    }
+
+    bool
+    CacheControl::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "snapshot")) r__.read(snapshot);
+      else if (JSONReader::match(key__, size__, "message")) message.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     CacheControl::setTimeStampNested(double value__)
     {
@@ -1672,6 +2044,22 @@ namespace DUNE
       IMC::toJSON(os__, "name", name, nindent__);
     }
 
+    void
+    LoggingControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"op\":", op);
+      w__.field(",\"name\":", name);
+    }
+
+    bool
+    LoggingControl::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "name")) r__.read(name);
+      else return false;
+      return true;
+    }
+
     LogBookEntry::LogBookEntry(void)
     {
       m_header.mgid = 103;
@@ -1746,6 +2134,26 @@ namespace DUNE
       IMC::toJSON(os__, "text", text, nindent__);
     }
 
+    void
+    LogBookEntry::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"type\":", type);
+      w__.field(",\"htime\":", htime);
+      w__.field(",\"context\":", context);
+      w__.field(",\"text\":", text);
+    }
+
+    bool
+    LogBookEntry::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "htime")) r__.read(htime);
+      else if (JSONReader::match(key__, size__, "context")) r__.read(context);
+      else if (JSONReader::match(key__, size__, "text")) r__.read(text);
+      else return false;
+      return true;
+    }
+
     LogBookControl::LogBookControl(void)
     {
       m_header.mgid = 104;
@@ -1815,6 +2223,24 @@ namespace DUNE
       msg.toJSON(os__, "msg", nindent__);
     }
 
+    void
+    LogBookControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"command\":", command);
+      w__.field(",\"htime\":", htime);
+      msg.toJSON(w__, ",\"msg\":");
+    }
+
+    bool
+    LogBookControl::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "command")) r__.read(command);
+      else if (JSONReader::match(key__, size__, "htime")) r__.read(htime);
+      else if (JSONReader::match(key__, size__, "msg")) msg.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     LogBookControl::setTimeStampNested(double value__)
     {
@@ -1907,6 +2333,22 @@ namespace DUNE
       IMC::toJSON(os__, "file", file, nindent__);
     }
 
+    void
+    ReplayControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"op\":", op);
+      w__.field(",\"file\":", file);
+    }
+
+    bool
+    ReplayControl::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "file")) r__.read(file);
+      else return false;
+      return true;
+    }
+
     ClockControl::ClockControl(void)
     {
       m_header.mgid = 106;
@@ -1976,6 +2418,24 @@ namespace DUNE
       IMC::toJSON(os__, "tz", tz, nindent__);
     }
 
+    void
+    ClockControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"op\":", op);
+      w__.field(",\"clock\":", clock);
+      w__.field(",\"tz\":", tz);
+    }
+
+    bool
+    ClockControl::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "clock")) r__.read(clock);
+      else if (JSONReader::match(key__, size__, "tz")) r__.read(tz);
+      else return false;
+      return true;
+    }
+
     HistoricCTD::HistoricCTD(void)
     {
       m_header.mgid = 107;
@@ -2044,6 +2504,24 @@ namespace DUNE
       IMC::toJSON(os__, "depth", depth, nindent__);
     }
 
+    void
+    HistoricCTD::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"conductivity\":", conductivity);
+      w__.field(",\"temperature\":", temperature);
+      w__.field(",\"depth\":", depth);
+    }
+
+    bool
+    HistoricCTD::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "conductivity")) r__.read(conductivity);
+      else if (JSONReader::match(key__, size__, "temperature")) r__.read(temperature);
+      else if (JSONReader::match(key__, size__, "depth")) r__.read(depth);
+      else return false;
+      return true;
+    }
+
     HistoricTelemetry::HistoricTelemetry(void)
     {
       m_header.mgid = 108;
@@ -2124,6 +2602,28 @@ namespace DUNE
       IMC::toJSON(os__, "speed", speed, nindent__);
     }
 
+    void
+    HistoricTelemetry::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"altitude\":", altitude);
+      w__.field(",\"roll\":", roll);
+      w__.field(",\"pitch\":", pitch);
+      w__.field(",\"yaw\":", yaw);
+      w__.field(",\"speed\":", speed);
+    }
+
+    bool
+    HistoricTelemetry::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "altitude")) r__.read(altitude);
+      else if (JSONReader::match(key__, size__, "roll")) r__.read(roll);
+      else if (JSONReader::match(key__, size__, "pitch")) r__.read(pitch);
+      else if (JSONReader::match(key__, size__, "yaw")) r__.read(yaw);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else return false;
+      return true;
+    }
+
     HistoricSonarData::HistoricSonarData(void)
     {
       m_header.mgid = 109;
@@ -2216,6 +2716,32 @@ namespace DUNE
       IMC::toJSON(os__, "sonar_data", sonar_data, nindent__);
     }
 
+    void
+    HistoricSonarData::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"altitude\":", altitude);
+      w__.field(",\"width\":", width);
+      w__.field(",\"length\":", length);
+      w__.field(",\"bearing\":", bearing);
+      w__.field(",\"pxl\":", pxl);
+      w__.field(",\"encoding\":", encoding);
+      w__.field(",\"sonar_data\":", sonar_data);
+    }
+
+    bool
+    HistoricSonarData::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "altitude")) r__.read(altitude);
+      else if (JSONReader::match(key__, size__, "width")) r__.read(width);
+      else if (JSONReader::match(key__, size__, "length")) r__.read(length);
+      else if (JSONReader::match(key__, size__, "bearing")) r__.read(bearing);
+      else if (JSONReader::match(key__, size__, "pxl")) r__.read(pxl);
+      else if (JSONReader::match(key__, size__, "encoding")) r__.read(encoding);
+      else if (JSONReader::match(key__, size__, "sonar_data")) r__.read(sonar_data);
+      else return false;
+      return true;
+    }
+
     HistoricEvent::HistoricEvent(void)
     {
       m_header.mgid = 110;
@@ -2278,6 +2804,22 @@ namespace DUNE
       IMC::toJSON(os__, "type", type, nindent__);
     }
 
+    void
+    HistoricEvent::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"text\":", text);
+      w__.field(",\"type\":", type);
+    }
+
+    bool
+    HistoricEvent::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "text")) r__.read(text);
+      else if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else return false;
+      return true;
+    }
+
     ProfileSample::ProfileSample(void)
     {
       m_header.mgid = 112;
@@ -2340,6 +2882,22 @@ namespace DUNE
       IMC::toJSON(os__, "avg", avg, nindent__);
     }
 
+    void
+    ProfileSample::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"depth\":", depth);
+      w__.field(",\"avg\":", avg);
+    }
+
+    bool
+    ProfileSample::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "depth")) r__.read(depth);
+      else if (JSONReader::match(key__, size__, "avg")) r__.read(avg);
+      else return false;
+      return true;
+    }
+
     VerticalProfile::VerticalProfile(void)
     {
       m_header.mgid = 111;
@@ -2422,13 +2980,35 @@ namespace DUNE
     }
 
     void
-    VerticalProfile::setTimeStampNested(double value__)
+    VerticalProfile::fieldsToJSON(JSONWriter& w__) const
     {
-      samples.setTimeStamp(value__);
+      w__.field(",\"parameter\":", parameter);
+      w__.field(",\"numsamples\":", numsamples);
+      samples.toJSON(w__, ",\"samples\":");
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
     }
 
-    void
-    VerticalProfile::setSourceNested(uint16_t value__)
+    bool
+    VerticalProfile::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "parameter")) r__.read(parameter);
+      else if (JSONReader::match(key__, size__, "numsamples")) r__.read(numsamples);
+      else if (JSONReader::match(key__, size__, "samples")) samples.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else return false;
+      return true;
+    }
+
+    void
+    VerticalProfile::setTimeStampNested(double value__)
+    {
+      samples.setTimeStamp(value__);
+    }
+
+    void
+    VerticalProfile::setSourceNested(uint16_t value__)
     {
       samples.setSource(value__);
     }
@@ -2584,6 +3164,32 @@ namespace DUNE
       IMC::toJSON(os__, "services", services, nindent__);
     }
 
+    void
+    Announce::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"sys_name\":", sys_name);
+      w__.field(",\"sys_type\":", sys_type);
+      w__.field(",\"owner\":", owner);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"height\":", height);
+      w__.field(",\"services\":", services);
+    }
+
+    bool
+    Announce::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "sys_name")) r__.read(sys_name);
+      else if (JSONReader::match(key__, size__, "sys_type")) r__.read(sys_type);
+      else if (JSONReader::match(key__, size__, "owner")) r__.read(owner);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "height")) r__.read(height);
+      else if (JSONReader::match(key__, size__, "services")) r__.read(services);
+      else return false;
+      return true;
+    }
+
     AnnounceService::AnnounceService(void)
     {
       m_header.mgid = 152;
@@ -2646,6 +3252,22 @@ namespace DUNE
       IMC::toJSON(os__, "service_type", service_type, nindent__);
     }
 
+    void
+    AnnounceService::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"service\":", service);
+      w__.field(",\"service_type\":", service_type);
+    }
+
+    bool
+    AnnounceService::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "service")) r__.read(service);
+      else if (JSONReader::match(key__, size__, "service_type")) r__.read(service_type);
+      else return false;
+      return true;
+    }
+
     RSSI::RSSI(void)
     {
       m_header.mgid = 153;
@@ -2715,6 +3337,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    RSSI::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    RSSI::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     VSWR::VSWR(void)
     {
       m_header.mgid = 154;
@@ -2783,6 +3419,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    VSWR::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    VSWR::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     LinkLevel::LinkLevel(void)
     {
       m_header.mgid = 155;
@@ -2851,6 +3501,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    LinkLevel::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    LinkLevel::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     Sms::Sms(void)
     {
       m_header.mgid = 156;
@@ -2919,6 +3583,24 @@ namespace DUNE
       IMC::toJSON(os__, "contents", contents, nindent__);
     }
 
+    void
+    Sms::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"number\":", number);
+      w__.field(",\"timeout\":", timeout);
+      w__.field(",\"contents\":", contents);
+    }
+
+    bool
+    Sms::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "number")) r__.read(number);
+      else if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "contents")) r__.read(contents);
+      else return false;
+      return true;
+    }
+
     SmsTx::SmsTx(void)
     {
       m_header.mgid = 157;
@@ -2993,6 +3675,26 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    SmsTx::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"seq\":", seq);
+      w__.field(",\"destination\":", destination);
+      w__.field(",\"timeout\":", timeout);
+      w__.field(",\"data\":", data);
+    }
+
+    bool
+    SmsTx::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "seq")) r__.read(seq);
+      else if (JSONReader::match(key__, size__, "destination")) r__.read(destination);
+      else if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "data")) r__.read(data);
+      else return false;
+      return true;
+    }
+
     SmsRx::SmsRx(void)
     {
       m_header.mgid = 158;
@@ -3055,6 +3757,22 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    SmsRx::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"source\":", source);
+      w__.field(",\"data\":", data);
+    }
+
+    bool
+    SmsRx::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "source")) r__.read(source);
+      else if (JSONReader::match(key__, size__, "data")) r__.read(data);
+      else return false;
+      return true;
+    }
+
     SmsState::SmsState(void)
     {
       m_header.mgid = 159;
@@ -3123,6 +3841,24 @@ namespace DUNE
       IMC::toJSON(os__, "error", error, nindent__);
     }
 
+    void
+    SmsState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"seq\":", seq);
+      w__.field(",\"state\":", state);
+      w__.field(",\"error\":", error);
+    }
+
+    bool
+    SmsState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "seq")) r__.read(seq);
+      else if (JSONReader::match(key__, size__, "state")) r__.read(state);
+      else if (JSONReader::match(key__, size__, "error")) r__.read(error);
+      else return false;
+      return true;
+    }
+
     TextMessage::TextMessage(void)
     {
       m_header.mgid = 160;
@@ -3185,6 +3921,22 @@ namespace DUNE
       IMC::toJSON(os__, "text", text, nindent__);
     }
 
+    void
+    TextMessage::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"origin\":", origin);
+      w__.field(",\"text\":", text);
+    }
+
+    bool
+    TextMessage::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "origin")) r__.read(origin);
+      else if (JSONReader::match(key__, size__, "text")) r__.read(text);
+      else return false;
+      return true;
+    }
+
     IridiumMsgRx::IridiumMsgRx(void)
     {
       m_header.mgid = 170;
@@ -3265,6 +4017,28 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    IridiumMsgRx::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"origin\":", origin);
+      w__.field(",\"htime\":", htime);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"data\":", data);
+    }
+
+    bool
+    IridiumMsgRx::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "origin")) r__.read(origin);
+      else if (JSONReader::match(key__, size__, "htime")) r__.read(htime);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "data")) r__.read(data);
+      else return false;
+      return true;
+    }
+
     IridiumMsgTx::IridiumMsgTx(void)
     {
       m_header.mgid = 171;
@@ -3339,6 +4113,26 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    IridiumMsgTx::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"req_id\":", req_id);
+      w__.field(",\"ttl\":", ttl);
+      w__.field(",\"destination\":", destination);
+      w__.field(",\"data\":", data);
+    }
+
+    bool
+    IridiumMsgTx::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "req_id")) r__.read(req_id);
+      else if (JSONReader::match(key__, size__, "ttl")) r__.read(ttl);
+      else if (JSONReader::match(key__, size__, "destination")) r__.read(destination);
+      else if (JSONReader::match(key__, size__, "data")) r__.read(data);
+      else return false;
+      return true;
+    }
+
     IridiumTxStatus::IridiumTxStatus(void)
     {
       m_header.mgid = 172;
@@ -3407,6 +4201,24 @@ namespace DUNE
       IMC::toJSON(os__, "text", text, nindent__);
     }
 
+    void
+    IridiumTxStatus::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"req_id\":", req_id);
+      w__.field(",\"status\":", status);
+      w__.field(",\"text\":", text);
+    }
+
+    bool
+    IridiumTxStatus::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "req_id")) r__.read(req_id);
+      else if (JSONReader::match(key__, size__, "status")) r__.read(status);
+      else if (JSONReader::match(key__, size__, "text")) r__.read(text);
+      else return false;
+      return true;
+    }
+
     GroupMembershipState::GroupMembershipState(void)
     {
       m_header.mgid = 180;
@@ -3469,6 +4281,22 @@ namespace DUNE
       IMC::toJSON(os__, "links", links, nindent__);
     }
 
+    void
+    GroupMembershipState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"group_name\":", group_name);
+      w__.field(",\"links\":", links);
+    }
+
+    bool
+    GroupMembershipState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "group_name")) r__.read(group_name);
+      else if (JSONReader::match(key__, size__, "links")) r__.read(links);
+      else return false;
+      return true;
+    }
+
     SystemGroup::SystemGroup(void)
     {
       m_header.mgid = 181;
@@ -3537,6 +4365,24 @@ namespace DUNE
       IMC::toJSON(os__, "grouplist", grouplist, nindent__);
     }
 
+    void
+    SystemGroup::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"groupname\":", groupname);
+      w__.field(",\"action\":", action);
+      w__.field(",\"grouplist\":", grouplist);
+    }
+
+    bool
+    SystemGroup::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "groupname")) r__.read(groupname);
+      else if (JSONReader::match(key__, size__, "action")) r__.read(action);
+      else if (JSONReader::match(key__, size__, "grouplist")) r__.read(grouplist);
+      else return false;
+      return true;
+    }
+
     LinkLatency::LinkLatency(void)
     {
       m_header.mgid = 182;
@@ -3612,6 +4458,22 @@ namespace DUNE
       IMC::toJSON(os__, "sys_src", sys_src, nindent__);
     }
 
+    void
+    LinkLatency::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+      w__.field(",\"sys_src\":", sys_src);
+    }
+
+    bool
+    LinkLatency::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else if (JSONReader::match(key__, size__, "sys_src")) r__.read(sys_src);
+      else return false;
+      return true;
+    }
+
     ExtendedRSSI::ExtendedRSSI(void)
     {
       m_header.mgid = 183;
@@ -3686,6 +4548,22 @@ namespace DUNE
       IMC::toJSON(os__, "units", units, nindent__);
     }
 
+    void
+    ExtendedRSSI::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+      w__.field(",\"units\":", units);
+    }
+
+    bool
+    ExtendedRSSI::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else if (JSONReader::match(key__, size__, "units")) r__.read(units);
+      else return false;
+      return true;
+    }
+
     HistoricData::HistoricData(void)
     {
       m_header.mgid = 184;
@@ -3761,6 +4639,26 @@ namespace DUNE
       data.toJSON(os__, "data", nindent__);
     }
 
+    void
+    HistoricData::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"base_lat\":", base_lat);
+      w__.field(",\"base_lon\":", base_lon);
+      w__.field(",\"base_time\":", base_time);
+      data.toJSON(w__, ",\"data\":");
+    }
+
+    bool
+    HistoricData::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "base_lat")) r__.read(base_lat);
+      else if (JSONReader::match(key__, size__, "base_lon")) r__.read(base_lon);
+      else if (JSONReader::match(key__, size__, "base_time")) r__.read(base_time);
+      else if (JSONReader::match(key__, size__, "data")) data.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     HistoricData::setTimeStampNested(double value__)
     {
@@ -3865,6 +4763,26 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    CompressedHistory::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"base_lat\":", base_lat);
+      w__.field(",\"base_lon\":", base_lon);
+      w__.field(",\"base_time\":", base_time);
+      w__.field(",\"data\":", data);
+    }
+
+    bool
+    CompressedHistory::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "base_lat")) r__.read(base_lat);
+      else if (JSONReader::match(key__, size__, "base_lon")) r__.read(base_lon);
+      else if (JSONReader::match(key__, size__, "base_time")) r__.read(base_time);
+      else if (JSONReader::match(key__, size__, "data")) r__.read(data);
+      else return false;
+      return true;
+    }
+
     HistoricSample::HistoricSample(void)
     {
       m_header.mgid = 186;
@@ -3958,6 +4876,32 @@ namespace DUNE
       sample.toJSON(os__, "sample", nindent__);
     }
 
+    void
+    HistoricSample::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"sys_id\":", sys_id);
+      w__.field(",\"priority\":", priority);
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+      w__.field(",\"t\":", t);
+      sample.toJSON(w__, ",\"sample\":");
+    }
+
+    bool
+    HistoricSample::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "sys_id")) r__.read(sys_id);
+      else if (JSONReader::match(key__, size__, "priority")) r__.read(priority);
+      else if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "t")) r__.read(t);
+      else if (JSONReader::match(key__, size__, "sample")) sample.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     HistoricSample::setTimeStampNested(double value__)
     {
@@ -4078,6 +5022,26 @@ namespace DUNE
       data.toJSON(os__, "data", nindent__);
     }
 
+    void
+    HistoricDataQuery::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"req_id\":", req_id);
+      w__.field(",\"type\":", type);
+      w__.field(",\"max_size\":", max_size);
+      data.toJSON(w__, ",\"data\":");
+    }
+
+    bool
+    HistoricDataQuery::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "req_id")) r__.read(req_id);
+      else if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "max_size")) r__.read(max_size);
+      else if (JSONReader::match(key__, size__, "data")) data.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     HistoricDataQuery::setTimeStampNested(double value__)
     {
@@ -4198,6 +5162,26 @@ namespace DUNE
       cmd.toJSON(os__, "cmd", nindent__);
     }
 
+    void
+    RemoteCommand::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"original_source\":", original_source);
+      w__.field(",\"destination\":", destination);
+      w__.field(",\"timeout\":", timeout);
+      cmd.toJSON(w__, ",\"cmd\":");
+    }
+
+    bool
+    RemoteCommand::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "original_source")) r__.read(original_source);
+      else if (JSONReader::match(key__, size__, "destination")) r__.read(destination);
+      else if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "cmd")) cmd.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     RemoteCommand::setTimeStampNested(double value__)
     {
@@ -4317,6 +5301,26 @@ namespace DUNE
       IMC::toJSON(os__, "list", list, nindent__);
     }
 
+    void
+    CommSystemsQuery::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"type\":", type);
+      w__.field(",\"comm_interface\":", comm_interface);
+      w__.field(",\"model\":", model);
+      w__.field(",\"list\":", list);
+    }
+
+    bool
+    CommSystemsQuery::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "comm_interface")) r__.read(comm_interface);
+      else if (JSONReader::match(key__, size__, "model")) r__.read(model);
+      else if (JSONReader::match(key__, size__, "list")) r__.read(list);
+      else return false;
+      return true;
+    }
+
     TelemetryMsg::TelemetryMsg(void)
     {
       m_header.mgid = 190;
@@ -4421,6 +5425,36 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    TelemetryMsg::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"type\":", type);
+      w__.field(",\"req_id\":", req_id);
+      w__.field(",\"ttl\":", ttl);
+      w__.field(",\"code\":", code);
+      w__.field(",\"destination\":", destination);
+      w__.field(",\"source\":", source);
+      w__.field(",\"acknowledge\":", acknowledge);
+      w__.field(",\"status\":", status);
+      w__.field(",\"data\":", data);
+    }
+
+    bool
+    TelemetryMsg::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "req_id")) r__.read(req_id);
+      else if (JSONReader::match(key__, size__, "ttl")) r__.read(ttl);
+      else if (JSONReader::match(key__, size__, "code")) r__.read(code);
+      else if (JSONReader::match(key__, size__, "destination")) r__.read(destination);
+      else if (JSONReader::match(key__, size__, "source")) r__.read(source);
+      else if (JSONReader::match(key__, size__, "acknowledge")) r__.read(acknowledge);
+      else if (JSONReader::match(key__, size__, "status")) r__.read(status);
+      else if (JSONReader::match(key__, size__, "data")) r__.read(data);
+      else return false;
+      return true;
+    }
+
     LblRange::LblRange(void)
     {
       m_header.mgid = 200;
@@ -4476,6 +5510,12 @@ namespace DUNE
       return bfr__ - start__;
     }
 
+    bool
+    LblRange::hasSubId(void) const
+    {
+      return true;
+    }
+
     uint16_t
     LblRange::getSubId(void) const
     {
@@ -4495,6 +5535,22 @@ namespace DUNE
       IMC::toJSON(os__, "range", range, nindent__);
     }
 
+    void
+    LblRange::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"id\":", id);
+      w__.field(",\"range\":", range);
+    }
+
+    bool
+    LblRange::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "id")) r__.read(id);
+      else if (JSONReader::match(key__, size__, "range")) r__.read(range);
+      else return false;
+      return true;
+    }
+
     LblBeacon::LblBeacon(void)
     {
       m_header.mgid = 202;
@@ -4589,6 +5645,32 @@ namespace DUNE
       IMC::toJSON(os__, "transponder_delay", transponder_delay, nindent__);
     }
 
+    void
+    LblBeacon::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"beacon\":", beacon);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"depth\":", depth);
+      w__.field(",\"query_channel\":", query_channel);
+      w__.field(",\"reply_channel\":", reply_channel);
+      w__.field(",\"transponder_delay\":", transponder_delay);
+    }
+
+    bool
+    LblBeacon::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "beacon")) r__.read(beacon);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "depth")) r__.read(depth);
+      else if (JSONReader::match(key__, size__, "query_channel")) r__.read(query_channel);
+      else if (JSONReader::match(key__, size__, "reply_channel")) r__.read(reply_channel);
+      else if (JSONReader::match(key__, size__, "transponder_delay")) r__.read(transponder_delay);
+      else return false;
+      return true;
+    }
+
     LblConfig::LblConfig(void)
     {
       m_header.mgid = 203;
@@ -4653,13 +5735,29 @@ namespace DUNE
     }
 
     void
-    LblConfig::setTimeStampNested(double value__)
+    LblConfig::fieldsToJSON(JSONWriter& w__) const
     {
-      beacons.setTimeStamp(value__);
+      w__.field(",\"op\":", op);
+      beacons.toJSON(w__, ",\"beacons\":");
     }
 
-    void
-    LblConfig::setSourceNested(uint16_t value__)
+    bool
+    LblConfig::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "beacons")) beacons.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
+    void
+    LblConfig::setTimeStampNested(double value__)
+    {
+      beacons.setTimeStamp(value__);
+    }
+
+    void
+    LblConfig::setSourceNested(uint16_t value__)
     {
       beacons.setSource(value__);
     }
@@ -4739,6 +5837,20 @@ namespace DUNE
       message.toJSON(os__, "message", nindent__);
     }
 
+    void
+    AcousticMessage::fieldsToJSON(JSONWriter& w__) const
+    {
+      message.toJSON(w__, ",\"message\":");
+    }
+
+    bool
+    AcousticMessage::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "message")) message.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     AcousticMessage::setTimeStampNested(double value__)
     {
@@ -4859,6 +5971,26 @@ namespace DUNE
       msg.toJSON(os__, "msg", nindent__);
     }
 
+    void
+    AcousticOperation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"op\":", op);
+      w__.field(",\"system\":", system);
+      w__.field(",\"range\":", range);
+      msg.toJSON(w__, ",\"msg\":");
+    }
+
+    bool
+    AcousticOperation::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "system")) r__.read(system);
+      else if (JSONReader::match(key__, size__, "range")) r__.read(range);
+      else if (JSONReader::match(key__, size__, "msg")) msg.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     AcousticOperation::setTimeStampNested(double value__)
     {
@@ -4999,6 +6131,20 @@ namespace DUNE
       IMC::toJSON(os__, "list", list, nindent__);
     }
 
+    void
+    AcousticSystems::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"list\":", list);
+    }
+
+    bool
+    AcousticSystems::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "list")) r__.read(list);
+      else return false;
+      return true;
+    }
+
     AcousticLink::AcousticLink(void)
     {
       m_header.mgid = 214;
@@ -5067,6 +6213,24 @@ namespace DUNE
       IMC::toJSON(os__, "integrity", integrity, nindent__);
     }
 
+    void
+    AcousticLink::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"peer\":", peer);
+      w__.field(",\"rssi\":", rssi);
+      w__.field(",\"integrity\":", integrity);
+    }
+
+    bool
+    AcousticLink::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "peer")) r__.read(peer);
+      else if (JSONReader::match(key__, size__, "rssi")) r__.read(rssi);
+      else if (JSONReader::match(key__, size__, "integrity")) r__.read(integrity);
+      else return false;
+      return true;
+    }
+
     Rpm::Rpm(void)
     {
       m_header.mgid = 250;
@@ -5135,6 +6299,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Rpm::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    Rpm::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     Voltage::Voltage(void)
     {
       m_header.mgid = 251;
@@ -5203,6 +6381,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Voltage::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    Voltage::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     Current::Current(void)
     {
       m_header.mgid = 252;
@@ -5271,6 +6463,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Current::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    Current::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     GpsFix::GpsFix(void)
     {
       m_header.mgid = 253;
@@ -5419,6 +6625,50 @@ namespace DUNE
       IMC::toJSON(os__, "vacc", vacc, nindent__);
     }
 
+    void
+    GpsFix::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"validity\":", validity);
+      w__.field(",\"type\":", type);
+      w__.field(",\"utc_year\":", utc_year);
+      w__.field(",\"utc_month\":", utc_month);
+      w__.field(",\"utc_day\":", utc_day);
+      w__.field(",\"utc_time\":", utc_time);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"height\":", height);
+      w__.field(",\"satellites\":", satellites);
+      w__.field(",\"cog\":", cog);
+      w__.field(",\"sog\":", sog);
+      w__.field(",\"hdop\":", hdop);
+      w__.field(",\"vdop\":", vdop);
+      w__.field(",\"hacc\":", hacc);
+      w__.field(",\"vacc\":", vacc);
+    }
+
+    bool
+    GpsFix::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "validity")) r__.read(validity);
+      else if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "utc_year")) r__.read(utc_year);
+      else if (JSONReader::match(key__, size__, "utc_month")) r__.read(utc_month);
+      else if (JSONReader::match(key__, size__, "utc_day")) r__.read(utc_day);
+      else if (JSONReader::match(key__, size__, "utc_time")) r__.read(utc_time);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "height")) r__.read(height);
+      else if (JSONReader::match(key__, size__, "satellites")) r__.read(satellites);
+      else if (JSONReader::match(key__, size__, "cog")) r__.read(cog);
+      else if (JSONReader::match(key__, size__, "sog")) r__.read(sog);
+      else if (JSONReader::match(key__, size__, "hdop")) r__.read(hdop);
+      else if (JSONReader::match(key__, size__, "vdop")) r__.read(vdop);
+      else if (JSONReader::match(key__, size__, "hacc")) r__.read(hacc);
+      else if (JSONReader::match(key__, size__, "vacc")) r__.read(vacc);
+      else return false;
+      return true;
+    }
+
     EulerAngles::EulerAngles(void)
     {
       m_header.mgid = 254;
@@ -5503,6 +6753,28 @@ namespace DUNE
       IMC::toJSON(os__, "psi_magnetic", psi_magnetic, nindent__);
     }
 
+    void
+    EulerAngles::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"time\":", time);
+      w__.field(",\"phi\":", phi);
+      w__.field(",\"theta\":", theta);
+      w__.field(",\"psi\":", psi);
+      w__.field(",\"psi_magnetic\":", psi_magnetic);
+    }
+
+    bool
+    EulerAngles::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "time")) r__.read(time);
+      else if (JSONReader::match(key__, size__, "phi")) r__.read(phi);
+      else if (JSONReader::match(key__, size__, "theta")) r__.read(theta);
+      else if (JSONReader::match(key__, size__, "psi")) r__.read(psi);
+      else if (JSONReader::match(key__, size__, "psi_magnetic")) r__.read(psi_magnetic);
+      else return false;
+      return true;
+    }
+
     EulerAnglesDelta::EulerAnglesDelta(void)
     {
       m_header.mgid = 255;
@@ -5583,6 +6855,28 @@ namespace DUNE
       IMC::toJSON(os__, "timestep", timestep, nindent__);
     }
 
+    void
+    EulerAnglesDelta::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"time\":", time);
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+      w__.field(",\"timestep\":", timestep);
+    }
+
+    bool
+    EulerAnglesDelta::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "time")) r__.read(time);
+      else if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "timestep")) r__.read(timestep);
+      else return false;
+      return true;
+    }
+
     AngularVelocity::AngularVelocity(void)
     {
       m_header.mgid = 256;
@@ -5657,6 +6951,26 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    AngularVelocity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"time\":", time);
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+    }
+
+    bool
+    AngularVelocity::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "time")) r__.read(time);
+      else if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else return false;
+      return true;
+    }
+
     Acceleration::Acceleration(void)
     {
       m_header.mgid = 257;
@@ -5731,6 +7045,26 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    Acceleration::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"time\":", time);
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+    }
+
+    bool
+    Acceleration::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "time")) r__.read(time);
+      else if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else return false;
+      return true;
+    }
+
     MagneticField::MagneticField(void)
     {
       m_header.mgid = 258;
@@ -5805,6 +7139,26 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    MagneticField::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"time\":", time);
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+    }
+
+    bool
+    MagneticField::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "time")) r__.read(time);
+      else if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else return false;
+      return true;
+    }
+
     GroundVelocity::GroundVelocity(void)
     {
       m_header.mgid = 259;
@@ -5879,6 +7233,26 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    GroundVelocity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"validity\":", validity);
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+    }
+
+    bool
+    GroundVelocity::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "validity")) r__.read(validity);
+      else if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else return false;
+      return true;
+    }
+
     WaterVelocity::WaterVelocity(void)
     {
       m_header.mgid = 260;
@@ -5953,6 +7327,26 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    WaterVelocity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"validity\":", validity);
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+    }
+
+    bool
+    WaterVelocity::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "validity")) r__.read(validity);
+      else if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else return false;
+      return true;
+    }
+
     VelocityDelta::VelocityDelta(void)
     {
       m_header.mgid = 261;
@@ -6027,6 +7421,26 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    VelocityDelta::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"time\":", time);
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+    }
+
+    bool
+    VelocityDelta::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "time")) r__.read(time);
+      else if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else return false;
+      return true;
+    }
+
     DeviceState::DeviceState(void)
     {
       m_header.mgid = 282;
@@ -6113,6 +7527,30 @@ namespace DUNE
       IMC::toJSON(os__, "psi", psi, nindent__);
     }
 
+    void
+    DeviceState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+      w__.field(",\"phi\":", phi);
+      w__.field(",\"theta\":", theta);
+      w__.field(",\"psi\":", psi);
+    }
+
+    bool
+    DeviceState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "phi")) r__.read(phi);
+      else if (JSONReader::match(key__, size__, "theta")) r__.read(theta);
+      else if (JSONReader::match(key__, size__, "psi")) r__.read(psi);
+      else return false;
+      return true;
+    }
+
     BeamConfig::BeamConfig(void)
     {
       m_header.mgid = 283;
@@ -6177,6 +7615,22 @@ namespace DUNE
       IMC::toJSON(os__, "beam_height", beam_height, nindent__);
     }
 
+    void
+    BeamConfig::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"beam_width\":", beam_width);
+      w__.field(",\"beam_height\":", beam_height);
+    }
+
+    bool
+    BeamConfig::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "beam_width")) r__.read(beam_width);
+      else if (JSONReader::match(key__, size__, "beam_height")) r__.read(beam_height);
+      else return false;
+      return true;
+    }
+
     Distance::Distance(void)
     {
       m_header.mgid = 262;
@@ -6265,6 +7719,26 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Distance::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"validity\":", validity);
+      location.toJSON(w__, ",\"location\":");
+      beam_config.toJSON(w__, ",\"beam_config\":");
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    Distance::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "validity")) r__.read(validity);
+      else if (JSONReader::match(key__, size__, "location")) location.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "beam_config")) beam_config.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     void
     Distance::setTimeStampNested(double value__)
     {
@@ -6373,6 +7847,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Temperature::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    Temperature::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     Pressure::Pressure(void)
     {
       m_header.mgid = 264;
@@ -6441,6 +7929,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Pressure::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    Pressure::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     Depth::Depth(void)
     {
       m_header.mgid = 265;
@@ -6509,6 +8011,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Depth::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    Depth::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     DepthOffset::DepthOffset(void)
     {
       m_header.mgid = 266;
@@ -6577,6 +8093,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    DepthOffset::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    DepthOffset::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     SoundSpeed::SoundSpeed(void)
     {
       m_header.mgid = 267;
@@ -6645,6 +8175,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    SoundSpeed::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    SoundSpeed::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     WaterDensity::WaterDensity(void)
     {
       m_header.mgid = 268;
@@ -6713,6 +8257,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    WaterDensity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    WaterDensity::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     Conductivity::Conductivity(void)
     {
       m_header.mgid = 269;
@@ -6781,6 +8339,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Conductivity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    Conductivity::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     Salinity::Salinity(void)
     {
       m_header.mgid = 270;
@@ -6849,6 +8421,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Salinity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    Salinity::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     WindSpeed::WindSpeed(void)
     {
       m_header.mgid = 271;
@@ -6917,6 +8503,24 @@ namespace DUNE
       IMC::toJSON(os__, "turbulence", turbulence, nindent__);
     }
 
+    void
+    WindSpeed::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"direction\":", direction);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"turbulence\":", turbulence);
+    }
+
+    bool
+    WindSpeed::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "direction")) r__.read(direction);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "turbulence")) r__.read(turbulence);
+      else return false;
+      return true;
+    }
+
     RelativeHumidity::RelativeHumidity(void)
     {
       m_header.mgid = 272;
@@ -6986,6 +8590,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    RelativeHumidity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    RelativeHumidity::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     DevDataText::DevDataText(void)
     {
       m_header.mgid = 273;
@@ -7042,6 +8660,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    DevDataText::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    DevDataText::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     DevDataBinary::DevDataBinary(void)
     {
       m_header.mgid = 274;
@@ -7098,6 +8730,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    DevDataBinary::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    DevDataBinary::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     Force::Force(void)
     {
       m_header.mgid = 275;
@@ -7166,6 +8812,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Force::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    Force::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     SonarData::SonarData(void)
     {
       m_header.mgid = 276;
@@ -7265,6 +8925,34 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    SonarData::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"type\":", type);
+      w__.field(",\"frequency\":", frequency);
+      w__.field(",\"min_range\":", min_range);
+      w__.field(",\"max_range\":", max_range);
+      w__.field(",\"bits_per_point\":", bits_per_point);
+      w__.field(",\"scale_factor\":", scale_factor);
+      beam_config.toJSON(w__, ",\"beam_config\":");
+      w__.field(",\"data\":", data);
+    }
+
+    bool
+    SonarData::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "frequency")) r__.read(frequency);
+      else if (JSONReader::match(key__, size__, "min_range")) r__.read(min_range);
+      else if (JSONReader::match(key__, size__, "max_range")) r__.read(max_range);
+      else if (JSONReader::match(key__, size__, "bits_per_point")) r__.read(bits_per_point);
+      else if (JSONReader::match(key__, size__, "scale_factor")) r__.read(scale_factor);
+      else if (JSONReader::match(key__, size__, "beam_config")) beam_config.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "data")) r__.read(data);
+      else return false;
+      return true;
+    }
+
     void
     SonarData::setTimeStampNested(double value__)
     {
@@ -7390,6 +9078,20 @@ namespace DUNE
       IMC::toJSON(os__, "op", op, nindent__);
     }
 
+    void
+    PulseDetectionControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"op\":", op);
+    }
+
+    bool
+    PulseDetectionControl::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else return false;
+      return true;
+    }
+
     FuelLevel::FuelLevel(void)
     {
       m_header.mgid = 279;
@@ -7472,6 +9174,24 @@ namespace DUNE
       IMC::toJSON(os__, "opmodes", opmodes, nindent__);
     }
 
+    void
+    FuelLevel::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+      w__.field(",\"confidence\":", confidence);
+      w__.field(",\"opmodes\":", opmodes);
+    }
+
+    bool
+    FuelLevel::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else if (JSONReader::match(key__, size__, "confidence")) r__.read(confidence);
+      else if (JSONReader::match(key__, size__, "opmodes")) r__.read(opmodes);
+      else return false;
+      return true;
+    }
+
     GpsNavData::GpsNavData(void)
     {
       m_header.mgid = 280;
@@ -7612,6 +9332,48 @@ namespace DUNE
       IMC::toJSON(os__, "cacc", cacc, nindent__);
     }
 
+    void
+    GpsNavData::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"itow\":", itow);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"height_ell\":", height_ell);
+      w__.field(",\"height_sea\":", height_sea);
+      w__.field(",\"hacc\":", hacc);
+      w__.field(",\"vacc\":", vacc);
+      w__.field(",\"vel_n\":", vel_n);
+      w__.field(",\"vel_e\":", vel_e);
+      w__.field(",\"vel_d\":", vel_d);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"gspeed\":", gspeed);
+      w__.field(",\"heading\":", heading);
+      w__.field(",\"sacc\":", sacc);
+      w__.field(",\"cacc\":", cacc);
+    }
+
+    bool
+    GpsNavData::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "itow")) r__.read(itow);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "height_ell")) r__.read(height_ell);
+      else if (JSONReader::match(key__, size__, "height_sea")) r__.read(height_sea);
+      else if (JSONReader::match(key__, size__, "hacc")) r__.read(hacc);
+      else if (JSONReader::match(key__, size__, "vacc")) r__.read(vacc);
+      else if (JSONReader::match(key__, size__, "vel_n")) r__.read(vel_n);
+      else if (JSONReader::match(key__, size__, "vel_e")) r__.read(vel_e);
+      else if (JSONReader::match(key__, size__, "vel_d")) r__.read(vel_d);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "gspeed")) r__.read(gspeed);
+      else if (JSONReader::match(key__, size__, "heading")) r__.read(heading);
+      else if (JSONReader::match(key__, size__, "sacc")) r__.read(sacc);
+      else if (JSONReader::match(key__, size__, "cacc")) r__.read(cacc);
+      else return false;
+      return true;
+    }
+
     ServoPosition::ServoPosition(void)
     {
       m_header.mgid = 281;
@@ -7668,6 +9430,12 @@ namespace DUNE
       return bfr__ - start__;
     }
 
+    bool
+    ServoPosition::hasSubId(void) const
+    {
+      return true;
+    }
+
     uint16_t
     ServoPosition::getSubId(void) const
     {
@@ -7699,6 +9467,22 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    ServoPosition::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"id\":", id);
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    ServoPosition::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "id")) r__.read(id);
+      else if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     DataSanity::DataSanity(void)
     {
       m_header.mgid = 284;
@@ -7755,6 +9539,20 @@ namespace DUNE
       IMC::toJSON(os__, "sane", sane, nindent__);
     }
 
+    void
+    DataSanity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"sane\":", sane);
+    }
+
+    bool
+    DataSanity::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "sane")) r__.read(sane);
+      else return false;
+      return true;
+    }
+
     RhodamineDye::RhodamineDye(void)
     {
       m_header.mgid = 285;
@@ -7823,6 +9621,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    RhodamineDye::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    RhodamineDye::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     CrudeOil::CrudeOil(void)
     {
       m_header.mgid = 286;
@@ -7891,6 +9703,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    CrudeOil::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    CrudeOil::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     FineOil::FineOil(void)
     {
       m_header.mgid = 287;
@@ -7959,6 +9785,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    FineOil::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    FineOil::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     Turbidity::Turbidity(void)
     {
       m_header.mgid = 288;
@@ -8027,6 +9867,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Turbidity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    Turbidity::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     Chlorophyll::Chlorophyll(void)
     {
       m_header.mgid = 289;
@@ -8095,6 +9949,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Chlorophyll::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    Chlorophyll::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     Fluorescein::Fluorescein(void)
     {
       m_header.mgid = 290;
@@ -8163,6 +10031,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Fluorescein::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    Fluorescein::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     Phycocyanin::Phycocyanin(void)
     {
       m_header.mgid = 291;
@@ -8231,6 +10113,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Phycocyanin::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    Phycocyanin::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     Phycoerythrin::Phycoerythrin(void)
     {
       m_header.mgid = 292;
@@ -8299,6 +10195,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Phycoerythrin::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    Phycoerythrin::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     GpsFixRtk::GpsFixRtk(void)
     {
       m_header.mgid = 293;
@@ -8441,6 +10351,48 @@ namespace DUNE
       IMC::toJSON(os__, "iar_ratio", iar_ratio, nindent__);
     }
 
+    void
+    GpsFixRtk::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"validity\":", validity);
+      w__.field(",\"type\":", type);
+      w__.field(",\"tow\":", tow);
+      w__.field(",\"base_lat\":", base_lat);
+      w__.field(",\"base_lon\":", base_lon);
+      w__.field(",\"base_height\":", base_height);
+      w__.field(",\"n\":", n);
+      w__.field(",\"e\":", e);
+      w__.field(",\"d\":", d);
+      w__.field(",\"v_n\":", v_n);
+      w__.field(",\"v_e\":", v_e);
+      w__.field(",\"v_d\":", v_d);
+      w__.field(",\"satellites\":", satellites);
+      w__.field(",\"iar_hyp\":", iar_hyp);
+      w__.field(",\"iar_ratio\":", iar_ratio);
+    }
+
+    bool
+    GpsFixRtk::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "validity")) r__.read(validity);
+      else if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "tow")) r__.read(tow);
+      else if (JSONReader::match(key__, size__, "base_lat")) r__.read(base_lat);
+      else if (JSONReader::match(key__, size__, "base_lon")) r__.read(base_lon);
+      else if (JSONReader::match(key__, size__, "base_height")) r__.read(base_height);
+      else if (JSONReader::match(key__, size__, "n")) r__.read(n);
+      else if (JSONReader::match(key__, size__, "e")) r__.read(e);
+      else if (JSONReader::match(key__, size__, "d")) r__.read(d);
+      else if (JSONReader::match(key__, size__, "v_n")) r__.read(v_n);
+      else if (JSONReader::match(key__, size__, "v_e")) r__.read(v_e);
+      else if (JSONReader::match(key__, size__, "v_d")) r__.read(v_d);
+      else if (JSONReader::match(key__, size__, "satellites")) r__.read(satellites);
+      else if (JSONReader::match(key__, size__, "iar_hyp")) r__.read(iar_hyp);
+      else if (JSONReader::match(key__, size__, "iar_ratio")) r__.read(iar_ratio);
+      else return false;
+      return true;
+    }
+
     EstimatedState::EstimatedState(void)
     {
       m_header.mgid = 350;
@@ -8619,6 +10571,58 @@ namespace DUNE
       IMC::toJSON(os__, "alt", alt, nindent__);
     }
 
+    void
+    EstimatedState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"height\":", height);
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+      w__.field(",\"phi\":", phi);
+      w__.field(",\"theta\":", theta);
+      w__.field(",\"psi\":", psi);
+      w__.field(",\"u\":", u);
+      w__.field(",\"v\":", v);
+      w__.field(",\"w\":", w);
+      w__.field(",\"vx\":", vx);
+      w__.field(",\"vy\":", vy);
+      w__.field(",\"vz\":", vz);
+      w__.field(",\"p\":", p);
+      w__.field(",\"q\":", q);
+      w__.field(",\"r\":", r);
+      w__.field(",\"depth\":", depth);
+      w__.field(",\"alt\":", alt);
+    }
+
+    bool
+    EstimatedState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "height")) r__.read(height);
+      else if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "phi")) r__.read(phi);
+      else if (JSONReader::match(key__, size__, "theta")) r__.read(theta);
+      else if (JSONReader::match(key__, size__, "psi")) r__.read(psi);
+      else if (JSONReader::match(key__, size__, "u")) r__.read(u);
+      else if (JSONReader::match(key__, size__, "v")) r__.read(v);
+      else if (JSONReader::match(key__, size__, "w")) r__.read(w);
+      else if (JSONReader::match(key__, size__, "vx")) r__.read(vx);
+      else if (JSONReader::match(key__, size__, "vy")) r__.read(vy);
+      else if (JSONReader::match(key__, size__, "vz")) r__.read(vz);
+      else if (JSONReader::match(key__, size__, "p")) r__.read(p);
+      else if (JSONReader::match(key__, size__, "q")) r__.read(q);
+      else if (JSONReader::match(key__, size__, "r")) r__.read(r);
+      else if (JSONReader::match(key__, size__, "depth")) r__.read(depth);
+      else if (JSONReader::match(key__, size__, "alt")) r__.read(alt);
+      else return false;
+      return true;
+    }
+
     ExternalNavData::ExternalNavData(void)
     {
       m_header.mgid = 294;
@@ -8682,6 +10686,22 @@ namespace DUNE
       IMC::toJSON(os__, "type", type, nindent__);
     }
 
+    void
+    ExternalNavData::fieldsToJSON(JSONWriter& w__) const
+    {
+      state.toJSON(w__, ",\"state\":");
+      w__.field(",\"type\":", type);
+    }
+
+    bool
+    ExternalNavData::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "state")) state.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else return false;
+      return true;
+    }
+
     void
     ExternalNavData::setTimeStampNested(double value__)
     {
@@ -8795,6 +10815,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    DissolvedOxygen::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    DissolvedOxygen::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     AirSaturation::AirSaturation(void)
     {
       m_header.mgid = 296;
@@ -8863,6 +10897,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    AirSaturation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    AirSaturation::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     Throttle::Throttle(void)
     {
       m_header.mgid = 297;
@@ -8931,6 +10979,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Throttle::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    Throttle::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     PH::PH(void)
     {
       m_header.mgid = 298;
@@ -8999,6 +11061,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    PH::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    PH::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     Redox::Redox(void)
     {
       m_header.mgid = 299;
@@ -9067,6 +11143,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    Redox::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    Redox::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     CameraZoom::CameraZoom(void)
     {
       m_header.mgid = 300;
@@ -9127,6 +11217,12 @@ namespace DUNE
       return bfr__ - start__;
     }
 
+    bool
+    CameraZoom::hasSubId(void) const
+    {
+      return true;
+    }
+
     uint16_t
     CameraZoom::getSubId(void) const
     {
@@ -9147,16 +11243,34 @@ namespace DUNE
       IMC::toJSON(os__, "action", action, nindent__);
     }
 
-    SetThrusterActuation::SetThrusterActuation(void)
+    void
+    CameraZoom::fieldsToJSON(JSONWriter& w__) const
     {
-      m_header.mgid = 301;
-      clear();
+      w__.field(",\"id\":", id);
+      w__.field(",\"zoom\":", zoom);
+      w__.field(",\"action\":", action);
     }
 
-    void
-    SetThrusterActuation::clear(void)
+    bool
+    CameraZoom::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
     {
-      id = 0;
+      if (JSONReader::match(key__, size__, "id")) r__.read(id);
+      else if (JSONReader::match(key__, size__, "zoom")) r__.read(zoom);
+      else if (JSONReader::match(key__, size__, "action")) r__.read(action);
+      else return false;
+      return true;
+    }
+
+    SetThrusterActuation::SetThrusterActuation(void)
+    {
+      m_header.mgid = 301;
+      clear();
+    }
+
+    void
+    SetThrusterActuation::clear(void)
+    {
+      id = 0;
       value = 0;
     }
 
@@ -9203,6 +11317,12 @@ namespace DUNE
       return bfr__ - start__;
     }
 
+    bool
+    SetThrusterActuation::hasSubId(void) const
+    {
+      return true;
+    }
+
     uint16_t
     SetThrusterActuation::getSubId(void) const
     {
@@ -9234,6 +11354,22 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    SetThrusterActuation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"id\":", id);
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    SetThrusterActuation::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "id")) r__.read(id);
+      else if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     SetServoPosition::SetServoPosition(void)
     {
       m_header.mgid = 302;
@@ -9290,6 +11426,12 @@ namespace DUNE
       return bfr__ - start__;
     }
 
+    bool
+    SetServoPosition::hasSubId(void) const
+    {
+      return true;
+    }
+
     uint16_t
     SetServoPosition::getSubId(void) const
     {
@@ -9321,6 +11463,22 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    SetServoPosition::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"id\":", id);
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    SetServoPosition::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "id")) r__.read(id);
+      else if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     SetControlSurfaceDeflection::SetControlSurfaceDeflection(void)
     {
       m_header.mgid = 303;
@@ -9376,6 +11534,12 @@ namespace DUNE
       return bfr__ - start__;
     }
 
+    bool
+    SetControlSurfaceDeflection::hasSubId(void) const
+    {
+      return true;
+    }
+
     uint16_t
     SetControlSurfaceDeflection::getSubId(void) const
     {
@@ -9395,6 +11559,22 @@ namespace DUNE
       IMC::toJSON(os__, "angle", angle, nindent__);
     }
 
+    void
+    SetControlSurfaceDeflection::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"id\":", id);
+      w__.field(",\"angle\":", angle);
+    }
+
+    bool
+    SetControlSurfaceDeflection::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "id")) r__.read(id);
+      else if (JSONReader::match(key__, size__, "angle")) r__.read(angle);
+      else return false;
+      return true;
+    }
+
     RemoteActionsRequest::RemoteActionsRequest(void)
     {
       m_header.mgid = 304;
@@ -9457,6 +11637,22 @@ namespace DUNE
       IMC::toJSON(os__, "actions", actions, nindent__);
     }
 
+    void
+    RemoteActionsRequest::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"op\":", op);
+      w__.field(",\"actions\":", actions);
+    }
+
+    bool
+    RemoteActionsRequest::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "actions")) r__.read(actions);
+      else return false;
+      return true;
+    }
+
     RemoteActions::RemoteActions(void)
     {
       m_header.mgid = 305;
@@ -9513,6 +11709,20 @@ namespace DUNE
       IMC::toJSON(os__, "actions", actions, nindent__);
     }
 
+    void
+    RemoteActions::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"actions\":", actions);
+    }
+
+    bool
+    RemoteActions::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "actions")) r__.read(actions);
+      else return false;
+      return true;
+    }
+
     ButtonEvent::ButtonEvent(void)
     {
       m_header.mgid = 306;
@@ -9587,6 +11797,22 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    ButtonEvent::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"button\":", button);
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    ButtonEvent::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "button")) r__.read(button);
+      else if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     LcdControl::LcdControl(void)
     {
       m_header.mgid = 307;
@@ -9649,6 +11875,22 @@ namespace DUNE
       IMC::toJSON(os__, "text", text, nindent__);
     }
 
+    void
+    LcdControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"op\":", op);
+      w__.field(",\"text\":", text);
+    }
+
+    bool
+    LcdControl::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "text")) r__.read(text);
+      else return false;
+      return true;
+    }
+
     PowerOperation::PowerOperation(void)
     {
       m_header.mgid = 308;
@@ -9717,6 +11959,24 @@ namespace DUNE
       IMC::toJSON(os__, "sched_time", sched_time, nindent__);
     }
 
+    void
+    PowerOperation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"op\":", op);
+      w__.field(",\"time_remain\":", time_remain);
+      w__.field(",\"sched_time\":", sched_time);
+    }
+
+    bool
+    PowerOperation::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "time_remain")) r__.read(time_remain);
+      else if (JSONReader::match(key__, size__, "sched_time")) r__.read(sched_time);
+      else return false;
+      return true;
+    }
+
     PowerChannelControl::PowerChannelControl(void)
     {
       m_header.mgid = 309;
@@ -9786,6 +12046,24 @@ namespace DUNE
       IMC::toJSON(os__, "sched_time", sched_time, nindent__);
     }
 
+    void
+    PowerChannelControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"name\":", name);
+      w__.field(",\"op\":", op);
+      w__.field(",\"sched_time\":", sched_time);
+    }
+
+    bool
+    PowerChannelControl::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "name")) r__.read(name);
+      else if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "sched_time")) r__.read(sched_time);
+      else return false;
+      return true;
+    }
+
     QueryPowerChannelState::QueryPowerChannelState(void)
     {
       m_header.mgid = 310;
@@ -9887,6 +12165,22 @@ namespace DUNE
       IMC::toJSON(os__, "state", state, nindent__);
     }
 
+    void
+    PowerChannelState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"name\":", name);
+      w__.field(",\"state\":", state);
+    }
+
+    bool
+    PowerChannelState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "name")) r__.read(name);
+      else if (JSONReader::match(key__, size__, "state")) r__.read(state);
+      else return false;
+      return true;
+    }
+
     LedBrightness::LedBrightness(void)
     {
       m_header.mgid = 312;
@@ -9961,6 +12255,22 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    LedBrightness::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"name\":", name);
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    LedBrightness::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "name")) r__.read(name);
+      else if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     QueryLedBrightness::QueryLedBrightness(void)
     {
       m_header.mgid = 313;
@@ -10017,6 +12327,20 @@ namespace DUNE
       IMC::toJSON(os__, "name", name, nindent__);
     }
 
+    void
+    QueryLedBrightness::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"name\":", name);
+    }
+
+    bool
+    QueryLedBrightness::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "name")) r__.read(name);
+      else return false;
+      return true;
+    }
+
     SetLedBrightness::SetLedBrightness(void)
     {
       m_header.mgid = 314;
@@ -10091,6 +12415,22 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    SetLedBrightness::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"name\":", name);
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    SetLedBrightness::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "name")) r__.read(name);
+      else if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     SetPWM::SetPWM(void)
     {
       m_header.mgid = 315;
@@ -10151,6 +12491,12 @@ namespace DUNE
       return bfr__ - start__;
     }
 
+    bool
+    SetPWM::hasSubId(void) const
+    {
+      return true;
+    }
+
     uint16_t
     SetPWM::getSubId(void) const
     {
@@ -10171,6 +12517,24 @@ namespace DUNE
       IMC::toJSON(os__, "duty_cycle", duty_cycle, nindent__);
     }
 
+    void
+    SetPWM::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"id\":", id);
+      w__.field(",\"period\":", period);
+      w__.field(",\"duty_cycle\":", duty_cycle);
+    }
+
+    bool
+    SetPWM::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "id")) r__.read(id);
+      else if (JSONReader::match(key__, size__, "period")) r__.read(period);
+      else if (JSONReader::match(key__, size__, "duty_cycle")) r__.read(duty_cycle);
+      else return false;
+      return true;
+    }
+
     PWM::PWM(void)
     {
       m_header.mgid = 316;
@@ -10231,6 +12595,12 @@ namespace DUNE
       return bfr__ - start__;
     }
 
+    bool
+    PWM::hasSubId(void) const
+    {
+      return true;
+    }
+
     uint16_t
     PWM::getSubId(void) const
     {
@@ -10251,6 +12621,24 @@ namespace DUNE
       IMC::toJSON(os__, "duty_cycle", duty_cycle, nindent__);
     }
 
+    void
+    PWM::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"id\":", id);
+      w__.field(",\"period\":", period);
+      w__.field(",\"duty_cycle\":", duty_cycle);
+    }
+
+    bool
+    PWM::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "id")) r__.read(id);
+      else if (JSONReader::match(key__, size__, "period")) r__.read(period);
+      else if (JSONReader::match(key__, size__, "duty_cycle")) r__.read(duty_cycle);
+      else return false;
+      return true;
+    }
+
     EstimatedStreamVelocity::EstimatedStreamVelocity(void)
     {
       m_header.mgid = 351;
@@ -10319,6 +12707,24 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    EstimatedStreamVelocity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+    }
+
+    bool
+    EstimatedStreamVelocity::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else return false;
+      return true;
+    }
+
     IndicatedSpeed::IndicatedSpeed(void)
     {
       m_header.mgid = 352;
@@ -10387,6 +12793,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    IndicatedSpeed::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    IndicatedSpeed::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     TrueSpeed::TrueSpeed(void)
     {
       m_header.mgid = 353;
@@ -10455,6 +12875,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    TrueSpeed::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    TrueSpeed::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     NavigationUncertainty::NavigationUncertainty(void)
     {
       m_header.mgid = 354;
@@ -10589,6 +13023,46 @@ namespace DUNE
       IMC::toJSON(os__, "bias_r", bias_r, nindent__);
     }
 
+    void
+    NavigationUncertainty::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+      w__.field(",\"phi\":", phi);
+      w__.field(",\"theta\":", theta);
+      w__.field(",\"psi\":", psi);
+      w__.field(",\"p\":", p);
+      w__.field(",\"q\":", q);
+      w__.field(",\"r\":", r);
+      w__.field(",\"u\":", u);
+      w__.field(",\"v\":", v);
+      w__.field(",\"w\":", w);
+      w__.field(",\"bias_psi\":", bias_psi);
+      w__.field(",\"bias_r\":", bias_r);
+    }
+
+    bool
+    NavigationUncertainty::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "phi")) r__.read(phi);
+      else if (JSONReader::match(key__, size__, "theta")) r__.read(theta);
+      else if (JSONReader::match(key__, size__, "psi")) r__.read(psi);
+      else if (JSONReader::match(key__, size__, "p")) r__.read(p);
+      else if (JSONReader::match(key__, size__, "q")) r__.read(q);
+      else if (JSONReader::match(key__, size__, "r")) r__.read(r);
+      else if (JSONReader::match(key__, size__, "u")) r__.read(u);
+      else if (JSONReader::match(key__, size__, "v")) r__.read(v);
+      else if (JSONReader::match(key__, size__, "w")) r__.read(w);
+      else if (JSONReader::match(key__, size__, "bias_psi")) r__.read(bias_psi);
+      else if (JSONReader::match(key__, size__, "bias_r")) r__.read(bias_r);
+      else return false;
+      return true;
+    }
+
     NavigationData::NavigationData(void)
     {
       m_header.mgid = 355;
@@ -10693,6 +13167,36 @@ namespace DUNE
       IMC::toJSON(os__, "custom_z", custom_z, nindent__);
     }
 
+    void
+    NavigationData::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"bias_psi\":", bias_psi);
+      w__.field(",\"bias_r\":", bias_r);
+      w__.field(",\"cog\":", cog);
+      w__.field(",\"cyaw\":", cyaw);
+      w__.field(",\"lbl_rej_level\":", lbl_rej_level);
+      w__.field(",\"gps_rej_level\":", gps_rej_level);
+      w__.field(",\"custom_x\":", custom_x);
+      w__.field(",\"custom_y\":", custom_y);
+      w__.field(",\"custom_z\":", custom_z);
+    }
+
+    bool
+    NavigationData::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "bias_psi")) r__.read(bias_psi);
+      else if (JSONReader::match(key__, size__, "bias_r")) r__.read(bias_r);
+      else if (JSONReader::match(key__, size__, "cog")) r__.read(cog);
+      else if (JSONReader::match(key__, size__, "cyaw")) r__.read(cyaw);
+      else if (JSONReader::match(key__, size__, "lbl_rej_level")) r__.read(lbl_rej_level);
+      else if (JSONReader::match(key__, size__, "gps_rej_level")) r__.read(gps_rej_level);
+      else if (JSONReader::match(key__, size__, "custom_x")) r__.read(custom_x);
+      else if (JSONReader::match(key__, size__, "custom_y")) r__.read(custom_y);
+      else if (JSONReader::match(key__, size__, "custom_z")) r__.read(custom_z);
+      else return false;
+      return true;
+    }
+
     GpsFixRejection::GpsFixRejection(void)
     {
       m_header.mgid = 356;
@@ -10755,6 +13259,22 @@ namespace DUNE
       IMC::toJSON(os__, "reason", reason, nindent__);
     }
 
+    void
+    GpsFixRejection::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"utc_time\":", utc_time);
+      w__.field(",\"reason\":", reason);
+    }
+
+    bool
+    GpsFixRejection::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "utc_time")) r__.read(utc_time);
+      else if (JSONReader::match(key__, size__, "reason")) r__.read(reason);
+      else return false;
+      return true;
+    }
+
     LblRangeAcceptance::LblRangeAcceptance(void)
     {
       m_header.mgid = 357;
@@ -10815,6 +13335,12 @@ namespace DUNE
       return bfr__ - start__;
     }
 
+    bool
+    LblRangeAcceptance::hasSubId(void) const
+    {
+      return true;
+    }
+
     uint16_t
     LblRangeAcceptance::getSubId(void) const
     {
@@ -10835,6 +13361,24 @@ namespace DUNE
       IMC::toJSON(os__, "acceptance", acceptance, nindent__);
     }
 
+    void
+    LblRangeAcceptance::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"id\":", id);
+      w__.field(",\"range\":", range);
+      w__.field(",\"acceptance\":", acceptance);
+    }
+
+    bool
+    LblRangeAcceptance::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "id")) r__.read(id);
+      else if (JSONReader::match(key__, size__, "range")) r__.read(range);
+      else if (JSONReader::match(key__, size__, "acceptance")) r__.read(acceptance);
+      else return false;
+      return true;
+    }
+
     DvlRejection::DvlRejection(void)
     {
       m_header.mgid = 358;
@@ -10921,6 +13465,26 @@ namespace DUNE
       IMC::toJSON(os__, "timestep", timestep, nindent__);
     }
 
+    void
+    DvlRejection::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"type\":", type);
+      w__.field(",\"reason\":", reason);
+      w__.field(",\"value\":", value);
+      w__.field(",\"timestep\":", timestep);
+    }
+
+    bool
+    DvlRejection::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "reason")) r__.read(reason);
+      else if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else if (JSONReader::match(key__, size__, "timestep")) r__.read(timestep);
+      else return false;
+      return true;
+    }
+
     LblEstimate::LblEstimate(void)
     {
       m_header.mgid = 360;
@@ -11008,6 +13572,30 @@ namespace DUNE
       IMC::toJSON(os__, "distance", distance, nindent__);
     }
 
+    void
+    LblEstimate::fieldsToJSON(JSONWriter& w__) const
+    {
+      beacon.toJSON(w__, ",\"beacon\":");
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"var_x\":", var_x);
+      w__.field(",\"var_y\":", var_y);
+      w__.field(",\"distance\":", distance);
+    }
+
+    bool
+    LblEstimate::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "beacon")) beacon.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "var_x")) r__.read(var_x);
+      else if (JSONReader::match(key__, size__, "var_y")) r__.read(var_y);
+      else if (JSONReader::match(key__, size__, "distance")) r__.read(distance);
+      else return false;
+      return true;
+    }
+
     void
     LblEstimate::setTimeStampNested(double value__)
     {
@@ -11109,6 +13697,20 @@ namespace DUNE
       IMC::toJSON(os__, "state", state, nindent__);
     }
 
+    void
+    AlignmentState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"state\":", state);
+    }
+
+    bool
+    AlignmentState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "state")) r__.read(state);
+      else return false;
+      return true;
+    }
+
     GroupStreamVelocity::GroupStreamVelocity(void)
     {
       m_header.mgid = 362;
@@ -11177,6 +13779,24 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    GroupStreamVelocity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+    }
+
+    bool
+    GroupStreamVelocity::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else return false;
+      return true;
+    }
+
     Airflow::Airflow(void)
     {
       m_header.mgid = 363;
@@ -11245,6 +13865,24 @@ namespace DUNE
       IMC::toJSON(os__, "ssa", ssa, nindent__);
     }
 
+    void
+    Airflow::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"va\":", va);
+      w__.field(",\"aoa\":", aoa);
+      w__.field(",\"ssa\":", ssa);
+    }
+
+    bool
+    Airflow::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "va")) r__.read(va);
+      else if (JSONReader::match(key__, size__, "aoa")) r__.read(aoa);
+      else if (JSONReader::match(key__, size__, "ssa")) r__.read(ssa);
+      else return false;
+      return true;
+    }
+
     DesiredHeading::DesiredHeading(void)
     {
       m_header.mgid = 400;
@@ -11313,6 +13951,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    DesiredHeading::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    DesiredHeading::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     DesiredZ::DesiredZ(void)
     {
       m_header.mgid = 401;
@@ -11387,6 +14039,22 @@ namespace DUNE
       IMC::toJSON(os__, "z_units", z_units, nindent__);
     }
 
+    void
+    DesiredZ::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+      w__.field(",\"z_units\":", z_units);
+    }
+
+    bool
+    DesiredZ::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else return false;
+      return true;
+    }
+
     DesiredSpeed::DesiredSpeed(void)
     {
       m_header.mgid = 402;
@@ -11461,6 +14129,22 @@ namespace DUNE
       IMC::toJSON(os__, "speed_units", speed_units, nindent__);
     }
 
+    void
+    DesiredSpeed::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+      w__.field(",\"speed_units\":", speed_units);
+    }
+
+    bool
+    DesiredSpeed::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else return false;
+      return true;
+    }
+
     DesiredRoll::DesiredRoll(void)
     {
       m_header.mgid = 403;
@@ -11529,6 +14213,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    DesiredRoll::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    DesiredRoll::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     DesiredPitch::DesiredPitch(void)
     {
       m_header.mgid = 404;
@@ -11597,6 +14295,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    DesiredPitch::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    DesiredPitch::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     DesiredVerticalRate::DesiredVerticalRate(void)
     {
       m_header.mgid = 405;
@@ -11665,6 +14377,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    DesiredVerticalRate::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    DesiredVerticalRate::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     DesiredPath::DesiredPath(void)
     {
       m_header.mgid = 406;
@@ -11797,6 +14523,44 @@ namespace DUNE
       IMC::toJSON(os__, "flags", flags, nindent__);
     }
 
+    void
+    DesiredPath::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"path_ref\":", path_ref);
+      w__.field(",\"start_lat\":", start_lat);
+      w__.field(",\"start_lon\":", start_lon);
+      w__.field(",\"start_z\":", start_z);
+      w__.field(",\"start_z_units\":", start_z_units);
+      w__.field(",\"end_lat\":", end_lat);
+      w__.field(",\"end_lon\":", end_lon);
+      w__.field(",\"end_z\":", end_z);
+      w__.field(",\"end_z_units\":", end_z_units);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"lradius\":", lradius);
+      w__.field(",\"flags\":", flags);
+    }
+
+    bool
+    DesiredPath::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "path_ref")) r__.read(path_ref);
+      else if (JSONReader::match(key__, size__, "start_lat")) r__.read(start_lat);
+      else if (JSONReader::match(key__, size__, "start_lon")) r__.read(start_lon);
+      else if (JSONReader::match(key__, size__, "start_z")) r__.read(start_z);
+      else if (JSONReader::match(key__, size__, "start_z_units")) r__.read(start_z_units);
+      else if (JSONReader::match(key__, size__, "end_lat")) r__.read(end_lat);
+      else if (JSONReader::match(key__, size__, "end_lon")) r__.read(end_lon);
+      else if (JSONReader::match(key__, size__, "end_z")) r__.read(end_z);
+      else if (JSONReader::match(key__, size__, "end_z_units")) r__.read(end_z_units);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "lradius")) r__.read(lradius);
+      else if (JSONReader::match(key__, size__, "flags")) r__.read(flags);
+      else return false;
+      return true;
+    }
+
     DesiredControl::DesiredControl(void)
     {
       m_header.mgid = 407;
@@ -11889,6 +14653,32 @@ namespace DUNE
       IMC::toJSON(os__, "flags", flags, nindent__);
     }
 
+    void
+    DesiredControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+      w__.field(",\"k\":", k);
+      w__.field(",\"m\":", m);
+      w__.field(",\"n\":", n);
+      w__.field(",\"flags\":", flags);
+    }
+
+    bool
+    DesiredControl::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "k")) r__.read(k);
+      else if (JSONReader::match(key__, size__, "m")) r__.read(m);
+      else if (JSONReader::match(key__, size__, "n")) r__.read(n);
+      else if (JSONReader::match(key__, size__, "flags")) r__.read(flags);
+      else return false;
+      return true;
+    }
+
     DesiredHeadingRate::DesiredHeadingRate(void)
     {
       m_header.mgid = 408;
@@ -11957,6 +14747,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    DesiredHeadingRate::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    DesiredHeadingRate::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     DesiredVelocity::DesiredVelocity(void)
     {
       m_header.mgid = 409;
@@ -12049,6 +14853,32 @@ namespace DUNE
       IMC::toJSON(os__, "flags", flags, nindent__);
     }
 
+    void
+    DesiredVelocity::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"u\":", u);
+      w__.field(",\"v\":", v);
+      w__.field(",\"w\":", w);
+      w__.field(",\"p\":", p);
+      w__.field(",\"q\":", q);
+      w__.field(",\"r\":", r);
+      w__.field(",\"flags\":", flags);
+    }
+
+    bool
+    DesiredVelocity::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "u")) r__.read(u);
+      else if (JSONReader::match(key__, size__, "v")) r__.read(v);
+      else if (JSONReader::match(key__, size__, "w")) r__.read(w);
+      else if (JSONReader::match(key__, size__, "p")) r__.read(p);
+      else if (JSONReader::match(key__, size__, "q")) r__.read(q);
+      else if (JSONReader::match(key__, size__, "r")) r__.read(r);
+      else if (JSONReader::match(key__, size__, "flags")) r__.read(flags);
+      else return false;
+      return true;
+    }
+
     PathControlState::PathControlState(void)
     {
       m_header.mgid = 410;
@@ -12217,6 +15047,56 @@ namespace DUNE
       IMC::toJSON(os__, "eta", eta, nindent__);
     }
 
+    void
+    PathControlState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"path_ref\":", path_ref);
+      w__.field(",\"start_lat\":", start_lat);
+      w__.field(",\"start_lon\":", start_lon);
+      w__.field(",\"start_z\":", start_z);
+      w__.field(",\"start_z_units\":", start_z_units);
+      w__.field(",\"end_lat\":", end_lat);
+      w__.field(",\"end_lon\":", end_lon);
+      w__.field(",\"end_z\":", end_z);
+      w__.field(",\"end_z_units\":", end_z_units);
+      w__.field(",\"lradius\":", lradius);
+      w__.field(",\"flags\":", flags);
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+      w__.field(",\"vx\":", vx);
+      w__.field(",\"vy\":", vy);
+      w__.field(",\"vz\":", vz);
+      w__.field(",\"course_error\":", course_error);
+      w__.field(",\"eta\":", eta);
+    }
+
+    bool
+    PathControlState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "path_ref")) r__.read(path_ref);
+      else if (JSONReader::match(key__, size__, "start_lat")) r__.read(start_lat);
+      else if (JSONReader::match(key__, size__, "start_lon")) r__.read(start_lon);
+      else if (JSONReader::match(key__, size__, "start_z")) r__.read(start_z);
+      else if (JSONReader::match(key__, size__, "start_z_units")) r__.read(start_z_units);
+      else if (JSONReader::match(key__, size__, "end_lat")) r__.read(end_lat);
+      else if (JSONReader::match(key__, size__, "end_lon")) r__.read(end_lon);
+      else if (JSONReader::match(key__, size__, "end_z")) r__.read(end_z);
+      else if (JSONReader::match(key__, size__, "end_z_units")) r__.read(end_z_units);
+      else if (JSONReader::match(key__, size__, "lradius")) r__.read(lradius);
+      else if (JSONReader::match(key__, size__, "flags")) r__.read(flags);
+      else if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "vx")) r__.read(vx);
+      else if (JSONReader::match(key__, size__, "vy")) r__.read(vy);
+      else if (JSONReader::match(key__, size__, "vz")) r__.read(vz);
+      else if (JSONReader::match(key__, size__, "course_error")) r__.read(course_error);
+      else if (JSONReader::match(key__, size__, "eta")) r__.read(eta);
+      else return false;
+      return true;
+    }
+
     AllocatedControlTorques::AllocatedControlTorques(void)
     {
       m_header.mgid = 411;
@@ -12285,6 +15165,24 @@ namespace DUNE
       IMC::toJSON(os__, "n", n, nindent__);
     }
 
+    void
+    AllocatedControlTorques::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"k\":", k);
+      w__.field(",\"m\":", m);
+      w__.field(",\"n\":", n);
+    }
+
+    bool
+    AllocatedControlTorques::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "k")) r__.read(k);
+      else if (JSONReader::match(key__, size__, "m")) r__.read(m);
+      else if (JSONReader::match(key__, size__, "n")) r__.read(n);
+      else return false;
+      return true;
+    }
+
     ControlParcel::ControlParcel(void)
     {
       m_header.mgid = 412;
@@ -12359,6 +15257,26 @@ namespace DUNE
       IMC::toJSON(os__, "a", a, nindent__);
     }
 
+    void
+    ControlParcel::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"p\":", p);
+      w__.field(",\"i\":", i);
+      w__.field(",\"d\":", d);
+      w__.field(",\"a\":", a);
+    }
+
+    bool
+    ControlParcel::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "p")) r__.read(p);
+      else if (JSONReader::match(key__, size__, "i")) r__.read(i);
+      else if (JSONReader::match(key__, size__, "d")) r__.read(d);
+      else if (JSONReader::match(key__, size__, "a")) r__.read(a);
+      else return false;
+      return true;
+    }
+
     Brake::Brake(void)
     {
       m_header.mgid = 413;
@@ -12415,6 +15333,20 @@ namespace DUNE
       IMC::toJSON(os__, "op", op, nindent__);
     }
 
+    void
+    Brake::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"op\":", op);
+    }
+
+    bool
+    Brake::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else return false;
+      return true;
+    }
+
     DesiredLinearState::DesiredLinearState(void)
     {
       m_header.mgid = 414;
@@ -12525,6 +15457,38 @@ namespace DUNE
       IMC::toJSON(os__, "flags", flags, nindent__);
     }
 
+    void
+    DesiredLinearState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+      w__.field(",\"vx\":", vx);
+      w__.field(",\"vy\":", vy);
+      w__.field(",\"vz\":", vz);
+      w__.field(",\"ax\":", ax);
+      w__.field(",\"ay\":", ay);
+      w__.field(",\"az\":", az);
+      w__.field(",\"flags\":", flags);
+    }
+
+    bool
+    DesiredLinearState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "vx")) r__.read(vx);
+      else if (JSONReader::match(key__, size__, "vy")) r__.read(vy);
+      else if (JSONReader::match(key__, size__, "vz")) r__.read(vz);
+      else if (JSONReader::match(key__, size__, "ax")) r__.read(ax);
+      else if (JSONReader::match(key__, size__, "ay")) r__.read(ay);
+      else if (JSONReader::match(key__, size__, "az")) r__.read(az);
+      else if (JSONReader::match(key__, size__, "flags")) r__.read(flags);
+      else return false;
+      return true;
+    }
+
     DesiredThrottle::DesiredThrottle(void)
     {
       m_header.mgid = 415;
@@ -12593,6 +15557,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    DesiredThrottle::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    DesiredThrottle::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     Goto::Goto(void)
     {
       m_header.mgid = 450;
@@ -12714,6 +15692,40 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Goto::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"timeout\":", timeout);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"roll\":", roll);
+      w__.field(",\"pitch\":", pitch);
+      w__.field(",\"yaw\":", yaw);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    Goto::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "roll")) r__.read(roll);
+      else if (JSONReader::match(key__, size__, "pitch")) r__.read(pitch);
+      else if (JSONReader::match(key__, size__, "yaw")) r__.read(yaw);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     PopUp::PopUp(void)
     {
       m_header.mgid = 451;
@@ -12833,6 +15845,40 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    PopUp::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"timeout\":", timeout);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"duration\":", duration);
+      w__.field(",\"radius\":", radius);
+      w__.field(",\"flags\":", flags);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    PopUp::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "duration")) r__.read(duration);
+      else if (JSONReader::match(key__, size__, "radius")) r__.read(radius);
+      else if (JSONReader::match(key__, size__, "flags")) r__.read(flags);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     Teleoperation::Teleoperation(void)
     {
       m_header.mgid = 452;
@@ -12889,6 +15935,20 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Teleoperation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    Teleoperation::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     Loiter::Loiter(void)
     {
       m_header.mgid = 453;
@@ -13030,6 +16090,46 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Loiter::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"timeout\":", timeout);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"duration\":", duration);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"type\":", type);
+      w__.field(",\"radius\":", radius);
+      w__.field(",\"length\":", length);
+      w__.field(",\"bearing\":", bearing);
+      w__.field(",\"direction\":", direction);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    Loiter::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "duration")) r__.read(duration);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "radius")) r__.read(radius);
+      else if (JSONReader::match(key__, size__, "length")) r__.read(length);
+      else if (JSONReader::match(key__, size__, "bearing")) r__.read(bearing);
+      else if (JSONReader::match(key__, size__, "direction")) r__.read(direction);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     IdleManeuver::IdleManeuver(void)
     {
       m_header.mgid = 454;
@@ -13092,6 +16192,22 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    IdleManeuver::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"duration\":", duration);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    IdleManeuver::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "duration")) r__.read(duration);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     LowLevelControl::LowLevelControl(void)
     {
       m_header.mgid = 455;
@@ -13161,6 +16277,24 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    LowLevelControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      control.toJSON(w__, ",\"control\":");
+      w__.field(",\"duration\":", duration);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    LowLevelControl::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "control")) control.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "duration")) r__.read(duration);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     void
     LowLevelControl::setTimeStampNested(double value__)
     {
@@ -13360,6 +16494,50 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Rows::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"timeout\":", timeout);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"bearing\":", bearing);
+      w__.field(",\"cross_angle\":", cross_angle);
+      w__.field(",\"width\":", width);
+      w__.field(",\"length\":", length);
+      w__.field(",\"hstep\":", hstep);
+      w__.field(",\"coff\":", coff);
+      w__.field(",\"alternation\":", alternation);
+      w__.field(",\"flags\":", flags);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    Rows::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "bearing")) r__.read(bearing);
+      else if (JSONReader::match(key__, size__, "cross_angle")) r__.read(cross_angle);
+      else if (JSONReader::match(key__, size__, "width")) r__.read(width);
+      else if (JSONReader::match(key__, size__, "length")) r__.read(length);
+      else if (JSONReader::match(key__, size__, "hstep")) r__.read(hstep);
+      else if (JSONReader::match(key__, size__, "coff")) r__.read(coff);
+      else if (JSONReader::match(key__, size__, "alternation")) r__.read(alternation);
+      else if (JSONReader::match(key__, size__, "flags")) r__.read(flags);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     PathPoint::PathPoint(void)
     {
       m_header.mgid = 458;
@@ -13428,6 +16606,24 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    PathPoint::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+    }
+
+    bool
+    PathPoint::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else return false;
+      return true;
+    }
+
     FollowPath::FollowPath(void)
     {
       m_header.mgid = 457;
@@ -13535,6 +16731,36 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    FollowPath::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"timeout\":", timeout);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      points.toJSON(w__, ",\"points\":");
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    FollowPath::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "points")) points.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     void
     FollowPath::setTimeStampNested(double value__)
     {
@@ -13678,6 +16904,38 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    YoYo::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"timeout\":", timeout);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"amplitude\":", amplitude);
+      w__.field(",\"pitch\":", pitch);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    YoYo::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "amplitude")) r__.read(amplitude);
+      else if (JSONReader::match(key__, size__, "pitch")) r__.read(pitch);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     TeleoperationDone::TeleoperationDone(void)
     {
       m_header.mgid = 460;
@@ -13823,6 +17081,36 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    StationKeeping::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"radius\":", radius);
+      w__.field(",\"duration\":", duration);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    StationKeeping::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "radius")) r__.read(radius);
+      else if (JSONReader::match(key__, size__, "duration")) r__.read(duration);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     Elevator::Elevator(void)
     {
       m_header.mgid = 462;
@@ -13948,6 +17236,42 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Elevator::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"timeout\":", timeout);
+      w__.field(",\"flags\":", flags);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"start_z\":", start_z);
+      w__.field(",\"start_z_units\":", start_z_units);
+      w__.field(",\"end_z\":", end_z);
+      w__.field(",\"end_z_units\":", end_z_units);
+      w__.field(",\"radius\":", radius);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    Elevator::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "flags")) r__.read(flags);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "start_z")) r__.read(start_z);
+      else if (JSONReader::match(key__, size__, "start_z_units")) r__.read(start_z_units);
+      else if (JSONReader::match(key__, size__, "end_z")) r__.read(end_z);
+      else if (JSONReader::match(key__, size__, "end_z_units")) r__.read(end_z_units);
+      else if (JSONReader::match(key__, size__, "radius")) r__.read(radius);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     TrajectoryPoint::TrajectoryPoint(void)
     {
       m_header.mgid = 464;
@@ -14022,6 +17346,26 @@ namespace DUNE
       IMC::toJSON(os__, "t", t, nindent__);
     }
 
+    void
+    TrajectoryPoint::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+      w__.field(",\"t\":", t);
+    }
+
+    bool
+    TrajectoryPoint::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "t")) r__.read(t);
+      else return false;
+      return true;
+    }
+
     FollowTrajectory::FollowTrajectory(void)
     {
       m_header.mgid = 463;
@@ -14129,6 +17473,36 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    FollowTrajectory::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"timeout\":", timeout);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      points.toJSON(w__, ",\"points\":");
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    FollowTrajectory::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "points")) points.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     void
     FollowTrajectory::setTimeStampNested(double value__)
     {
@@ -14227,6 +17601,24 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    CustomManeuver::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"timeout\":", timeout);
+      w__.field(",\"name\":", name);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    CustomManeuver::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "name")) r__.read(name);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     VehicleFormationParticipant::VehicleFormationParticipant(void)
     {
       m_header.mgid = 467;
@@ -14301,6 +17693,26 @@ namespace DUNE
       IMC::toJSON(os__, "off_z", off_z, nindent__);
     }
 
+    void
+    VehicleFormationParticipant::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"vid\":", vid);
+      w__.field(",\"off_x\":", off_x);
+      w__.field(",\"off_y\":", off_y);
+      w__.field(",\"off_z\":", off_z);
+    }
+
+    bool
+    VehicleFormationParticipant::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "vid")) r__.read(vid);
+      else if (JSONReader::match(key__, size__, "off_x")) r__.read(off_x);
+      else if (JSONReader::match(key__, size__, "off_y")) r__.read(off_y);
+      else if (JSONReader::match(key__, size__, "off_z")) r__.read(off_z);
+      else return false;
+      return true;
+    }
+
     VehicleFormation::VehicleFormation(void)
     {
       m_header.mgid = 466;
@@ -14415,6 +17827,38 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    VehicleFormation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      points.toJSON(w__, ",\"points\":");
+      participants.toJSON(w__, ",\"participants\":");
+      w__.field(",\"start_time\":", start_time);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    VehicleFormation::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "points")) points.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "participants")) participants.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "start_time")) r__.read(start_time);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     void
     VehicleFormation::setTimeStampNested(double value__)
     {
@@ -14550,6 +17994,20 @@ namespace DUNE
       IMC::toJSON(os__, "mid", mid, nindent__);
     }
 
+    void
+    RegisterManeuver::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"mid\":", mid);
+    }
+
+    bool
+    RegisterManeuver::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "mid")) r__.read(mid);
+      else return false;
+      return true;
+    }
+
     ManeuverControlState::ManeuverControlState(void)
     {
       m_header.mgid = 470;
@@ -14618,6 +18076,24 @@ namespace DUNE
       IMC::toJSON(os__, "info", info, nindent__);
     }
 
+    void
+    ManeuverControlState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"state\":", state);
+      w__.field(",\"eta\":", eta);
+      w__.field(",\"info\":", info);
+    }
+
+    bool
+    ManeuverControlState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "state")) r__.read(state);
+      else if (JSONReader::match(key__, size__, "eta")) r__.read(eta);
+      else if (JSONReader::match(key__, size__, "info")) r__.read(info);
+      else return false;
+      return true;
+    }
+
     FollowSystem::FollowSystem(void)
     {
       m_header.mgid = 471;
@@ -14716,6 +18192,34 @@ namespace DUNE
       IMC::toJSON(os__, "z_units", z_units, nindent__);
     }
 
+    void
+    FollowSystem::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"system\":", system);
+      w__.field(",\"duration\":", duration);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+    }
+
+    bool
+    FollowSystem::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "system")) r__.read(system);
+      else if (JSONReader::match(key__, size__, "duration")) r__.read(duration);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else return false;
+      return true;
+    }
+
     CommsRelay::CommsRelay(void)
     {
       m_header.mgid = 472;
@@ -14816,6 +18320,34 @@ namespace DUNE
       IMC::toJSON(os__, "move_threshold", move_threshold, nindent__);
     }
 
+    void
+    CommsRelay::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"duration\":", duration);
+      w__.field(",\"sys_a\":", sys_a);
+      w__.field(",\"sys_b\":", sys_b);
+      w__.field(",\"move_threshold\":", move_threshold);
+    }
+
+    bool
+    CommsRelay::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "duration")) r__.read(duration);
+      else if (JSONReader::match(key__, size__, "sys_a")) r__.read(sys_a);
+      else if (JSONReader::match(key__, size__, "sys_b")) r__.read(sys_b);
+      else if (JSONReader::match(key__, size__, "move_threshold")) r__.read(move_threshold);
+      else return false;
+      return true;
+    }
+
     PolygonVertex::PolygonVertex(void)
     {
       m_header.mgid = 474;
@@ -14880,6 +18412,22 @@ namespace DUNE
       IMC::toJSON(os__, "lon", lon, nindent__);
     }
 
+    void
+    PolygonVertex::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+    }
+
+    bool
+    PolygonVertex::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else return false;
+      return true;
+    }
+
     CoverArea::CoverArea(void)
     {
       m_header.mgid = 473;
@@ -14981,6 +18529,34 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    CoverArea::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      polygon.toJSON(w__, ",\"polygon\":");
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    CoverArea::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "polygon")) polygon.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     void
     CoverArea::setTimeStampNested(double value__)
     {
@@ -15144,6 +18720,44 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    CompassCalibration::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"timeout\":", timeout);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"pitch\":", pitch);
+      w__.field(",\"amplitude\":", amplitude);
+      w__.field(",\"duration\":", duration);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"radius\":", radius);
+      w__.field(",\"direction\":", direction);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    CompassCalibration::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "pitch")) r__.read(pitch);
+      else if (JSONReader::match(key__, size__, "amplitude")) r__.read(amplitude);
+      else if (JSONReader::match(key__, size__, "duration")) r__.read(duration);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "radius")) r__.read(radius);
+      else if (JSONReader::match(key__, size__, "direction")) r__.read(direction);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     FormationParameters::FormationParameters(void)
     {
       m_header.mgid = 476;
@@ -15219,6 +18833,26 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    FormationParameters::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"formation_name\":", formation_name);
+      w__.field(",\"reference_frame\":", reference_frame);
+      participants.toJSON(w__, ",\"participants\":");
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    FormationParameters::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "formation_name")) r__.read(formation_name);
+      else if (JSONReader::match(key__, size__, "reference_frame")) r__.read(reference_frame);
+      else if (JSONReader::match(key__, size__, "participants")) participants.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     void
     FormationParameters::setTimeStampNested(double value__)
     {
@@ -15383,6 +19017,46 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    FormationPlanExecution::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"group_name\":", group_name);
+      w__.field(",\"formation_name\":", formation_name);
+      w__.field(",\"plan_id\":", plan_id);
+      w__.field(",\"description\":", description);
+      w__.field(",\"leader_speed\":", leader_speed);
+      w__.field(",\"leader_bank_lim\":", leader_bank_lim);
+      w__.field(",\"pos_sim_err_lim\":", pos_sim_err_lim);
+      w__.field(",\"pos_sim_err_wrn\":", pos_sim_err_wrn);
+      w__.field(",\"pos_sim_err_timeout\":", pos_sim_err_timeout);
+      w__.field(",\"converg_max\":", converg_max);
+      w__.field(",\"converg_timeout\":", converg_timeout);
+      w__.field(",\"comms_timeout\":", comms_timeout);
+      w__.field(",\"turb_lim\":", turb_lim);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    FormationPlanExecution::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "group_name")) r__.read(group_name);
+      else if (JSONReader::match(key__, size__, "formation_name")) r__.read(formation_name);
+      else if (JSONReader::match(key__, size__, "plan_id")) r__.read(plan_id);
+      else if (JSONReader::match(key__, size__, "description")) r__.read(description);
+      else if (JSONReader::match(key__, size__, "leader_speed")) r__.read(leader_speed);
+      else if (JSONReader::match(key__, size__, "leader_bank_lim")) r__.read(leader_bank_lim);
+      else if (JSONReader::match(key__, size__, "pos_sim_err_lim")) r__.read(pos_sim_err_lim);
+      else if (JSONReader::match(key__, size__, "pos_sim_err_wrn")) r__.read(pos_sim_err_wrn);
+      else if (JSONReader::match(key__, size__, "pos_sim_err_timeout")) r__.read(pos_sim_err_timeout);
+      else if (JSONReader::match(key__, size__, "converg_max")) r__.read(converg_max);
+      else if (JSONReader::match(key__, size__, "converg_timeout")) r__.read(converg_timeout);
+      else if (JSONReader::match(key__, size__, "comms_timeout")) r__.read(comms_timeout);
+      else if (JSONReader::match(key__, size__, "turb_lim")) r__.read(turb_lim);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     FollowReference::FollowReference(void)
     {
       m_header.mgid = 478;
@@ -15463,6 +19137,28 @@ namespace DUNE
       IMC::toJSON(os__, "altitude_interval", altitude_interval, nindent__);
     }
 
+    void
+    FollowReference::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"control_src\":", control_src);
+      w__.field(",\"control_ent\":", control_ent);
+      w__.field(",\"timeout\":", timeout);
+      w__.field(",\"loiter_radius\":", loiter_radius);
+      w__.field(",\"altitude_interval\":", altitude_interval);
+    }
+
+    bool
+    FollowReference::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "control_src")) r__.read(control_src);
+      else if (JSONReader::match(key__, size__, "control_ent")) r__.read(control_ent);
+      else if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "loiter_radius")) r__.read(loiter_radius);
+      else if (JSONReader::match(key__, size__, "altitude_interval")) r__.read(altitude_interval);
+      else return false;
+      return true;
+    }
+
     Reference::Reference(void)
     {
       m_header.mgid = 479;
@@ -15551,6 +19247,30 @@ namespace DUNE
       IMC::toJSON(os__, "radius", radius, nindent__);
     }
 
+    void
+    Reference::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"flags\":", flags);
+      speed.toJSON(w__, ",\"speed\":");
+      z.toJSON(w__, ",\"z\":");
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"radius\":", radius);
+    }
+
+    bool
+    Reference::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "flags")) r__.read(flags);
+      else if (JSONReader::match(key__, size__, "speed")) speed.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "z")) z.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "radius")) r__.read(radius);
+      else return false;
+      return true;
+    }
+
     void
     Reference::setTimeStampNested(double value__)
     {
@@ -15702,6 +19422,28 @@ namespace DUNE
       IMC::toJSON(os__, "proximity", proximity, nindent__);
     }
 
+    void
+    FollowRefState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"control_src\":", control_src);
+      w__.field(",\"control_ent\":", control_ent);
+      reference.toJSON(w__, ",\"reference\":");
+      w__.field(",\"state\":", state);
+      w__.field(",\"proximity\":", proximity);
+    }
+
+    bool
+    FollowRefState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "control_src")) r__.read(control_src);
+      else if (JSONReader::match(key__, size__, "control_ent")) r__.read(control_ent);
+      else if (JSONReader::match(key__, size__, "reference")) reference.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "state")) r__.read(state);
+      else if (JSONReader::match(key__, size__, "proximity")) r__.read(proximity);
+      else return false;
+      return true;
+    }
+
     void
     FollowRefState::setTimeStampNested(double value__)
     {
@@ -15929,6 +19671,62 @@ namespace DUNE
       IMC::toJSON(os__, "virt_err_z", virt_err_z, nindent__);
     }
 
+    void
+    RelativeState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"s_id\":", s_id);
+      w__.field(",\"dist\":", dist);
+      w__.field(",\"err\":", err);
+      w__.field(",\"ctrl_imp\":", ctrl_imp);
+      w__.field(",\"rel_dir_x\":", rel_dir_x);
+      w__.field(",\"rel_dir_y\":", rel_dir_y);
+      w__.field(",\"rel_dir_z\":", rel_dir_z);
+      w__.field(",\"err_x\":", err_x);
+      w__.field(",\"err_y\":", err_y);
+      w__.field(",\"err_z\":", err_z);
+      w__.field(",\"rf_err_x\":", rf_err_x);
+      w__.field(",\"rf_err_y\":", rf_err_y);
+      w__.field(",\"rf_err_z\":", rf_err_z);
+      w__.field(",\"rf_err_vx\":", rf_err_vx);
+      w__.field(",\"rf_err_vy\":", rf_err_vy);
+      w__.field(",\"rf_err_vz\":", rf_err_vz);
+      w__.field(",\"ss_x\":", ss_x);
+      w__.field(",\"ss_y\":", ss_y);
+      w__.field(",\"ss_z\":", ss_z);
+      w__.field(",\"virt_err_x\":", virt_err_x);
+      w__.field(",\"virt_err_y\":", virt_err_y);
+      w__.field(",\"virt_err_z\":", virt_err_z);
+    }
+
+    bool
+    RelativeState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "s_id")) r__.read(s_id);
+      else if (JSONReader::match(key__, size__, "dist")) r__.read(dist);
+      else if (JSONReader::match(key__, size__, "err")) r__.read(err);
+      else if (JSONReader::match(key__, size__, "ctrl_imp")) r__.read(ctrl_imp);
+      else if (JSONReader::match(key__, size__, "rel_dir_x")) r__.read(rel_dir_x);
+      else if (JSONReader::match(key__, size__, "rel_dir_y")) r__.read(rel_dir_y);
+      else if (JSONReader::match(key__, size__, "rel_dir_z")) r__.read(rel_dir_z);
+      else if (JSONReader::match(key__, size__, "err_x")) r__.read(err_x);
+      else if (JSONReader::match(key__, size__, "err_y")) r__.read(err_y);
+      else if (JSONReader::match(key__, size__, "err_z")) r__.read(err_z);
+      else if (JSONReader::match(key__, size__, "rf_err_x")) r__.read(rf_err_x);
+      else if (JSONReader::match(key__, size__, "rf_err_y")) r__.read(rf_err_y);
+      else if (JSONReader::match(key__, size__, "rf_err_z")) r__.read(rf_err_z);
+      else if (JSONReader::match(key__, size__, "rf_err_vx")) r__.read(rf_err_vx);
+      else if (JSONReader::match(key__, size__, "rf_err_vy")) r__.read(rf_err_vy);
+      else if (JSONReader::match(key__, size__, "rf_err_vz")) r__.read(rf_err_vz);
+      else if (JSONReader::match(key__, size__, "ss_x")) r__.read(ss_x);
+      else if (JSONReader::match(key__, size__, "ss_y")) r__.read(ss_y);
+      else if (JSONReader::match(key__, size__, "ss_z")) r__.read(ss_z);
+      else if (JSONReader::match(key__, size__, "virt_err_x")) r__.read(virt_err_x);
+      else if (JSONReader::match(key__, size__, "virt_err_y")) r__.read(virt_err_y);
+      else if (JSONReader::match(key__, size__, "virt_err_z")) r__.read(virt_err_z);
+      else return false;
+      return true;
+    }
+
     FormationMonitor::FormationMonitor(void)
     {
       m_header.mgid = 481;
@@ -16094,6 +19892,56 @@ namespace DUNE
       rel_state.toJSON(os__, "rel_state", nindent__);
     }
 
+    void
+    FormationMonitor::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"ax_cmd\":", ax_cmd);
+      w__.field(",\"ay_cmd\":", ay_cmd);
+      w__.field(",\"az_cmd\":", az_cmd);
+      w__.field(",\"ax_des\":", ax_des);
+      w__.field(",\"ay_des\":", ay_des);
+      w__.field(",\"az_des\":", az_des);
+      w__.field(",\"virt_err_x\":", virt_err_x);
+      w__.field(",\"virt_err_y\":", virt_err_y);
+      w__.field(",\"virt_err_z\":", virt_err_z);
+      w__.field(",\"surf_fdbk_x\":", surf_fdbk_x);
+      w__.field(",\"surf_fdbk_y\":", surf_fdbk_y);
+      w__.field(",\"surf_fdbk_z\":", surf_fdbk_z);
+      w__.field(",\"surf_unkn_x\":", surf_unkn_x);
+      w__.field(",\"surf_unkn_y\":", surf_unkn_y);
+      w__.field(",\"surf_unkn_z\":", surf_unkn_z);
+      w__.field(",\"ss_x\":", ss_x);
+      w__.field(",\"ss_y\":", ss_y);
+      w__.field(",\"ss_z\":", ss_z);
+      rel_state.toJSON(w__, ",\"rel_state\":");
+    }
+
+    bool
+    FormationMonitor::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "ax_cmd")) r__.read(ax_cmd);
+      else if (JSONReader::match(key__, size__, "ay_cmd")) r__.read(ay_cmd);
+      else if (JSONReader::match(key__, size__, "az_cmd")) r__.read(az_cmd);
+      else if (JSONReader::match(key__, size__, "ax_des")) r__.read(ax_des);
+      else if (JSONReader::match(key__, size__, "ay_des")) r__.read(ay_des);
+      else if (JSONReader::match(key__, size__, "az_des")) r__.read(az_des);
+      else if (JSONReader::match(key__, size__, "virt_err_x")) r__.read(virt_err_x);
+      else if (JSONReader::match(key__, size__, "virt_err_y")) r__.read(virt_err_y);
+      else if (JSONReader::match(key__, size__, "virt_err_z")) r__.read(virt_err_z);
+      else if (JSONReader::match(key__, size__, "surf_fdbk_x")) r__.read(surf_fdbk_x);
+      else if (JSONReader::match(key__, size__, "surf_fdbk_y")) r__.read(surf_fdbk_y);
+      else if (JSONReader::match(key__, size__, "surf_fdbk_z")) r__.read(surf_fdbk_z);
+      else if (JSONReader::match(key__, size__, "surf_unkn_x")) r__.read(surf_unkn_x);
+      else if (JSONReader::match(key__, size__, "surf_unkn_y")) r__.read(surf_unkn_y);
+      else if (JSONReader::match(key__, size__, "surf_unkn_z")) r__.read(surf_unkn_z);
+      else if (JSONReader::match(key__, size__, "ss_x")) r__.read(ss_x);
+      else if (JSONReader::match(key__, size__, "ss_y")) r__.read(ss_y);
+      else if (JSONReader::match(key__, size__, "ss_z")) r__.read(ss_z);
+      else if (JSONReader::match(key__, size__, "rel_state")) rel_state.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     FormationMonitor::setTimeStampNested(double value__)
     {
@@ -16198,6 +20046,26 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Dislodge::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"timeout\":", timeout);
+      w__.field(",\"rpm\":", rpm);
+      w__.field(",\"direction\":", direction);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    Dislodge::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "rpm")) r__.read(rpm);
+      else if (JSONReader::match(key__, size__, "direction")) r__.read(direction);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     Formation::Formation(void)
     {
       m_header.mgid = 484;
@@ -16375,6 +20243,60 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Formation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"formation_name\":", formation_name);
+      w__.field(",\"type\":", type);
+      w__.field(",\"op\":", op);
+      w__.field(",\"group_name\":", group_name);
+      w__.field(",\"plan_id\":", plan_id);
+      w__.field(",\"description\":", description);
+      w__.field(",\"reference_frame\":", reference_frame);
+      participants.toJSON(w__, ",\"participants\":");
+      w__.field(",\"leader_bank_lim\":", leader_bank_lim);
+      w__.field(",\"leader_speed_min\":", leader_speed_min);
+      w__.field(",\"leader_speed_max\":", leader_speed_max);
+      w__.field(",\"leader_alt_min\":", leader_alt_min);
+      w__.field(",\"leader_alt_max\":", leader_alt_max);
+      w__.field(",\"pos_sim_err_lim\":", pos_sim_err_lim);
+      w__.field(",\"pos_sim_err_wrn\":", pos_sim_err_wrn);
+      w__.field(",\"pos_sim_err_timeout\":", pos_sim_err_timeout);
+      w__.field(",\"converg_max\":", converg_max);
+      w__.field(",\"converg_timeout\":", converg_timeout);
+      w__.field(",\"comms_timeout\":", comms_timeout);
+      w__.field(",\"turb_lim\":", turb_lim);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    Formation::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "formation_name")) r__.read(formation_name);
+      else if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "group_name")) r__.read(group_name);
+      else if (JSONReader::match(key__, size__, "plan_id")) r__.read(plan_id);
+      else if (JSONReader::match(key__, size__, "description")) r__.read(description);
+      else if (JSONReader::match(key__, size__, "reference_frame")) r__.read(reference_frame);
+      else if (JSONReader::match(key__, size__, "participants")) participants.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "leader_bank_lim")) r__.read(leader_bank_lim);
+      else if (JSONReader::match(key__, size__, "leader_speed_min")) r__.read(leader_speed_min);
+      else if (JSONReader::match(key__, size__, "leader_speed_max")) r__.read(leader_speed_max);
+      else if (JSONReader::match(key__, size__, "leader_alt_min")) r__.read(leader_alt_min);
+      else if (JSONReader::match(key__, size__, "leader_alt_max")) r__.read(leader_alt_max);
+      else if (JSONReader::match(key__, size__, "pos_sim_err_lim")) r__.read(pos_sim_err_lim);
+      else if (JSONReader::match(key__, size__, "pos_sim_err_wrn")) r__.read(pos_sim_err_wrn);
+      else if (JSONReader::match(key__, size__, "pos_sim_err_timeout")) r__.read(pos_sim_err_timeout);
+      else if (JSONReader::match(key__, size__, "converg_max")) r__.read(converg_max);
+      else if (JSONReader::match(key__, size__, "converg_timeout")) r__.read(converg_timeout);
+      else if (JSONReader::match(key__, size__, "comms_timeout")) r__.read(comms_timeout);
+      else if (JSONReader::match(key__, size__, "turb_lim")) r__.read(turb_lim);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     void
     Formation::setTimeStampNested(double value__)
     {
@@ -16505,6 +20427,34 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Launch::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"timeout\":", timeout);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    Launch::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     Drop::Drop(void)
     {
       m_header.mgid = 486;
@@ -16605,6 +20555,34 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Drop::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"timeout\":", timeout);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    Drop::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     ScheduledGoto::ScheduledGoto(void)
     {
       m_header.mgid = 487;
@@ -16705,6 +20683,34 @@ namespace DUNE
       IMC::toJSON(os__, "delayed", delayed, nindent__);
     }
 
+    void
+    ScheduledGoto::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"arrival_time\":", arrival_time);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"travel_z\":", travel_z);
+      w__.field(",\"travel_z_units\":", travel_z_units);
+      w__.field(",\"delayed\":", delayed);
+    }
+
+    bool
+    ScheduledGoto::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "arrival_time")) r__.read(arrival_time);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "travel_z")) r__.read(travel_z);
+      else if (JSONReader::match(key__, size__, "travel_z_units")) r__.read(travel_z_units);
+      else if (JSONReader::match(key__, size__, "delayed")) r__.read(delayed);
+      else return false;
+      return true;
+    }
+
     RowsCoverage::RowsCoverage(void)
     {
       m_header.mgid = 488;
@@ -16859,6 +20865,50 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    RowsCoverage::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"bearing\":", bearing);
+      w__.field(",\"cross_angle\":", cross_angle);
+      w__.field(",\"width\":", width);
+      w__.field(",\"length\":", length);
+      w__.field(",\"coff\":", coff);
+      w__.field(",\"angaperture\":", angaperture);
+      w__.field(",\"range\":", range);
+      w__.field(",\"overlap\":", overlap);
+      w__.field(",\"flags\":", flags);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    RowsCoverage::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "bearing")) r__.read(bearing);
+      else if (JSONReader::match(key__, size__, "cross_angle")) r__.read(cross_angle);
+      else if (JSONReader::match(key__, size__, "width")) r__.read(width);
+      else if (JSONReader::match(key__, size__, "length")) r__.read(length);
+      else if (JSONReader::match(key__, size__, "coff")) r__.read(coff);
+      else if (JSONReader::match(key__, size__, "angaperture")) r__.read(angaperture);
+      else if (JSONReader::match(key__, size__, "range")) r__.read(range);
+      else if (JSONReader::match(key__, size__, "overlap")) r__.read(overlap);
+      else if (JSONReader::match(key__, size__, "flags")) r__.read(flags);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     Sample::Sample(void)
     {
       m_header.mgid = 489;
@@ -16977,6 +21027,40 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Sample::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"timeout\":", timeout);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"syringe0\":", syringe0);
+      w__.field(",\"syringe1\":", syringe1);
+      w__.field(",\"syringe2\":", syringe2);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    Sample::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "syringe0")) r__.read(syringe0);
+      else if (JSONReader::match(key__, size__, "syringe1")) r__.read(syringe1);
+      else if (JSONReader::match(key__, size__, "syringe2")) r__.read(syringe2);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     ImageTracking::ImageTracking(void)
     {
       m_header.mgid = 490;
@@ -17117,6 +21201,34 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Takeoff::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"takeoff_pitch\":", takeoff_pitch);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    Takeoff::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "takeoff_pitch")) r__.read(takeoff_pitch);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     Land::Land(void)
     {
       m_header.mgid = 492;
@@ -17237,6 +21349,40 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Land::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"abort_z\":", abort_z);
+      w__.field(",\"bearing\":", bearing);
+      w__.field(",\"glide_slope\":", glide_slope);
+      w__.field(",\"glide_slope_alt\":", glide_slope_alt);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    Land::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "abort_z")) r__.read(abort_z);
+      else if (JSONReader::match(key__, size__, "bearing")) r__.read(bearing);
+      else if (JSONReader::match(key__, size__, "glide_slope")) r__.read(glide_slope);
+      else if (JSONReader::match(key__, size__, "glide_slope_alt")) r__.read(glide_slope_alt);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     AutonomousSection::AutonomousSection(void)
     {
       m_header.mgid = 493;
@@ -17356,6 +21502,40 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    AutonomousSection::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"limits\":", limits);
+      w__.field(",\"max_depth\":", max_depth);
+      w__.field(",\"min_alt\":", min_alt);
+      w__.field(",\"time_limit\":", time_limit);
+      area_limits.toJSON(w__, ",\"area_limits\":");
+      w__.field(",\"controller\":", controller);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    AutonomousSection::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "limits")) r__.read(limits);
+      else if (JSONReader::match(key__, size__, "max_depth")) r__.read(max_depth);
+      else if (JSONReader::match(key__, size__, "min_alt")) r__.read(min_alt);
+      else if (JSONReader::match(key__, size__, "time_limit")) r__.read(time_limit);
+      else if (JSONReader::match(key__, size__, "area_limits")) area_limits.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "controller")) r__.read(controller);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     void
     AutonomousSection::setTimeStampNested(double value__)
     {
@@ -17487,6 +21667,34 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    FollowPoint::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"target\":", target);
+      w__.field(",\"max_speed\":", max_speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    FollowPoint::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "target")) r__.read(target);
+      else if (JSONReader::match(key__, size__, "max_speed")) r__.read(max_speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     Alignment::Alignment(void)
     {
       m_header.mgid = 495;
@@ -17575,6 +21783,30 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    Alignment::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"timeout\":", timeout);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    Alignment::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     StationKeepingExtended::StationKeepingExtended(void)
     {
       m_header.mgid = 496;
@@ -17699,6 +21931,42 @@ namespace DUNE
       IMC::toJSON(os__, "custom", custom, nindent__);
     }
 
+    void
+    StationKeepingExtended::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"radius\":", radius);
+      w__.field(",\"duration\":", duration);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"speed_units\":", speed_units);
+      w__.field(",\"popup_period\":", popup_period);
+      w__.field(",\"popup_duration\":", popup_duration);
+      w__.field(",\"flags\":", flags);
+      w__.field(",\"custom\":", custom);
+    }
+
+    bool
+    StationKeepingExtended::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "radius")) r__.read(radius);
+      else if (JSONReader::match(key__, size__, "duration")) r__.read(duration);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "speed_units")) r__.read(speed_units);
+      else if (JSONReader::match(key__, size__, "popup_period")) r__.read(popup_period);
+      else if (JSONReader::match(key__, size__, "popup_duration")) r__.read(popup_duration);
+      else if (JSONReader::match(key__, size__, "flags")) r__.read(flags);
+      else if (JSONReader::match(key__, size__, "custom")) r__.read(custom);
+      else return false;
+      return true;
+    }
+
     VehicleState::VehicleState(void)
     {
       m_header.mgid = 500;
@@ -17809,6 +22077,38 @@ namespace DUNE
       IMC::toJSON(os__, "last_error_time", last_error_time, nindent__);
     }
 
+    void
+    VehicleState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"op_mode\":", op_mode);
+      w__.field(",\"error_count\":", error_count);
+      w__.field(",\"error_ents\":", error_ents);
+      w__.field(",\"maneuver_type\":", maneuver_type);
+      w__.field(",\"maneuver_stime\":", maneuver_stime);
+      w__.field(",\"maneuver_eta\":", maneuver_eta);
+      w__.field(",\"control_loops\":", control_loops);
+      w__.field(",\"flags\":", flags);
+      w__.field(",\"last_error\":", last_error);
+      w__.field(",\"last_error_time\":", last_error_time);
+    }
+
+    bool
+    VehicleState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op_mode")) r__.read(op_mode);
+      else if (JSONReader::match(key__, size__, "error_count")) r__.read(error_count);
+      else if (JSONReader::match(key__, size__, "error_ents")) r__.read(error_ents);
+      else if (JSONReader::match(key__, size__, "maneuver_type")) r__.read(maneuver_type);
+      else if (JSONReader::match(key__, size__, "maneuver_stime")) r__.read(maneuver_stime);
+      else if (JSONReader::match(key__, size__, "maneuver_eta")) r__.read(maneuver_eta);
+      else if (JSONReader::match(key__, size__, "control_loops")) r__.read(control_loops);
+      else if (JSONReader::match(key__, size__, "flags")) r__.read(flags);
+      else if (JSONReader::match(key__, size__, "last_error")) r__.read(last_error);
+      else if (JSONReader::match(key__, size__, "last_error_time")) r__.read(last_error_time);
+      else return false;
+      return true;
+    }
+
     VehicleCommand::VehicleCommand(void)
     {
       m_header.mgid = 501;
@@ -17896,6 +22196,30 @@ namespace DUNE
       IMC::toJSON(os__, "info", info, nindent__);
     }
 
+    void
+    VehicleCommand::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"type\":", type);
+      w__.field(",\"request_id\":", request_id);
+      w__.field(",\"command\":", command);
+      maneuver.toJSON(w__, ",\"maneuver\":");
+      w__.field(",\"calib_time\":", calib_time);
+      w__.field(",\"info\":", info);
+    }
+
+    bool
+    VehicleCommand::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "request_id")) r__.read(request_id);
+      else if (JSONReader::match(key__, size__, "command")) r__.read(command);
+      else if (JSONReader::match(key__, size__, "maneuver")) maneuver.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "calib_time")) r__.read(calib_time);
+      else if (JSONReader::match(key__, size__, "info")) r__.read(info);
+      else return false;
+      return true;
+    }
+
     void
     VehicleCommand::setTimeStampNested(double value__)
     {
@@ -18003,6 +22327,22 @@ namespace DUNE
       IMC::toJSON(os__, "entities", entities, nindent__);
     }
 
+    void
+    MonitorEntityState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"command\":", command);
+      w__.field(",\"entities\":", entities);
+    }
+
+    bool
+    MonitorEntityState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "command")) r__.read(command);
+      else if (JSONReader::match(key__, size__, "entities")) r__.read(entities);
+      else return false;
+      return true;
+    }
+
     EntityMonitoringState::EntityMonitoringState(void)
     {
       m_header.mgid = 503;
@@ -18101,6 +22441,34 @@ namespace DUNE
       IMC::toJSON(os__, "last_error_time", last_error_time, nindent__);
     }
 
+    void
+    EntityMonitoringState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"mcount\":", mcount);
+      w__.field(",\"mnames\":", mnames);
+      w__.field(",\"ecount\":", ecount);
+      w__.field(",\"enames\":", enames);
+      w__.field(",\"ccount\":", ccount);
+      w__.field(",\"cnames\":", cnames);
+      w__.field(",\"last_error\":", last_error);
+      w__.field(",\"last_error_time\":", last_error_time);
+    }
+
+    bool
+    EntityMonitoringState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "mcount")) r__.read(mcount);
+      else if (JSONReader::match(key__, size__, "mnames")) r__.read(mnames);
+      else if (JSONReader::match(key__, size__, "ecount")) r__.read(ecount);
+      else if (JSONReader::match(key__, size__, "enames")) r__.read(enames);
+      else if (JSONReader::match(key__, size__, "ccount")) r__.read(ccount);
+      else if (JSONReader::match(key__, size__, "cnames")) r__.read(cnames);
+      else if (JSONReader::match(key__, size__, "last_error")) r__.read(last_error);
+      else if (JSONReader::match(key__, size__, "last_error_time")) r__.read(last_error_time);
+      else return false;
+      return true;
+    }
+
     OperationalLimits::OperationalLimits(void)
     {
       m_header.mgid = 504;
@@ -18231,6 +22599,42 @@ namespace DUNE
       IMC::toJSON(os__, "length", length, nindent__);
     }
 
+    void
+    OperationalLimits::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"mask\":", mask);
+      w__.field(",\"max_depth\":", max_depth);
+      w__.field(",\"min_altitude\":", min_altitude);
+      w__.field(",\"max_altitude\":", max_altitude);
+      w__.field(",\"min_speed\":", min_speed);
+      w__.field(",\"max_speed\":", max_speed);
+      w__.field(",\"max_vrate\":", max_vrate);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"orientation\":", orientation);
+      w__.field(",\"width\":", width);
+      w__.field(",\"length\":", length);
+    }
+
+    bool
+    OperationalLimits::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "mask")) r__.read(mask);
+      else if (JSONReader::match(key__, size__, "max_depth")) r__.read(max_depth);
+      else if (JSONReader::match(key__, size__, "min_altitude")) r__.read(min_altitude);
+      else if (JSONReader::match(key__, size__, "max_altitude")) r__.read(max_altitude);
+      else if (JSONReader::match(key__, size__, "min_speed")) r__.read(min_speed);
+      else if (JSONReader::match(key__, size__, "max_speed")) r__.read(max_speed);
+      else if (JSONReader::match(key__, size__, "max_vrate")) r__.read(max_vrate);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "orientation")) r__.read(orientation);
+      else if (JSONReader::match(key__, size__, "width")) r__.read(width);
+      else if (JSONReader::match(key__, size__, "length")) r__.read(length);
+      else return false;
+      return true;
+    }
+
     GetOperationalLimits::GetOperationalLimits(void)
     {
       m_header.mgid = 505;
@@ -18326,6 +22730,20 @@ namespace DUNE
       IMC::toJSON(os__, "duration", duration, nindent__);
     }
 
+    void
+    Calibration::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"duration\":", duration);
+    }
+
+    bool
+    Calibration::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "duration")) r__.read(duration);
+      else return false;
+      return true;
+    }
+
     ControlLoops::ControlLoops(void)
     {
       m_header.mgid = 507;
@@ -18394,6 +22812,24 @@ namespace DUNE
       IMC::toJSON(os__, "scope_ref", scope_ref, nindent__);
     }
 
+    void
+    ControlLoops::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"enable\":", enable);
+      w__.field(",\"mask\":", mask);
+      w__.field(",\"scope_ref\":", scope_ref);
+    }
+
+    bool
+    ControlLoops::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "enable")) r__.read(enable);
+      else if (JSONReader::match(key__, size__, "mask")) r__.read(mask);
+      else if (JSONReader::match(key__, size__, "scope_ref")) r__.read(scope_ref);
+      else return false;
+      return true;
+    }
+
     VehicleMedium::VehicleMedium(void)
     {
       m_header.mgid = 508;
@@ -18450,6 +22886,20 @@ namespace DUNE
       IMC::toJSON(os__, "medium", medium, nindent__);
     }
 
+    void
+    VehicleMedium::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"medium\":", medium);
+    }
+
+    bool
+    VehicleMedium::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "medium")) r__.read(medium);
+      else return false;
+      return true;
+    }
+
     Collision::Collision(void)
     {
       m_header.mgid = 509;
@@ -18524,6 +22974,22 @@ namespace DUNE
       IMC::toJSON(os__, "type", type, nindent__);
     }
 
+    void
+    Collision::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+      w__.field(",\"type\":", type);
+    }
+
+    bool
+    Collision::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else return false;
+      return true;
+    }
+
     FormState::FormState(void)
     {
       m_header.mgid = 510;
@@ -18610,6 +23076,30 @@ namespace DUNE
       IMC::toJSON(os__, "convergmon", convergmon, nindent__);
     }
 
+    void
+    FormState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"possimerr\":", possimerr);
+      w__.field(",\"converg\":", converg);
+      w__.field(",\"turbulence\":", turbulence);
+      w__.field(",\"possimmon\":", possimmon);
+      w__.field(",\"commmon\":", commmon);
+      w__.field(",\"convergmon\":", convergmon);
+    }
+
+    bool
+    FormState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "possimerr")) r__.read(possimerr);
+      else if (JSONReader::match(key__, size__, "converg")) r__.read(converg);
+      else if (JSONReader::match(key__, size__, "turbulence")) r__.read(turbulence);
+      else if (JSONReader::match(key__, size__, "possimmon")) r__.read(possimmon);
+      else if (JSONReader::match(key__, size__, "commmon")) r__.read(commmon);
+      else if (JSONReader::match(key__, size__, "convergmon")) r__.read(convergmon);
+      else return false;
+      return true;
+    }
+
     AutopilotMode::AutopilotMode(void)
     {
       m_header.mgid = 511;
@@ -18672,6 +23162,22 @@ namespace DUNE
       IMC::toJSON(os__, "mode", mode, nindent__);
     }
 
+    void
+    AutopilotMode::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"autonomy\":", autonomy);
+      w__.field(",\"mode\":", mode);
+    }
+
+    bool
+    AutopilotMode::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "autonomy")) r__.read(autonomy);
+      else if (JSONReader::match(key__, size__, "mode")) r__.read(mode);
+      else return false;
+      return true;
+    }
+
     FormationState::FormationState(void)
     {
       m_header.mgid = 512;
@@ -18770,6 +23276,34 @@ namespace DUNE
       IMC::toJSON(os__, "convergmon", convergmon, nindent__);
     }
 
+    void
+    FormationState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"type\":", type);
+      w__.field(",\"op\":", op);
+      w__.field(",\"possimerr\":", possimerr);
+      w__.field(",\"converg\":", converg);
+      w__.field(",\"turbulence\":", turbulence);
+      w__.field(",\"possimmon\":", possimmon);
+      w__.field(",\"commmon\":", commmon);
+      w__.field(",\"convergmon\":", convergmon);
+    }
+
+    bool
+    FormationState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "possimerr")) r__.read(possimerr);
+      else if (JSONReader::match(key__, size__, "converg")) r__.read(converg);
+      else if (JSONReader::match(key__, size__, "turbulence")) r__.read(turbulence);
+      else if (JSONReader::match(key__, size__, "possimmon")) r__.read(possimmon);
+      else if (JSONReader::match(key__, size__, "commmon")) r__.read(commmon);
+      else if (JSONReader::match(key__, size__, "convergmon")) r__.read(convergmon);
+      else return false;
+      return true;
+    }
+
     ReportControl::ReportControl(void)
     {
       m_header.mgid = 513;
@@ -18844,6 +23378,26 @@ namespace DUNE
       IMC::toJSON(os__, "sys_dst", sys_dst, nindent__);
     }
 
+    void
+    ReportControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"op\":", op);
+      w__.field(",\"comm_interface\":", comm_interface);
+      w__.field(",\"period\":", period);
+      w__.field(",\"sys_dst\":", sys_dst);
+    }
+
+    bool
+    ReportControl::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "comm_interface")) r__.read(comm_interface);
+      else if (JSONReader::match(key__, size__, "period")) r__.read(period);
+      else if (JSONReader::match(key__, size__, "sys_dst")) r__.read(sys_dst);
+      else return false;
+      return true;
+    }
+
     StateReport::StateReport(void)
     {
       m_header.mgid = 514;
@@ -18954,6 +23508,38 @@ namespace DUNE
       IMC::toJSON(os__, "plan_checksum", plan_checksum, nindent__);
     }
 
+    void
+    StateReport::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"stime\":", stime);
+      w__.field(",\"latitude\":", latitude);
+      w__.field(",\"longitude\":", longitude);
+      w__.field(",\"altitude\":", altitude);
+      w__.field(",\"depth\":", depth);
+      w__.field(",\"heading\":", heading);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"fuel\":", fuel);
+      w__.field(",\"exec_state\":", exec_state);
+      w__.field(",\"plan_checksum\":", plan_checksum);
+    }
+
+    bool
+    StateReport::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "stime")) r__.read(stime);
+      else if (JSONReader::match(key__, size__, "latitude")) r__.read(latitude);
+      else if (JSONReader::match(key__, size__, "longitude")) r__.read(longitude);
+      else if (JSONReader::match(key__, size__, "altitude")) r__.read(altitude);
+      else if (JSONReader::match(key__, size__, "depth")) r__.read(depth);
+      else if (JSONReader::match(key__, size__, "heading")) r__.read(heading);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "fuel")) r__.read(fuel);
+      else if (JSONReader::match(key__, size__, "exec_state")) r__.read(exec_state);
+      else if (JSONReader::match(key__, size__, "plan_checksum")) r__.read(plan_checksum);
+      else return false;
+      return true;
+    }
+
     TransmissionRequest::TransmissionRequest(void)
     {
       m_header.mgid = 515;
@@ -19053,6 +23639,34 @@ namespace DUNE
       IMC::toJSON(os__, "raw_data", raw_data, nindent__);
     }
 
+    void
+    TransmissionRequest::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"req_id\":", req_id);
+      w__.field(",\"comm_mean\":", comm_mean);
+      w__.field(",\"destination\":", destination);
+      w__.field(",\"deadline\":", deadline);
+      w__.field(",\"data_mode\":", data_mode);
+      msg_data.toJSON(w__, ",\"msg_data\":");
+      w__.field(",\"txt_data\":", txt_data);
+      w__.field(",\"raw_data\":", raw_data);
+    }
+
+    bool
+    TransmissionRequest::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "req_id")) r__.read(req_id);
+      else if (JSONReader::match(key__, size__, "comm_mean")) r__.read(comm_mean);
+      else if (JSONReader::match(key__, size__, "destination")) r__.read(destination);
+      else if (JSONReader::match(key__, size__, "deadline")) r__.read(deadline);
+      else if (JSONReader::match(key__, size__, "data_mode")) r__.read(data_mode);
+      else if (JSONReader::match(key__, size__, "msg_data")) msg_data.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "txt_data")) r__.read(txt_data);
+      else if (JSONReader::match(key__, size__, "raw_data")) r__.read(raw_data);
+      else return false;
+      return true;
+    }
+
     void
     TransmissionRequest::setTimeStampNested(double value__)
     {
@@ -19166,6 +23780,24 @@ namespace DUNE
       IMC::toJSON(os__, "info", info, nindent__);
     }
 
+    void
+    TransmissionStatus::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"req_id\":", req_id);
+      w__.field(",\"status\":", status);
+      w__.field(",\"info\":", info);
+    }
+
+    bool
+    TransmissionStatus::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "req_id")) r__.read(req_id);
+      else if (JSONReader::match(key__, size__, "status")) r__.read(status);
+      else if (JSONReader::match(key__, size__, "info")) r__.read(info);
+      else return false;
+      return true;
+    }
+
     SmsRequest::SmsRequest(void)
     {
       m_header.mgid = 517;
@@ -19240,6 +23872,26 @@ namespace DUNE
       IMC::toJSON(os__, "sms_text", sms_text, nindent__);
     }
 
+    void
+    SmsRequest::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"req_id\":", req_id);
+      w__.field(",\"destination\":", destination);
+      w__.field(",\"timeout\":", timeout);
+      w__.field(",\"sms_text\":", sms_text);
+    }
+
+    bool
+    SmsRequest::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "req_id")) r__.read(req_id);
+      else if (JSONReader::match(key__, size__, "destination")) r__.read(destination);
+      else if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else if (JSONReader::match(key__, size__, "sms_text")) r__.read(sms_text);
+      else return false;
+      return true;
+    }
+
     SmsStatus::SmsStatus(void)
     {
       m_header.mgid = 518;
@@ -19308,6 +23960,24 @@ namespace DUNE
       IMC::toJSON(os__, "info", info, nindent__);
     }
 
+    void
+    SmsStatus::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"req_id\":", req_id);
+      w__.field(",\"status\":", status);
+      w__.field(",\"info\":", info);
+    }
+
+    bool
+    SmsStatus::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "req_id")) r__.read(req_id);
+      else if (JSONReader::match(key__, size__, "status")) r__.read(status);
+      else if (JSONReader::match(key__, size__, "info")) r__.read(info);
+      else return false;
+      return true;
+    }
+
     VtolState::VtolState(void)
     {
       m_header.mgid = 519;
@@ -19364,6 +24034,20 @@ namespace DUNE
       IMC::toJSON(os__, "state", state, nindent__);
     }
 
+    void
+    VtolState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"state\":", state);
+    }
+
+    bool
+    VtolState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "state")) r__.read(state);
+      else return false;
+      return true;
+    }
+
     ArmingState::ArmingState(void)
     {
       m_header.mgid = 520;
@@ -19420,6 +24104,20 @@ namespace DUNE
       IMC::toJSON(os__, "state", state, nindent__);
     }
 
+    void
+    ArmingState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"state\":", state);
+    }
+
+    bool
+    ArmingState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "state")) r__.read(state);
+      else return false;
+      return true;
+    }
+
     Abort::Abort(void)
     {
       m_header.mgid = 550;
@@ -19533,6 +24231,26 @@ namespace DUNE
       IMC::toJSON(os__, "access", access, nindent__);
     }
 
+    void
+    PlanVariable::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"name\":", name);
+      w__.field(",\"value\":", value);
+      w__.field(",\"type\":", type);
+      w__.field(",\"access\":", access);
+    }
+
+    bool
+    PlanVariable::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "name")) r__.read(name);
+      else if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "access")) r__.read(access);
+      else return false;
+      return true;
+    }
+
     PlanManeuver::PlanManeuver(void)
     {
       m_header.mgid = 552;
@@ -19610,6 +24328,26 @@ namespace DUNE
       end_actions.toJSON(os__, "end_actions", nindent__);
     }
 
+    void
+    PlanManeuver::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"maneuver_id\":", maneuver_id);
+      data.toJSON(w__, ",\"data\":");
+      start_actions.toJSON(w__, ",\"start_actions\":");
+      end_actions.toJSON(w__, ",\"end_actions\":");
+    }
+
+    bool
+    PlanManeuver::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "maneuver_id")) r__.read(maneuver_id);
+      else if (JSONReader::match(key__, size__, "data")) data.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "start_actions")) start_actions.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "end_actions")) end_actions.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     PlanManeuver::setTimeStampNested(double value__)
     {
@@ -19750,6 +24488,26 @@ namespace DUNE
       actions.toJSON(os__, "actions", nindent__);
     }
 
+    void
+    PlanTransition::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"source_man\":", source_man);
+      w__.field(",\"dest_man\":", dest_man);
+      w__.field(",\"conditions\":", conditions);
+      actions.toJSON(w__, ",\"actions\":");
+    }
+
+    bool
+    PlanTransition::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "source_man")) r__.read(source_man);
+      else if (JSONReader::match(key__, size__, "dest_man")) r__.read(dest_man);
+      else if (JSONReader::match(key__, size__, "conditions")) r__.read(conditions);
+      else if (JSONReader::match(key__, size__, "actions")) actions.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     PlanTransition::setTimeStampNested(double value__)
     {
@@ -19889,6 +24647,36 @@ namespace DUNE
       end_actions.toJSON(os__, "end_actions", nindent__);
     }
 
+    void
+    PlanSpecification::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"plan_id\":", plan_id);
+      w__.field(",\"description\":", description);
+      w__.field(",\"vnamespace\":", vnamespace);
+      variables.toJSON(w__, ",\"variables\":");
+      w__.field(",\"start_man_id\":", start_man_id);
+      maneuvers.toJSON(w__, ",\"maneuvers\":");
+      transitions.toJSON(w__, ",\"transitions\":");
+      start_actions.toJSON(w__, ",\"start_actions\":");
+      end_actions.toJSON(w__, ",\"end_actions\":");
+    }
+
+    bool
+    PlanSpecification::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "plan_id")) r__.read(plan_id);
+      else if (JSONReader::match(key__, size__, "description")) r__.read(description);
+      else if (JSONReader::match(key__, size__, "vnamespace")) r__.read(vnamespace);
+      else if (JSONReader::match(key__, size__, "variables")) variables.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "start_man_id")) r__.read(start_man_id);
+      else if (JSONReader::match(key__, size__, "maneuvers")) maneuvers.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "transitions")) transitions.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "start_actions")) start_actions.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "end_actions")) end_actions.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     PlanSpecification::setTimeStampNested(double value__)
     {
@@ -20022,6 +24810,22 @@ namespace DUNE
       plan.toJSON(os__, "plan", nindent__);
     }
 
+    void
+    EmergencyControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"command\":", command);
+      plan.toJSON(w__, ",\"plan\":");
+    }
+
+    bool
+    EmergencyControl::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "command")) r__.read(command);
+      else if (JSONReader::match(key__, size__, "plan")) plan.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     EmergencyControl::setTimeStampNested(double value__)
     {
@@ -20136,6 +24940,24 @@ namespace DUNE
       IMC::toJSON(os__, "comm_level", comm_level, nindent__);
     }
 
+    void
+    EmergencyControlState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"state\":", state);
+      w__.field(",\"plan_id\":", plan_id);
+      w__.field(",\"comm_level\":", comm_level);
+    }
+
+    bool
+    EmergencyControlState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "state")) r__.read(state);
+      else if (JSONReader::match(key__, size__, "plan_id")) r__.read(plan_id);
+      else if (JSONReader::match(key__, size__, "comm_level")) r__.read(comm_level);
+      else return false;
+      return true;
+    }
+
     PlanDB::PlanDB(void)
     {
       m_header.mgid = 556;
@@ -20223,6 +25045,30 @@ namespace DUNE
       IMC::toJSON(os__, "info", info, nindent__);
     }
 
+    void
+    PlanDB::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"type\":", type);
+      w__.field(",\"op\":", op);
+      w__.field(",\"request_id\":", request_id);
+      w__.field(",\"plan_id\":", plan_id);
+      arg.toJSON(w__, ",\"arg\":");
+      w__.field(",\"info\":", info);
+    }
+
+    bool
+    PlanDB::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "request_id")) r__.read(request_id);
+      else if (JSONReader::match(key__, size__, "plan_id")) r__.read(plan_id);
+      else if (JSONReader::match(key__, size__, "arg")) arg.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "info")) r__.read(info);
+      else return false;
+      return true;
+    }
+
     void
     PlanDB::setTimeStampNested(double value__)
     {
@@ -20354,6 +25200,30 @@ namespace DUNE
       IMC::toJSON(os__, "md5", md5, nindent__);
     }
 
+    void
+    PlanDBInformation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"plan_id\":", plan_id);
+      w__.field(",\"plan_size\":", plan_size);
+      w__.field(",\"change_time\":", change_time);
+      w__.field(",\"change_sid\":", change_sid);
+      w__.field(",\"change_sname\":", change_sname);
+      w__.field(",\"md5\":", md5);
+    }
+
+    bool
+    PlanDBInformation::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "plan_id")) r__.read(plan_id);
+      else if (JSONReader::match(key__, size__, "plan_size")) r__.read(plan_size);
+      else if (JSONReader::match(key__, size__, "change_time")) r__.read(change_time);
+      else if (JSONReader::match(key__, size__, "change_sid")) r__.read(change_sid);
+      else if (JSONReader::match(key__, size__, "change_sname")) r__.read(change_sname);
+      else if (JSONReader::match(key__, size__, "md5")) r__.read(md5);
+      else return false;
+      return true;
+    }
+
     PlanDBState::PlanDBState(void)
     {
       m_header.mgid = 557;
@@ -20447,6 +25317,32 @@ namespace DUNE
       plans_info.toJSON(os__, "plans_info", nindent__);
     }
 
+    void
+    PlanDBState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"plan_count\":", plan_count);
+      w__.field(",\"plan_size\":", plan_size);
+      w__.field(",\"change_time\":", change_time);
+      w__.field(",\"change_sid\":", change_sid);
+      w__.field(",\"change_sname\":", change_sname);
+      w__.field(",\"md5\":", md5);
+      plans_info.toJSON(w__, ",\"plans_info\":");
+    }
+
+    bool
+    PlanDBState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "plan_count")) r__.read(plan_count);
+      else if (JSONReader::match(key__, size__, "plan_size")) r__.read(plan_size);
+      else if (JSONReader::match(key__, size__, "change_time")) r__.read(change_time);
+      else if (JSONReader::match(key__, size__, "change_sid")) r__.read(change_sid);
+      else if (JSONReader::match(key__, size__, "change_sname")) r__.read(change_sname);
+      else if (JSONReader::match(key__, size__, "md5")) r__.read(md5);
+      else if (JSONReader::match(key__, size__, "plans_info")) plans_info.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     PlanDBState::setTimeStampNested(double value__)
     {
@@ -20570,6 +25466,32 @@ namespace DUNE
       IMC::toJSON(os__, "info", info, nindent__);
     }
 
+    void
+    PlanControl::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"type\":", type);
+      w__.field(",\"op\":", op);
+      w__.field(",\"request_id\":", request_id);
+      w__.field(",\"plan_id\":", plan_id);
+      w__.field(",\"flags\":", flags);
+      arg.toJSON(w__, ",\"arg\":");
+      w__.field(",\"info\":", info);
+    }
+
+    bool
+    PlanControl::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "request_id")) r__.read(request_id);
+      else if (JSONReader::match(key__, size__, "plan_id")) r__.read(plan_id);
+      else if (JSONReader::match(key__, size__, "flags")) r__.read(flags);
+      else if (JSONReader::match(key__, size__, "arg")) arg.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "info")) r__.read(info);
+      else return false;
+      return true;
+    }
+
     void
     PlanControl::setTimeStampNested(double value__)
     {
@@ -20713,6 +25635,34 @@ namespace DUNE
       IMC::toJSON(os__, "last_outcome", last_outcome, nindent__);
     }
 
+    void
+    PlanControlState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"state\":", state);
+      w__.field(",\"plan_id\":", plan_id);
+      w__.field(",\"plan_eta\":", plan_eta);
+      w__.field(",\"plan_progress\":", plan_progress);
+      w__.field(",\"man_id\":", man_id);
+      w__.field(",\"man_type\":", man_type);
+      w__.field(",\"man_eta\":", man_eta);
+      w__.field(",\"last_outcome\":", last_outcome);
+    }
+
+    bool
+    PlanControlState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "state")) r__.read(state);
+      else if (JSONReader::match(key__, size__, "plan_id")) r__.read(plan_id);
+      else if (JSONReader::match(key__, size__, "plan_eta")) r__.read(plan_eta);
+      else if (JSONReader::match(key__, size__, "plan_progress")) r__.read(plan_progress);
+      else if (JSONReader::match(key__, size__, "man_id")) r__.read(man_id);
+      else if (JSONReader::match(key__, size__, "man_type")) r__.read(man_type);
+      else if (JSONReader::match(key__, size__, "man_eta")) r__.read(man_eta);
+      else if (JSONReader::match(key__, size__, "last_outcome")) r__.read(last_outcome);
+      else return false;
+      return true;
+    }
+
     PlanGeneration::PlanGeneration(void)
     {
       m_header.mgid = 562;
@@ -20787,6 +25737,26 @@ namespace DUNE
       IMC::toJSON(os__, "params", params, nindent__);
     }
 
+    void
+    PlanGeneration::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"cmd\":", cmd);
+      w__.field(",\"op\":", op);
+      w__.field(",\"plan_id\":", plan_id);
+      w__.field(",\"params\":", params);
+    }
+
+    bool
+    PlanGeneration::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "cmd")) r__.read(cmd);
+      else if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "plan_id")) r__.read(plan_id);
+      else if (JSONReader::match(key__, size__, "params")) r__.read(params);
+      else return false;
+      return true;
+    }
+
     LeaderState::LeaderState(void)
     {
       m_header.mgid = 563;
@@ -20965,6 +25935,58 @@ namespace DUNE
       IMC::toJSON(os__, "svz", svz, nindent__);
     }
 
+    void
+    LeaderState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"group_name\":", group_name);
+      w__.field(",\"op\":", op);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"height\":", height);
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+      w__.field(",\"phi\":", phi);
+      w__.field(",\"theta\":", theta);
+      w__.field(",\"psi\":", psi);
+      w__.field(",\"vx\":", vx);
+      w__.field(",\"vy\":", vy);
+      w__.field(",\"vz\":", vz);
+      w__.field(",\"p\":", p);
+      w__.field(",\"q\":", q);
+      w__.field(",\"r\":", r);
+      w__.field(",\"svx\":", svx);
+      w__.field(",\"svy\":", svy);
+      w__.field(",\"svz\":", svz);
+    }
+
+    bool
+    LeaderState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "group_name")) r__.read(group_name);
+      else if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "height")) r__.read(height);
+      else if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "phi")) r__.read(phi);
+      else if (JSONReader::match(key__, size__, "theta")) r__.read(theta);
+      else if (JSONReader::match(key__, size__, "psi")) r__.read(psi);
+      else if (JSONReader::match(key__, size__, "vx")) r__.read(vx);
+      else if (JSONReader::match(key__, size__, "vy")) r__.read(vy);
+      else if (JSONReader::match(key__, size__, "vz")) r__.read(vz);
+      else if (JSONReader::match(key__, size__, "p")) r__.read(p);
+      else if (JSONReader::match(key__, size__, "q")) r__.read(q);
+      else if (JSONReader::match(key__, size__, "r")) r__.read(r);
+      else if (JSONReader::match(key__, size__, "svx")) r__.read(svx);
+      else if (JSONReader::match(key__, size__, "svy")) r__.read(svy);
+      else if (JSONReader::match(key__, size__, "svz")) r__.read(svz);
+      else return false;
+      return true;
+    }
+
     PlanStatistics::PlanStatistics(void)
     {
       m_header.mgid = 564;
@@ -21057,6 +26079,32 @@ namespace DUNE
       IMC::toJSON(os__, "fuel", fuel, nindent__);
     }
 
+    void
+    PlanStatistics::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"plan_id\":", plan_id);
+      w__.field(",\"type\":", type);
+      w__.field(",\"properties\":", properties);
+      w__.field(",\"durations\":", durations);
+      w__.field(",\"distances\":", distances);
+      w__.field(",\"actions\":", actions);
+      w__.field(",\"fuel\":", fuel);
+    }
+
+    bool
+    PlanStatistics::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "plan_id")) r__.read(plan_id);
+      else if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "properties")) r__.read(properties);
+      else if (JSONReader::match(key__, size__, "durations")) r__.read(durations);
+      else if (JSONReader::match(key__, size__, "distances")) r__.read(distances);
+      else if (JSONReader::match(key__, size__, "actions")) r__.read(actions);
+      else if (JSONReader::match(key__, size__, "fuel")) r__.read(fuel);
+      else return false;
+      return true;
+    }
+
     ReportedState::ReportedState(void)
     {
       m_header.mgid = 600;
@@ -21161,6 +26209,36 @@ namespace DUNE
       IMC::toJSON(os__, "s_type", s_type, nindent__);
     }
 
+    void
+    ReportedState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"depth\":", depth);
+      w__.field(",\"roll\":", roll);
+      w__.field(",\"pitch\":", pitch);
+      w__.field(",\"yaw\":", yaw);
+      w__.field(",\"rcp_time\":", rcp_time);
+      w__.field(",\"sid\":", sid);
+      w__.field(",\"s_type\":", s_type);
+    }
+
+    bool
+    ReportedState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "depth")) r__.read(depth);
+      else if (JSONReader::match(key__, size__, "roll")) r__.read(roll);
+      else if (JSONReader::match(key__, size__, "pitch")) r__.read(pitch);
+      else if (JSONReader::match(key__, size__, "yaw")) r__.read(yaw);
+      else if (JSONReader::match(key__, size__, "rcp_time")) r__.read(rcp_time);
+      else if (JSONReader::match(key__, size__, "sid")) r__.read(sid);
+      else if (JSONReader::match(key__, size__, "s_type")) r__.read(s_type);
+      else return false;
+      return true;
+    }
+
     RemoteSensorInfo::RemoteSensorInfo(void)
     {
       m_header.mgid = 601;
@@ -21253,6 +26331,32 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    RemoteSensorInfo::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"id\":", id);
+      w__.field(",\"sensor_class\":", sensor_class);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"alt\":", alt);
+      w__.field(",\"heading\":", heading);
+      w__.field(",\"data\":", data);
+    }
+
+    bool
+    RemoteSensorInfo::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "id")) r__.read(id);
+      else if (JSONReader::match(key__, size__, "sensor_class")) r__.read(sensor_class);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "alt")) r__.read(alt);
+      else if (JSONReader::match(key__, size__, "heading")) r__.read(heading);
+      else if (JSONReader::match(key__, size__, "data")) r__.read(data);
+      else return false;
+      return true;
+    }
+
     MapPoint::MapPoint(void)
     {
       m_header.mgid = 604;
@@ -21321,6 +26425,24 @@ namespace DUNE
       IMC::toJSON(os__, "alt", alt, nindent__);
     }
 
+    void
+    MapPoint::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"alt\":", alt);
+    }
+
+    bool
+    MapPoint::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "alt")) r__.read(alt);
+      else return false;
+      return true;
+    }
+
     MapFeature::MapFeature(void)
     {
       m_header.mgid = 603;
@@ -21408,6 +26530,30 @@ namespace DUNE
       feature.toJSON(os__, "feature", nindent__);
     }
 
+    void
+    MapFeature::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"id\":", id);
+      w__.field(",\"feature_type\":", feature_type);
+      w__.field(",\"rgb_red\":", rgb_red);
+      w__.field(",\"rgb_green\":", rgb_green);
+      w__.field(",\"rgb_blue\":", rgb_blue);
+      feature.toJSON(w__, ",\"feature\":");
+    }
+
+    bool
+    MapFeature::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "id")) r__.read(id);
+      else if (JSONReader::match(key__, size__, "feature_type")) r__.read(feature_type);
+      else if (JSONReader::match(key__, size__, "rgb_red")) r__.read(rgb_red);
+      else if (JSONReader::match(key__, size__, "rgb_green")) r__.read(rgb_green);
+      else if (JSONReader::match(key__, size__, "rgb_blue")) r__.read(rgb_blue);
+      else if (JSONReader::match(key__, size__, "feature")) feature.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     MapFeature::setTimeStampNested(double value__)
     {
@@ -21501,6 +26647,22 @@ namespace DUNE
       features.toJSON(os__, "features", nindent__);
     }
 
+    void
+    Map::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"id\":", id);
+      features.toJSON(w__, ",\"features\":");
+    }
+
+    bool
+    Map::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "id")) r__.read(id);
+      else if (JSONReader::match(key__, size__, "features")) features.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     Map::setTimeStampNested(double value__)
     {
@@ -21595,9 +26757,27 @@ namespace DUNE
     void
     CcuEvent::fieldsToJSON(std::ostream& os__, unsigned nindent__) const
     {
-      IMC::toJSON(os__, "type", type, nindent__);
-      IMC::toJSON(os__, "id", id, nindent__);
-      arg.toJSON(os__, "arg", nindent__);
+      IMC::toJSON(os__, "type", type, nindent__);
+      IMC::toJSON(os__, "id", id, nindent__);
+      arg.toJSON(os__, "arg", nindent__);
+    }
+
+    void
+    CcuEvent::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"type\":", type);
+      w__.field(",\"id\":", id);
+      arg.toJSON(w__, ",\"arg\":");
+    }
+
+    bool
+    CcuEvent::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "id")) r__.read(id);
+      else if (JSONReader::match(key__, size__, "arg")) arg.fromJSON(r__);
+      else return false;
+      return true;
     }
 
     void
@@ -21708,6 +26888,22 @@ namespace DUNE
       links.toJSON(os__, "links", nindent__);
     }
 
+    void
+    VehicleLinks::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"localname\":", localname);
+      links.toJSON(w__, ",\"links\":");
+    }
+
+    bool
+    VehicleLinks::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "localname")) r__.read(localname);
+      else if (JSONReader::match(key__, size__, "links")) links.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     VehicleLinks::setTimeStampNested(double value__)
     {
@@ -21806,6 +27002,24 @@ namespace DUNE
       IMC::toJSON(os__, "attributes", attributes, nindent__);
     }
 
+    void
+    TrexObservation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"timeline\":", timeline);
+      w__.field(",\"predicate\":", predicate);
+      w__.field(",\"attributes\":", attributes);
+    }
+
+    bool
+    TrexObservation::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "timeline")) r__.read(timeline);
+      else if (JSONReader::match(key__, size__, "predicate")) r__.read(predicate);
+      else if (JSONReader::match(key__, size__, "attributes")) r__.read(attributes);
+      else return false;
+      return true;
+    }
+
     TrexCommand::TrexCommand(void)
     {
       m_header.mgid = 652;
@@ -21874,6 +27088,24 @@ namespace DUNE
       IMC::toJSON(os__, "goal_xml", goal_xml, nindent__);
     }
 
+    void
+    TrexCommand::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"command\":", command);
+      w__.field(",\"goal_id\":", goal_id);
+      w__.field(",\"goal_xml\":", goal_xml);
+    }
+
+    bool
+    TrexCommand::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "command")) r__.read(command);
+      else if (JSONReader::match(key__, size__, "goal_id")) r__.read(goal_id);
+      else if (JSONReader::match(key__, size__, "goal_xml")) r__.read(goal_xml);
+      else return false;
+      return true;
+    }
+
     TrexAttribute::TrexAttribute(void)
     {
       m_header.mgid = 656;
@@ -21948,6 +27180,26 @@ namespace DUNE
       IMC::toJSON(os__, "max", max, nindent__);
     }
 
+    void
+    TrexAttribute::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"name\":", name);
+      w__.field(",\"attr_type\":", attr_type);
+      w__.field(",\"min\":", min);
+      w__.field(",\"max\":", max);
+    }
+
+    bool
+    TrexAttribute::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "name")) r__.read(name);
+      else if (JSONReader::match(key__, size__, "attr_type")) r__.read(attr_type);
+      else if (JSONReader::match(key__, size__, "min")) r__.read(min);
+      else if (JSONReader::match(key__, size__, "max")) r__.read(max);
+      else return false;
+      return true;
+    }
+
     TrexToken::TrexToken(void)
     {
       m_header.mgid = 657;
@@ -22017,6 +27269,24 @@ namespace DUNE
       attributes.toJSON(os__, "attributes", nindent__);
     }
 
+    void
+    TrexToken::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"timeline\":", timeline);
+      w__.field(",\"predicate\":", predicate);
+      attributes.toJSON(w__, ",\"attributes\":");
+    }
+
+    bool
+    TrexToken::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "timeline")) r__.read(timeline);
+      else if (JSONReader::match(key__, size__, "predicate")) r__.read(predicate);
+      else if (JSONReader::match(key__, size__, "attributes")) attributes.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     TrexToken::setTimeStampNested(double value__)
     {
@@ -22116,6 +27386,24 @@ namespace DUNE
       token.toJSON(os__, "token", nindent__);
     }
 
+    void
+    TrexOperation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"op\":", op);
+      w__.field(",\"goal_id\":", goal_id);
+      token.toJSON(w__, ",\"token\":");
+    }
+
+    bool
+    TrexOperation::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "goal_id")) r__.read(goal_id);
+      else if (JSONReader::match(key__, size__, "token")) token.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     TrexOperation::setTimeStampNested(double value__)
     {
@@ -22224,6 +27512,22 @@ namespace DUNE
       tokens.toJSON(os__, "tokens", nindent__);
     }
 
+    void
+    TrexPlan::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"reactor\":", reactor);
+      tokens.toJSON(w__, ",\"tokens\":");
+    }
+
+    bool
+    TrexPlan::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "reactor")) r__.read(reactor);
+      else if (JSONReader::match(key__, size__, "tokens")) tokens.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     TrexPlan::setTimeStampNested(double value__)
     {
@@ -22316,6 +27620,22 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    Event::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"topic\":", topic);
+      w__.field(",\"data\":", data);
+    }
+
+    bool
+    Event::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "topic")) r__.read(topic);
+      else if (JSONReader::match(key__, size__, "data")) r__.read(data);
+      else return false;
+      return true;
+    }
+
     CompressedImage::CompressedImage(void)
     {
       m_header.mgid = 702;
@@ -22378,6 +27698,22 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    CompressedImage::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"frameid\":", frameid);
+      w__.field(",\"data\":", data);
+    }
+
+    bool
+    CompressedImage::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "frameid")) r__.read(frameid);
+      else if (JSONReader::match(key__, size__, "data")) r__.read(data);
+      else return false;
+      return true;
+    }
+
     ImageTxSettings::ImageTxSettings(void)
     {
       m_header.mgid = 703;
@@ -22452,6 +27788,26 @@ namespace DUNE
       IMC::toJSON(os__, "tsize", tsize, nindent__);
     }
 
+    void
+    ImageTxSettings::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"fps\":", fps);
+      w__.field(",\"quality\":", quality);
+      w__.field(",\"reps\":", reps);
+      w__.field(",\"tsize\":", tsize);
+    }
+
+    bool
+    ImageTxSettings::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "fps")) r__.read(fps);
+      else if (JSONReader::match(key__, size__, "quality")) r__.read(quality);
+      else if (JSONReader::match(key__, size__, "reps")) r__.read(reps);
+      else if (JSONReader::match(key__, size__, "tsize")) r__.read(tsize);
+      else return false;
+      return true;
+    }
+
     RemoteState::RemoteState(void)
     {
       m_header.mgid = 750;
@@ -22534,6 +27890,28 @@ namespace DUNE
       IMC::toJSON(os__, "psi", psi, nindent__);
     }
 
+    void
+    RemoteState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"depth\":", depth);
+      w__.field(",\"speed\":", speed);
+      w__.field(",\"psi\":", psi);
+    }
+
+    bool
+    RemoteState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "depth")) r__.read(depth);
+      else if (JSONReader::match(key__, size__, "speed")) r__.read(speed);
+      else if (JSONReader::match(key__, size__, "psi")) r__.read(psi);
+      else return false;
+      return true;
+    }
+
     Target::Target(void)
     {
       m_header.mgid = 800;
@@ -22628,6 +28006,32 @@ namespace DUNE
       IMC::toJSON(os__, "sog", sog, nindent__);
     }
 
+    void
+    Target::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"label\":", label);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"cog\":", cog);
+      w__.field(",\"sog\":", sog);
+    }
+
+    bool
+    Target::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "label")) r__.read(label);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "cog")) r__.read(cog);
+      else if (JSONReader::match(key__, size__, "sog")) r__.read(sog);
+      else return false;
+      return true;
+    }
+
     EntityParameter::EntityParameter(void)
     {
       m_header.mgid = 801;
@@ -22690,6 +28094,22 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    EntityParameter::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"name\":", name);
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    EntityParameter::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "name")) r__.read(name);
+      else if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     EntityParameters::EntityParameters(void)
     {
       m_header.mgid = 802;
@@ -22753,6 +28173,22 @@ namespace DUNE
       params.toJSON(os__, "params", nindent__);
     }
 
+    void
+    EntityParameters::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"name\":", name);
+      params.toJSON(w__, ",\"params\":");
+    }
+
+    bool
+    EntityParameters::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "name")) r__.read(name);
+      else if (JSONReader::match(key__, size__, "params")) params.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     EntityParameters::setTimeStampNested(double value__)
     {
@@ -22851,6 +28287,24 @@ namespace DUNE
       IMC::toJSON(os__, "scope", scope, nindent__);
     }
 
+    void
+    QueryEntityParameters::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"name\":", name);
+      w__.field(",\"visibility\":", visibility);
+      w__.field(",\"scope\":", scope);
+    }
+
+    bool
+    QueryEntityParameters::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "name")) r__.read(name);
+      else if (JSONReader::match(key__, size__, "visibility")) r__.read(visibility);
+      else if (JSONReader::match(key__, size__, "scope")) r__.read(scope);
+      else return false;
+      return true;
+    }
+
     SetEntityParameters::SetEntityParameters(void)
     {
       m_header.mgid = 804;
@@ -22914,6 +28368,22 @@ namespace DUNE
       params.toJSON(os__, "params", nindent__);
     }
 
+    void
+    SetEntityParameters::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"name\":", name);
+      params.toJSON(w__, ",\"params\":");
+    }
+
+    bool
+    SetEntityParameters::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "name")) r__.read(name);
+      else if (JSONReader::match(key__, size__, "params")) params.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     SetEntityParameters::setTimeStampNested(double value__)
     {
@@ -23000,6 +28470,20 @@ namespace DUNE
       IMC::toJSON(os__, "name", name, nindent__);
     }
 
+    void
+    SaveEntityParameters::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"name\":", name);
+    }
+
+    bool
+    SaveEntityParameters::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "name")) r__.read(name);
+      else return false;
+      return true;
+    }
+
     CreateSession::CreateSession(void)
     {
       m_header.mgid = 806;
@@ -23056,6 +28540,20 @@ namespace DUNE
       IMC::toJSON(os__, "timeout", timeout, nindent__);
     }
 
+    void
+    CreateSession::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"timeout\":", timeout);
+    }
+
+    bool
+    CreateSession::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "timeout")) r__.read(timeout);
+      else return false;
+      return true;
+    }
+
     CloseSession::CloseSession(void)
     {
       m_header.mgid = 807;
@@ -23112,6 +28610,20 @@ namespace DUNE
       IMC::toJSON(os__, "sessid", sessid, nindent__);
     }
 
+    void
+    CloseSession::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"sessid\":", sessid);
+    }
+
+    bool
+    CloseSession::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "sessid")) r__.read(sessid);
+      else return false;
+      return true;
+    }
+
     SessionSubscription::SessionSubscription(void)
     {
       m_header.mgid = 808;
@@ -23174,6 +28686,22 @@ namespace DUNE
       IMC::toJSON(os__, "messages", messages, nindent__);
     }
 
+    void
+    SessionSubscription::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"sessid\":", sessid);
+      w__.field(",\"messages\":", messages);
+    }
+
+    bool
+    SessionSubscription::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "sessid")) r__.read(sessid);
+      else if (JSONReader::match(key__, size__, "messages")) r__.read(messages);
+      else return false;
+      return true;
+    }
+
     SessionKeepAlive::SessionKeepAlive(void)
     {
       m_header.mgid = 809;
@@ -23230,6 +28758,20 @@ namespace DUNE
       IMC::toJSON(os__, "sessid", sessid, nindent__);
     }
 
+    void
+    SessionKeepAlive::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"sessid\":", sessid);
+    }
+
+    bool
+    SessionKeepAlive::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "sessid")) r__.read(sessid);
+      else return false;
+      return true;
+    }
+
     SessionStatus::SessionStatus(void)
     {
       m_header.mgid = 810;
@@ -23292,6 +28834,22 @@ namespace DUNE
       IMC::toJSON(os__, "status", status, nindent__);
     }
 
+    void
+    SessionStatus::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"sessid\":", sessid);
+      w__.field(",\"status\":", status);
+    }
+
+    bool
+    SessionStatus::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "sessid")) r__.read(sessid);
+      else if (JSONReader::match(key__, size__, "status")) r__.read(status);
+      else return false;
+      return true;
+    }
+
     PushEntityParameters::PushEntityParameters(void)
     {
       m_header.mgid = 811;
@@ -23348,6 +28906,20 @@ namespace DUNE
       IMC::toJSON(os__, "name", name, nindent__);
     }
 
+    void
+    PushEntityParameters::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"name\":", name);
+    }
+
+    bool
+    PushEntityParameters::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "name")) r__.read(name);
+      else return false;
+      return true;
+    }
+
     PopEntityParameters::PopEntityParameters(void)
     {
       m_header.mgid = 812;
@@ -23404,6 +28976,20 @@ namespace DUNE
       IMC::toJSON(os__, "name", name, nindent__);
     }
 
+    void
+    PopEntityParameters::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"name\":", name);
+    }
+
+    bool
+    PopEntityParameters::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "name")) r__.read(name);
+      else return false;
+      return true;
+    }
+
     IoEvent::IoEvent(void)
     {
       m_header.mgid = 813;
@@ -23466,6 +29052,22 @@ namespace DUNE
       IMC::toJSON(os__, "error", error, nindent__);
     }
 
+    void
+    IoEvent::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"type\":", type);
+      w__.field(",\"error\":", error);
+    }
+
+    bool
+    IoEvent::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "error")) r__.read(error);
+      else return false;
+      return true;
+    }
+
     UamTxFrame::UamTxFrame(void)
     {
       m_header.mgid = 814;
@@ -23540,6 +29142,26 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    UamTxFrame::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"seq\":", seq);
+      w__.field(",\"sys_dst\":", sys_dst);
+      w__.field(",\"flags\":", flags);
+      w__.field(",\"data\":", data);
+    }
+
+    bool
+    UamTxFrame::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "seq")) r__.read(seq);
+      else if (JSONReader::match(key__, size__, "sys_dst")) r__.read(sys_dst);
+      else if (JSONReader::match(key__, size__, "flags")) r__.read(flags);
+      else if (JSONReader::match(key__, size__, "data")) r__.read(data);
+      else return false;
+      return true;
+    }
+
     UamRxFrame::UamRxFrame(void)
     {
       m_header.mgid = 815;
@@ -23614,6 +29236,26 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    UamRxFrame::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"sys_src\":", sys_src);
+      w__.field(",\"sys_dst\":", sys_dst);
+      w__.field(",\"flags\":", flags);
+      w__.field(",\"data\":", data);
+    }
+
+    bool
+    UamRxFrame::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "sys_src")) r__.read(sys_src);
+      else if (JSONReader::match(key__, size__, "sys_dst")) r__.read(sys_dst);
+      else if (JSONReader::match(key__, size__, "flags")) r__.read(flags);
+      else if (JSONReader::match(key__, size__, "data")) r__.read(data);
+      else return false;
+      return true;
+    }
+
     UamTxStatus::UamTxStatus(void)
     {
       m_header.mgid = 816;
@@ -23694,6 +29336,24 @@ namespace DUNE
       IMC::toJSON(os__, "error", error, nindent__);
     }
 
+    void
+    UamTxStatus::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"seq\":", seq);
+      w__.field(",\"value\":", value);
+      w__.field(",\"error\":", error);
+    }
+
+    bool
+    UamTxStatus::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "seq")) r__.read(seq);
+      else if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else if (JSONReader::match(key__, size__, "error")) r__.read(error);
+      else return false;
+      return true;
+    }
+
     UamRxRange::UamRxRange(void)
     {
       m_header.mgid = 817;
@@ -23774,6 +29434,24 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    UamRxRange::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"seq\":", seq);
+      w__.field(",\"sys\":", sys);
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    UamRxRange::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "seq")) r__.read(seq);
+      else if (JSONReader::match(key__, size__, "sys")) r__.read(sys);
+      else if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     FormCtrlParam::FormCtrlParam(void)
     {
       m_header.mgid = 820;
@@ -23860,6 +29538,30 @@ namespace DUNE
       IMC::toJSON(os__, "deconflgain", deconflgain, nindent__);
     }
 
+    void
+    FormCtrlParam::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"action\":", action);
+      w__.field(",\"longain\":", longain);
+      w__.field(",\"latgain\":", latgain);
+      w__.field(",\"bondthick\":", bondthick);
+      w__.field(",\"leadgain\":", leadgain);
+      w__.field(",\"deconflgain\":", deconflgain);
+    }
+
+    bool
+    FormCtrlParam::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "action")) r__.read(action);
+      else if (JSONReader::match(key__, size__, "longain")) r__.read(longain);
+      else if (JSONReader::match(key__, size__, "latgain")) r__.read(latgain);
+      else if (JSONReader::match(key__, size__, "bondthick")) r__.read(bondthick);
+      else if (JSONReader::match(key__, size__, "leadgain")) r__.read(leadgain);
+      else if (JSONReader::match(key__, size__, "deconflgain")) r__.read(deconflgain);
+      else return false;
+      return true;
+    }
+
     FormationEval::FormationEval(void)
     {
       m_header.mgid = 821;
@@ -23928,6 +29630,24 @@ namespace DUNE
       IMC::toJSON(os__, "dist_min_mean", dist_min_mean, nindent__);
     }
 
+    void
+    FormationEval::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"err_mean\":", err_mean);
+      w__.field(",\"dist_min_abs\":", dist_min_abs);
+      w__.field(",\"dist_min_mean\":", dist_min_mean);
+    }
+
+    bool
+    FormationEval::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "err_mean")) r__.read(err_mean);
+      else if (JSONReader::match(key__, size__, "dist_min_abs")) r__.read(dist_min_abs);
+      else if (JSONReader::match(key__, size__, "dist_min_mean")) r__.read(dist_min_mean);
+      else return false;
+      return true;
+    }
+
     FormationControlParams::FormationControlParams(void)
     {
       m_header.mgid = 822;
@@ -24044,6 +29764,40 @@ namespace DUNE
       IMC::toJSON(os__, "accel_lim_x", accel_lim_x, nindent__);
     }
 
+    void
+    FormationControlParams::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"action\":", action);
+      w__.field(",\"lon_gain\":", lon_gain);
+      w__.field(",\"lat_gain\":", lat_gain);
+      w__.field(",\"bond_thick\":", bond_thick);
+      w__.field(",\"lead_gain\":", lead_gain);
+      w__.field(",\"deconfl_gain\":", deconfl_gain);
+      w__.field(",\"accel_switch_gain\":", accel_switch_gain);
+      w__.field(",\"safe_dist\":", safe_dist);
+      w__.field(",\"deconflict_offset\":", deconflict_offset);
+      w__.field(",\"accel_safe_margin\":", accel_safe_margin);
+      w__.field(",\"accel_lim_x\":", accel_lim_x);
+    }
+
+    bool
+    FormationControlParams::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "action")) r__.read(action);
+      else if (JSONReader::match(key__, size__, "lon_gain")) r__.read(lon_gain);
+      else if (JSONReader::match(key__, size__, "lat_gain")) r__.read(lat_gain);
+      else if (JSONReader::match(key__, size__, "bond_thick")) r__.read(bond_thick);
+      else if (JSONReader::match(key__, size__, "lead_gain")) r__.read(lead_gain);
+      else if (JSONReader::match(key__, size__, "deconfl_gain")) r__.read(deconfl_gain);
+      else if (JSONReader::match(key__, size__, "accel_switch_gain")) r__.read(accel_switch_gain);
+      else if (JSONReader::match(key__, size__, "safe_dist")) r__.read(safe_dist);
+      else if (JSONReader::match(key__, size__, "deconflict_offset")) r__.read(deconflict_offset);
+      else if (JSONReader::match(key__, size__, "accel_safe_margin")) r__.read(accel_safe_margin);
+      else if (JSONReader::match(key__, size__, "accel_lim_x")) r__.read(accel_lim_x);
+      else return false;
+      return true;
+    }
+
     FormationEvaluation::FormationEvaluation(void)
     {
       m_header.mgid = 823;
@@ -24143,6 +29897,34 @@ namespace DUNE
       controlparams.toJSON(os__, "controlparams", nindent__);
     }
 
+    void
+    FormationEvaluation::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"type\":", type);
+      w__.field(",\"op\":", op);
+      w__.field(",\"err_mean\":", err_mean);
+      w__.field(",\"dist_min_abs\":", dist_min_abs);
+      w__.field(",\"dist_min_mean\":", dist_min_mean);
+      w__.field(",\"roll_rate_mean\":", roll_rate_mean);
+      w__.field(",\"time\":", time);
+      controlparams.toJSON(w__, ",\"controlparams\":");
+    }
+
+    bool
+    FormationEvaluation::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "err_mean")) r__.read(err_mean);
+      else if (JSONReader::match(key__, size__, "dist_min_abs")) r__.read(dist_min_abs);
+      else if (JSONReader::match(key__, size__, "dist_min_mean")) r__.read(dist_min_mean);
+      else if (JSONReader::match(key__, size__, "roll_rate_mean")) r__.read(roll_rate_mean);
+      else if (JSONReader::match(key__, size__, "time")) r__.read(time);
+      else if (JSONReader::match(key__, size__, "controlparams")) controlparams.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     FormationEvaluation::setTimeStampNested(double value__)
     {
@@ -24262,6 +30044,26 @@ namespace DUNE
       IMC::toJSON(os__, "duration", duration, nindent__);
     }
 
+    void
+    SoiWaypoint::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"eta\":", eta);
+      w__.field(",\"duration\":", duration);
+    }
+
+    bool
+    SoiWaypoint::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "eta")) r__.read(eta);
+      else if (JSONReader::match(key__, size__, "duration")) r__.read(duration);
+      else return false;
+      return true;
+    }
+
     SoiPlan::SoiPlan(void)
     {
       m_header.mgid = 851;
@@ -24325,6 +30127,22 @@ namespace DUNE
       waypoints.toJSON(os__, "waypoints", nindent__);
     }
 
+    void
+    SoiPlan::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"plan_id\":", plan_id);
+      waypoints.toJSON(w__, ",\"waypoints\":");
+    }
+
+    bool
+    SoiPlan::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "plan_id")) r__.read(plan_id);
+      else if (JSONReader::match(key__, size__, "waypoints")) waypoints.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     SoiPlan::setTimeStampNested(double value__)
     {
@@ -24436,6 +30254,28 @@ namespace DUNE
       IMC::toJSON(os__, "info", info, nindent__);
     }
 
+    void
+    SoiCommand::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"type\":", type);
+      w__.field(",\"command\":", command);
+      w__.field(",\"settings\":", settings);
+      plan.toJSON(w__, ",\"plan\":");
+      w__.field(",\"info\":", info);
+    }
+
+    bool
+    SoiCommand::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else if (JSONReader::match(key__, size__, "command")) r__.read(command);
+      else if (JSONReader::match(key__, size__, "settings")) r__.read(settings);
+      else if (JSONReader::match(key__, size__, "plan")) plan.fromJSON(r__);
+      else if (JSONReader::match(key__, size__, "info")) r__.read(info);
+      else return false;
+      return true;
+    }
+
     void
     SoiCommand::setTimeStampNested(double value__)
     {
@@ -24555,6 +30395,26 @@ namespace DUNE
       IMC::toJSON(os__, "settings_chk", settings_chk, nindent__);
     }
 
+    void
+    SoiState::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"state\":", state);
+      w__.field(",\"plan_id\":", plan_id);
+      w__.field(",\"wpt_id\":", wpt_id);
+      w__.field(",\"settings_chk\":", settings_chk);
+    }
+
+    bool
+    SoiState::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "state")) r__.read(state);
+      else if (JSONReader::match(key__, size__, "plan_id")) r__.read(plan_id);
+      else if (JSONReader::match(key__, size__, "wpt_id")) r__.read(wpt_id);
+      else if (JSONReader::match(key__, size__, "settings_chk")) r__.read(settings_chk);
+      else return false;
+      return true;
+    }
+
     MessagePart::MessagePart(void)
     {
       m_header.mgid = 877;
@@ -24629,6 +30489,26 @@ namespace DUNE
       IMC::toJSON(os__, "data", data, nindent__);
     }
 
+    void
+    MessagePart::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"uid\":", uid);
+      w__.field(",\"frag_number\":", frag_number);
+      w__.field(",\"num_frags\":", num_frags);
+      w__.field(",\"data\":", data);
+    }
+
+    bool
+    MessagePart::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "uid")) r__.read(uid);
+      else if (JSONReader::match(key__, size__, "frag_number")) r__.read(frag_number);
+      else if (JSONReader::match(key__, size__, "num_frags")) r__.read(num_frags);
+      else if (JSONReader::match(key__, size__, "data")) r__.read(data);
+      else return false;
+      return true;
+    }
+
     NeptusBlob::NeptusBlob(void)
     {
       m_header.mgid = 888;
@@ -24691,6 +30571,22 @@ namespace DUNE
       IMC::toJSON(os__, "content", content, nindent__);
     }
 
+    void
+    NeptusBlob::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"content_type\":", content_type);
+      w__.field(",\"content\":", content);
+    }
+
+    bool
+    NeptusBlob::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "content_type")) r__.read(content_type);
+      else if (JSONReader::match(key__, size__, "content")) r__.read(content);
+      else return false;
+      return true;
+    }
+
     Aborted::Aborted(void)
     {
       m_header.mgid = 889;
@@ -24798,6 +30694,24 @@ namespace DUNE
       IMC::toJSON(os__, "elevation", elevation, nindent__);
     }
 
+    void
+    UsblAngles::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"target\":", target);
+      w__.field(",\"bearing\":", bearing);
+      w__.field(",\"elevation\":", elevation);
+    }
+
+    bool
+    UsblAngles::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "target")) r__.read(target);
+      else if (JSONReader::match(key__, size__, "bearing")) r__.read(bearing);
+      else if (JSONReader::match(key__, size__, "elevation")) r__.read(elevation);
+      else return false;
+      return true;
+    }
+
     UsblPosition::UsblPosition(void)
     {
       m_header.mgid = 891;
@@ -24872,6 +30786,26 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    UsblPosition::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"target\":", target);
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+    }
+
+    bool
+    UsblPosition::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "target")) r__.read(target);
+      else if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else return false;
+      return true;
+    }
+
     UsblFix::UsblFix(void)
     {
       m_header.mgid = 892;
@@ -24954,6 +30888,28 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    UsblFix::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"target\":", target);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"z\":", z);
+    }
+
+    bool
+    UsblFix::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "target")) r__.read(target);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else return false;
+      return true;
+    }
+
     ParametersXml::ParametersXml(void)
     {
       m_header.mgid = 893;
@@ -25016,6 +30972,22 @@ namespace DUNE
       IMC::toJSON(os__, "config", config, nindent__);
     }
 
+    void
+    ParametersXml::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"locale\":", locale);
+      w__.field(",\"config\":", config);
+    }
+
+    bool
+    ParametersXml::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "locale")) r__.read(locale);
+      else if (JSONReader::match(key__, size__, "config")) r__.read(config);
+      else return false;
+      return true;
+    }
+
     GetParametersXml::GetParametersXml(void)
     {
       m_header.mgid = 894;
@@ -25123,6 +31095,24 @@ namespace DUNE
       IMC::toJSON(os__, "y", y, nindent__);
     }
 
+    void
+    SetImageCoords::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"camid\":", camid);
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+    }
+
+    bool
+    SetImageCoords::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "camid")) r__.read(camid);
+      else if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else return false;
+      return true;
+    }
+
     GetImageCoords::GetImageCoords(void)
     {
       m_header.mgid = 896;
@@ -25191,6 +31181,24 @@ namespace DUNE
       IMC::toJSON(os__, "y", y, nindent__);
     }
 
+    void
+    GetImageCoords::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"camid\":", camid);
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+    }
+
+    bool
+    GetImageCoords::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "camid")) r__.read(camid);
+      else if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else return false;
+      return true;
+    }
+
     GetWorldCoordinates::GetWorldCoordinates(void)
     {
       m_header.mgid = 897;
@@ -25277,6 +31285,30 @@ namespace DUNE
       IMC::toJSON(os__, "z", z, nindent__);
     }
 
+    void
+    GetWorldCoordinates::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"tracking\":", tracking);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+    }
+
+    bool
+    GetWorldCoordinates::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "tracking")) r__.read(tracking);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else return false;
+      return true;
+    }
+
     UsblAnglesExtended::UsblAnglesExtended(void)
     {
       m_header.mgid = 898;
@@ -25385,6 +31417,36 @@ namespace DUNE
       IMC::toJSON(os__, "accuracy", accuracy, nindent__);
     }
 
+    void
+    UsblAnglesExtended::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"target\":", target);
+      w__.field(",\"lbearing\":", lbearing);
+      w__.field(",\"lelevation\":", lelevation);
+      w__.field(",\"bearing\":", bearing);
+      w__.field(",\"elevation\":", elevation);
+      w__.field(",\"phi\":", phi);
+      w__.field(",\"theta\":", theta);
+      w__.field(",\"psi\":", psi);
+      w__.field(",\"accuracy\":", accuracy);
+    }
+
+    bool
+    UsblAnglesExtended::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "target")) r__.read(target);
+      else if (JSONReader::match(key__, size__, "lbearing")) r__.read(lbearing);
+      else if (JSONReader::match(key__, size__, "lelevation")) r__.read(lelevation);
+      else if (JSONReader::match(key__, size__, "bearing")) r__.read(bearing);
+      else if (JSONReader::match(key__, size__, "elevation")) r__.read(elevation);
+      else if (JSONReader::match(key__, size__, "phi")) r__.read(phi);
+      else if (JSONReader::match(key__, size__, "theta")) r__.read(theta);
+      else if (JSONReader::match(key__, size__, "psi")) r__.read(psi);
+      else if (JSONReader::match(key__, size__, "accuracy")) r__.read(accuracy);
+      else return false;
+      return true;
+    }
+
     UsblPositionExtended::UsblPositionExtended(void)
     {
       m_header.mgid = 899;
@@ -25505,6 +31567,40 @@ namespace DUNE
       IMC::toJSON(os__, "accuracy", accuracy, nindent__);
     }
 
+    void
+    UsblPositionExtended::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"target\":", target);
+      w__.field(",\"x\":", x);
+      w__.field(",\"y\":", y);
+      w__.field(",\"z\":", z);
+      w__.field(",\"n\":", n);
+      w__.field(",\"e\":", e);
+      w__.field(",\"d\":", d);
+      w__.field(",\"phi\":", phi);
+      w__.field(",\"theta\":", theta);
+      w__.field(",\"psi\":", psi);
+      w__.field(",\"accuracy\":", accuracy);
+    }
+
+    bool
+    UsblPositionExtended::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "target")) r__.read(target);
+      else if (JSONReader::match(key__, size__, "x")) r__.read(x);
+      else if (JSONReader::match(key__, size__, "y")) r__.read(y);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "n")) r__.read(n);
+      else if (JSONReader::match(key__, size__, "e")) r__.read(e);
+      else if (JSONReader::match(key__, size__, "d")) r__.read(d);
+      else if (JSONReader::match(key__, size__, "phi")) r__.read(phi);
+      else if (JSONReader::match(key__, size__, "theta")) r__.read(theta);
+      else if (JSONReader::match(key__, size__, "psi")) r__.read(psi);
+      else if (JSONReader::match(key__, size__, "accuracy")) r__.read(accuracy);
+      else return false;
+      return true;
+    }
+
     UsblFixExtended::UsblFixExtended(void)
     {
       m_header.mgid = 900;
@@ -25594,6 +31690,30 @@ namespace DUNE
       IMC::toJSON(os__, "accuracy", accuracy, nindent__);
     }
 
+    void
+    UsblFixExtended::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"target\":", target);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z_units\":", z_units);
+      w__.field(",\"z\":", z);
+      w__.field(",\"accuracy\":", accuracy);
+    }
+
+    bool
+    UsblFixExtended::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "target")) r__.read(target);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "accuracy")) r__.read(accuracy);
+      else return false;
+      return true;
+    }
+
     UsblModem::UsblModem(void)
     {
       m_header.mgid = 901;
@@ -25676,6 +31796,28 @@ namespace DUNE
       IMC::toJSON(os__, "z_units", z_units, nindent__);
     }
 
+    void
+    UsblModem::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"name\":", name);
+      w__.field(",\"lat\":", lat);
+      w__.field(",\"lon\":", lon);
+      w__.field(",\"z\":", z);
+      w__.field(",\"z_units\":", z_units);
+    }
+
+    bool
+    UsblModem::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "name")) r__.read(name);
+      else if (JSONReader::match(key__, size__, "lat")) r__.read(lat);
+      else if (JSONReader::match(key__, size__, "lon")) r__.read(lon);
+      else if (JSONReader::match(key__, size__, "z")) r__.read(z);
+      else if (JSONReader::match(key__, size__, "z_units")) r__.read(z_units);
+      else return false;
+      return true;
+    }
+
     UsblConfig::UsblConfig(void)
     {
       m_header.mgid = 902;
@@ -25739,6 +31881,22 @@ namespace DUNE
       modems.toJSON(os__, "modems", nindent__);
     }
 
+    void
+    UsblConfig::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"op\":", op);
+      modems.toJSON(w__, ",\"modems\":");
+    }
+
+    bool
+    UsblConfig::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "op")) r__.read(op);
+      else if (JSONReader::match(key__, size__, "modems")) modems.fromJSON(r__);
+      else return false;
+      return true;
+    }
+
     void
     UsblConfig::setTimeStampNested(double value__)
     {
@@ -25843,6 +32001,22 @@ namespace DUNE
       IMC::toJSON(os__, "type", type, nindent__);
     }
 
+    void
+    DissolvedOrganicMatter::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+      w__.field(",\"type\":", type);
+    }
+
+    bool
+    DissolvedOrganicMatter::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else if (JSONReader::match(key__, size__, "type")) r__.read(type);
+      else return false;
+      return true;
+    }
+
     OpticalBackscatter::OpticalBackscatter(void)
     {
       m_header.mgid = 904;
@@ -25911,6 +32085,20 @@ namespace DUNE
       IMC::toJSON(os__, "value", value, nindent__);
     }
 
+    void
+    OpticalBackscatter::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"value\":", value);
+    }
+
+    bool
+    OpticalBackscatter::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else return false;
+      return true;
+    }
+
     Tachograph::Tachograph(void)
     {
       m_header.mgid = 905;
@@ -26057,6 +32245,50 @@ namespace DUNE
       IMC::toJSON(os__, "depth_max", depth_max, nindent__);
     }
 
+    void
+    Tachograph::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"timestamp_last_service\":", timestamp_last_service);
+      w__.field(",\"time_next_service\":", time_next_service);
+      w__.field(",\"time_motor_next_service\":", time_motor_next_service);
+      w__.field(",\"time_idle_ground\":", time_idle_ground);
+      w__.field(",\"time_idle_air\":", time_idle_air);
+      w__.field(",\"time_idle_water\":", time_idle_water);
+      w__.field(",\"time_idle_underwater\":", time_idle_underwater);
+      w__.field(",\"time_idle_unknown\":", time_idle_unknown);
+      w__.field(",\"time_motor_ground\":", time_motor_ground);
+      w__.field(",\"time_motor_air\":", time_motor_air);
+      w__.field(",\"time_motor_water\":", time_motor_water);
+      w__.field(",\"time_motor_underwater\":", time_motor_underwater);
+      w__.field(",\"time_motor_unknown\":", time_motor_unknown);
+      w__.field(",\"rpm_min\":", rpm_min);
+      w__.field(",\"rpm_max\":", rpm_max);
+      w__.field(",\"depth_max\":", depth_max);
+    }
+
+    bool
+    Tachograph::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "timestamp_last_service")) r__.read(timestamp_last_service);
+      else if (JSONReader::match(key__, size__, "time_next_service")) r__.read(time_next_service);
+      else if (JSONReader::match(key__, size__, "time_motor_next_service")) r__.read(time_motor_next_service);
+      else if (JSONReader::match(key__, size__, "time_idle_ground")) r__.read(time_idle_ground);
+      else if (JSONReader::match(key__, size__, "time_idle_air")) r__.read(time_idle_air);
+      else if (JSONReader::match(key__, size__, "time_idle_water")) r__.read(time_idle_water);
+      else if (JSONReader::match(key__, size__, "time_idle_underwater")) r__.read(time_idle_underwater);
+      else if (JSONReader::match(key__, size__, "time_idle_unknown")) r__.read(time_idle_unknown);
+      else if (JSONReader::match(key__, size__, "time_motor_ground")) r__.read(time_motor_ground);
+      else if (JSONReader::match(key__, size__, "time_motor_air")) r__.read(time_motor_air);
+      else if (JSONReader::match(key__, size__, "time_motor_water")) r__.read(time_motor_water);
+      else if (JSONReader::match(key__, size__, "time_motor_underwater")) r__.read(time_motor_underwater);
+      else if (JSONReader::match(key__, size__, "time_motor_unknown")) r__.read(time_motor_unknown);
+      else if (JSONReader::match(key__, size__, "rpm_min")) r__.read(rpm_min);
+      else if (JSONReader::match(key__, size__, "rpm_max")) r__.read(rpm_max);
+      else if (JSONReader::match(key__, size__, "depth_max")) r__.read(depth_max);
+      else return false;
+      return true;
+    }
+
     ApmStatus::ApmStatus(void)
     {
       m_header.mgid = 906;
@@ -26119,6 +32351,22 @@ namespace DUNE
       IMC::toJSON(os__, "text", text, nindent__);
     }
 
+    void
+    ApmStatus::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"severity\":", severity);
+      w__.field(",\"text\":", text);
+    }
+
+    bool
+    ApmStatus::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "severity")) r__.read(severity);
+      else if (JSONReader::match(key__, size__, "text")) r__.read(text);
+      else return false;
+      return true;
+    }
+
     SadcReadings::SadcReadings(void)
     {
       m_header.mgid = 907;
@@ -26200,6 +32448,24 @@ namespace DUNE
       IMC::toJSON(os__, "gain", gain, nindent__);
     }
 
+    void
+    SadcReadings::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"channel\":", channel);
+      w__.field(",\"value\":", value);
+      w__.field(",\"gain\":", gain);
+    }
+
+    bool
+    SadcReadings::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "channel")) r__.read(channel);
+      else if (JSONReader::match(key__, size__, "value")) r__.read(value);
+      else if (JSONReader::match(key__, size__, "gain")) r__.read(gain);
+      else return false;
+      return true;
+    }
+
     DmsDetection::DmsDetection(void)
     {
       m_header.mgid = 908;
@@ -26345,5 +32611,49 @@ namespace DUNE
       IMC::toJSON(os__, "ch15", ch15, nindent__);
       IMC::toJSON(os__, "ch16", ch16, nindent__);
     }
+
+    void
+    DmsDetection::fieldsToJSON(JSONWriter& w__) const
+    {
+      w__.field(",\"ch01\":", ch01);
+      w__.field(",\"ch02\":", ch02);
+      w__.field(",\"ch03\":", ch03);
+      w__.field(",\"ch04\":", ch04);
+      w__.field(",\"ch05\":", ch05);
+      w__.field(",\"ch06\":", ch06);
+      w__.field(",\"ch07\":", ch07);
+      w__.field(",\"ch08\":", ch08);
+      w__.field(",\"ch09\":", ch09);
+      w__.field(",\"ch10\":", ch10);
+      w__.field(",\"ch11\":", ch11);
+      w__.field(",\"ch12\":", ch12);
+      w__.field(",\"ch13\":", ch13);
+      w__.field(",\"ch14\":", ch14);
+      w__.field(",\"ch15\":", ch15);
+      w__.field(",\"ch16\":", ch16);
+    }
+
+    bool
+    DmsDetection::fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__)
+    {
+      if (JSONReader::match(key__, size__, "ch01")) r__.read(ch01);
+      else if (JSONReader::match(key__, size__, "ch02")) r__.read(ch02);
+      else if (JSONReader::match(key__, size__, "ch03")) r__.read(ch03);
+      else if (JSONReader::match(key__, size__, "ch04")) r__.read(ch04);
+      else if (JSONReader::match(key__, size__, "ch05")) r__.read(ch05);
+      else if (JSONReader::match(key__, size__, "ch06")) r__.read(ch06);
+      else if (JSONReader::match(key__, size__, "ch07")) r__.read(ch07);
+      else if (JSONReader::match(key__, size__, "ch08")) r__.read(ch08);
+      else if (JSONReader::match(key__, size__, "ch09")) r__.read(ch09);
+      else if (JSONReader::match(key__, size__, "ch10")) r__.read(ch10);
+      else if (JSONReader::match(key__, size__, "ch11")) r__.read(ch11);
+      else if (JSONReader::match(key__, size__, "ch12")) r__.read(ch12);
+      else if (JSONReader::match(key__, size__, "ch13")) r__.read(ch13);
+      else if (JSONReader::match(key__, size__, "ch14")) r__.read(ch14);
+      else if (JSONReader::match(key__, size__, "ch15")) r__.read(ch15);
+      else if (JSONReader::match(key__, size__, "ch16")) r__.read(ch16);
+      else return false;
+      return true;
+    }
   }
 }
@@ -144,6 +144,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Query Entity State.
@@ -270,6 +276,9 @@ namespace DUNE
         return IMC::getSerializationSize(label) + IMC::getSerializationSize(component);
       }
 
+      bool
+      hasSubId(void) const;
+
       uint16_t
       getSubId(void) const;
 
@@ -278,6 +287,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Query Entity Information.
@@ -337,6 +352,9 @@ namespace DUNE
         return 1;
       }
 
+      bool
+      hasSubId(void) const;
+
       uint16_t
       getSubId(void) const;
 
@@ -345,6 +363,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Entity List.
@@ -423,6 +447,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! CPU Usage.
@@ -490,6 +520,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Transport Bindings.
@@ -559,6 +595,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Restart System.
@@ -629,6 +671,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Device Calibration Control.
@@ -703,6 +751,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Device Calibration State.
@@ -791,6 +845,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Entity Activation State.
@@ -881,6 +941,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Query Entity Activation State.
@@ -1040,6 +1106,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Message List.
@@ -1108,6 +1180,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -1218,6 +1296,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Leak Simulation.
@@ -1296,6 +1380,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Underwater Acoustics Simulation.
@@ -1378,6 +1468,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Dynamics Simulation Parameters.
@@ -1454,6 +1550,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Storage Usage.
@@ -1523,6 +1625,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Cache Control.
@@ -1610,6 +1718,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -1711,6 +1825,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Log Book Entry.
@@ -1799,6 +1919,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Log Book Control.
@@ -1884,6 +2010,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -1981,6 +2113,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Clock Control.
@@ -2063,6 +2201,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Historic CTD.
@@ -2128,6 +2272,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Historic Telemetry.
@@ -2197,6 +2347,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Historic Sonar Data.
@@ -2287,6 +2443,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Historic Event.
@@ -2365,6 +2527,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Profile Sample.
@@ -2428,6 +2596,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Vertical Profile.
@@ -2523,6 +2697,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -2670,6 +2850,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Announce Service.
@@ -2748,6 +2934,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Receive Signal Strength Information.
@@ -2815,6 +3007,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Voltage Standing Wave Ratio.
@@ -2882,6 +3080,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Link Level.
@@ -2949,6 +3153,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! SMS.
@@ -3020,6 +3230,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! SMS Transmit.
@@ -3093,6 +3309,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! SMS Receive.
@@ -3162,6 +3384,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! SMS State.
@@ -3252,6 +3480,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Text Message.
@@ -3321,6 +3555,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Received Iridium Message.
@@ -3396,6 +3636,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Transmit Iridium Message.
@@ -3469,6 +3715,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Iridium Transmission Status.
@@ -3557,6 +3809,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Group Membership State.
@@ -3626,6 +3884,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! System Group.
@@ -3714,6 +3978,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Link Latency.
@@ -3783,6 +4053,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Extended Receive Signal Strength Information.
@@ -3852,6 +4128,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Historic Data Series.
@@ -3926,6 +4208,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -4014,6 +4302,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Historic Data Sample.
@@ -4094,6 +4388,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -4194,6 +4494,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -4283,6 +4589,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -4406,6 +4718,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Telemetry Message.
@@ -4545,6 +4863,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! LBL Range.
@@ -4606,6 +4930,9 @@ namespace DUNE
         return 5;
       }
 
+      bool
+      hasSubId(void) const;
+
       uint16_t
       getSubId(void) const;
 
@@ -4614,6 +4941,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! LBL Beacon Configuration.
@@ -4693,6 +5026,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! LBL Configuration.
@@ -4774,6 +5113,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -4857,6 +5202,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -4987,6 +5338,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -5122,6 +5479,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Acoustic Link Quality.
@@ -5193,6 +5556,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Revolutions Per Minute.
@@ -5260,6 +5629,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Voltage.
@@ -5327,6 +5702,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Current.
@@ -5394,9 +5775,15 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
-    };
 
-    //! GPS Fix.
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+    };
+
+    //! GPS Fix.
     class GpsFix: public Message
     {
     public:
@@ -5523,6 +5910,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Euler Angles.
@@ -5592,6 +5985,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Euler Angles Delta.
@@ -5661,6 +6060,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Angular Velocity.
@@ -5728,6 +6133,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Acceleration.
@@ -5795,6 +6206,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Magnetic Field.
@@ -5862,6 +6279,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Ground Velocity.
@@ -5940,6 +6363,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Water Velocity.
@@ -6018,6 +6447,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Velocity Delta.
@@ -6085,6 +6520,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Device State.
@@ -6156,6 +6597,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Beam Configuration.
@@ -6219,6 +6666,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Distance.
@@ -6308,6 +6761,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -6390,6 +6849,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Pressure.
@@ -6457,6 +6922,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Depth.
@@ -6524,6 +6995,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Depth Offset.
@@ -6591,6 +7068,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Sound Speed.
@@ -6658,6 +7141,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Water Density.
@@ -6725,6 +7214,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Conductivity.
@@ -6792,6 +7287,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Salinity.
@@ -6859,6 +7360,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Wind Speed.
@@ -6924,6 +7431,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Relative Humidity.
@@ -6991,6 +7504,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Device Data (Text).
@@ -7058,6 +7577,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Device Data (Binary).
@@ -7125,6 +7650,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Force.
@@ -7192,6 +7723,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Sonar Data.
@@ -7285,6 +7822,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -7423,6 +7966,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Fuel Level.
@@ -7500,6 +8049,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! GPS Navigation Data.
@@ -7589,6 +8144,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Servo Position.
@@ -7650,6 +8211,9 @@ namespace DUNE
         return 5;
       }
 
+      bool
+      hasSubId(void) const;
+
       uint16_t
       getSubId(void) const;
 
@@ -7664,6 +8228,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Data Sanity.
@@ -7734,6 +8304,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Rhodamine Dye.
@@ -7801,6 +8377,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Crude Oil.
@@ -7868,6 +8450,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Fine Oil.
@@ -7935,6 +8523,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Turbidity.
@@ -8002,6 +8596,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Chlorophyll.
@@ -8069,6 +8669,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Fluorescein.
@@ -8136,6 +8742,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Phycocyanin.
@@ -8203,6 +8815,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Phycoerythrin.
@@ -8270,6 +8888,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! GPS Fix RTK.
@@ -8385,6 +9009,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Estimated State.
@@ -8484,6 +9114,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! External Navigation Data.
@@ -8565,6 +9201,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -8647,6 +9289,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Air Saturation.
@@ -8714,6 +9362,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Throttle.
@@ -8781,6 +9435,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! pH.
@@ -8848,6 +9508,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Redox Potential.
@@ -8915,6 +9581,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Camera Zoom.
@@ -8991,6 +9663,9 @@ namespace DUNE
         return 3;
       }
 
+      bool
+      hasSubId(void) const;
+
       uint16_t
       getSubId(void) const;
 
@@ -8999,6 +9674,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Set Thruster Actuation.
@@ -9060,6 +9741,9 @@ namespace DUNE
         return 5;
       }
 
+      bool
+      hasSubId(void) const;
+
       uint16_t
       getSubId(void) const;
 
@@ -9074,6 +9758,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Set Servo Position.
@@ -9135,6 +9825,9 @@ namespace DUNE
         return 5;
       }
 
+      bool
+      hasSubId(void) const;
+
       uint16_t
       getSubId(void) const;
 
@@ -9149,6 +9842,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Set Control Surface Deflection.
@@ -9210,6 +9909,9 @@ namespace DUNE
         return 5;
       }
 
+      bool
+      hasSubId(void) const;
+
       uint16_t
       getSubId(void) const;
 
@@ -9218,6 +9920,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Remote Actions Request.
@@ -9296,6 +10004,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Remote Actions.
@@ -9363,6 +10077,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Button Event.
@@ -9432,6 +10152,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! LCD Control.
@@ -9516,6 +10242,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Power Operation.
@@ -9600,6 +10332,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Power Channel Control.
@@ -9692,6 +10430,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Query Power Channel State.
@@ -9823,6 +10567,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! LED Brightness.
@@ -9898,6 +10648,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Query LED Brightness.
@@ -9965,6 +10721,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Set LED Brightness.
@@ -10040,6 +10802,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Set PWM.
@@ -10103,6 +10871,9 @@ namespace DUNE
         return 9;
       }
 
+      bool
+      hasSubId(void) const;
+
       uint16_t
       getSubId(void) const;
 
@@ -10111,6 +10882,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! PWM.
@@ -10174,6 +10951,9 @@ namespace DUNE
         return 9;
       }
 
+      bool
+      hasSubId(void) const;
+
       uint16_t
       getSubId(void) const;
 
@@ -10182,6 +10962,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Estimated Stream Velocity.
@@ -10247,6 +11033,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Indicated Speed.
@@ -10314,6 +11106,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! True Speed.
@@ -10381,6 +11179,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Navigation Uncertainty.
@@ -10468,6 +11272,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Navigation Data.
@@ -10545,6 +11355,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! GPS Fix Rejection.
@@ -10623,6 +11439,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! LBL Range Acceptance.
@@ -10701,6 +11523,9 @@ namespace DUNE
         return 6;
       }
 
+      bool
+      hasSubId(void) const;
+
       uint16_t
       getSubId(void) const;
 
@@ -10709,6 +11534,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! DVL Rejection.
@@ -10804,6 +11635,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! LBL Beacon Position Estimate.
@@ -10882,6 +11719,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -10973,6 +11816,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! GroupStreamVelocity.
@@ -11038,6 +11887,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Airflow.
@@ -11103,6 +11958,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Desired Heading.
@@ -11170,6 +12031,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Desired Z.
@@ -11239,6 +12106,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Desired Speed.
@@ -11308,6 +12181,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Desired Roll.
@@ -11375,6 +12254,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Desired Pitch.
@@ -11442,6 +12327,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Desired Vertical Rate.
@@ -11509,6 +12400,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Desired Path.
@@ -11615,6 +12512,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Desired Control.
@@ -11705,6 +12608,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Desired Heading Rate.
@@ -11772,6 +12681,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Desired Velocity.
@@ -11862,6 +12777,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Path Control State.
@@ -11974,6 +12895,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Allocated Control Torques.
@@ -12039,6 +12966,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Control Parcel.
@@ -12106,6 +13039,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Brake.
@@ -12178,6 +13117,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Desired Linear State.
@@ -12280,6 +13225,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Desired Throttle.
@@ -12347,6 +13298,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Goto Maneuver.
@@ -12434,6 +13391,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! PopUp Maneuver.
@@ -12532,6 +13495,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Teleoperation Maneuver.
@@ -12599,6 +13568,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Loiter Maneuver.
@@ -12720,6 +13695,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Idle Maneuver.
@@ -12789,6 +13770,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Low Level Control Maneuver.
@@ -12861,6 +13848,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -12982,6 +13975,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Path Point.
@@ -13047,6 +14046,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Follow Path Maneuver.
@@ -13131,6 +14136,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -13231,6 +14242,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Teleoperation Done.
@@ -13367,6 +14384,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Elevator Maneuver.
@@ -13463,6 +14486,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Trajectory Point.
@@ -13530,6 +14559,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Follow Trajectory.
@@ -13614,6 +14649,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -13700,6 +14741,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Vehicle Formation Participant.
@@ -13767,6 +14814,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Vehicle Formation.
@@ -13853,6 +14906,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -13982,6 +15041,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Maneuver Control State.
@@ -14066,6 +15131,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Follow System.
@@ -14141,6 +15212,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Communications Relay.
@@ -14216,6 +15293,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Polygon Vertex.
@@ -14279,6 +15362,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Cover Area.
@@ -14361,6 +15450,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -14480,6 +15575,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Formation Parameters.
@@ -14565,6 +15666,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -14673,6 +15780,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Follow Reference Maneuver.
@@ -14742,6 +15855,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Reference To Follow.
@@ -14839,6 +15958,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -14962,6 +16087,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -15086,6 +16217,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Formation Monitoring Data.
@@ -15190,6 +16327,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -15289,6 +16432,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Formation.
@@ -15432,6 +16581,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -15528,6 +16683,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Drop Maneuver.
@@ -15609,6 +16770,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Scheduled Goto.
@@ -15695,6 +16862,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Rows Coverage.
@@ -15801,6 +16974,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Sample Maneuver.
@@ -15888,6 +17067,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Image Tracking.
@@ -16022,6 +17207,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Land Maneuver.
@@ -16109,6 +17300,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Autonomous Section.
@@ -16210,6 +17407,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -16306,6 +17509,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Alignment Maneuver.
@@ -16383,6 +17592,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Station Keeping Extended.
@@ -16479,6 +17694,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Vehicle State.
@@ -16588,6 +17809,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Vehicle Command.
@@ -16692,6 +17919,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -16791,6 +18024,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Entity Monitoring State.
@@ -16872,6 +18111,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Operational Limits.
@@ -16955,6 +18200,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Get Operational Limits.
@@ -17069,6 +18320,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Control Loops.
@@ -17143,6 +18400,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Vehicle Medium.
@@ -17219,6 +18482,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Collision.
@@ -17301,6 +18570,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Formation Tracking State.
@@ -17401,6 +18676,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Autopilot Mode.
@@ -17481,6 +18762,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Formation Tracking State.
@@ -17603,6 +18890,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Report Control.
@@ -17708,6 +19001,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! State Report.
@@ -17787,6 +19086,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Transmission Request.
@@ -17893,6 +19198,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -17998,6 +19309,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! SMS Transmission Request.
@@ -18071,6 +19388,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! SMS Transmission Status.
@@ -18155,6 +19478,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! VTOL State.
@@ -18231,6 +19560,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Arming State.
@@ -18301,6 +19636,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Abort.
@@ -18451,6 +19792,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Plan Maneuver.
@@ -18525,6 +19872,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -18614,6 +19967,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -18713,6 +20072,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -18815,6 +20180,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -18918,6 +20289,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Plan DB.
@@ -19030,6 +20407,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -19122,6 +20505,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Plan DB State.
@@ -19202,6 +20591,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -19332,6 +20727,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -19452,6 +20853,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Plan Generation.
@@ -19545,6 +20952,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Leader State.
@@ -19661,6 +21074,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Plan Statistics.
@@ -19766,6 +21185,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Reported State.
@@ -19864,6 +21289,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Remote Sensor Info.
@@ -19943,6 +21374,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! MapPoint.
@@ -20008,6 +21445,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Map Feature.
@@ -20105,6 +21548,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -20190,6 +21639,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -20300,6 +21755,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -20385,6 +21846,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -20471,6 +21938,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! TREX Command.
@@ -20559,6 +22032,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! TREX Attribute.
@@ -20647,6 +22126,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! TREX Token.
@@ -20719,6 +22204,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -20821,6 +22312,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -20906,6 +22403,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -20990,6 +22493,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Compressed Image.
@@ -21059,6 +22568,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Image Transmission Settings.
@@ -21126,6 +22641,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Remote State.
@@ -21195,6 +22716,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Target.
@@ -21274,6 +22801,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! EntityParameter.
@@ -21343,6 +22876,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! EntityParameters.
@@ -21413,6 +22952,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -21499,6 +23044,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! SetEntityParameters.
@@ -21569,6 +23120,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -21651,6 +23208,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Create Session.
@@ -21712,6 +23275,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Close Session.
@@ -21773,6 +23342,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Session Subscription.
@@ -21842,6 +23417,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Session Keep-Alive.
@@ -21903,6 +23484,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Session Status.
@@ -21975,6 +23562,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Push Entity Parameters.
@@ -22042,6 +23635,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Pop Entity Parameters.
@@ -22109,6 +23708,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! I/O Event.
@@ -22187,6 +23792,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! UamTxFrame.
@@ -22269,6 +23880,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! UamRxFrame.
@@ -22351,6 +23968,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! UamTxStatus.
@@ -22449,6 +24072,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! UamRxRange.
@@ -22526,6 +24155,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Formation Control Parameters.
@@ -22608,6 +24243,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Formation Evaluation Data.
@@ -22673,6 +24314,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Formation Control Parameters.
@@ -22765,6 +24412,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Formation Evaluation Data.
@@ -22871,6 +24524,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -22953,6 +24612,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! SOI Plan.
@@ -23023,6 +24688,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -23142,6 +24813,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -23235,6 +24912,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Message Fragment.
@@ -23308,6 +24991,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Neptus Blob.
@@ -23377,6 +25066,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Aborted.
@@ -23495,6 +25190,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! USBL Position.
@@ -23562,6 +25263,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! USBL Fix.
@@ -23631,6 +25338,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Parameters XML.
@@ -23700,6 +25413,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Get Parameters XML.
@@ -23818,6 +25537,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Get Image Coordinates.
@@ -23883,6 +25608,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Get World Coordinates.
@@ -23954,6 +25685,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! USBL Angles Extended.
@@ -24037,6 +25774,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! USBL Position Extended.
@@ -24124,6 +25867,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! USBL Fix Extended.
@@ -24201,6 +25950,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! USBL Modem Configuration.
@@ -24276,6 +26031,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! USBL Configuration.
@@ -24357,6 +26118,12 @@ namespace DUNE
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
 
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
+
     protected:
       void
       setTimeStampNested(double value__);
@@ -24450,6 +26217,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Optical Backscattering Coefficient.
@@ -24517,6 +26290,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! Tachograph.
@@ -24608,6 +26387,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! APM Status.
@@ -24698,6 +26483,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! SADC Readings.
@@ -24780,6 +26571,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
 
     //! DMS Detection.
@@ -24871,6 +26668,12 @@ namespace DUNE
 
       void
       fieldsToJSON(std::ostream& os__, unsigned nindent__) const;
+
+      void
+      fieldsToJSON(JSONWriter& w__) const;
+
+      bool
+      fieldFromJSON(const char* key__, unsigned size__, JSONReader& r__);
     };
   }
 }
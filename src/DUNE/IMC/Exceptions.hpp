@@ -120,6 +120,15 @@ namespace DUNE
       { }
     };
 
+    //! Invalid JSON text.
+    class InvalidJSON: public std::runtime_error
+    {
+    public:
+      InvalidJSON(size_t offset):
+        std::runtime_error(Utils::String::str(DTR("invalid JSON at offset %u"), (unsigned)offset))
+      { }
+    };
+
     class InvalidMessageSize: public std::runtime_error
     {
     public:
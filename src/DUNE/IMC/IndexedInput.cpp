@@ -0,0 +1,169 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <fstream>
+#include <streambuf>
+
+// DUNE headers.
+#include <DUNE/I18N.hpp>
+#include <DUNE/Utils/ByteBuffer.hpp>
+#include <DUNE/Compression/Factory.hpp>
+#include <DUNE/Compression/Decompressor.hpp>
+#include <DUNE/Compression/Exceptions.hpp>
+#include <DUNE/IMC/IndexedInput.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Stream buffer that loads one selected chunk at a time.
+    class IndexedInput::Buffer: public std::streambuf
+    {
+    public:
+      Buffer(const std::string& data_file, const LogIndex& index, const LogIndex::Query& query):
+        m_method(index.getMethod()),
+        m_ifs(data_file.c_str(), std::ios::binary),
+        m_next(0)
+      {
+        if (!m_ifs.is_open())
+          throw std::runtime_error(DTR("unable to open data file: ") + data_file);
+
+        std::vector<const LogIndex::Chunk*> chunks;
+        index.select(query, chunks);
+        for (size_t i = 0; i < chunks.size(); ++i)
+          m_chunks.push_back(*chunks[i]);
+
+        setg(0, 0, 0);
+      }
+
+      size_t
+      getChunkCount(void) const
+      {
+        return m_chunks.size();
+      }
+
+    protected:
+      int_type
+      underflow(void)
+      {
+        while (gptr() == egptr())
+        {
+          if (m_next == m_chunks.size())
+            return traits_type::eof();
+
+          load(m_chunks[m_next++]);
+        }
+
+        return traits_type::to_int_type(*gptr());
+      }
+
+    private:
+      //! Compression method of the data file.
+      Compression::Methods m_method;
+      //! Data file.
+      std::ifstream m_ifs;
+      //! Selected chunks.
+      std::vector<LogIndex::Chunk> m_chunks;
+      //! Index of the next chunk to load.
+      size_t m_next;
+      //! Stored chunk.
+      Utils::ByteBuffer m_stored;
+      //! Decoded chunk.
+      Utils::ByteBuffer m_decoded;
+
+      void
+      load(const LogIndex::Chunk& chunk)
+      {
+        // Uncompressed chunks are read straight into the decoded buffer.
+        bool raw = (m_method == Compression::METHOD_UNKNOWN);
+        Utils::ByteBuffer& stored = raw ? m_decoded : m_stored;
+
+        stored.setSize(chunk.length);
+        m_ifs.clear();
+        m_ifs.seekg(chunk.offset);
+        m_ifs.read(stored.getBufferSigned(), chunk.length);
+        if (m_ifs.gcount() != (std::streamsize)chunk.length)
+          throw Compression::UnexpectedEOD();
+
+        if (!raw)
+        {
+          // Chunks are independent, each one gets a fresh decoder.
+          Compression::Decompressor* dec = Compression::Factory::decompressor(m_method);
+          m_decoded.setSize(chunk.size);
+
+          try
+          {
+            unsigned long src_idx = 0;
+            unsigned long dst_idx = 0;
+            while (dst_idx < chunk.size)
+            {
+              dec->decompress(m_decoded.getBufferSigned() + dst_idx, chunk.size - dst_idx,
+                              m_stored.getBufferSigned() + src_idx, chunk.length - src_idx);
+              if (dec->decompressed() == 0 && dec->processed() == 0)
+                throw Compression::CorruptedData();
+
+              dst_idx += dec->decompressed();
+              src_idx += dec->processed();
+            }
+          }
+          catch (...)
+          {
+            delete dec;
+            throw;
+          }
+
+          delete dec;
+        }
+
+        char* base = m_decoded.getBufferSigned();
+        setg(base, base, base + m_decoded.getSize());
+      }
+    };
+
+    IndexedInput::IndexedInput(const std::string& data_file, const LogIndex& index,
+                               const LogIndex::Query& query):
+      std::istream(0),
+      m_buffer(new Buffer(data_file, index, query))
+    {
+      rdbuf(m_buffer);
+    }
+
+    IndexedInput::~IndexedInput(void)
+    {
+      delete m_buffer;
+    }
+
+    size_t
+    IndexedInput::getChunkCount(void) const
+    {
+      return m_buffer->getChunkCount();
+    }
+  }
+}
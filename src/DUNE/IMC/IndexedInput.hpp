@@ -24,59 +24,56 @@
 // https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
 // http://ec.europa.eu/idabc/eupl.html.                                     *
 //***************************************************************************
-// Author: Eduardo Marques                                                  *
+// Author: Pedro Seruca                                                     *
 //***************************************************************************
 
-#ifndef SIMULATORS_ENVIRONMENT_POINT_HPP_INCLUDED_
-#define SIMULATORS_ENVIRONMENT_POINT_HPP_INCLUDED_
+#ifndef DUNE_IMC_INDEXED_INPUT_HPP_INCLUDED_
+#define DUNE_IMC_INDEXED_INPUT_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
-#include <iomanip>
-#include <cmath>
+#include <istream>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
+#include <DUNE/IMC/LogIndex.hpp>
 
-namespace Simulators
+namespace DUNE
 {
-  namespace Environment
+  namespace IMC
   {
-    //! Directions for search/insertion
-    enum
-    {
-      DIR_NW, DIR_NE, DIR_SW, DIR_SE
-    };
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM IndexedInput;
 
-    //! Point structure.
-    struct Point
+    //! Input stream over the chunks of an indexed LSF file that match
+    //! a query. Only the selected chunks are read and decompressed,
+    //! so the stream yields a subset of the log which is suitable
+    //! for Packet::deserialize(); messages within a selected chunk
+    //! are not filtered.
+    class IndexedInput: public std::istream
     {
-      double x, y;
-
-      Point(double x_, double y_):
-        x(x_), y(y_) { }
-
-      double
-      distance(const Point& other) const
-      {
-        double dx = x - other.x;
-        double dy = y - other.y;
-        return std::sqrt(dx * dx + dy * dy);
-      }
-
-      template <typename T>
-      int
-      direction(const T& other) const
-      {
-        double dx = other.x - x;
-        double dy = other.y - y;
+    public:
+      //! Constructor.
+      //! @param[in] data_file chunked LSF file.
+      //! @param[in] index index of the data file, it is not
+      //! referenced after construction.
+      //! @param[in] query chunk selection criteria.
+      IndexedInput(const std::string& data_file, const LogIndex& index,
+                   const LogIndex::Query& query = LogIndex::Query());
 
-        int dir = dx >= 0 ? DIR_NW : DIR_SW;
+      //! Destructor.
+      ~IndexedInput(void);
 
-        if (dy > 0)
-          dir++;      // other is East of this
+      //! Get the number of selected chunks.
+      //! @return number of chunks.
+      size_t
+      getChunkCount(void) const;
 
-        return dir;
-      }
+    private:
+      // Forward declaration.
+      class Buffer;
+      //! Chunk reader.
+      Buffer* m_buffer;
     };
   }
 }
@@ -275,6 +275,41 @@ namespace DUNE
         }
       }
 
+      //! Append the inline message to a compact JSON writer.
+      //! @param[in] w JSON writer.
+      //! @param[in] key key literal, including separator and colon.
+      template <size_t N>
+      void
+      toJSON(JSONWriter& w, const char (&key)[N]) const
+      {
+        w.put(key);
+
+        if (m_msg == NULL)
+        {
+          w.put("null");
+        }
+        else
+        {
+          w.put("{\"abbrev\":");
+          w.write(m_msg->getName());
+          m_msg->fieldsToJSON(w);
+          w.put('}');
+        }
+      }
+
+      //! Read the inline message from JSON.
+      //! @param[in] r JSON reader.
+      void
+      fromJSON(JSONReader& r)
+      {
+        Type* m = static_cast<Type*>(r.readMessage());
+
+        if (m == NULL)
+          clear();
+        else
+          replace(m);
+      }
+
     private:
       //! Parent message.
       const Message* m_parent;
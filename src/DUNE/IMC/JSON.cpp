@@ -27,8 +27,17 @@
 // Author: Ricardo Martins                                                  *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+
 // DUNE headers.
 #include <DUNE/IMC/JSON.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/Factory.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
 
 namespace DUNE
 {
@@ -63,5 +72,581 @@ namespace DUNE
 
       return c_levels[count];
     }
+
+    //! Hexadecimal digits.
+    static const char c_hex[] = "0123456789ABCDEF";
+    //! Largest real number that is written as an integer.
+    static const double c_max_integral = 1e15;
+    //! Size of buffers holding number tokens.
+    static const size_t c_token_size = 64;
+    //! Maximum nesting depth of objects and arrays.
+    static const unsigned c_max_depth = 32;
+
+    JSONWriter::JSONWriter(size_t capacity):
+      m_bfr(capacity),
+      m_size(0)
+    { }
+
+    void
+    JSONWriter::write(const std::vector<char>& value)
+    {
+      reserve(value.size() * 2 + 2);
+      m_bfr[m_size++] = '"';
+      for (size_t i = 0; i < value.size(); ++i)
+      {
+        uint8_t byte = static_cast<uint8_t>(value[i]);
+        m_bfr[m_size++] = c_hex[byte >> 4];
+        m_bfr[m_size++] = c_hex[byte & 0x0f];
+      }
+      m_bfr[m_size++] = '"';
+    }
+
+    void
+    JSONWriter::write(const Message& msg)
+    {
+      put("{\"abbrev\":");
+      write(msg.getName());
+      field(",\"timestamp\":", msg.getTimeStamp());
+      field(",\"src\":", msg.getSource());
+      field(",\"src_ent\":", msg.getSourceEntity());
+      field(",\"dst\":", msg.getDestination());
+      field(",\"dst_ent\":", msg.getDestinationEntity());
+      msg.fieldsToJSON(*this);
+      put('}');
+    }
+
+    void
+    JSONWriter::writeString(const char* value, size_t size)
+    {
+      // Worst case is every character escaped as \u00XX.
+      reserve(size * 6 + 2);
+      char* dst = &m_bfr[m_size];
+      *dst++ = '"';
+
+      for (size_t i = 0; i < size; ++i)
+      {
+        uint8_t c = static_cast<uint8_t>(value[i]);
+        if (c >= 0x20 && c != '"' && c != '\\')
+        {
+          *dst++ = c;
+          continue;
+        }
+
+        *dst++ = '\\';
+        switch (c)
+        {
+          case '"':
+          case '\\':
+            *dst++ = c;
+            break;
+          case '\n':
+            *dst++ = 'n';
+            break;
+          case '\r':
+            *dst++ = 'r';
+            break;
+          case '\t':
+            *dst++ = 't';
+            break;
+          default:
+            *dst++ = 'u';
+            *dst++ = '0';
+            *dst++ = '0';
+            *dst++ = c_hex[c >> 4];
+            *dst++ = c_hex[c & 0x0f];
+            break;
+        }
+      }
+
+      *dst++ = '"';
+      m_size = dst - &m_bfr[0];
+    }
+
+    void
+    JSONWriter::writeSigned(int64_t value)
+    {
+      if (value >= 0)
+      {
+        writeUnsigned(static_cast<uint64_t>(value));
+        return;
+      }
+
+      put('-');
+      writeUnsigned(~static_cast<uint64_t>(value) + 1);
+    }
+
+    void
+    JSONWriter::writeUnsigned(uint64_t value)
+    {
+      char bfr[20];
+      char* ptr = bfr + sizeof(bfr);
+
+      do
+      {
+        *--ptr = static_cast<char>('0' + value % 10);
+        value /= 10;
+      }
+      while (value != 0);
+
+      put(ptr, bfr + sizeof(bfr) - ptr);
+    }
+
+    void
+    JSONWriter::writeReal(fp64_t value, bool single)
+    {
+      if (value != value || std::fabs(value) > std::numeric_limits<fp64_t>::max())
+      {
+        put("null");
+        return;
+      }
+
+      // Most values are integral (identifiers, enumerations, counts).
+      if (std::fabs(value) < c_max_integral && value == std::floor(value))
+      {
+        writeSigned(static_cast<int64_t>(value));
+        return;
+      }
+
+      // Try the shorter representation first.
+      char bfr[c_token_size];
+      int size = std::sprintf(bfr, single ? "%.7g" : "%.15g", value);
+      fp64_t back = std::strtod(bfr, NULL);
+      if (single ? (static_cast<fp32_t>(back) != static_cast<fp32_t>(value)) : (back != value))
+        size = std::sprintf(bfr, single ? "%.9g" : "%.17g", value);
+
+      put(bfr, size);
+    }
+
+    //! Increments the nesting depth of a reader for the lifetime of
+    //! the object, rejecting input nested too deeply.
+    class JSONReader::Nesting
+    {
+    public:
+      Nesting(unsigned& depth, size_t offset):
+        m_depth(depth)
+      {
+        if (m_depth >= c_max_depth)
+          throw InvalidJSON(offset);
+
+        ++m_depth;
+      }
+
+      ~Nesting(void)
+      {
+        --m_depth;
+      }
+
+    private:
+      //! Depth counter.
+      unsigned& m_depth;
+    };
+
+    JSONReader::JSONReader(const char* data, size_t size):
+      m_begin(data),
+      m_ptr(data),
+      m_end(data + size),
+      m_depth(0)
+    { }
+
+    void
+    JSONReader::fail(void) const
+    {
+      throw InvalidJSON(getOffset());
+    }
+
+    bool
+    JSONReader::isDone(void)
+    {
+      skipSpace();
+      return m_ptr == m_end;
+    }
+
+    bool
+    JSONReader::consume(char c)
+    {
+      skipSpace();
+      if (m_ptr == m_end || *m_ptr != c)
+        return false;
+
+      ++m_ptr;
+      return true;
+    }
+
+    void
+    JSONReader::expect(char c)
+    {
+      if (!consume(c))
+        fail();
+    }
+
+    bool
+    JSONReader::readNull(void)
+    {
+      skipSpace();
+
+      // Message::toJSON(std::ostream&) writes null messages quoted.
+      size_t quoted = (m_ptr < m_end && *m_ptr == '"') ? 1 : 0;
+      if (m_end - m_ptr < (ptrdiff_t)(4 + 2 * quoted))
+        return false;
+
+      if (std::memcmp(m_ptr + quoted, "null", 4) != 0)
+        return false;
+
+      if (quoted && m_ptr[5] != '"')
+        return false;
+
+      m_ptr += 4 + 2 * quoted;
+      return true;
+    }
+
+    void
+    JSONReader::readKey(const char*& key, unsigned& size)
+    {
+      expect('"');
+      key = m_ptr;
+
+      while (m_ptr < m_end && *m_ptr != '"')
+        ++m_ptr;
+
+      if (m_ptr == m_end)
+        fail();
+
+      size = m_ptr - key;
+      ++m_ptr;
+      expect(':');
+    }
+
+    Message*
+    JSONReader::readMessage(void)
+    {
+      if (readNull())
+        return NULL;
+
+      expect('{');
+      Nesting nesting(m_depth, getOffset());
+      const char* start = m_ptr;
+
+      // The abbreviation is needed to create the message but may
+      // appear anywhere in the object.
+      const char* key = NULL;
+      unsigned size = 0;
+      while (true)
+      {
+        readKey(key, size);
+        if (match(key, size, "abbrev"))
+        {
+          read(m_abbrev);
+          break;
+        }
+
+        skip();
+        if (!consume(','))
+          fail();
+      }
+
+      Message* msg = Factory::produce(m_abbrev);
+      if (msg == NULL)
+        throw InvalidMessageAbbrev(m_abbrev);
+
+      m_ptr = start;
+
+      try
+      {
+        do
+        {
+          readKey(key, size);
+
+          if (match(key, size, "abbrev"))
+            skip();
+          else if (match(key, size, "timestamp"))
+            msg->setTimeStamp(readReal());
+          else if (match(key, size, "src"))
+            msg->setSource(static_cast<uint16_t>(readInteger()));
+          else if (match(key, size, "src_ent"))
+            msg->setSourceEntity(static_cast<uint8_t>(readInteger()));
+          else if (match(key, size, "dst"))
+            msg->setDestination(static_cast<uint16_t>(readInteger()));
+          else if (match(key, size, "dst_ent"))
+            msg->setDestinationEntity(static_cast<uint8_t>(readInteger()));
+          else if (!msg->fieldFromJSON(key, size, *this))
+            skip();
+        }
+        while (consume(','));
+
+        expect('}');
+      }
+      catch (...)
+      {
+        delete msg;
+        throw;
+      }
+
+      return msg;
+    }
+
+    void
+    JSONReader::skip(void)
+    {
+      skipSpace();
+      if (m_ptr == m_end)
+        fail();
+
+      if (*m_ptr == '"')
+      {
+        for (++m_ptr; m_ptr < m_end && *m_ptr != '"'; ++m_ptr)
+        {
+          if (*m_ptr == '\\')
+            ++m_ptr;
+        }
+
+        if (m_ptr >= m_end)
+          fail();
+
+        ++m_ptr;
+        return;
+      }
+
+      if (*m_ptr == '{' || *m_ptr == '[')
+      {
+        char close = (*m_ptr == '{') ? '}' : ']';
+        ++m_ptr;
+        Nesting nesting(m_depth, getOffset());
+
+        if (consume(close))
+          return;
+
+        do
+        {
+          if (close == '}')
+          {
+            const char* key = NULL;
+            unsigned size = 0;
+            readKey(key, size);
+          }
+
+          skip();
+        }
+        while (consume(','));
+
+        expect(close);
+        return;
+      }
+
+      // Numbers and literals.
+      const char* start = m_ptr;
+      while (m_ptr < m_end && *m_ptr != ',' && *m_ptr != '}' && *m_ptr != ']'
+             && *m_ptr != ' ' && *m_ptr != '\n' && *m_ptr != '\r' && *m_ptr != '\t')
+        ++m_ptr;
+
+      if (m_ptr == start)
+        fail();
+    }
+
+    void
+    JSONReader::readToken(char* bfr, size_t size)
+    {
+      skipSpace();
+
+      bool quoted = (m_ptr < m_end && *m_ptr == '"');
+      if (quoted)
+        ++m_ptr;
+
+      size_t i = 0;
+      while (m_ptr < m_end && i < size - 1)
+      {
+        char c = *m_ptr;
+        if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E')
+          bfr[i++] = c;
+        else
+          break;
+        ++m_ptr;
+      }
+      bfr[i] = 0;
+
+      if (i == 0)
+        fail();
+
+      if (quoted && (m_ptr == m_end || *m_ptr++ != '"'))
+        fail();
+    }
+
+    int64_t
+    JSONReader::readInteger(void)
+    {
+      skipSpace();
+
+      // Fast path for unquoted integers.
+      const char* ptr = m_ptr;
+      bool negative = (ptr < m_end && *ptr == '-');
+      if (negative)
+        ++ptr;
+
+      const char* digits = ptr;
+      uint64_t value = 0;
+      while (ptr < m_end && *ptr >= '0' && *ptr <= '9')
+        value = value * 10 + (*ptr++ - '0');
+
+      if (ptr != digits && (ptr == m_end || (*ptr != '.' && *ptr != 'e' && *ptr != 'E')))
+      {
+        m_ptr = ptr;
+        return negative ? -static_cast<int64_t>(value) : static_cast<int64_t>(value);
+      }
+
+      char bfr[c_token_size];
+      readToken(bfr, sizeof(bfr));
+
+      char* end = NULL;
+      if (std::strpbrk(bfr, ".eE") == NULL)
+      {
+        int64_t rv = std::strtoll(bfr, &end, 10);
+        if (*end != 0)
+          fail();
+        return rv;
+      }
+
+      fp64_t rv = std::strtod(bfr, &end);
+      if (*end != 0)
+        fail();
+      return static_cast<int64_t>(rv);
+    }
+
+    fp64_t
+    JSONReader::readReal(void)
+    {
+      if (readNull())
+        return std::numeric_limits<fp64_t>::quiet_NaN();
+
+      char bfr[c_token_size];
+      readToken(bfr, sizeof(bfr));
+
+      char* end = NULL;
+      fp64_t rv = std::strtod(bfr, &end);
+      if (*end != 0)
+        fail();
+
+      return rv;
+    }
+
+    //! Decode an hexadecimal digit.
+    //! @param[in] c digit.
+    //! @return value of digit, -1 if invalid.
+    static int
+    decodeHex(char c)
+    {
+      if (c >= '0' && c <= '9')
+        return c - '0';
+      if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+      if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+      return -1;
+    }
+
+    void
+    JSONReader::read(std::string& value)
+    {
+      value.clear();
+      expect('"');
+
+      while (true)
+      {
+        const char* start = m_ptr;
+        while (m_ptr < m_end && *m_ptr != '"' && *m_ptr != '\\')
+          ++m_ptr;
+
+        value.append(start, m_ptr - start);
+
+        if (m_ptr == m_end)
+          fail();
+
+        if (*m_ptr++ == '"')
+          return;
+
+        if (m_ptr == m_end)
+          fail();
+
+        char c = *m_ptr++;
+        switch (c)
+        {
+          case 'n':
+            value += '\n';
+            break;
+          case 'r':
+            value += '\r';
+            break;
+          case 't':
+            value += '\t';
+            break;
+          case 'b':
+            value += '\b';
+            break;
+          case 'f':
+            value += '\f';
+            break;
+          case 'u':
+          {
+            if (m_end - m_ptr < 4)
+              fail();
+
+            unsigned code = 0;
+            for (unsigned i = 0; i < 4; ++i)
+            {
+              int digit = decodeHex(*m_ptr++);
+              if (digit < 0)
+                fail();
+              code = (code << 4) | digit;
+            }
+
+            // Surrogate pairs are not combined, each half is encoded
+            // on its own.
+            if (code < 0x80)
+            {
+              value += static_cast<char>(code);
+            }
+            else if (code < 0x800)
+            {
+              value += static_cast<char>(0xc0 | (code >> 6));
+              value += static_cast<char>(0x80 | (code & 0x3f));
+            }
+            else
+            {
+              value += static_cast<char>(0xe0 | (code >> 12));
+              value += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+              value += static_cast<char>(0x80 | (code & 0x3f));
+            }
+            break;
+          }
+          default:
+            value += c;
+            break;
+        }
+      }
+    }
+
+    void
+    JSONReader::read(std::vector<char>& value)
+    {
+      value.clear();
+      expect('"');
+
+      while (m_ptr < m_end && *m_ptr != '"')
+      {
+        if (m_end - m_ptr < 2)
+          fail();
+
+        int hi = decodeHex(m_ptr[0]);
+        int lo = decodeHex(m_ptr[1]);
+        if (hi < 0 || lo < 0)
+          fail();
+
+        value.push_back(static_cast<char>((hi << 4) | lo));
+        m_ptr += 2;
+      }
+
+      if (m_ptr == m_end)
+        fail();
+
+      ++m_ptr;
+    }
   }
 }
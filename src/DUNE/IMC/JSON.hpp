@@ -34,6 +34,8 @@
 #include <ostream>
 #include <vector>
 #include <string>
+#include <cstddef>
+#include <cstring>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
@@ -43,6 +45,9 @@ namespace DUNE
 {
   namespace IMC
   {
+    // Forward declarations.
+    class Message;
+
     //! Return a string with a given number of white spaces.
     //! @param[in] count number of white spaces.
     //! @return string with 'count' white spaces.
@@ -120,6 +125,394 @@ namespace DUNE
       const char* indent = indentJSON(nindent);
       os << prefix << '\n' << indent << '"' << label << "\": \"" << Utils::String::toHex(value) << '"';
     }
+
+    //! Compact JSON writer. Values are appended to an internal
+    //! buffer that is reused between messages, numbers are written
+    //! as JSON numbers and field keys are written from preformatted
+    //! literals.
+    class JSONWriter
+    {
+    public:
+      //! Constructor.
+      //! @param[in] capacity initial capacity of the buffer.
+      JSONWriter(size_t capacity = 1024);
+
+      //! Discard the contents of the buffer, keeping its capacity.
+      void
+      clear(void)
+      {
+        m_size = 0;
+      }
+
+      //! Get the contents of the buffer.
+      //! @return pointer to the contents of the buffer.
+      const char*
+      data(void) const
+      {
+        return m_size ? &m_bfr[0] : "";
+      }
+
+      //! Get the size of the contents of the buffer.
+      //! @return size of the buffer in bytes.
+      size_t
+      size(void) const
+      {
+        return m_size;
+      }
+
+      //! Get a copy of the contents of the buffer.
+      //! @return contents of the buffer.
+      std::string
+      str(void) const
+      {
+        return std::string(data(), m_size);
+      }
+
+      //! Append a character.
+      //! @param[in] c character.
+      void
+      put(char c)
+      {
+        reserve(1);
+        m_bfr[m_size++] = c;
+      }
+
+      //! Append raw text.
+      //! @param[in] text text.
+      //! @param[in] size size of text.
+      void
+      put(const char* text, size_t size)
+      {
+        reserve(size);
+        std::memcpy(&m_bfr[m_size], text, size);
+        m_size += size;
+      }
+
+      //! Append a string literal.
+      //! @param[in] text string literal.
+      template <size_t N>
+      void
+      put(const char (&text)[N])
+      {
+        put(text, N - 1);
+      }
+
+      //! Append a preformatted key followed by a value.
+      //! @param[in] key key literal, including separator and colon.
+      //! @param[in] value value.
+      template <size_t N, typename Type>
+      void
+      field(const char (&key)[N], const Type& value)
+      {
+        put(key, N - 1);
+        write(value);
+      }
+
+      void
+      write(int8_t value)
+      {
+        writeSigned(value);
+      }
+
+      void
+      write(uint8_t value)
+      {
+        writeUnsigned(value);
+      }
+
+      void
+      write(int16_t value)
+      {
+        writeSigned(value);
+      }
+
+      void
+      write(uint16_t value)
+      {
+        writeUnsigned(value);
+      }
+
+      void
+      write(int32_t value)
+      {
+        writeSigned(value);
+      }
+
+      void
+      write(uint32_t value)
+      {
+        writeUnsigned(value);
+      }
+
+      void
+      write(int64_t value)
+      {
+        writeSigned(value);
+      }
+
+      void
+      write(uint64_t value)
+      {
+        writeUnsigned(value);
+      }
+
+      void
+      write(fp32_t value)
+      {
+        writeReal(value, true);
+      }
+
+      void
+      write(fp64_t value)
+      {
+        writeReal(value, false);
+      }
+
+      //! Append a quoted and escaped string.
+      //! @param[in] value string.
+      void
+      write(const std::string& value)
+      {
+        writeString(value.data(), value.size());
+      }
+
+      //! Append a zero terminated string, quoted and escaped.
+      //! @param[in] value string.
+      void
+      write(const char* value)
+      {
+        writeString(value, std::strlen(value));
+      }
+
+      //! Append raw data as a quoted hexadecimal string.
+      //! @param[in] value raw data.
+      void
+      write(const std::vector<char>& value);
+
+      //! Append a complete message, including header.
+      //! @param[in] msg message.
+      void
+      write(const Message& msg);
+
+      //! Append a quoted and escaped string.
+      //! @param[in] value string.
+      //! @param[in] size size of the string.
+      void
+      writeString(const char* value, size_t size);
+
+      //! Append a signed integer.
+      //! @param[in] value integer.
+      void
+      writeSigned(int64_t value);
+
+      //! Append an unsigned integer.
+      //! @param[in] value integer.
+      void
+      writeUnsigned(uint64_t value);
+
+      //! Append the shortest representation of a real number that
+      //! reads back to the same value. Infinities and NaN are
+      //! written as null.
+      //! @param[in] value real number.
+      //! @param[in] single true if value has single precision.
+      void
+      writeReal(fp64_t value, bool single);
+
+    private:
+      //! Buffer.
+      std::vector<char> m_bfr;
+      //! Number of bytes used.
+      size_t m_size;
+
+      //! Make room for a number of bytes.
+      //! @param[in] size number of bytes.
+      void
+      reserve(size_t size)
+      {
+        if (m_size + size > m_bfr.size())
+          m_bfr.resize(m_size + size > 2 * m_bfr.size() ? m_size + size : 2 * m_bfr.size());
+      }
+    };
+
+    //! Streaming JSON reader of messages. Reads the compact format
+    //! written by JSONWriter and the indented format written by
+    //! Message::toJSON(std::ostream&), where numbers are quoted.
+    //! Objects and arrays may be nested at most 32 levels deep,
+    //! deeper input is rejected with InvalidJSON.
+    class JSONReader
+    {
+    public:
+      //! Constructor.
+      //! @param[in] data JSON text, need not be zero terminated.
+      //! @param[in] size size of text.
+      JSONReader(const char* data, size_t size);
+
+      //! Test if all input was consumed, ignoring white space.
+      //! @return true if there is no more input, false otherwise.
+      bool
+      isDone(void);
+
+      //! Get the number of bytes consumed.
+      //! @return offset in input.
+      size_t
+      getOffset(void) const
+      {
+        return m_ptr - m_begin;
+      }
+
+      //! Read a message object. Header fields are optional, unknown
+      //! fields are ignored.
+      //! @return message, NULL if the value is null.
+      Message*
+      readMessage(void);
+
+      //! Consume a character, ignoring white space.
+      //! @param[in] c character.
+      //! @return true if the character was consumed, false if the
+      //! next character is different.
+      bool
+      consume(char c);
+
+      //! Consume a character, ignoring white space.
+      //! @param[in] c character.
+      //! @throw InvalidJSON if the next character is different.
+      void
+      expect(char c);
+
+      //! Skip a value of any type.
+      void
+      skip(void);
+
+      void
+      read(int8_t& value)
+      {
+        value = static_cast<int8_t>(readInteger());
+      }
+
+      void
+      read(uint8_t& value)
+      {
+        value = static_cast<uint8_t>(readInteger());
+      }
+
+      void
+      read(int16_t& value)
+      {
+        value = static_cast<int16_t>(readInteger());
+      }
+
+      void
+      read(uint16_t& value)
+      {
+        value = static_cast<uint16_t>(readInteger());
+      }
+
+      void
+      read(int32_t& value)
+      {
+        value = static_cast<int32_t>(readInteger());
+      }
+
+      void
+      read(uint32_t& value)
+      {
+        value = static_cast<uint32_t>(readInteger());
+      }
+
+      void
+      read(int64_t& value)
+      {
+        value = readInteger();
+      }
+
+      void
+      read(fp32_t& value)
+      {
+        value = static_cast<fp32_t>(readReal());
+      }
+
+      void
+      read(fp64_t& value)
+      {
+        value = readReal();
+      }
+
+      //! Read a string, decoding escape sequences.
+      //! @param[out] value string.
+      void
+      read(std::string& value);
+
+      //! Read raw data from an hexadecimal string.
+      //! @param[out] value raw data.
+      void
+      read(std::vector<char>& value);
+
+      //! Read an integer, possibly quoted.
+      //! @return integer.
+      int64_t
+      readInteger(void);
+
+      //! Read a real number, possibly quoted. Null reads as NaN.
+      //! @return real number.
+      fp64_t
+      readReal(void);
+
+      //! Test if a key matches a name.
+      //! @param[in] key key.
+      //! @param[in] size size of key.
+      //! @param[in] name name literal.
+      //! @return true if key matches name, false otherwise.
+      template <size_t N>
+      static bool
+      match(const char* key, unsigned size, const char (&name)[N])
+      {
+        return size == N - 1 && std::memcmp(key, name, N - 1) == 0;
+      }
+
+    private:
+      //! Start of input.
+      const char* m_begin;
+      //! Current position.
+      const char* m_ptr;
+      //! End of input.
+      const char* m_end;
+      //! Abbreviation of the message being read.
+      std::string m_abbrev;
+      //! Current nesting depth of objects and arrays.
+      unsigned m_depth;
+
+      class Nesting;
+
+      //! Skip white space.
+      void
+      skipSpace(void)
+      {
+        while (m_ptr < m_end && (*m_ptr == ' ' || *m_ptr == '\n' || *m_ptr == '\r' || *m_ptr == '\t'))
+          ++m_ptr;
+      }
+
+      //! Read an object key, without escape sequences, and the
+      //! following colon.
+      //! @param[out] key key.
+      //! @param[out] size size of key.
+      void
+      readKey(const char*& key, unsigned& size);
+
+      //! Consume the null literal, possibly quoted.
+      //! @return true if null was consumed, false otherwise.
+      bool
+      readNull(void);
+
+      //! Copy a number token, possibly quoted, to a buffer.
+      //! @param[out] bfr buffer, zero terminated.
+      //! @param[in] size size of buffer.
+      void
+      readToken(char* bfr, size_t size);
+
+      //! Throw an error at the current position.
+      void
+      fail(void) const;
+    };
   }
 }
 
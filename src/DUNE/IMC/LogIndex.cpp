@@ -0,0 +1,295 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <limits>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+
+// DUNE headers.
+#include <DUNE/I18N.hpp>
+#include <DUNE/Utils/ByteBuffer.hpp>
+#include <DUNE/Compression/Factory.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+#include <DUNE/IMC/LogIndex.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Index file magic.
+    static const char c_magic[] = "DLSI";
+    //! Index format version.
+    static const uint8_t c_version = 2;
+
+    //! Append an unsigned integer in little endian byte order.
+    //! @param[in] bfr buffer.
+    //! @param[in] value value.
+    //! @param[in] size number of bytes.
+    static void
+    putLE(Utils::ByteBuffer& bfr, uint64_t value, size_t size)
+    {
+      uint8_t data[8];
+      for (size_t i = 0; i < size; ++i)
+        data[i] = (uint8_t)(value >> (8 * i));
+      bfr.append(data, size);
+    }
+
+    //! Read an unsigned integer in little endian byte order.
+    //! @param[in] is input stream.
+    //! @param[out] value value.
+    //! @param[in] size number of bytes.
+    //! @return true if the value was read, false otherwise.
+    static bool
+    getLE(std::istream& is, uint64_t& value, size_t size)
+    {
+      uint8_t data[8];
+      is.read((char*)data, size);
+      if (is.gcount() != (std::streamsize)size)
+        return false;
+
+      value = 0;
+      for (size_t i = 0; i < size; ++i)
+        value |= (uint64_t)data[i] << (8 * i);
+      return true;
+    }
+
+    template <typename T>
+    static void
+    put(Utils::ByteBuffer& bfr, const T& value)
+    {
+      putLE(bfr, (uint64_t)value, sizeof(T));
+    }
+
+    static void
+    put(Utils::ByteBuffer& bfr, const double& value)
+    {
+      uint64_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      putLE(bfr, bits, sizeof(bits));
+    }
+
+    template <typename T>
+    static bool
+    get(std::istream& is, T& value)
+    {
+      uint64_t v = 0;
+      if (!getLE(is, v, sizeof(T)))
+        return false;
+
+      value = (T)v;
+      return true;
+    }
+
+    static bool
+    get(std::istream& is, double& value)
+    {
+      uint64_t bits = 0;
+      if (!getLE(is, bits, sizeof(bits)))
+        return false;
+
+      std::memcpy(&value, &bits, sizeof(value));
+      return true;
+    }
+
+    LogIndex::Query::Query(void):
+      time_start(-std::numeric_limits<double>::infinity()),
+      time_end(std::numeric_limits<double>::infinity())
+    { }
+
+    LogIndex::LogIndex(void):
+      m_method(Compression::METHOD_UNKNOWN)
+    { }
+
+    std::string
+    LogIndex::getPath(const std::string& data_file)
+    {
+      return data_file + ".idx";
+    }
+
+    void
+    LogIndex::writeHeader(std::ostream& os, Compression::Methods method)
+    {
+      std::string name = Compression::Factory::method(method);
+
+      Utils::ByteBuffer bfr;
+      bfr.appendSigned(c_magic, 4);
+      put(bfr, c_version);
+      put(bfr, (uint8_t)name.size());
+      bfr.appendSigned(name.c_str(), name.size());
+      os.write(bfr.getBufferSigned(), bfr.getSize());
+    }
+
+    void
+    LogIndex::writeChunk(std::ostream& os, const Chunk& chunk)
+    {
+      Utils::ByteBuffer bfr(64 + chunk.ids.size() * 2 + chunk.sources.size() * 3);
+      put(bfr, chunk.offset);
+      put(bfr, chunk.length);
+      put(bfr, chunk.size);
+      put(bfr, chunk.time_start);
+      put(bfr, chunk.time_end);
+      put(bfr, chunk.count);
+      put(bfr, chunk.flags);
+
+      put(bfr, (uint32_t)chunk.ids.size());
+      for (size_t i = 0; i < chunk.ids.size(); ++i)
+        put(bfr, chunk.ids[i]);
+
+      put(bfr, (uint32_t)chunk.sources.size());
+      for (size_t i = 0; i < chunk.sources.size(); ++i)
+      {
+        put(bfr, chunk.sources[i].system);
+        put(bfr, chunk.sources[i].entity);
+      }
+
+      os.write(bfr.getBufferSigned(), bfr.getSize());
+    }
+
+    void
+    LogIndex::load(const std::string& index_file)
+    {
+      std::ifstream ifs(index_file.c_str(), std::ios::binary);
+      if (!ifs.is_open())
+        throw std::runtime_error(DTR("unable to open index file: ") + index_file);
+
+      load(ifs);
+    }
+
+    void
+    LogIndex::load(std::istream& is)
+    {
+      m_chunks.clear();
+
+      char magic[4];
+      uint8_t version = 0;
+      uint8_t name_len = 0;
+      is.read(magic, sizeof(magic));
+      if (is.gcount() != sizeof(magic) || std::memcmp(magic, c_magic, sizeof(magic)) != 0)
+        throw InvalidFormat();
+
+      if (!get(is, version) || version != c_version || !get(is, name_len))
+        throw InvalidFormat();
+
+      std::string name(name_len, '\0');
+      is.read(&name[0], name_len);
+      if (is.gcount() != name_len)
+        throw InvalidFormat();
+
+      m_method = Compression::Factory::method(name);
+
+      while (true)
+      {
+        Chunk chunk;
+        uint32_t id_count = 0;
+        uint32_t source_count = 0;
+
+        if (!get(is, chunk.offset) || !get(is, chunk.length) || !get(is, chunk.size)
+            || !get(is, chunk.time_start) || !get(is, chunk.time_end)
+            || !get(is, chunk.count) || !get(is, chunk.flags) || !get(is, id_count))
+          break;
+
+        if (id_count > 65536)
+          throw InvalidFormat();
+
+        chunk.ids.resize(id_count);
+        bool complete = true;
+        for (uint32_t i = 0; i < id_count && complete; ++i)
+          complete = get(is, chunk.ids[i]);
+
+        if (!complete || !get(is, source_count))
+          break;
+
+        if (source_count > 65536 * 256)
+          throw InvalidFormat();
+
+        chunk.sources.resize(source_count);
+        for (uint32_t i = 0; i < source_count && complete; ++i)
+          complete = get(is, chunk.sources[i].system) && get(is, chunk.sources[i].entity);
+
+        if (!complete)
+          break;
+
+        m_chunks.push_back(chunk);
+      }
+    }
+
+    bool
+    LogIndex::matches(const Chunk& chunk, const Query& query)
+    {
+      if (chunk.flags & CF_OPAQUE)
+        return true;
+
+      if (chunk.count == 0)
+        return false;
+
+      if (chunk.time_end < query.time_start || chunk.time_start > query.time_end)
+        return false;
+
+      if (!query.ids.empty())
+      {
+        bool found = false;
+        for (size_t i = 0; i < chunk.ids.size() && !found; ++i)
+          found = query.ids.find(chunk.ids[i]) != query.ids.end();
+
+        if (!found)
+          return false;
+      }
+
+      if (!query.sources.empty())
+      {
+        bool found = false;
+        std::set<Source>::const_iterator itr = query.sources.begin();
+        for (; itr != query.sources.end() && !found; ++itr)
+        {
+          for (size_t i = 0; i < chunk.sources.size() && !found; ++i)
+            found = itr->matches(chunk.sources[i]);
+        }
+
+        if (!found)
+          return false;
+      }
+
+      return true;
+    }
+
+    void
+    LogIndex::select(const Query& query, std::vector<const Chunk*>& chunks) const
+    {
+      chunks.clear();
+
+      for (size_t i = 0; i < m_chunks.size(); ++i)
+      {
+        if (matches(m_chunks[i], query))
+          chunks.push_back(&m_chunks[i]);
+      }
+    }
+  }
+}
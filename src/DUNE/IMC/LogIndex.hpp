@@ -0,0 +1,227 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef DUNE_IMC_LOG_INDEX_HPP_INCLUDED_
+#define DUNE_IMC_LOG_INDEX_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <set>
+#include <string>
+#include <vector>
+#include <istream>
+#include <ostream>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Compression/Methods.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM LogIndex;
+
+    //! Sidecar index of a chunked LSF file. A chunked LSF file is a
+    //! sequence of independently compressed chunks, each holding a
+    //! whole number of messages. The index, stored next to the data
+    //! file with an ".idx" suffix, records for every chunk its
+    //! location, time span and the message identifiers and sources
+    //! (system and entity) it contains, allowing readers to skip
+    //! irrelevant chunks without decompressing them. All index
+    //! fields are stored in little endian byte order.
+    class LogIndex
+    {
+    public:
+      //! Chunk flags.
+      enum ChunkFlags
+      {
+        //! Chunk contents were not inspected, readers must not skip it.
+        CF_OPAQUE = 0x01
+      };
+
+      //! Message source: system and entity.
+      struct Source
+      {
+        //! Wildcard system address.
+        static const uint16_t c_any_system = 0xffff;
+        //! Wildcard entity.
+        static const uint8_t c_any_entity = 0xff;
+
+        //! Source system.
+        uint16_t system;
+        //! Source entity.
+        uint8_t entity;
+
+        Source(uint16_t a_system = c_any_system, uint8_t a_entity = c_any_entity):
+          system(a_system),
+          entity(a_entity)
+        { }
+
+        //! Test if this source, possibly holding wildcards, matches
+        //! another one.
+        //! @param[in] other source.
+        //! @return true if the sources match.
+        bool
+        matches(const Source& other) const
+        {
+          return (system == c_any_system || system == other.system)
+          && (entity == c_any_entity || entity == other.entity);
+        }
+
+        bool
+        operator<(const Source& other) const
+        {
+          if (system != other.system)
+            return system < other.system;
+          return entity < other.entity;
+        }
+
+        bool
+        operator==(const Source& other) const
+        {
+          return system == other.system && entity == other.entity;
+        }
+      };
+
+      //! Chunk descriptor.
+      struct Chunk
+      {
+        //! Offset of the chunk in the data file.
+        uint64_t offset;
+        //! Stored (compressed) length.
+        uint32_t length;
+        //! Uncompressed length.
+        uint32_t size;
+        //! Timestamp of the earliest message.
+        double time_start;
+        //! Timestamp of the latest message.
+        double time_end;
+        //! Number of messages.
+        uint32_t count;
+        //! Chunk flags.
+        uint8_t flags;
+        //! Sorted message identifiers.
+        std::vector<uint16_t> ids;
+        //! Sorted message sources.
+        std::vector<Source> sources;
+
+        Chunk(void):
+          offset(0),
+          length(0),
+          size(0),
+          time_start(0),
+          time_end(0),
+          count(0),
+          flags(0)
+        { }
+      };
+
+      //! Chunk selection criteria. Empty sets match everything.
+      struct Query
+      {
+        //! Earliest timestamp of interest.
+        double time_start;
+        //! Latest timestamp of interest.
+        double time_end;
+        //! Message identifiers of interest.
+        std::set<uint16_t> ids;
+        //! Message sources of interest, which may hold wildcards.
+        std::set<Source> sources;
+
+        Query(void);
+      };
+
+      //! Constructor.
+      LogIndex(void);
+
+      //! Get the index file name of a data file.
+      //! @param[in] data_file data file.
+      //! @return index file name.
+      static std::string
+      getPath(const std::string& data_file);
+
+      //! Write the index header.
+      //! @param[in] os output stream.
+      //! @param[in] method compression method of the data file.
+      static void
+      writeHeader(std::ostream& os, Compression::Methods method);
+
+      //! Append one chunk descriptor.
+      //! @param[in] os output stream.
+      //! @param[in] chunk chunk descriptor.
+      static void
+      writeChunk(std::ostream& os, const Chunk& chunk);
+
+      //! Load an index file. A truncated trailing entry, left behind
+      //! by an interrupted writer, is ignored.
+      //! @param[in] index_file index file name.
+      void
+      load(const std::string& index_file);
+
+      //! Load an index from a stream.
+      //! @param[in] is input stream.
+      void
+      load(std::istream& is);
+
+      //! Get the compression method of the data file.
+      //! @return compression method.
+      Compression::Methods
+      getMethod(void) const
+      {
+        return m_method;
+      }
+
+      //! Get all chunks, in file order.
+      //! @return chunk descriptors.
+      const std::vector<Chunk>&
+      getChunks(void) const
+      {
+        return m_chunks;
+      }
+
+      //! Select the chunks that may contain messages matching a query.
+      //! @param[in] query selection criteria.
+      //! @param[out] chunks selected chunks, in file order.
+      void
+      select(const Query& query, std::vector<const Chunk*>& chunks) const;
+
+    private:
+      //! Compression method of the data file.
+      Compression::Methods m_method;
+      //! Chunks.
+      std::vector<Chunk> m_chunks;
+
+      static bool
+      matches(const Chunk& chunk, const Query& query);
+    };
+  }
+}
+
+#endif
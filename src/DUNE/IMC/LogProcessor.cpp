@@ -0,0 +1,509 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+#include <DUNE/IMC/LogProcessor.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/System/Resources.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Maximum number of messages per batch.
+    static const size_t c_batch_size = 1024;
+    //! Maximum number of decoded batches queued per file.
+    static const size_t c_queue_depth = 4;
+
+    //! Decoded messages of one file, in file order.
+    typedef std::vector<Message*> Batch;
+
+    static void
+    clearBatch(Batch* batch)
+    {
+      for (size_t i = 0; i < batch->size(); ++i)
+        delete (*batch)[i];
+      delete batch;
+    }
+
+    //! Per file state. Fields marked shared are guarded by m_cond,
+    //! the reader is only touched by the worker holding the busy
+    //! flag and the head batch only by the merging thread.
+    struct LogProcessor::Source
+    {
+      //! File path.
+      std::string path;
+      //! File index.
+      unsigned index;
+      //! Timestamp of the first packet (shared).
+      double start;
+      //! True once the first timestamp is known (shared).
+      bool scanned;
+      //! True while the file is being merged (shared).
+      bool active;
+      //! True if the file may be decoded ahead of its activation (shared).
+      bool prefetch;
+      //! True while a worker owns this file (shared).
+      bool busy;
+      //! True when all batches have been produced (shared).
+      bool done;
+      //! Decoded batches waiting for the merger (shared).
+      std::deque<Batch*> queue;
+      //! Reader.
+      LogReader* reader;
+      //! Batch being merged.
+      Batch* head;
+      //! Position in the head batch.
+      size_t pos;
+
+      Source(const std::string& p, unsigned i):
+        path(p),
+        index(i),
+        start(std::numeric_limits<double>::infinity()),
+        scanned(false),
+        active(false),
+        prefetch(false),
+        busy(false),
+        done(false),
+        reader(NULL),
+        head(NULL),
+        pos(0)
+      { }
+
+      ~Source(void)
+      {
+        delete reader;
+
+        if (head != NULL)
+          clearBatch(head);
+
+        while (!queue.empty())
+        {
+          clearBatch(queue.front());
+          queue.pop_front();
+        }
+      }
+
+      //! Timestamp of the next message to merge.
+      double
+      getHeadTime(void) const
+      {
+        return (*head)[pos]->getTimeStamp();
+      }
+    };
+
+    class LogProcessor::Worker: public Concurrency::Thread
+    {
+    public:
+      Worker(LogProcessor& parent):
+        m_parent(parent)
+      { }
+
+    private:
+      LogProcessor& m_parent;
+
+      void
+      run(void)
+      {
+        m_parent.work();
+      }
+    };
+
+    LogProcessor::LogProcessor(unsigned workers):
+      m_worker_count(workers),
+      m_time_start(-std::numeric_limits<double>::infinity()),
+      m_time_end(std::numeric_limits<double>::infinity()),
+      m_handler(NULL),
+      m_stop(false)
+    {
+      if (m_worker_count == 0)
+        m_worker_count = System::Resources::getProcessorCount();
+    }
+
+    LogProcessor::~LogProcessor(void)
+    {
+      clear();
+    }
+
+    unsigned
+    LogProcessor::addFile(const std::string& file)
+    {
+      m_files.push_back(file);
+      return m_files.size() - 1;
+    }
+
+    uint64_t
+    LogProcessor::run(Handler& handler)
+    {
+      clear();
+      m_errors.clear();
+      m_handler = &handler;
+      m_stop = false;
+
+      for (unsigned i = 0; i < m_files.size(); ++i)
+        m_sources.push_back(new Source(m_files[i], i));
+
+      std::vector<Worker*> workers;
+      for (unsigned i = 0; i < m_worker_count; ++i)
+      {
+        workers.push_back(new Worker(*this));
+        workers.back()->start();
+      }
+
+      uint64_t count = 0;
+      std::string error;
+
+      try
+      {
+        count = merge();
+      }
+      catch (std::exception& e)
+      {
+        error = e.what();
+      }
+
+      m_cond.lock();
+      m_stop = true;
+      m_cond.broadcast();
+      m_cond.unlock();
+
+      for (size_t i = 0; i < workers.size(); ++i)
+      {
+        workers[i]->stopAndJoin();
+        delete workers[i];
+      }
+
+      clear();
+      m_handler = NULL;
+
+      if (!error.empty())
+        throw std::runtime_error(error);
+
+      return count;
+    }
+
+    void
+    LogProcessor::clear(void)
+    {
+      for (size_t i = 0; i < m_sources.size(); ++i)
+        delete m_sources[i];
+      m_sources.clear();
+    }
+
+    bool
+    LogProcessor::startsBefore(const Source* a, const Source* b)
+    {
+      return a->start < b->start;
+    }
+
+    LogProcessor::Source*
+    LogProcessor::pickJob(void)
+    {
+      Source* best = NULL;
+
+      for (size_t i = 0; i < m_sources.size(); ++i)
+      {
+        Source* src = m_sources[i];
+        if (src->busy || src->done)
+          continue;
+
+        // Scanning start times comes first, the merger needs all of
+        // them before it can activate any file.
+        if (!src->scanned)
+          return src;
+
+        if (!(src->active || src->prefetch) || src->queue.size() >= c_queue_depth)
+          continue;
+
+        // Files being merged come first, decoding ahead only uses
+        // otherwise idle workers.
+        if (best == NULL || (src->active && !best->active)
+            || (src->active == best->active && src->queue.size() < best->queue.size()))
+          best = src;
+      }
+
+      return best;
+    }
+
+    void
+    LogProcessor::work(void)
+    {
+      while (true)
+      {
+        Source* src = NULL;
+
+        {
+          Concurrency::ScopedCondition c(m_cond);
+          while (!m_stop && (src = pickJob()) == NULL)
+            m_cond.wait(1.0);
+
+          if (m_stop)
+            return;
+
+          src->busy = true;
+        }
+
+        produce(src);
+      }
+    }
+
+    bool
+    LogProcessor::accept(const PacketView& view)
+    {
+      double t = view.getTimeStamp();
+      if (t < m_time_start || t > m_time_end)
+        return false;
+
+      if (!m_ids.empty() && m_ids.find(view.getId()) == m_ids.end())
+        return false;
+
+      return m_handler->filter(view);
+    }
+
+    void
+    LogProcessor::produce(Source* src)
+    {
+      Batch* batch = NULL;
+      bool eof = false;
+      std::string error;
+
+      try
+      {
+        if (src->reader == NULL)
+          src->reader = new LogReader(src->path);
+
+        PacketView view;
+
+        if (!src->scanned)
+        {
+          if (src->reader->next(view))
+          {
+            src->start = view.getTimeStamp();
+            // Reopen on activation, an idle reader should not hold
+            // its buffers while other files are merged.
+            delete src->reader;
+            src->reader = NULL;
+          }
+          else
+          {
+            eof = true;
+          }
+        }
+        else
+        {
+          batch = new Batch;
+          batch->reserve(c_batch_size);
+
+          while (batch->size() < c_batch_size)
+          {
+            if (!src->reader->next(view))
+            {
+              eof = true;
+              break;
+            }
+
+            if (accept(view))
+              batch->push_back(view.decode());
+          }
+        }
+      }
+      catch (std::exception& e)
+      {
+        error = src->path + ": " + e.what();
+        eof = true;
+      }
+
+      if (eof)
+      {
+        delete src->reader;
+        src->reader = NULL;
+      }
+
+      Concurrency::ScopedCondition c(m_cond);
+
+      if (batch != NULL)
+      {
+        if (batch->empty())
+          delete batch;
+        else
+          src->queue.push_back(batch);
+      }
+
+      if (!error.empty())
+        m_errors.push_back(error);
+
+      src->scanned = true;
+      src->done = eof;
+      src->busy = false;
+      m_cond.broadcast();
+    }
+
+    uint64_t
+    LogProcessor::merge(void)
+    {
+      Concurrency::ScopedCondition c(m_cond);
+
+      // Wait for the start times of all files.
+      while (true)
+      {
+        bool scanned = true;
+        for (size_t i = 0; i < m_sources.size(); ++i)
+          scanned = scanned && (m_sources[i]->scanned && !m_sources[i]->busy);
+
+        if (scanned)
+          break;
+
+        m_cond.wait(1.0);
+      }
+
+      // Files that can still produce messages, by start time.
+      std::vector<Source*> pending;
+      for (size_t i = 0; i < m_sources.size(); ++i)
+      {
+        if (!m_sources[i]->done)
+          pending.push_back(m_sources[i]);
+      }
+
+      std::stable_sort(pending.begin(), pending.end(), startsBefore);
+
+      std::vector<Source*> active;
+      size_t next = 0;
+      size_t ahead = 0;
+      uint64_t count = 0;
+
+      while (true)
+      {
+        // Decode the next files ahead of their activation.
+        if (ahead < pending.size() && ahead < next + m_worker_count)
+        {
+          while (ahead < pending.size() && ahead < next + m_worker_count)
+            pending[ahead++]->prefetch = true;
+          m_cond.broadcast();
+        }
+
+        // Ensure every active file has a message ready or is drained.
+        bool ready = true;
+        for (size_t i = 0; i < active.size(); )
+        {
+          Source* src = active[i];
+          if (src->head == NULL && !src->queue.empty())
+          {
+            src->head = src->queue.front();
+            src->pos = 0;
+            src->queue.pop_front();
+            m_cond.broadcast();
+          }
+
+          if (src->head != NULL)
+          {
+            ++i;
+            continue;
+          }
+
+          if (src->done && !src->busy)
+          {
+            src->active = false;
+            active.erase(active.begin() + i);
+            continue;
+          }
+
+          ready = false;
+          ++i;
+        }
+
+        if (!ready)
+        {
+          m_cond.wait(1.0);
+          continue;
+        }
+
+        // Find the earliest message.
+        Source* first = NULL;
+        for (size_t i = 0; i < active.size(); ++i)
+        {
+          if (first == NULL || active[i]->getHeadTime() < first->getHeadTime())
+            first = active[i];
+        }
+
+        // Activate files that start before the merge front.
+        if (next < pending.size()
+            && (first == NULL || pending[next]->start <= first->getHeadTime()))
+        {
+          pending[next]->active = true;
+          active.push_back(pending[next]);
+          ++next;
+          m_cond.broadcast();
+          continue;
+        }
+
+        if (first == NULL)
+          break;
+
+        // Reduce outside the lock, workers keep decoding meanwhile.
+        Message* msg = (*first->head)[first->pos];
+        (*first->head)[first->pos] = NULL;
+
+        m_cond.unlock();
+
+        try
+        {
+          m_handler->reduce(msg, first->index);
+        }
+        catch (...)
+        {
+          delete msg;
+          m_cond.lock();
+          throw;
+        }
+
+        delete msg;
+        ++count;
+
+        m_cond.lock();
+
+        if (++first->pos == first->head->size())
+        {
+          clearBatch(first->head);
+          first->head = NULL;
+        }
+      }
+
+      return count;
+    }
+  }
+}
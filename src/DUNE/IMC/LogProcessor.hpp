@@ -0,0 +1,201 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef DUNE_IMC_LOG_PROCESSOR_HPP_INCLUDED_
+#define DUNE_IMC_LOG_PROCESSOR_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <set>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Condition.hpp>
+#include <DUNE/IMC/LogReader.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM LogProcessor;
+
+    //! Parallel batch processor for LSF files. Worker threads, one
+    //! per processor by default, decompress, frame, filter and
+    //! decode the input files in batches; the calling thread merges
+    //! the decoded streams by timestamp and hands every message to a
+    //! user supplied reduce stage. Files are opened in order of their
+    //! first timestamp: besides the files overlapping the merge front,
+    //! only the next few files (one per worker) are decoded ahead, so
+    //! sequential logs keep all workers busy without every file being
+    //! open at once.
+    class LogProcessor
+    {
+    public:
+      //! User supplied stages.
+      class Handler
+      {
+      public:
+        virtual
+        ~Handler(void)
+        { }
+
+        //! Filter stage, called on worker threads before a packet is
+        //! decoded. Must be thread safe.
+        //! @param[in] view packet view.
+        //! @return true to decode and reduce the packet.
+        virtual bool
+        filter(const PacketView& view)
+        {
+          (void)view;
+          return true;
+        }
+
+        //! Reduce stage, called on the thread executing run(), in
+        //! timestamp order.
+        //! @param[in] msg message, destroyed after the call.
+        //! @param[in] file index of the originating file.
+        virtual void
+        reduce(const Message* msg, unsigned file) = 0;
+      };
+
+      //! Constructor.
+      //! @param[in] workers number of worker threads, zero to use one
+      //! per processor.
+      LogProcessor(unsigned workers = 0);
+
+      //! Destructor.
+      ~LogProcessor(void);
+
+      //! Add an input file.
+      //! @param[in] file LSF file, compressed or not.
+      //! @return index of the file.
+      unsigned
+      addFile(const std::string& file);
+
+      //! Only process messages with the given identifiers.
+      //! @param[in] ids message identifiers, empty to process all.
+      void
+      setMessages(const std::set<uint16_t>& ids)
+      {
+        m_ids = ids;
+      }
+
+      //! Only process messages within a time range.
+      //! @param[in] start earliest timestamp.
+      //! @param[in] end latest timestamp.
+      void
+      setTimeRange(double start, double end)
+      {
+        m_time_start = start;
+        m_time_end = end;
+      }
+
+      //! Get the number of worker threads.
+      //! @return number of worker threads.
+      unsigned
+      getWorkerCount(void) const
+      {
+        return m_worker_count;
+      }
+
+      //! Process all files. Errors reading a file end that file
+      //! early and are reported by getErrors(); exceptions thrown by
+      //! the reduce stage abort processing and are propagated.
+      //! @param[in] handler user stages.
+      //! @return number of reduced messages.
+      uint64_t
+      run(Handler& handler);
+
+      //! Get the errors of the last run.
+      //! @return error messages, one per failed file.
+      const std::vector<std::string>&
+      getErrors(void) const
+      {
+        return m_errors;
+      }
+
+    private:
+      // Forward declarations.
+      struct Source;
+      class Worker;
+
+      //! Number of worker threads.
+      unsigned m_worker_count;
+      //! Input files.
+      std::vector<std::string> m_files;
+      //! Message identifiers of interest.
+      std::set<uint16_t> m_ids;
+      //! Earliest timestamp of interest.
+      double m_time_start;
+      //! Latest timestamp of interest.
+      double m_time_end;
+      //! Errors of the last run.
+      std::vector<std::string> m_errors;
+      //! Per file state of the current run.
+      std::vector<Source*> m_sources;
+      //! Handler of the current run.
+      Handler* m_handler;
+      //! True when workers must exit.
+      bool m_stop;
+      //! Guards the state shared with workers.
+      Concurrency::Condition m_cond;
+
+      static bool
+      startsBefore(const Source* a, const Source* b);
+
+      Source*
+      pickJob(void);
+
+      void
+      work(void);
+
+      void
+      produce(Source* src);
+
+      bool
+      accept(const PacketView& view);
+
+      uint64_t
+      merge(void);
+
+      void
+      clear(void);
+
+      // Non-copyable.
+      LogProcessor(const LogProcessor&);
+
+      LogProcessor&
+      operator=(const LogProcessor&);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,185 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/System/Error.hpp>
+#include <DUNE/Compression/Factory.hpp>
+#include <DUNE/Compression/FileInput.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+#include <DUNE/IMC/LogReader.hpp>
+
+#if defined(DUNE_SYS_HAS_MMAP)
+#  include <sys/mman.h>
+#  include <sys/types.h>
+#  include <sys/stat.h>
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Initial size of the decompression window.
+    static const size_t c_window_size = 1024 * 1024;
+
+    LogReader::LogReader(const std::string& file):
+      m_data(NULL),
+      m_data_size(0),
+      m_mapped(false),
+      m_input(NULL),
+      m_window(c_window_size),
+      m_begin(0),
+      m_end(0)
+    {
+      Compression::Methods method = Compression::Factory::detect(file.c_str());
+
+      if (method != Compression::METHOD_UNKNOWN)
+      {
+        m_input = new Compression::FileInput(file.c_str(), method);
+        m_data = m_window.getBuffer();
+        return;
+      }
+
+#if defined(DUNE_SYS_HAS_MMAP)
+      int fd = open(file.c_str(), O_RDONLY);
+      if (fd < 0)
+        throw System::Error(errno, "opening log", file);
+
+      struct stat st;
+      if (fstat(fd, &st) != 0)
+      {
+        int error = errno;
+        ::close(fd);
+        throw System::Error(error, "opening log", file);
+      }
+
+      m_data_size = st.st_size;
+      if (m_data_size > 0)
+      {
+        void* addr = mmap(NULL, m_data_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED)
+        {
+          int error = errno;
+          ::close(fd);
+          throw System::Error(error, "mapping log", file);
+        }
+
+        madvise(addr, m_data_size, MADV_SEQUENTIAL);
+        m_data = static_cast<const uint8_t*>(addr);
+        m_mapped = true;
+      }
+
+      ::close(fd);
+#else
+      std::ifstream ifs(file.c_str(), std::ios::binary);
+      if (!ifs.is_open())
+        throw System::Error(errno, "opening log", file);
+
+      ifs.seekg(0, std::ios::end);
+      m_data_size = ifs.tellg();
+      ifs.seekg(0, std::ios::beg);
+      m_window.setSize(m_data_size);
+      ifs.read(m_window.getBufferSigned(), m_data_size);
+      m_data = m_window.getBuffer();
+#endif
+
+      m_end = m_data_size;
+    }
+
+    LogReader::~LogReader(void)
+    {
+#if defined(DUNE_SYS_HAS_MMAP)
+      if (m_mapped)
+        munmap(const_cast<uint8_t*>(m_data), m_data_size);
+#endif
+
+      delete m_input;
+    }
+
+    size_t
+    LogReader::fill(size_t size)
+    {
+      size_t avail = m_end - m_begin;
+      if (avail >= size || m_input == NULL)
+        return avail;
+
+      // Slide remaining bytes to the start of the window.
+      uint8_t* bfr = m_window.getBuffer();
+      std::memmove(bfr, bfr + m_begin, avail);
+      m_begin = 0;
+      m_end = avail;
+
+      if (m_window.getCapacity() < size)
+        m_window.grow(size);
+
+      bfr = m_window.getBuffer();
+      m_data = bfr;
+
+      while (m_end < size && !m_input->eof())
+      {
+        m_input->read((char*)bfr + m_end, m_window.getCapacity() - m_end);
+        std::streamsize n = m_input->gcount();
+        if (n <= 0)
+          break;
+
+        m_end += n;
+      }
+
+      return m_end;
+    }
+
+    bool
+    LogReader::next(PacketView& view)
+    {
+      size_t avail = fill(DUNE_IMC_CONST_HEADER_SIZE);
+      if (avail == 0)
+        return false;
+
+      if (avail < DUNE_IMC_CONST_HEADER_SIZE)
+        throw BufferTooShort();
+
+      Packet::deserializeHeader(view.m_header, current(), DUNE_IMC_CONST_HEADER_SIZE);
+
+      size_t size = view.getSize();
+      if (fill(size) < size)
+        throw BufferTooShort();
+
+      view.m_data = current();
+      m_begin += size;
+      return true;
+    }
+  }
+}
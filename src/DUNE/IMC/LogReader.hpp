@@ -0,0 +1,238 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef DUNE_IMC_LOG_READER_HPP_INCLUDED_
+#define DUNE_IMC_LOG_READER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Utils/ByteBuffer.hpp>
+#include <DUNE/IMC/Constants.hpp>
+#include <DUNE/IMC/Header.hpp>
+#include <DUNE/IMC/Packet.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    // Forward declaration.
+    class FileInput;
+  }
+
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM PacketView;
+    class DUNE_DLL_SYM LogReader;
+
+    //! Non-owning view of one serialized packet. The header is
+    //! decoded eagerly, the payload is only decoded (and its CRC
+    //! checked) when decode() is called.
+    class PacketView
+    {
+    public:
+      PacketView(void):
+        m_data(NULL)
+      { }
+
+      //! Get the packet header.
+      //! @return packet header.
+      const Header&
+      getHeader(void) const
+      {
+        return m_header;
+      }
+
+      //! Get the message identification number.
+      //! @return message identification number.
+      uint16_t
+      getId(void) const
+      {
+        return m_header.mgid;
+      }
+
+      //! Get the message timestamp.
+      //! @return timestamp.
+      double
+      getTimeStamp(void) const
+      {
+        return m_header.timestamp;
+      }
+
+      //! Get the source address.
+      //! @return source address.
+      uint16_t
+      getSource(void) const
+      {
+        return m_header.src;
+      }
+
+      //! Get the source entity.
+      //! @return source entity.
+      uint8_t
+      getSourceEntity(void) const
+      {
+        return m_header.src_ent;
+      }
+
+      //! Get the serialized packet.
+      //! @return pointer to the first byte of the packet.
+      const uint8_t*
+      getData(void) const
+      {
+        return m_data;
+      }
+
+      //! Get the size of the serialized packet.
+      //! @return packet size.
+      size_t
+      getSize(void) const
+      {
+        return DUNE_IMC_CONST_HEADER_SIZE + m_header.size + DUNE_IMC_CONST_FOOTER_SIZE;
+      }
+
+      //! Get the serialized payload.
+      //! @return pointer to the first byte of the payload.
+      const uint8_t*
+      getPayload(void) const
+      {
+        return m_data + DUNE_IMC_CONST_HEADER_SIZE;
+      }
+
+      //! Get the size of the serialized payload.
+      //! @return payload size.
+      uint16_t
+      getPayloadSize(void) const
+      {
+        return m_header.size;
+      }
+
+      //! Materialize the message.
+      //! @return new message object, owned by the caller.
+      Message*
+      decode(void) const
+      {
+        return Packet::deserializePayload(m_header, m_data, getSize(), NULL);
+      }
+
+      //! Decode the message into an existing object of the same type,
+      //! avoiding any allocation.
+      //! @param[out] msg message object.
+      void
+      decode(Message& msg) const
+      {
+        Packet::deserializePayload(m_header, m_data, getSize(), &msg);
+      }
+
+    private:
+      //! Decoded header.
+      Header m_header;
+      //! Serialized packet.
+      const uint8_t* m_data;
+
+      friend class LogReader;
+    };
+
+    //! Sequential LSF reader that yields packet views without
+    //! allocating per message. Uncompressed files are memory mapped
+    //! where supported; compressed files are decompressed into a
+    //! sliding window. A view remains valid until the next call to
+    //! next().
+    class LogReader
+    {
+    public:
+      //! Open a log file, detecting its compression method.
+      //! @param[in] file LSF file.
+      explicit LogReader(const std::string& file);
+
+      //! Destructor.
+      ~LogReader(void);
+
+      //! Advance to the next packet.
+      //! @param[out] view packet view.
+      //! @return true if a packet is available, false at the end of
+      //! the file.
+      //! @throw BufferTooShort if the file ends in a partial packet.
+      bool
+      next(PacketView& view);
+
+      //! Check if the file is memory mapped.
+      //! @return true if the file is memory mapped.
+      bool
+      isMapped(void) const
+      {
+        return m_mapped;
+      }
+
+    private:
+      //! Whole file contents, if mapped or loaded at once.
+      const uint8_t* m_data;
+      //! Size of the whole file contents.
+      size_t m_data_size;
+      //! True if m_data is a memory mapping.
+      bool m_mapped;
+      //! Decompressing input, for compressed files.
+      Compression::FileInput* m_input;
+      //! Sliding window over decompressed data or whole file buffer.
+      Utils::ByteBuffer m_window;
+      //! Read position.
+      size_t m_begin;
+      //! End of valid data.
+      size_t m_end;
+
+      //! Make at least a given number of bytes available at the read
+      //! position.
+      //! @param[in] size number of bytes.
+      //! @return number of available bytes, which may be less than
+      //! requested only at the end of the file.
+      size_t
+      fill(size_t size);
+
+      //! Get the read position.
+      //! @return pointer to the read position.
+      const uint8_t*
+      current(void) const
+      {
+        return m_data + m_begin;
+      }
+
+      // Non-copyable.
+      LogReader(const LogReader&);
+
+      LogReader&
+      operator=(const LogReader&);
+    };
+  }
+}
+
+#endif
@@ -32,17 +32,22 @@
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/AtomicCounter.hpp>
 #include <DUNE/Time/Clock.hpp>
 #include <DUNE/IMC/Constants.hpp>
 #include <DUNE/IMC/Header.hpp>
 #include <DUNE/IMC/Packet.hpp>
 #include <DUNE/IMC/AddressResolver.hpp>
+#include <DUNE/IMC/JSON.hpp>
 
 namespace DUNE
 {
   //! Implementation of the %IMC API
   namespace IMC
   {
+    // Forward declarations.
+    class SharedMessage;
+
     // Export symbol.
     class DUNE_DLL_SYM Message;
 
@@ -60,6 +65,22 @@ namespace DUNE
         m_header.timestamp = -1.0;
       }
 
+      //! Copy constructor. The reference count is not copied.
+      //! @param[in] other message to copy.
+      Message(const Message& other):
+        m_header(other.m_header)
+      { }
+
+      //! Assignment operator. The reference count is not copied.
+      //! @param[in] other message to copy.
+      //! @return reference to this message.
+      Message&
+      operator=(const Message& other)
+      {
+        m_header = other.m_header;
+        return *this;
+      }
+
       //! Default destructor.
       virtual
       ~Message(void)
@@ -186,6 +207,15 @@ namespace DUNE
         setDestinationEntityNested(dst_ent);
       }
 
+      //! Test if the message has a sub identification number (id field).
+      //! @return true if the message has a sub identification number,
+      //! false otherwise.
+      virtual bool
+      hasSubId(void) const
+      {
+        return false;
+      }
+
       //! Retrieve message's sub identification number (id field).
       //! @return message's sub identification number.
       virtual uint16_t
@@ -263,6 +293,14 @@ namespace DUNE
       void
       toJSON(std::ostream& os) const;
 
+      //! Append the message to a compact JSON writer.
+      //! @param w JSON writer.
+      void
+      toJSON(JSONWriter& w) const
+      {
+        w.write(*this);
+      }
+
       //! Output the message in human readable text.
       //! @param os output stream.
       void
@@ -298,6 +336,30 @@ namespace DUNE
         (void)indent_level;
       }
 
+      //! Append the message fields (excluding header) to a compact
+      //! JSON writer.
+      //! @param w JSON writer.
+      virtual void
+      fieldsToJSON(JSONWriter& w) const
+      {
+        (void)w;
+      }
+
+      //! Read the value of a message field from JSON.
+      //! @param key field name.
+      //! @param size size of field name.
+      //! @param r JSON reader.
+      //! @return true if the field was read, false if the message
+      //! has no such field.
+      virtual bool
+      fieldFromJSON(const char* key, unsigned size, JSONReader& r)
+      {
+        (void)key;
+        (void)size;
+        (void)r;
+        return false;
+      }
+
       //! Compare messages for equality.
       //! @param[in] other message to compare.
       //! @return true if messages are equal, false otherwise.
@@ -366,6 +428,12 @@ namespace DUNE
         (void)other;
         return true;
       }
+
+    private:
+      friend class SharedMessage;
+
+      //! Number of SharedMessage handles referencing this message.
+      mutable Concurrency::AtomicCounter m_refs;
     };
   }
 }
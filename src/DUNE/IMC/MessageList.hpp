@@ -356,6 +356,62 @@ namespace DUNE
         os << "]";
       }
 
+      //! Append the list to a compact JSON writer.
+      //! @param[in] w JSON writer.
+      //! @param[in] key key literal, including separator and colon.
+      template <size_t N>
+      void
+      toJSON(JSONWriter& w, const char (&key)[N]) const
+      {
+        w.put(key);
+        w.put('[');
+
+        for (unsigned i = 0; i < m_list.size(); ++i)
+        {
+          if (i != 0)
+            w.put(',');
+
+          if (m_list[i] == NULL)
+          {
+            w.put("null");
+          }
+          else
+          {
+            w.put("{\"abbrev\":");
+            w.write(m_list[i]->getName());
+            m_list[i]->fieldsToJSON(w);
+            w.put('}');
+          }
+        }
+
+        w.put(']');
+      }
+
+      //! Read the list from JSON.
+      //! @param[in] r JSON reader.
+      void
+      fromJSON(JSONReader& r)
+      {
+        clear();
+        r.expect('[');
+
+        if (r.consume(']'))
+          return;
+
+        do
+        {
+          Type* msg = static_cast<Type*>(r.readMessage());
+
+          if (msg != NULL && m_parent != NULL)
+            synchronizeHeader(msg);
+
+          m_list.push_back(msg);
+        }
+        while (r.consume(','));
+
+        r.expect(']');
+      }
+
       void
       setTimeStamp(double value)
       {
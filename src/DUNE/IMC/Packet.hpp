@@ -91,8 +91,19 @@ namespace DUNE
       static void
       deserializeHeader(Header& hdr, const uint8_t* bfr, uint16_t bfr_len);
 
+      //! Deserialize the payload of a packet whose header was
+      //! already deserialized.
+      //! @param[in] hdr packet header.
+      //! @param[in] bfr packet.
+      //! @param[in] bfr_len packet size.
+      //! @param[in] msg message object, NULL to create one.
+      //! @param[in] check_crc false to skip the CRC, for packets
+      //! that went through media that guarantee integrity. The CRC
+      //! need not be present in the packet.
+      //! @return message object.
       static Message*
-      deserializePayload(const Header& hdr, const uint8_t* bfr, uint16_t bfr_len, Message* msg);
+      deserializePayload(const Header& hdr, const uint8_t* bfr, uint16_t bfr_len, Message* msg,
+                         bool check_crc = true);
     };
   }
 }
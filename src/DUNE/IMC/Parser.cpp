@@ -27,14 +27,87 @@
 // Author: Eduardo Marques                                                  *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+
 // DUNE headers.
+#include <DUNE/Algorithms/CRC16.hpp>
 #include <DUNE/IMC/Parser.hpp>
 #include <DUNE/IMC/Packet.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+#include <DUNE/Utils/ByteCopy.hpp>
 
 namespace DUNE
 {
   namespace IMC
   {
+    //! First byte of the synchronization number in big-endian order.
+    static const uint8_t c_sync_msb = (DUNE_IMC_CONST_SYNC >> 8) & 0xff;
+    //! Second byte of the synchronization number in big-endian order.
+    static const uint8_t c_sync_lsb = DUNE_IMC_CONST_SYNC & 0xff;
+    //! Size of header and footer.
+    static const unsigned c_overhead = DUNE_IMC_CONST_HEADER_SIZE + DUNE_IMC_CONST_FOOTER_SIZE;
+
+    //! Test if two bytes are a synchronization number in any byte order.
+    static inline bool
+    isSync(const uint8_t* p)
+    {
+      return (p[0] == c_sync_msb && p[1] == c_sync_lsb)
+      || (p[0] == c_sync_lsb && p[1] == c_sync_msb);
+    }
+
+    //! Find the first possible synchronization number. Both byte
+    //! orders contain c_sync_msb, so a single memchr() pass finds
+    //! every candidate.
+    //! @param[in] p data.
+    //! @param[in] n number of bytes.
+    //! @return offset of the synchronization number, of a trailing
+    //! byte that may start one or n if there is none.
+    static unsigned
+    findSync(const uint8_t* p, unsigned n)
+    {
+      const uint8_t* s = p;
+      const uint8_t* e = p + n;
+
+      while (s < e)
+      {
+        const uint8_t* f = static_cast<const uint8_t*>(std::memchr(s, c_sync_msb, e - s));
+        if (f == NULL)
+          break;
+
+        if (f > p && f[-1] == c_sync_lsb)
+          return f - p - 1;
+
+        if (f + 1 == e || f[1] == c_sync_lsb)
+          return f - p;
+
+        s = f + 1;
+      }
+
+      if (n > 0 && p[n - 1] == c_sync_lsb)
+        return n - 1;
+
+      return n;
+    }
+
+    //! Check the CRC of a complete packet.
+    //! @param[in] hdr packet header.
+    //! @param[in] p packet.
+    //! @return true if valid, false otherwise.
+    static bool
+    checkCrc(const Header& hdr, const uint8_t* p)
+    {
+      uint16_t rcrc = 0;
+
+      if (hdr.sync == DUNE_IMC_CONST_SYNC_REV)
+        Utils::ByteCopy::rcopy(rcrc, p + DUNE_IMC_CONST_HEADER_SIZE + hdr.size);
+      else
+        Utils::ByteCopy::copy(rcrc, p + DUNE_IMC_CONST_HEADER_SIZE + hdr.size);
+
+      return Algorithms::CRC16::compute(p, DUNE_IMC_CONST_HEADER_SIZE + hdr.size) == rcrc;
+    }
+
     Parser::Parser(void)
     {
       reset();
@@ -46,91 +119,186 @@ namespace DUNE
     void
     Parser::reset(void)
     {
-      m_stage = c_sync;
-      m_pos = 0;
+      m_data = NULL;
+      m_size = 0;
+      m_offset = 0;
       m_buf.clear();
+      m_release = 0;
+      m_candidate_buf = false;
+      m_candidate_size = 0;
     }
 
     Message*
     Parser::parse(uint8_t byte)
     {
-      Message* m = 0;
-      m_buf.push_back(byte);
+      feed(&byte, 1);
+      Message* m = nextMessage();
 
-      while (true)
-      {
-        int n = m_buf.size() - m_pos;
+      // The byte must not outlive this call.
+      feed(NULL, 0);
+      return m;
+    }
 
-        if (!n)
+    void
+    Parser::feed(const uint8_t* data, unsigned size)
+    {
+      if (m_offset < m_size)
+      {
+        bool empty = m_buf.size() == m_release;
+        m_buf.insert(m_buf.end(), m_data + m_offset, m_data + m_size);
+        if (empty)
         {
-          reset(); // discard unneeded data
-          break;
+          m_buf.erase(m_buf.begin(), m_buf.begin() + m_release);
+          m_release = 0;
+          trim();
         }
+      }
 
-        if (m_stage == c_sync)
-        {
-          // This would not be stricly necessary but is more efficient
-          // than  handling recurrent exceptions from Packet::deserializeHeader
-          if (n == 1)
-          {
-            break; // need more data
-          }
-
-          uint16_t sync = (m_buf[m_pos] << 8) | m_buf[m_pos + 1];
-
-          if (sync != DUNE_IMC_CONST_SYNC && sync != DUNE_IMC_CONST_SYNC_REV)
-          {
-            m_pos++; // invalid sync, advance
-            continue;
-          }
-          m_stage = c_header; // sync is ok, get rest of header
-        }
+      m_data = data;
+      m_size = size;
+      m_offset = 0;
+    }
 
-        if (m_stage == c_header)
+    bool
+    Parser::nextPacket(Header& hdr, const uint8_t*& packet, unsigned& size)
+    {
+      while (findCandidate(hdr, packet))
+      {
+        if (checkCrc(hdr, packet))
         {
-          if (n < DUNE_IMC_CONST_HEADER_SIZE)
-            break;  // need more data
-
-          try
-          {
-            Packet::deserializeHeader(m_header, &m_buf[m_pos], n);
-          }
-          catch (...)
-          {
-            m_stage = c_sync;
-            ++m_pos; // try to find sync again from current position
-            continue;
-          }
-          m_stage = c_payload; // done with header
+          size = m_candidate_size;
+          accept();
+          return true;
         }
 
-        // on to c_payload stage
+        reject();
+      }
 
-        if (n < (int)(m_header.size + DUNE_IMC_CONST_HEADER_SIZE + DUNE_IMC_CONST_FOOTER_SIZE))
-          break;  // need more data
+      return false;
+    }
 
-        // all payload data available
-        m_stage = c_sync; // the next stage in any case
+    Message*
+    Parser::nextMessage(void)
+    {
+      Header hdr;
+      const uint8_t* packet = NULL;
 
+      while (findCandidate(hdr, packet))
+      {
         try
         {
-          m = Packet::deserializePayload(m_header, &m_buf[m_pos], n, 0);
+          Message* m = Packet::deserializePayload(hdr, packet, m_candidate_size, 0);
+          accept();
+          return m;
+        }
+        catch (InvalidCrc&)
+        {
+          reject();
         }
         catch (...)
         {
-          ++m_pos; // try to find sync again from current position
+          // Valid packet that cannot be decoded.
+          accept();
+        }
+      }
+
+      return NULL;
+    }
+
+    bool
+    Parser::findCandidate(Header& hdr, const uint8_t*& packet)
+    {
+      if (m_release > 0)
+      {
+        m_buf.erase(m_buf.begin(), m_buf.begin() + m_release);
+        m_release = 0;
+        trim();
+      }
+
+      while (!m_buf.empty())
+      {
+        if (m_buf.size() >= 2 && !isSync(&m_buf[0]))
+        {
+          m_buf.erase(m_buf.begin());
+          trim();
           continue;
         }
 
-        m_pos += n;
+        unsigned need = DUNE_IMC_CONST_HEADER_SIZE;
+        if (m_buf.size() >= need)
+        {
+          Packet::deserializeHeader(hdr, &m_buf[0], DUNE_IMC_CONST_HEADER_SIZE);
+          need = hdr.size + c_overhead;
+        }
 
-        if (m_pos == m_buf.size())
-          reset();  // discard unneeded data
+        if (m_buf.size() < need)
+        {
+          unsigned n = std::min(need - (unsigned)m_buf.size(), m_size - m_offset);
+          if (n == 0)
+            return false;
+
+          m_buf.insert(m_buf.end(), m_data + m_offset, m_data + m_offset + n);
+          m_offset += n;
+          continue;
+        }
 
-        break;
+        packet = &m_buf[0];
+        m_candidate_buf = true;
+        m_candidate_size = need;
+        return true;
       }
 
-      return m;
+      m_offset += findSync(m_data + m_offset, m_size - m_offset);
+      unsigned avail = m_size - m_offset;
+
+      if (avail >= DUNE_IMC_CONST_HEADER_SIZE)
+      {
+        Packet::deserializeHeader(hdr, m_data + m_offset, DUNE_IMC_CONST_HEADER_SIZE);
+        if (avail >= hdr.size + c_overhead)
+        {
+          packet = m_data + m_offset;
+          m_candidate_buf = false;
+          m_candidate_size = hdr.size + c_overhead;
+          return true;
+        }
+      }
+
+      // Keep the partial packet for the next block.
+      m_buf.insert(m_buf.end(), m_data + m_offset, m_data + m_size);
+      m_offset = m_size;
+      return false;
+    }
+
+    void
+    Parser::accept(void)
+    {
+      if (m_candidate_buf)
+        m_release = m_candidate_size;
+      else
+        m_offset += m_candidate_size;
+    }
+
+    void
+    Parser::reject(void)
+    {
+      if (m_candidate_buf)
+      {
+        m_buf.erase(m_buf.begin());
+        trim();
+      }
+      else
+      {
+        ++m_offset;
+      }
+    }
+
+    void
+    Parser::trim(void)
+    {
+      if (m_buf.empty())
+        return;
+
+      m_buf.erase(m_buf.begin(), m_buf.begin() + findSync(&m_buf[0], m_buf.size()));
     }
   }
 }
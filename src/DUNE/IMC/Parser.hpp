@@ -43,7 +43,20 @@ namespace DUNE
     // Export DLL Symbol.
     class DUNE_DLL_SYM Parser;
 
-    //! Parser class.
+    //! IMC stream parser. Data is fed in blocks and complete packets
+    //! are framed directly in the caller's buffer; only the bytes of
+    //! a packet split across blocks are copied to an internal buffer.
+    //!
+    //! Usage:
+    //! @code
+    //! Message* msg = NULL;
+    //! parser.feed(data, size);
+    //! while ((msg = parser.nextMessage()) != NULL)
+    //! {
+    //!   ...
+    //!   delete msg;
+    //! }
+    //! @endcode
     class Parser
     {
     public:
@@ -53,7 +66,7 @@ namespace DUNE
       //! Destructor.
       ~Parser(void);
 
-      //! Reset parser.
+      //! Reset parser, discarding any partial packet.
       void
       reset(void);
 
@@ -63,19 +76,69 @@ namespace DUNE
       Message*
       parse(uint8_t byte);
 
+      //! Provide a block of data. The block must remain valid until
+      //! nextPacket() or nextMessage() return no more packets, bytes
+      //! not consumed by then are copied on the next call to feed().
+      //! @param[in] data data block.
+      //! @param[in] size number of bytes in data.
+      void
+      feed(const uint8_t* data, unsigned size);
+
+      //! Retrieve the next complete packet with a valid CRC.
+      //! @param[out] hdr packet header.
+      //! @param[out] packet first byte of the packet, valid until the
+      //! next call to any other member function.
+      //! @param[out] size packet size, including header and footer.
+      //! @return true if a packet was found, false if more data is
+      //! needed.
+      bool
+      nextPacket(Header& hdr, const uint8_t*& packet, unsigned& size);
+
+      //! Retrieve the next message. Corrupted packets and packets
+      //! that cannot be deserialized are skipped.
+      //! @return message (owned by the caller) or NULL if more data is
+      //! needed.
+      Message*
+      nextMessage(void);
+
     private:
-      //! Parser stage constants.
-      enum ParserStage
-      {
-        c_sync,
-        c_header,
-        c_payload
-      };
-
-      ParserStage m_stage; //!< Parser stage.
-      std::vector<uint8_t> m_buf; //!< Internal buffer.
-      unsigned int m_pos; //!< Buffer position.
-      Header m_header; //!< Holds parsed header (c_payload stage).
+      //! Data block given to feed().
+      const uint8_t* m_data;
+      //! Size of data block.
+      unsigned m_size;
+      //! Bytes of the data block already consumed.
+      unsigned m_offset;
+      //! Bytes of a packet split across blocks, always starting at a
+      //! possible synchronization number.
+      std::vector<uint8_t> m_buf;
+      //! Bytes of m_buf to discard before framing again.
+      unsigned m_release;
+      //! True if the current candidate packet lies in m_buf.
+      bool m_candidate_buf;
+      //! Size of the current candidate packet.
+      unsigned m_candidate_size;
+
+      //! Find the next candidate packet: a synchronization number
+      //! followed by enough data for the size given in the header.
+      //! @param[out] hdr packet header.
+      //! @param[out] packet first byte of the packet.
+      //! @return true if found, false if more data is needed.
+      bool
+      findCandidate(Header& hdr, const uint8_t*& packet);
+
+      //! Consume the current candidate packet.
+      void
+      accept(void);
+
+      //! Discard the first byte of the current candidate packet and
+      //! look for synchronization again.
+      void
+      reject(void);
+
+      //! Discard bytes of m_buf before the first synchronization
+      //! number.
+      void
+      trim(void);
     };
   }
 }
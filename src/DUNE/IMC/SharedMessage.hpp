@@ -0,0 +1,235 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef DUNE_IMC_SHARED_MESSAGE_HPP_INCLUDED_
+#define DUNE_IMC_SHARED_MESSAGE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Message.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export symbol.
+    class DUNE_DLL_SYM SharedMessage;
+
+    //! Reference counted handle to an immutable message. Copying a
+    //! handle only increments the reference count of the message,
+    //! which allows the same message object to be delivered to any
+    //! number of consumers. The message is deleted when the last
+    //! handle referencing it is destroyed. Handles that need to
+    //! modify the message must use getMutable(), which makes a
+    //! private copy if the message is shared (copy-on-write).
+    class SharedMessage
+    {
+    public:
+      //! Create a null handle.
+      SharedMessage(void):
+        m_msg(NULL)
+      { }
+
+      //! Create a handle that takes ownership of a message. The
+      //! message must not be referenced by other handles and must
+      //! have been allocated with new.
+      //! @param[in] msg message object.
+      explicit
+      SharedMessage(Message* msg):
+        m_msg(msg)
+      {
+        acquire();
+      }
+
+      //! Copy constructor.
+      //! @param[in] other handle to copy.
+      SharedMessage(const SharedMessage& other):
+        m_msg(other.m_msg)
+      {
+        acquire();
+      }
+
+      //! Destructor.
+      ~SharedMessage(void)
+      {
+        release();
+      }
+
+      //! Assignment operator.
+      //! @param[in] other handle to copy.
+      //! @return reference to this handle.
+      SharedMessage&
+      operator=(const SharedMessage& other)
+      {
+        if (m_msg != other.m_msg)
+        {
+          release();
+          m_msg = other.m_msg;
+          acquire();
+        }
+
+        return *this;
+      }
+
+      //! Create a handle to a copy of a given message.
+      //! @param[in] msg message to copy.
+      //! @return handle to the message copy.
+      static SharedMessage
+      copy(const Message& msg)
+      {
+        return SharedMessage(msg.clone());
+      }
+
+      //! Test if the handle does not reference a message.
+      //! @return true if the handle is null, false otherwise.
+      bool
+      isNull(void) const
+      {
+        return m_msg == NULL;
+      }
+
+      //! Test if this is the only handle referencing the message.
+      //! @return true if the message is not shared, false otherwise.
+      bool
+      unique(void) const
+      {
+        return (m_msg != NULL) && (m_msg->m_refs.add(0) == 1);
+      }
+
+      //! Release the referenced message.
+      void
+      reset(void)
+      {
+        release();
+        m_msg = NULL;
+      }
+
+      //! Release the referenced message without decrementing its
+      //! reference count. The caller becomes the owner of that
+      //! reference and must eventually pass it to adopt().
+      //! @return message or NULL if the handle is null.
+      Message*
+      detach(void)
+      {
+        Message* msg = m_msg;
+        m_msg = NULL;
+        return msg;
+      }
+
+      //! Create a handle that takes over a reference previously
+      //! released with detach().
+      //! @param[in] msg message object.
+      //! @return message handle.
+      static SharedMessage
+      adopt(Message* msg)
+      {
+        SharedMessage handle;
+        handle.m_msg = msg;
+        return handle;
+      }
+
+      //! Retrieve a read-only view of the message.
+      //! @return message or NULL if the handle is null.
+      const Message*
+      get(void) const
+      {
+        return m_msg;
+      }
+
+      //! Retrieve a read-only view of the message with a given type.
+      //! @tparam M message type.
+      //! @return message or NULL if the handle is null.
+      template <typename M>
+      const M*
+      get(void) const
+      {
+        return static_cast<const M*>(m_msg);
+      }
+
+      //! Retrieve a modifiable message. If the message is referenced
+      //! by other handles a private copy is made first, other
+      //! handles are not affected.
+      //! @return message or NULL if the handle is null.
+      Message*
+      getMutable(void)
+      {
+        if (m_msg != NULL && !unique())
+          *this = SharedMessage(m_msg->clone());
+
+        return m_msg;
+      }
+
+      //! Retrieve a modifiable message with a given type. See
+      //! getMutable().
+      //! @tparam M message type.
+      //! @return message or NULL if the handle is null.
+      template <typename M>
+      M*
+      getMutable(void)
+      {
+        return static_cast<M*>(getMutable());
+      }
+
+      const Message*
+      operator->(void) const
+      {
+        return m_msg;
+      }
+
+      const Message&
+      operator*(void) const
+      {
+        return *m_msg;
+      }
+
+    private:
+      //! Referenced message.
+      Message* m_msg;
+
+      void
+      acquire(void)
+      {
+        if (m_msg != NULL)
+          m_msg->m_refs.add(1);
+      }
+
+      void
+      release(void)
+      {
+        if (m_msg != NULL && m_msg->m_refs.sub(1) == 0)
+          delete m_msg;
+      }
+    };
+  }
+}
+
+#endif
@@ -29,11 +29,13 @@
 
 // ISO C++ 98 headers.
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
 #include <DUNE/System/Error.hpp>
+#include <DUNE/Time/Clock.hpp>
 #include <DUNE/Time/Constants.hpp>
 #include <DUNE/Time/Utils.hpp>
 #include <DUNE/IO/Poll.hpp>
@@ -45,6 +47,42 @@ namespace DUNE
     using std::memset;
     using System::Error;
 
+    //! Registers a poll with the clock source, if one is installed,
+    //! so that a thread blocked on I/O does not hold time back. The
+    //! poll itself is not interrupted by the source: once the source
+    //! reaches the deadline the thread counts as running again until
+    //! the poll returns.
+    class PollWaiter: public Time::ClockSource::Waiter
+    {
+    public:
+      PollWaiter(double timeout):
+        Time::ClockSource::Waiter(NULL, c_forever),
+        m_source(Time::Clock::getSource())
+      {
+        if (m_source == NULL)
+          return;
+
+        if (timeout >= 0)
+          deadline = m_source->getNsec() + static_cast<uint64_t>(std::ceil(timeout * Time::c_nsec_per_sec_fp));
+
+        m_source->addWaiter(*this);
+      }
+
+      ~PollWaiter(void)
+      {
+        if (m_source != NULL)
+          m_source->removeWaiter(*this);
+      }
+
+      void
+      wake(void)
+      { }
+
+    private:
+      //! Clock source.
+      Time::ClockSource* m_source;
+    };
+
     void
     Poll::add(const NativeHandle& handle)
     {
@@ -82,6 +120,8 @@ namespace DUNE
     bool
     Poll::poll(double timeout)
     {
+      PollWaiter waiter(timeout);
+
 #if defined(DUNE_OS_WINDOWS)
       DWORD count = m_handles.size();
       m_rv = WaitForMultipleObjects(count, &m_handles[0], FALSE, timeout * 1000);
@@ -139,6 +179,8 @@ namespace DUNE
     bool
     Poll::poll(const NativeHandle& handle, double timeout)
     {
+      PollWaiter waiter(timeout);
+
 #if defined(DUNE_OS_WINDOWS)
       DWORD rv = WaitForSingleObjectEx(handle, timeout * 1000, FALSE);
       return rv == WAIT_OBJECT_0;
@@ -0,0 +1,390 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/System/Error.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/Delay.hpp>
+#include <DUNE/IO/Reactor.hpp>
+
+#if defined(DUNE_SYS_HAS_EPOLL_CREATE1) && defined(DUNE_SYS_HAS_EVENTFD)
+#  define DUNE_IO_REACTOR_EPOLL
+#  include <sys/epoll.h>
+#  include <sys/eventfd.h>
+#  include <unistd.h>
+#endif
+
+namespace DUNE
+{
+  namespace IO
+  {
+    using System::Error;
+
+    //! Maximum number of events retrieved at once.
+    static const int c_max_events = 16;
+    //! Polling slice, in seconds, of the portable implementation.
+    static const double c_slice = 0.005;
+
+    //! Remove a handle from a list of handles.
+    //! @param[in] list list of handles.
+    //! @param[in] handle handle to remove.
+    //! @return true if the handle was in the list, false otherwise.
+    static bool
+    eraseHandle(std::vector<NativeHandle>& list, const NativeHandle& handle)
+    {
+      std::vector<NativeHandle>::iterator itr = std::find(list.begin(), list.end(), handle);
+      if (itr == list.end())
+        return false;
+
+      list.erase(itr);
+      return true;
+    }
+
+#if defined(DUNE_IO_REACTOR_EPOLL)
+    //! Reactor wait registered with a clock source. The source wakes
+    //! the reactor up when the deadline is reached or when wakeUp()
+    //! notifies it.
+    class ReactorWaiter: public Time::ClockSource::Waiter
+    {
+    public:
+      ReactorWaiter(uint64_t dl, Reactor& reactor):
+        Time::ClockSource::Waiter(&reactor, dl),
+        m_reactor(reactor)
+      { }
+
+      void
+      wake(void)
+      {
+        m_reactor.interrupt();
+      }
+
+    private:
+      Reactor& m_reactor;
+    };
+
+    Reactor::Reactor(void):
+      m_pending(0),
+      m_woken(false),
+      m_epoll(-1),
+      m_event(-1)
+    {
+      m_epoll = epoll_create1(EPOLL_CLOEXEC);
+      if (m_epoll < 0)
+        throw Error("creating epoll instance", Error::getLastMessage());
+
+      m_event = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+      if (m_event < 0)
+      {
+        ::close(m_epoll);
+        throw Error("creating eventfd", Error::getLastMessage());
+      }
+
+      epoll_event ev;
+      ev.events = EPOLLIN;
+      ev.data.fd = m_event;
+      if (epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_event, &ev) < 0)
+      {
+        ::close(m_event);
+        ::close(m_epoll);
+        throw Error("registering eventfd", Error::getLastMessage());
+      }
+    }
+
+    Reactor::~Reactor(void)
+    {
+      ::close(m_event);
+      ::close(m_epoll);
+    }
+
+    void
+    Reactor::add(const NativeHandle& handle)
+    {
+      epoll_event ev;
+      ev.events = EPOLLIN;
+      ev.data.fd = handle;
+      if (epoll_ctl(m_epoll, EPOLL_CTL_ADD, handle, &ev) < 0)
+        throw Error("adding handle to reactor", Error::getLastMessage());
+
+      m_handles.push_back(handle);
+    }
+
+    void
+    Reactor::remove(const NativeHandle& handle)
+    {
+      if (!eraseHandle(m_handles, handle))
+        return;
+
+      epoll_event ev;
+      epoll_ctl(m_epoll, EPOLL_CTL_DEL, handle, &ev);
+
+      eraseHandle(m_triggered, handle);
+      eraseHandle(m_write_interest, handle);
+      eraseHandle(m_writable, handle);
+    }
+
+    void
+    Reactor::setWriteInterest(const NativeHandle& handle, bool enabled)
+    {
+      if (std::find(m_handles.begin(), m_handles.end(), handle) == m_handles.end())
+        return;
+
+      bool current = std::find(m_write_interest.begin(), m_write_interest.end(), handle) != m_write_interest.end();
+      if (current == enabled)
+        return;
+
+      epoll_event ev;
+      ev.events = enabled ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+      ev.data.fd = handle;
+      if (epoll_ctl(m_epoll, EPOLL_CTL_MOD, handle, &ev) < 0)
+        throw Error("changing reactor handle events", Error::getLastMessage());
+
+      if (enabled)
+        m_write_interest.push_back(handle);
+      else
+        eraseHandle(m_write_interest, handle);
+    }
+
+    bool
+    Reactor::wait(double timeout)
+    {
+      Time::ClockSource* source = Time::Clock::getSource();
+      if (source == NULL)
+        return waitEvents(timeout);
+
+      // Timeouts are measured by the clock source, the thread does
+      // not hold time back while blocked.
+      uint64_t deadline = ReactorWaiter::c_forever;
+      if (timeout >= 0)
+        deadline = source->getNsec() + static_cast<uint64_t>(std::ceil(timeout * Time::c_nsec_per_sec_fp));
+
+      ReactorWaiter waiter(deadline, *this);
+      source->addWaiter(waiter);
+
+      // The waiter may expire right away, waking up the reactor.
+      bool pending = source->getState(waiter) == ReactorWaiter::WS_PENDING;
+      bool rv = waitEvents(pending ? -1 : 0);
+      if (source->removeWaiter(waiter) == ReactorWaiter::WS_EXPIRED
+          && m_triggered.empty() && m_writable.empty())
+      {
+        m_woken = false;
+        return false;
+      }
+
+      return rv;
+    }
+
+    bool
+    Reactor::waitEvents(double timeout)
+    {
+      m_triggered.clear();
+      m_writable.clear();
+      m_woken = false;
+
+      int ms = -1;
+      if (timeout >= 0)
+        ms = (int)(timeout * 1000.0 + 0.999);
+
+      epoll_event events[c_max_events];
+      int rv = epoll_wait(m_epoll, events, c_max_events, ms);
+      if (rv < 0)
+      {
+        //! Workaround for when we are interrupted by a signal.
+        if (errno == EINTR)
+          return false;
+
+        throw Error("waiting for events", Error::getLastMessage());
+      }
+
+      for (int i = 0; i < rv; ++i)
+      {
+        if (events[i].data.fd != m_event)
+        {
+          if (events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP))
+            m_triggered.push_back(events[i].data.fd);
+          if (events[i].events & EPOLLOUT)
+            m_writable.push_back(events[i].data.fd);
+          continue;
+        }
+
+        // Drain the eventfd before clearing the pending flag: a
+        // concurrent wakeUp() either sees the flag set while the
+        // owner is already awake, or writes a new event for the next
+        // wait. Clearing first would let a wakeUp() write an event
+        // that is drained here, leaving the flag set for good.
+        uint64_t value = 0;
+        ssize_t n = ::read(m_event, &value, sizeof(value));
+        (void)n;
+        m_pending.compareAndSwap(1, 0);
+        m_woken = true;
+      }
+
+      return rv > 0;
+    }
+
+    void
+    Reactor::wakeUp(void)
+    {
+      interrupt();
+
+      // The owner must count as running before this call returns.
+      Time::ClockSource* source = Time::Clock::getSource();
+      if (source != NULL)
+        source->notify(this);
+    }
+
+    void
+    Reactor::interrupt(void)
+    {
+      if (!m_pending.compareAndSwap(0, 1))
+        return;
+
+      uint64_t value = 1;
+      ssize_t n = ::write(m_event, &value, sizeof(value));
+      (void)n;
+    }
+
+#else
+    Reactor::Reactor(void):
+      m_pending(0),
+      m_woken(false)
+    { }
+
+    Reactor::~Reactor(void)
+    { }
+
+    void
+    Reactor::add(const NativeHandle& handle)
+    {
+      m_handles.push_back(handle);
+      m_poll.add(handle);
+    }
+
+    void
+    Reactor::remove(const NativeHandle& handle)
+    {
+      if (!eraseHandle(m_handles, handle))
+        return;
+
+      m_poll.remove(handle);
+      eraseHandle(m_triggered, handle);
+      eraseHandle(m_write_interest, handle);
+      eraseHandle(m_writable, handle);
+    }
+
+    void
+    Reactor::setWriteInterest(const NativeHandle& handle, bool enabled)
+    {
+      if (std::find(m_handles.begin(), m_handles.end(), handle) == m_handles.end())
+        return;
+
+      eraseHandle(m_write_interest, handle);
+      if (enabled)
+        m_write_interest.push_back(handle);
+    }
+
+    bool
+    Reactor::wait(double timeout)
+    {
+      m_triggered.clear();
+      m_writable.clear();
+      m_woken = false;
+
+      // Poll and Delay register each slice with the clock source.
+      double now = Time::Clock::getNsec() / 1e9;
+      double deadline = now + timeout;
+
+      while (!m_pending.compareAndSwap(1, 0))
+      {
+        double slice = c_slice;
+        if (timeout >= 0)
+        {
+          if (now >= deadline)
+            return false;
+
+          slice = std::min(slice, deadline - now);
+        }
+
+        bool readable = false;
+        if (m_handles.empty())
+          Time::Delay::wait(slice);
+        else
+          readable = m_poll.poll(slice);
+
+        if (readable)
+        {
+          for (size_t i = 0; i < m_handles.size(); ++i)
+          {
+            if (m_poll.wasTriggered(m_handles[i]))
+              m_triggered.push_back(m_handles[i]);
+          }
+        }
+
+        // Writability cannot be polled here, handles waiting for it
+        // are retried once per slice.
+        m_writable = m_write_interest;
+
+        if (readable || !m_writable.empty())
+        {
+          m_woken = m_pending.compareAndSwap(1, 0);
+          return true;
+        }
+
+        now = Time::Clock::getNsec() / 1e9;
+      }
+
+      m_woken = true;
+      return true;
+    }
+
+    void
+    Reactor::wakeUp(void)
+    {
+      m_pending.compareAndSwap(0, 1);
+    }
+#endif
+
+    bool
+    Reactor::wasTriggered(const NativeHandle& handle) const
+    {
+      return std::find(m_triggered.begin(), m_triggered.end(), handle) != m_triggered.end();
+    }
+
+    bool
+    Reactor::wasWritable(const NativeHandle& handle) const
+    {
+      return std::find(m_writable.begin(), m_writable.end(), handle) != m_writable.end();
+    }
+  }
+}
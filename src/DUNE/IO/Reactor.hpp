@@ -0,0 +1,234 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef DUNE_IO_REACTOR_HPP_INCLUDED_
+#define DUNE_IO_REACTOR_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IO/Handle.hpp>
+#include <DUNE/IO/Poll.hpp>
+#include <DUNE/Concurrency/AtomicCounter.hpp>
+
+namespace DUNE
+{
+  namespace IO
+  {
+    // Export symbol.
+    class DUNE_DLL_SYM Reactor;
+
+    //! Waits for readable I/O handles and for wake up requests
+    //! coming from other threads at the same time, without
+    //! polling. On Linux this is an epoll instance with an eventfd
+    //! used for wake ups; elsewhere handles are polled in short
+    //! slices and wake ups are noticed between slices.
+    //!
+    //! Only the owner thread may add or remove handles and wait,
+    //! wakeUp() may be called from any thread.
+    class Reactor
+    {
+    public:
+      //! Constructor.
+      Reactor(void);
+
+      //! Destructor.
+      ~Reactor(void);
+
+      //! Add native I/O handle.
+      //! @param[in] handle native I/O handle.
+      void
+      add(const NativeHandle& handle);
+
+      //! Add I/O handle.
+      //! @param[in] handle I/O handle.
+      void
+      add(const Handle& handle)
+      {
+        add(handle.getNative());
+      }
+
+      //! Remove native I/O handle.
+      //! @param[in] handle native I/O handle.
+      void
+      remove(const NativeHandle& handle);
+
+      //! Remove I/O handle.
+      //! @param[in] handle I/O handle.
+      void
+      remove(const Handle& handle)
+      {
+        remove(handle.getNative());
+      }
+
+      //! Enable or disable waiting for a registered handle to become
+      //! writable, in addition to readable.
+      //! @param[in] handle native I/O handle.
+      //! @param[in] enabled true to wait for writability.
+      void
+      setWriteInterest(const NativeHandle& handle, bool enabled);
+
+      //! Enable or disable waiting for a registered handle to become
+      //! writable, in addition to readable.
+      //! @param[in] handle I/O handle.
+      //! @param[in] enabled true to wait for writability.
+      void
+      setWriteInterest(const Handle& handle, bool enabled)
+      {
+        setWriteInterest(handle.getNative(), enabled);
+      }
+
+      //! Retrieve the number of handles.
+      //! @return number of handles.
+      unsigned
+      size(void) const
+      {
+        return m_handles.size();
+      }
+
+      //! Wait until a handle is readable (or writable, see
+      //! setWriteInterest()) or wakeUp() is called.
+      //! @param[in] timeout timeout in seconds, use a negative number
+      //! to wait forever.
+      //! @return true if a handle was triggered or the reactor was
+      //! woken up, false on timeout.
+      bool
+      wait(double timeout);
+
+      //! Test if a handle was triggered by the last call to wait().
+      //! @param[in] handle native I/O handle.
+      //! @return true if triggered, false otherwise.
+      bool
+      wasTriggered(const NativeHandle& handle) const;
+
+      //! Test if a handle was triggered by the last call to wait().
+      //! @param[in] handle I/O handle.
+      //! @return true if triggered, false otherwise.
+      bool
+      wasTriggered(const Handle& handle) const
+      {
+        return wasTriggered(handle.getNative());
+      }
+
+      //! Test if a handle was found writable by the last call to
+      //! wait(). See setWriteInterest().
+      //! @param[in] handle native I/O handle.
+      //! @return true if writable, false otherwise.
+      bool
+      wasWritable(const NativeHandle& handle) const;
+
+      //! Test if a handle was found writable by the last call to
+      //! wait(). See setWriteInterest().
+      //! @param[in] handle I/O handle.
+      //! @return true if writable, false otherwise.
+      bool
+      wasWritable(const Handle& handle) const
+      {
+        return wasWritable(handle.getNative());
+      }
+
+      //! Retrieve the number of handles found writable by the last
+      //! call to wait().
+      //! @return number of writable handles.
+      unsigned
+      getWritableCount(void) const
+      {
+        return m_writable.size();
+      }
+
+      //! Retrieve the number of handles triggered by the last call
+      //! to wait().
+      //! @return number of triggered handles.
+      unsigned
+      getTriggeredCount(void) const
+      {
+        return m_triggered.size();
+      }
+
+      //! Test if the last call to wait() returned due to wakeUp().
+      //! @return true if woken up, false otherwise.
+      bool
+      wasWokenUp(void) const
+      {
+        return m_woken;
+      }
+
+      //! Wake up the owner from wait(). If the owner is not waiting
+      //! its next call to wait() returns immediately. Consecutive
+      //! calls before the owner wakes up cost a single system call.
+      void
+      wakeUp(void);
+
+    private:
+      //! Registered handles.
+      std::vector<NativeHandle> m_handles;
+      //! Handles triggered by the last wait().
+      std::vector<NativeHandle> m_triggered;
+      //! Handles waiting to become writable.
+      std::vector<NativeHandle> m_write_interest;
+      //! Handles found writable by the last wait().
+      std::vector<NativeHandle> m_writable;
+      //! Non-zero if a wake up is pending.
+      Concurrency::AtomicCounter m_pending;
+      //! True if the last wait() was woken up.
+      bool m_woken;
+#if defined(DUNE_SYS_HAS_EPOLL_CREATE1) && defined(DUNE_SYS_HAS_EVENTFD)
+      //! epoll instance.
+      int m_epoll;
+      //! eventfd used for wake ups.
+      int m_event;
+
+      //! Wait for events without involving the clock source.
+      //! @param[in] timeout timeout in seconds, negative to wait
+      //! forever.
+      //! @return true if a handle was triggered or the reactor was
+      //! woken up, false on timeout.
+      bool
+      waitEvents(double timeout);
+
+      //! Wake up the owner without involving the clock source.
+      void
+      interrupt(void);
+
+      friend class ReactorWaiter;
+#else
+      //! Fallback poller.
+      Poll m_poll;
+#endif
+
+      // Non-copyable.
+      Reactor(const Reactor&);
+      Reactor& operator=(const Reactor&);
+    };
+  }
+}
+
+#endif
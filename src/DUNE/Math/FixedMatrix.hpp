@@ -0,0 +1,647 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef DUNE_MATH_FIXED_MATRIX_HPP_INCLUDED_
+#define DUNE_MATH_FIXED_MATRIX_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Math/General.hpp>
+#include <DUNE/Math/Matrix.hpp>
+
+namespace DUNE
+{
+  namespace Math
+  {
+    //! Matrix with dimensions fixed at compile time.
+    //!
+    //! Storage is a plain row-major array held by value, so objects
+    //! of this class live on the stack (or inside their owner) and
+    //! no arithmetic operation touches the heap. Dimensions are part
+    //! of the type: mismatched products and sums are rejected by the
+    //! compiler instead of throwing at runtime. Expressions that are
+    //! common in estimation and control (A * B', A' * B, A * P * A')
+    //! are provided as fused kernels that skip the intermediate
+    //! transpose. Conversion to and from Math::Matrix is explicit.
+    //!
+    //! @tparam R number of rows.
+    //! @tparam C number of columns.
+    template <unsigned R, unsigned C>
+    class FixedMatrix
+    {
+    public:
+      //! Constructor.
+      //! Construct a matrix filled with zeros.
+      FixedMatrix(void)
+      {
+        fill(0.0);
+      }
+
+      //! Constructor.
+      //! Construct a matrix filled with a constant value.
+      //! @param[in] v value used to initialize cells.
+      explicit FixedMatrix(double v)
+      {
+        fill(v);
+      }
+
+      //! Constructor.
+      //! Construct a matrix from row-major data.
+      //! @param[in] data pointer to R * C values.
+      explicit FixedMatrix(const double* data)
+      {
+        std::memcpy(m_data, data, sizeof(m_data));
+      }
+
+      //! Constructor.
+      //! Construct a matrix from a dynamic matrix of the same size.
+      //! @param[in] m dynamic matrix.
+      explicit FixedMatrix(const Matrix& m)
+      {
+        set(m);
+      }
+
+      //! Retrieve the number of rows of the matrix.
+      //! @return number of rows.
+      static unsigned
+      rows(void)
+      {
+        return R;
+      }
+
+      //! Retrieve the number of columns of the matrix.
+      //! @return number of columns.
+      static unsigned
+      columns(void)
+      {
+        return C;
+      }
+
+      //! Retrieve the number of elements of the matrix.
+      //! @return number of elements.
+      static unsigned
+      size(void)
+      {
+        return R * C;
+      }
+
+      //! Fill the matrix with a constant value.
+      //! @param[in] v constant value.
+      void
+      fill(double v)
+      {
+        for (unsigned i = 0; i < R * C; ++i)
+          m_data[i] = v;
+      }
+
+      //! Turn the matrix into an identity matrix (ones on the main
+      //! diagonal, zeros elsewhere).
+      void
+      identity(void)
+      {
+        fill(0.0);
+        for (unsigned i = 0; i < R && i < C; ++i)
+          m_data[i * C + i] = 1.0;
+      }
+
+      //! Copy values from a dynamic matrix.
+      //! @param[in] m dynamic matrix with R rows and C columns.
+      void
+      set(const Matrix& m)
+      {
+        if (m.rows() != (int)R || m.columns() != (int)C)
+          throw Matrix::Error("dimension mismatch in fixed matrix assignment");
+
+        for (unsigned i = 0; i < R; ++i)
+          for (unsigned j = 0; j < C; ++j)
+            m_data[i * C + j] = m(i, j);
+      }
+
+      //! Copy values into a dynamic matrix. The destination is only
+      //! reallocated if its dimensions differ.
+      //! @param[out] m dynamic matrix.
+      void
+      get(Matrix& m) const
+      {
+        if (m.rows() != (int)R || m.columns() != (int)C)
+          m.resize(R, C);
+
+        for (unsigned i = 0; i < R; ++i)
+          for (unsigned j = 0; j < C; ++j)
+            m(i, j) = m_data[i * C + j];
+      }
+
+      //! Convert to a dynamic matrix.
+      //! @return dynamic matrix with the same contents.
+      Matrix
+      toMatrix(void) const
+      {
+        return Matrix(m_data, R, C);
+      }
+
+      //! Retrieve a pointer to the row-major storage.
+      //! @return pointer to storage.
+      double*
+      data(void)
+      {
+        return m_data;
+      }
+
+      //! Retrieve a pointer to the row-major storage.
+      //! @return pointer to storage.
+      const double*
+      data(void) const
+      {
+        return m_data;
+      }
+
+      //! Access element.
+      //! @param[in] i row.
+      //! @param[in] j column.
+      //! @return reference to element.
+      double&
+      operator()(unsigned i, unsigned j)
+      {
+        return m_data[i * C + j];
+      }
+
+      //! Access element.
+      //! @param[in] i row.
+      //! @param[in] j column.
+      //! @return element value.
+      double
+      operator()(unsigned i, unsigned j) const
+      {
+        return m_data[i * C + j];
+      }
+
+      //! Access element by linear (row-major) index. Intended for
+      //! vectors.
+      //! @param[in] i index.
+      //! @return reference to element.
+      double&
+      operator()(unsigned i)
+      {
+        return m_data[i];
+      }
+
+      //! Access element by linear (row-major) index. Intended for
+      //! vectors.
+      //! @param[in] i index.
+      //! @return element value.
+      double
+      operator()(unsigned i) const
+      {
+        return m_data[i];
+      }
+
+      FixedMatrix&
+      operator+=(const FixedMatrix& m)
+      {
+        for (unsigned i = 0; i < R * C; ++i)
+          m_data[i] += m.m_data[i];
+        return *this;
+      }
+
+      FixedMatrix&
+      operator-=(const FixedMatrix& m)
+      {
+        for (unsigned i = 0; i < R * C; ++i)
+          m_data[i] -= m.m_data[i];
+        return *this;
+      }
+
+      FixedMatrix&
+      operator*=(double x)
+      {
+        for (unsigned i = 0; i < R * C; ++i)
+          m_data[i] *= x;
+        return *this;
+      }
+
+      FixedMatrix&
+      operator/=(double x)
+      {
+        for (unsigned i = 0; i < R * C; ++i)
+          m_data[i] /= x;
+        return *this;
+      }
+
+      FixedMatrix
+      operator-(void) const
+      {
+        FixedMatrix r;
+        for (unsigned i = 0; i < R * C; ++i)
+          r.m_data[i] = -m_data[i];
+        return r;
+      }
+
+      bool
+      operator==(const FixedMatrix& m) const
+      {
+        for (unsigned i = 0; i < R * C; ++i)
+        {
+          if (m_data[i] != m.m_data[i])
+            return false;
+        }
+        return true;
+      }
+
+      //! Add a * x to this matrix (in-place update without
+      //! temporaries).
+      //! @param[in] x scale factor.
+      //! @param[in] a matrix to add.
+      void
+      addScaled(double x, const FixedMatrix& a)
+      {
+        for (unsigned i = 0; i < R * C; ++i)
+          m_data[i] += x * a.m_data[i];
+      }
+
+      //! Compute the sum of the diagonal elements.
+      //! @return trace.
+      double
+      trace(void) const
+      {
+        double t = 0.0;
+        for (unsigned i = 0; i < R && i < C; ++i)
+          t += m_data[i * C + i];
+        return t;
+      }
+
+      //! Compute the Frobenius norm (euclidean norm for vectors).
+      //! @return norm.
+      double
+      norm_2(void) const
+      {
+        double s = 0.0;
+        for (unsigned i = 0; i < R * C; ++i)
+          s += m_data[i] * m_data[i];
+        return std::sqrt(s);
+      }
+
+    private:
+      //! Row-major storage.
+      double m_data[R * C];
+    };
+
+    template <unsigned R, unsigned C>
+    inline FixedMatrix<R, C>
+    operator+(const FixedMatrix<R, C>& a, const FixedMatrix<R, C>& b)
+    {
+      FixedMatrix<R, C> r(a);
+      return r += b;
+    }
+
+    template <unsigned R, unsigned C>
+    inline FixedMatrix<R, C>
+    operator-(const FixedMatrix<R, C>& a, const FixedMatrix<R, C>& b)
+    {
+      FixedMatrix<R, C> r(a);
+      return r -= b;
+    }
+
+    template <unsigned R, unsigned C>
+    inline FixedMatrix<R, C>
+    operator*(const FixedMatrix<R, C>& a, double x)
+    {
+      FixedMatrix<R, C> r(a);
+      return r *= x;
+    }
+
+    template <unsigned R, unsigned C>
+    inline FixedMatrix<R, C>
+    operator*(double x, const FixedMatrix<R, C>& a)
+    {
+      FixedMatrix<R, C> r(a);
+      return r *= x;
+    }
+
+    template <unsigned R, unsigned C>
+    inline FixedMatrix<R, C>
+    operator/(const FixedMatrix<R, C>& a, double x)
+    {
+      FixedMatrix<R, C> r(a);
+      return r /= x;
+    }
+
+    //! Compute the product of two matrices.
+    //! @param[in] a R x K matrix.
+    //! @param[in] b K x C matrix.
+    //! @return R x C matrix.
+    template <unsigned R, unsigned K, unsigned C>
+    inline FixedMatrix<R, C>
+    operator*(const FixedMatrix<R, K>& a, const FixedMatrix<K, C>& b)
+    {
+      FixedMatrix<R, C> r;
+      for (unsigned i = 0; i < R; ++i)
+      {
+        for (unsigned k = 0; k < K; ++k)
+        {
+          double aik = a(i, k);
+          for (unsigned j = 0; j < C; ++j)
+            r(i, j) += aik * b(k, j);
+        }
+      }
+      return r;
+    }
+
+    //! Compute the transpose of a matrix.
+    //! @param[in] a matrix.
+    //! @return transposed matrix.
+    template <unsigned R, unsigned C>
+    inline FixedMatrix<C, R>
+    transpose(const FixedMatrix<R, C>& a)
+    {
+      FixedMatrix<C, R> r;
+      for (unsigned i = 0; i < R; ++i)
+        for (unsigned j = 0; j < C; ++j)
+          r(j, i) = a(i, j);
+      return r;
+    }
+
+    //! Compute a * transpose(b) without forming the transpose.
+    //! @param[in] a R x K matrix.
+    //! @param[in] b C x K matrix.
+    //! @return R x C matrix.
+    template <unsigned R, unsigned K, unsigned C>
+    inline FixedMatrix<R, C>
+    multiplyTranspose(const FixedMatrix<R, K>& a, const FixedMatrix<C, K>& b)
+    {
+      FixedMatrix<R, C> r;
+      for (unsigned i = 0; i < R; ++i)
+      {
+        for (unsigned j = 0; j < C; ++j)
+        {
+          double s = 0.0;
+          for (unsigned k = 0; k < K; ++k)
+            s += a(i, k) * b(j, k);
+          r(i, j) = s;
+        }
+      }
+      return r;
+    }
+
+    //! Compute transpose(a) * b without forming the transpose.
+    //! @param[in] a K x R matrix.
+    //! @param[in] b K x C matrix.
+    //! @return R x C matrix.
+    template <unsigned K, unsigned R, unsigned C>
+    inline FixedMatrix<R, C>
+    transposeMultiply(const FixedMatrix<K, R>& a, const FixedMatrix<K, C>& b)
+    {
+      FixedMatrix<R, C> r;
+      for (unsigned k = 0; k < K; ++k)
+      {
+        for (unsigned i = 0; i < R; ++i)
+        {
+          double aki = a(k, i);
+          for (unsigned j = 0; j < C; ++j)
+            r(i, j) += aki * b(k, j);
+        }
+      }
+      return r;
+    }
+
+    //! Compute the congruence transform a * p * transpose(a), the
+    //! covariance propagation step of a Kalman filter.
+    //! @param[in] a R x N matrix.
+    //! @param[in] p N x N matrix.
+    //! @return R x R matrix.
+    template <unsigned R, unsigned N>
+    inline FixedMatrix<R, R>
+    quadratic(const FixedMatrix<R, N>& a, const FixedMatrix<N, N>& p)
+    {
+      return multiplyTranspose(a * p, a);
+    }
+
+    //! Compute the inverse of a square matrix using Gauss-Jordan
+    //! elimination with partial pivoting.
+    //! @param[in] a square matrix.
+    //! @return inverse matrix.
+    template <unsigned N>
+    inline FixedMatrix<N, N>
+    inverse(const FixedMatrix<N, N>& a)
+    {
+      FixedMatrix<N, N> m(a);
+      FixedMatrix<N, N> r;
+      r.identity();
+
+      for (unsigned c = 0; c < N; ++c)
+      {
+        unsigned p = c;
+        for (unsigned i = c + 1; i < N; ++i)
+        {
+          if (std::fabs(m(i, c)) > std::fabs(m(p, c)))
+            p = i;
+        }
+
+        if (m(p, c) == 0.0)
+          throw Matrix::Error("Trying to invert a singular matrix!");
+
+        if (p != c)
+        {
+          for (unsigned j = 0; j < N; ++j)
+          {
+            std::swap(m(p, j), m(c, j));
+            std::swap(r(p, j), r(c, j));
+          }
+        }
+
+        double d = 1.0 / m(c, c);
+        for (unsigned j = 0; j < N; ++j)
+        {
+          m(c, j) *= d;
+          r(c, j) *= d;
+        }
+
+        for (unsigned i = 0; i < N; ++i)
+        {
+          if (i == c)
+            continue;
+
+          double f = m(i, c);
+          if (f == 0.0)
+            continue;
+
+          for (unsigned j = 0; j < N; ++j)
+          {
+            m(i, j) -= f * m(c, j);
+            r(i, j) -= f * r(c, j);
+          }
+        }
+      }
+
+      return r;
+    }
+
+    //! Compute the dot product of two vectors.
+    //! @param[in] a first vector.
+    //! @param[in] b second vector.
+    //! @return dot product.
+    template <unsigned R, unsigned C>
+    inline double
+    dot(const FixedMatrix<R, C>& a, const FixedMatrix<R, C>& b)
+    {
+      double s = 0.0;
+      for (unsigned i = 0; i < R * C; ++i)
+        s += a(i) * b(i);
+      return s;
+    }
+
+    //! Compute the matrix exponential using scaling and squaring
+    //! followed by a truncated Taylor series. Same algorithm as
+    //! Matrix::expmts().
+    //! @param[in] a square matrix.
+    //! @param[in] tol series truncation tolerance.
+    //! @return matrix exponential of a.
+    template <unsigned N>
+    inline FixedMatrix<N, N>
+    expmts(const FixedMatrix<N, N>& a, double tol = 1e-05)
+    {
+      unsigned m = computeNextPowerOfTwo((uint32_t)a.norm_2());
+
+      if (m > 1)
+      {
+        // Scaling.
+        FixedMatrix<N, N> ea = expmts(a * (1.0 / m), tol);
+
+        // Squaring.
+        for (unsigned i = 1; i < m; i = i << 1)
+          ea = ea * ea;
+        return ea;
+      }
+
+      FixedMatrix<N, N> ea;
+      ea.identity();
+      FixedMatrix<N, N> p;
+      p.identity();
+      double n2 = 1.0;
+      double inv_f = 1.0;
+      unsigned i = 0;
+
+      while (true)
+      {
+        inv_f *= 1.0 / ++i;
+        p = p * a;
+        ea.addScaled(inv_f, p);
+
+        double n2b = ea.norm_2();
+        if (std::fabs(n2b - n2) < tol)
+          break;
+        n2 = n2b;
+      }
+
+      return ea;
+    }
+
+    //! Compute the cross product of two 3-dimensional column vectors.
+    //! @param[in] a first vector.
+    //! @param[in] b second vector.
+    //! @return cross product.
+    inline FixedMatrix<3, 1>
+    cross(const FixedMatrix<3, 1>& a, const FixedMatrix<3, 1>& b)
+    {
+      FixedMatrix<3, 1> r;
+      r(0) = a(1) * b(2) - a(2) * b(1);
+      r(1) = a(2) * b(0) - a(0) * b(2);
+      r(2) = a(0) * b(1) - a(1) * b(0);
+      return r;
+    }
+
+    //! Compute the skew-symmetric (cross product) matrix of a
+    //! 3-dimensional column vector.
+    //! @param[in] a vector.
+    //! @return skew-symmetric matrix.
+    inline FixedMatrix<3, 3>
+    skew(const FixedMatrix<3, 1>& a)
+    {
+      FixedMatrix<3, 3> r;
+      r(0, 1) = -a(2);
+      r(0, 2) = a(1);
+      r(1, 0) = a(2);
+      r(1, 2) = -a(0);
+      r(2, 0) = -a(1);
+      r(2, 1) = a(0);
+      return r;
+    }
+
+    //! Compute the direction cosine matrix of a set of Euler angles
+    //! (same convention as Matrix::toDCM).
+    //! @param[in] ea roll, pitch and yaw angles.
+    //! @return direction cosine matrix.
+    inline FixedMatrix<3, 3>
+    toDCM(const FixedMatrix<3, 1>& ea)
+    {
+      double cr = std::cos(ea(0));
+      double sr = std::sin(ea(0));
+      double cp = std::cos(ea(1));
+      double sp = std::sin(ea(1));
+      double cy = std::cos(ea(2));
+      double sy = std::sin(ea(2));
+
+      double v[9] =
+      {
+        cp * cy, sr * sp * cy - cr * sy, cr * sp * cy + sr * sy,
+        cp * sy, sr * sp * sy + cr * cy, cr * sp * sy - sr * cy,
+        -sp, sr * cp, cr * cp
+      };
+
+      return FixedMatrix<3, 3>(v);
+    }
+
+    template <unsigned R, unsigned C>
+    inline std::ostream&
+    operator<<(std::ostream& os, const FixedMatrix<R, C>& a)
+    {
+      return os << a.toMatrix();
+    }
+
+    //! 2-dimensional column vector.
+    typedef FixedMatrix<2, 1> Vector2;
+    //! 3-dimensional column vector.
+    typedef FixedMatrix<3, 1> Vector3;
+    //! 6-dimensional column vector.
+    typedef FixedMatrix<6, 1> Vector6;
+    //! 2 x 2 matrix.
+    typedef FixedMatrix<2, 2> Matrix2;
+    //! 3 x 3 matrix.
+    typedef FixedMatrix<3, 3> Matrix3;
+    //! 6 x 6 matrix.
+    typedef FixedMatrix<6, 6> Matrix6;
+  }
+}
+
+#endif
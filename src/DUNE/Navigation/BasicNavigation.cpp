@@ -924,17 +924,17 @@ namespace DUNE
     {
       // "Outlier Rejection for Autonomous Acoustic Navigation"
       // Jerome Vaganay, John J. Leonard and James G. Bellingham. MIT
-      Math::Matrix H(1, 2, 0.0);
+      Math::FixedMatrix<1, 2> H;
       H(0, 0) = dx / exp_range;
       H(0, 1) = dy / exp_range;
-      Math::Matrix P(2, 2, 0.0);
-      P = m_kal.getCovariance(STATE_X, STATE_Y, STATE_X, STATE_Y);
+      Math::FixedMatrix<2, 2> P(m_kal.getCovariance(STATE_X, STATE_Y, STATE_X, STATE_Y));
+      double hph = Math::quadratic(H, P)(0);
 
       double k = getLblRejectionValue(exp_range);
-      double R = std::max(k, (H * P * transpose (H))(0));
+      double R = std::max(k, hph);
 
       double d = range - exp_range;
-      m_navdata.lbl_rej_level = (d * (1 / ((H * P * transpose (H))(0) + R)) * d);
+      m_navdata.lbl_rej_level = (d * (1 / (hph + R)) * d);
 
       // Is rejection level above maximum threshold?
       if (m_navdata.lbl_rej_level >= m_lbl_threshold)
@@ -1216,20 +1216,19 @@ namespace DUNE
     BasicNavigation::extractEarthRotation(double& p, double& q, double& r)
     {
       // Insert euler angles into row matrix.
-      Math::Matrix ea(3,1);
+      Math::Vector3 ea;
       ea(0) = Math::Angles::normalizeRadian(getEuler(AXIS_X));
       ea(1) = Math::Angles::normalizeRadian(getEuler(AXIS_Y));
       ea(2) = Math::Angles::normalizeRadian(getEuler(AXIS_Z));
 
       // Earth rotation vector.
-      Math::Matrix we(3,1);
+      Math::Vector3 we;
       we(0) = Math::c_earth_rotation * std::cos(m_last_lat);
       we(1) = 0.0;
       we(2) = - Math::c_earth_rotation * std::sin(m_last_lat);
 
       // Sensed angular velocities due to Earth rotation effect.
-      Math::Matrix av(3,1);
-      av = transpose(ea.toDCM()) * we;
+      Math::Vector3 av = Math::transposeMultiply(Math::toDCM(ea), we);
 
       // Extract from angular velocities measurements.
       p -= av(0);
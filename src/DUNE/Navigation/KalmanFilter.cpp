@@ -28,6 +28,9 @@
 // Author: José Braga                                                       *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <algorithm>
+
 // DUNE headers.
 #include <DUNE/Navigation/KalmanFilter.hpp>
 
@@ -35,12 +38,66 @@ namespace DUNE
 {
   namespace Navigation
   {
+    //! Compute, in place, the lower triangular Cholesky factor of a
+    //! symmetric positive definite matrix.
+    //! @param[in,out] a row-major n x n matrix.
+    //! @param[in] n dimension.
+    //! @return true on success, false if the matrix is not positive
+    //! definite.
+    static bool
+    cholesky(double* a, size_t n)
+    {
+      for (size_t j = 0; j < n; ++j)
+      {
+        double* rj = a + j * n;
+        double d = rj[j];
+        for (size_t k = 0; k < j; ++k)
+          d -= rj[k] * rj[k];
+
+        if (!(d > 0.0))
+          return false;
+
+        d = std::sqrt(d);
+        rj[j] = d;
+
+        for (size_t i = j + 1; i < n; ++i)
+        {
+          double* ri = a + i * n;
+          double v = ri[j];
+          for (size_t k = 0; k < j; ++k)
+            v -= ri[k] * rj[k];
+          ri[j] = v / d;
+        }
+      }
+
+      return true;
+    }
+
+    //! Solve l * y = b in place by forward substitution.
+    //! @param[in] l row-major lower triangular n x n matrix.
+    //! @param[in,out] b vector with stride 'stride'.
+    //! @param[in] n dimension.
+    //! @param[in] stride distance between consecutive elements of b.
+    static void
+    forwardSubstitute(const double* l, double* b, size_t n, size_t stride)
+    {
+      for (size_t i = 0; i < n; ++i)
+      {
+        const double* ri = l + i * n;
+        double v = b[i * stride];
+        for (size_t k = 0; k < i; ++k)
+          v -= ri[k] * b[k * stride];
+        b[i * stride] = v / ri[i];
+      }
+    }
+
     KalmanFilter::KalmanFilter(void)
     {
       m_state_count = 1;
       Math::Matrix I(1);
       I(0) = 0;
       m_x = m_y = m_ax = m_ap = m_c = m_p = m_q = m_r = m_innov = I;
+      reserve();
     }
 
     KalmanFilter::KalmanFilter(Math::Matrix& A, Math::Matrix& C, Math::Matrix& P, Math::Matrix& Q)
@@ -52,6 +109,7 @@ namespace DUNE
       m_q = Q;
       m_state_count = m_ax.rows();
       m_x.resizeAndFill(m_state_count, 1, 0.0);
+      reserve();
     }
 
     void
@@ -70,6 +128,8 @@ namespace DUNE
 
       m_ax.identity();
       m_ap.identity();
+
+      reserve();
     }
 
     bool
@@ -82,6 +142,7 @@ namespace DUNE
         m_c.resizeAndKeep(num_outputs, num_states);
         m_r.resizeAndKeep(num_outputs, num_outputs);
         m_innov.resizeAndKeep(num_outputs, 1);
+        reserve();
         return true;
       }
       else
@@ -101,10 +162,35 @@ namespace DUNE
       m_p = P0;
     }
 
+    void
+    KalmanFilter::reserve(void)
+    {
+      size_t n = m_state_count;
+      size_t m = m_innov.rows();
+
+      m_w_mat.resize(std::max(n * n, m * n));
+      m_w_cov.resize(m * m);
+      m_w_dx.resize(n);
+      m_w_ph.resize(n);
+      m_w_k.resize(n);
+      m_w_innov.resize(std::max(n, m));
+    }
+
     void
     KalmanFilter::normalize(void)
     {
-      m_p = 0.5 * (m_p + transpose(m_p));
+      size_t n = m_state_count;
+      double* p = &m_p(0);
+
+      for (size_t i = 0; i < n; ++i)
+      {
+        for (size_t j = i + 1; j < n; ++j)
+        {
+          double v = 0.5 * (p[i * n + j] + p[j * n + i]);
+          p[i * n + j] = v;
+          p[j * n + i] = v;
+        }
+      }
     }
 
     void
@@ -113,15 +199,87 @@ namespace DUNE
       if (u.rows() != b.columns() || u.columns() != 1)
         throw std::runtime_error(DTR("invalid dimensions"));
 
-      m_x = m_ax * m_x + b * u;
-      m_p = m_ap * m_p * transpose(m_ap) + m_q;
+      if ((size_t)b.rows() != m_state_count)
+        throw std::runtime_error(DTR("invalid dimensions"));
+
+      predictState();
+
+      double* x = &m_x(0);
+      for (size_t i = 0; i < m_state_count; ++i)
+      {
+        for (int j = 0; j < b.columns(); ++j)
+          x[i] += b.element(i, j) * u.element(j, 0);
+      }
+
+      predictCovariance();
     }
 
     void
     KalmanFilter::predict(void)
     {
-      m_x = m_ax * m_x;
-      m_p = m_ap * m_p * transpose(m_ap) + m_q;
+      predictState();
+      predictCovariance();
+    }
+
+    void
+    KalmanFilter::predictState(void)
+    {
+      size_t n = m_state_count;
+      const double* a = &m_ax(0);
+      double* x = &m_x(0);
+      double* y = &m_w_innov[0];
+
+      for (size_t i = 0; i < n; ++i)
+      {
+        const double* ai = a + i * n;
+        double v = 0.0;
+        for (size_t k = 0; k < n; ++k)
+          v += ai[k] * x[k];
+        y[i] = v;
+      }
+
+      std::copy(y, y + n, x);
+    }
+
+    void
+    KalmanFilter::predictCovariance(void)
+    {
+      size_t n = m_state_count;
+      const double* a = &m_ap(0);
+      const double* q = &m_q(0);
+      double* p = &m_p(0);
+      double* t = &m_w_mat[0];
+
+      // T = A * P, skipping the zeros of the (usually sparse) transition.
+      std::fill(t, t + n * n, 0.0);
+      for (size_t i = 0; i < n; ++i)
+      {
+        double* ti = t + i * n;
+        for (size_t k = 0; k < n; ++k)
+        {
+          double aik = a[i * n + k];
+          if (aik == 0.0)
+            continue;
+
+          const double* pk = p + k * n;
+          for (size_t j = 0; j < n; ++j)
+            ti[j] += aik * pk[j];
+        }
+      }
+
+      // P = T * A' + Q.
+      for (size_t i = 0; i < n; ++i)
+      {
+        const double* ti = t + i * n;
+        for (size_t j = 0; j < n; ++j)
+        {
+          const double* aj = a + j * n;
+          double v = q[i * n + j];
+          for (size_t k = 0; k < n; ++k)
+            v += ti[k] * aj[k];
+          p[i * n + j] = v;
+        }
+      }
     }
 
     int
@@ -139,42 +297,186 @@ namespace DUNE
       if (m_r.rows() != m_r.columns() || m_r.rows() != m_innov.rows())
         throw std::runtime_error(DTR("invalid dimensions"));
 
-      // Measurement prediction covariance.
-      Math::Matrix S = (m_c * m_p * transpose(m_c)) + m_r;
-      Math::Matrix S_1;
+      size_t n = m_state_count;
+      size_t m = m_innov.rows();
+      if (m == 0)
+        return 0;
 
-      // Inverse of the measurement prediction covariance.
-      try
-      {
-        S_1 = inverse(S);
-      }
-      catch (...)
-      {
-        throw std::runtime_error(DTR("matrix inversion error"));
-      }
+      double* c = &m_c(0);
+      double* r = &m_r(0);
+      double* v = &m_innov(0);
 
       // Check if innovation is above a threshold value.
       // Set threshold to 0 to accept everything.
       if (threshold != 0)
       {
-        double level = (transpose(m_innov) * S_1 * m_innov)(0);
+        computeInnovationCovariance();
+
+        double* s = &m_w_cov[0];
+        if (!cholesky(s, m))
+          throw std::runtime_error(DTR("matrix inversion error"));
+
+        double* y = &m_w_innov[0];
+        std::copy(v, v + m, y);
+        forwardSubstitute(s, y, m, 1);
+
+        double level = 0.0;
+        for (size_t i = 0; i < m; ++i)
+          level += y[i] * y[i];
 
         if (level >= threshold)
           return -1;
       }
 
-      // Kalman Gain.
-      Math::Matrix K = m_p * transpose(m_c) * S_1;
+      bool diagonal = true;
+      for (size_t i = 0; i < m && diagonal; ++i)
+      {
+        for (size_t j = 0; j < m; ++j)
+        {
+          if (i != j && r[i * m + j] != 0.0)
+          {
+            diagonal = false;
+            break;
+          }
+        }
+      }
+
+      // Correlated measurement noise: decorrelate observations and
+      // innovations with the Cholesky factor of R so that they can
+      // be processed one at a time with unit variance.
+      const double* h = c;
+      const double* e = v;
+      if (!diagonal)
+      {
+        double* l = &m_w_cov[0];
+        std::copy(r, r + m * m, l);
+        if (!cholesky(l, m))
+          throw std::runtime_error(DTR("matrix inversion error"));
+
+        double* cw = &m_w_mat[0];
+        std::copy(c, c + m * n, cw);
+        for (size_t j = 0; j < n; ++j)
+          forwardSubstitute(l, cw + j, m, n);
+
+        double* ew = &m_w_innov[0];
+        std::copy(v, v + m, ew);
+        forwardSubstitute(l, ew, m, 1);
+
+        h = cw;
+        e = ew;
+      }
+
+      std::fill(m_w_dx.begin(), m_w_dx.end(), 0.0);
 
-      // State update.
-      m_x = m_x + K * m_innov;
+      for (size_t i = 0; i < m; ++i)
+        updateScalar(h + i * n, e[i], diagonal ? r[i * m + i] : 1.0);
 
-      // State Covariance update.
-      m_p = m_p - K * m_c * m_p;
+      double* x = &m_x(0);
+      for (size_t i = 0; i < n; ++i)
+        x[i] += m_w_dx[i];
 
       return 0;
     }
 
+    void
+    KalmanFilter::computeInnovationCovariance(void)
+    {
+      size_t n = m_state_count;
+      size_t m = m_innov.rows();
+      const double* c = &m_c(0);
+      const double* p = &m_p(0);
+      const double* r = &m_r(0);
+      double* pc = &m_w_mat[0];
+      double* s = &m_w_cov[0];
+
+      // PC = C * P (m x n).
+      std::fill(pc, pc + m * n, 0.0);
+      for (size_t i = 0; i < m; ++i)
+      {
+        double* pci = pc + i * n;
+        for (size_t k = 0; k < n; ++k)
+        {
+          double cik = c[i * n + k];
+          if (cik == 0.0)
+            continue;
+
+          const double* pk = p + k * n;
+          for (size_t j = 0; j < n; ++j)
+            pci[j] += cik * pk[j];
+        }
+      }
+
+      // S = PC * C' + R.
+      for (size_t i = 0; i < m; ++i)
+      {
+        for (size_t j = 0; j < m; ++j)
+        {
+          double v = r[i * m + j];
+          for (size_t k = 0; k < n; ++k)
+            v += pc[i * n + k] * c[j * n + k];
+          s[i * m + j] = v;
+        }
+      }
+    }
+
+    void
+    KalmanFilter::updateScalar(const double* h, double innov, double r)
+    {
+      size_t n = m_state_count;
+
+      bool observed = false;
+      for (size_t k = 0; k < n && !observed; ++k)
+        observed = (h[k] != 0.0);
+
+      if (!observed)
+        return;
+
+      double* p = &m_p(0);
+      double* ph = &m_w_ph[0];
+      double* k = &m_w_k[0];
+      double* dx = &m_w_dx[0];
+
+      // PH = P * h'.
+      double s = r;
+      for (size_t i = 0; i < n; ++i)
+      {
+        const double* pi = p + i * n;
+        double v = 0.0;
+        for (size_t j = 0; j < n; ++j)
+          v += pi[j] * h[j];
+        ph[i] = v;
+        s += h[i] * v;
+      }
+
+      if (!(s > 0.0))
+        throw std::runtime_error(DTR("matrix inversion error"));
+
+      // Innovation corrected by the updates already applied.
+      double e = innov;
+      for (size_t i = 0; i < n; ++i)
+        e -= h[i] * dx[i];
+
+      for (size_t i = 0; i < n; ++i)
+      {
+        k[i] = ph[i] / s;
+        dx[i] += k[i] * e;
+      }
+
+      // Joseph form (I - k h) P (I - k h)' + k r k', expanded for a
+      // symmetric P and evaluated on the upper triangle.
+      for (size_t i = 0; i < n; ++i)
+      {
+        double* pi = p + i * n;
+        double ki = k[i];
+        double phi = ph[i];
+        for (size_t j = i; j < n; ++j)
+          pi[j] += s * ki * k[j] - ki * ph[j] - phi * k[j];
+
+        for (size_t j = i + 1; j < n; ++j)
+          p[j * n + i] = pi[j];
+      }
+    }
+
     void
     KalmanFilter::setState(short pos, double value)
     {
@@ -45,6 +45,7 @@
 // ISO C++ 98 headers.
 #include <stdexcept>
 #include <string>
+#include <vector>
 #include <cmath>
 
 // DUNE headers.
@@ -104,6 +105,10 @@ namespace DUNE
       predict(void);
 
       //! Kalman Filter update function.
+      //! Measurements are applied one at a time (decorrelated first
+      //! if the measurement noise is not diagonal), so no matrix
+      //! inversion takes place. Outputs with a null observation row
+      //! are skipped.
       //! @param threshold threshold to reject large state innovations.
       //! @return 0 if update is successful, -1 otherwise.
       int
@@ -152,6 +157,15 @@ namespace DUNE
       void
       setStateTransition(Math::Matrix a);
 
+      //! Set state transition matrix without allocating.
+      //! @param a state transition matrix.
+      template <unsigned N>
+      void
+      setStateTransition(const Math::FixedMatrix<N, N>& a)
+      {
+        copyTransition(a, m_ax);
+      }
+
       //! Get state covariance transition matrix.
       //! @return state covariance transition matrix.
       inline Math::Matrix
@@ -165,11 +179,30 @@ namespace DUNE
       void
       setCovarianceTransition(Math::Matrix a);
 
+      //! Set state covariance transition matrix without allocating.
+      //! @param a state covariance transition matrix.
+      template <unsigned N>
+      void
+      setCovarianceTransition(const Math::FixedMatrix<N, N>& a)
+      {
+        copyTransition(a, m_ap);
+      }
+
       //! Set transition matrices.
       //! @param a state transition matrix.
       void
       setTransitions(Math::Matrix a);
 
+      //! Set transition matrices without allocating.
+      //! @param a state transition matrix.
+      template <unsigned N>
+      void
+      setTransitions(const Math::FixedMatrix<N, N>& a)
+      {
+        copyTransition(a, m_ax);
+        copyTransition(a, m_ap);
+      }
+
       //! Reset output matrices.
       void
       resetOutputs(void);
@@ -341,6 +374,46 @@ namespace DUNE
       setMeasurementNoise(double value);
 
     private:
+      //! Size workspaces to the current number of states and outputs.
+      void
+      reserve(void);
+
+      //! Propagate the state through the state transition matrix.
+      void
+      predictState(void);
+
+      //! Propagate the state covariance and add process noise.
+      void
+      predictCovariance(void);
+
+      //! Compute the innovation covariance C * P * C' + R into the
+      //! covariance workspace.
+      void
+      computeInnovationCovariance(void);
+
+      //! Apply one scalar measurement to the state correction and
+      //! covariance (Joseph form).
+      //! @param h observation row.
+      //! @param innov innovation.
+      //! @param r measurement noise variance.
+      void
+      updateScalar(const double* h, double innov, double r);
+
+      //! Copy a fixed size transition matrix into its destination.
+      //! @param a transition matrix.
+      //! @param dst destination matrix, already sized to the state count.
+      template <unsigned N>
+      void
+      copyTransition(const Math::FixedMatrix<N, N>& a, Math::Matrix& dst)
+      {
+        if (N != m_state_count)
+          throw std::runtime_error(DTR("invalid dimensions"));
+
+        for (unsigned i = 0; i < N; ++i)
+          for (unsigned j = 0; j < N; ++j)
+            dst(i, j) = a(i, j);
+      }
+
       //! Kalman filter state count.
       size_t m_state_count;
       //! State vector.
@@ -361,6 +434,18 @@ namespace DUNE
       Math::Matrix m_r;
       //! Innovation vector.
       Math::Matrix m_innov;
+      //! Workspace for products with the covariance matrix.
+      std::vector<double> m_w_mat;
+      //! Workspace for the innovation covariance.
+      std::vector<double> m_w_cov;
+      //! Accumulated state correction.
+      std::vector<double> m_w_dx;
+      //! Workspace for P * h'.
+      std::vector<double> m_w_ph;
+      //! Workspace for the Kalman gain.
+      std::vector<double> m_w_k;
+      //! Workspace for innovations and state propagation.
+      std::vector<double> m_w_innov;
     };
   }
 }
@@ -0,0 +1,428 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Coordinates/WGS84.hpp>
+#include <DUNE/Math/Constants.hpp>
+#include <DUNE/Navigation/StateHistory.hpp>
+
+// Check if we can use GCC's atomic functions.
+#if defined(DUNE_SYS_HAS___SYNC_SYNCHRONIZE)
+#  define DUNE_NAVIGATION_STATE_HISTORY_GCC
+#endif
+
+namespace DUNE
+{
+  namespace Navigation
+  {
+    //! Convert Euler angles to a unit quaternion (w, x, y, z).
+    //! @param[in] phi roll angle.
+    //! @param[in] theta pitch angle.
+    //! @param[in] psi yaw angle.
+    //! @param[out] q quaternion.
+    static void
+    toQuaternion(double phi, double theta, double psi, double* q)
+    {
+      double cr = std::cos(phi / 2);
+      double sr = std::sin(phi / 2);
+      double cp = std::cos(theta / 2);
+      double sp = std::sin(theta / 2);
+      double cy = std::cos(psi / 2);
+      double sy = std::sin(psi / 2);
+
+      q[0] = cr * cp * cy + sr * sp * sy;
+      q[1] = sr * cp * cy - cr * sp * sy;
+      q[2] = cr * sp * cy + sr * cp * sy;
+      q[3] = cr * cp * sy - sr * sp * cy;
+    }
+
+    //! Convert a unit quaternion (w, x, y, z) to Euler angles.
+    //! @param[in] q quaternion.
+    //! @param[out] phi roll angle.
+    //! @param[out] theta pitch angle.
+    //! @param[out] psi yaw angle.
+    static void
+    toEulerAngles(const double* q, fp32_t& phi, fp32_t& theta, fp32_t& psi)
+    {
+      phi = std::atan2(2 * (q[0] * q[1] + q[2] * q[3]), 1 - 2 * (q[1] * q[1] + q[2] * q[2]));
+
+      double sp = 2 * (q[0] * q[2] - q[3] * q[1]);
+      if (sp >= 1)
+        theta = Math::c_half_pi;
+      else if (sp <= -1)
+        theta = -Math::c_half_pi;
+      else
+        theta = std::asin(sp);
+
+      psi = std::atan2(2 * (q[0] * q[3] + q[1] * q[2]), 1 - 2 * (q[2] * q[2] + q[3] * q[3]));
+    }
+
+    //! Spherical linear interpolation of unit quaternions, along
+    //! the shortest arc.
+    //! @param[in] a first quaternion.
+    //! @param[in] b second quaternion.
+    //! @param[in] k interpolation factor, between 0 and 1.
+    //! @param[out] q interpolated quaternion.
+    static void
+    slerp(const double* a, const double* b, double k, double* q)
+    {
+      double dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+      double sign = 1.0;
+      if (dot < 0)
+      {
+        dot = -dot;
+        sign = -1.0;
+      }
+
+      double ka = 1.0 - k;
+      double kb = k;
+
+      // Nearly parallel quaternions: interpolate linearly and
+      // normalize, avoiding the division by a vanishing sine.
+      if (dot < 0.9995)
+      {
+        double angle = std::acos(dot);
+        double s = std::sin(angle);
+        ka = std::sin(ka * angle) / s;
+        kb = std::sin(kb * angle) / s;
+      }
+
+      double norm = 0;
+      for (unsigned i = 0; i < 4; ++i)
+      {
+        q[i] = ka * a[i] + sign * kb * b[i];
+        norm += q[i] * q[i];
+      }
+
+      norm = std::sqrt(norm);
+      for (unsigned i = 0; i < 4; ++i)
+        q[i] /= norm;
+    }
+
+    //! Linear interpolation.
+    //! @param[in] a first value.
+    //! @param[in] b second value.
+    //! @param[in] k interpolation factor, between 0 and 1.
+    //! @return interpolated value.
+    static inline double
+    lerp(double a, double b, double k)
+    {
+      return a + (b - a) * k;
+    }
+
+    StateHistory::StateHistory(unsigned capacity, double max_gap):
+      m_ring(NULL),
+      m_mask(0),
+      m_capacity(capacity),
+      m_max_gap(max_gap),
+      m_head(0),
+      m_tail(0),
+      m_last_time(0)
+    {
+      if (m_capacity < 2)
+        m_capacity = 2;
+
+      // The ring holds twice the readable states, so that lookups
+      // only fail to read consistent states if the writer adds
+      // another capacity worth of states meanwhile.
+      size_t size = 2;
+      while (size < 2 * (size_t)m_capacity)
+        size <<= 1;
+
+      m_mask = size - 1;
+      m_ring = new Sample[size];
+    }
+
+    StateHistory::~StateHistory(void)
+    {
+      delete [] m_ring;
+    }
+
+    bool
+    StateHistory::push(const IMC::EstimatedState& state)
+    {
+      double time = state.getTimeStamp();
+      if (m_head != m_tail && time <= m_last_time)
+        return false;
+
+      Sample s;
+      s.time = time;
+      s.src = state.getSource();
+      s.src_ent = state.getSourceEntity();
+      s.lat = state.lat;
+      s.lon = state.lon;
+      s.height = state.height;
+      s.x = state.x;
+      s.y = state.y;
+      s.z = state.z;
+      s.phi = state.phi;
+      s.theta = state.theta;
+      s.psi = state.psi;
+      s.u = state.u;
+      s.v = state.v;
+      s.w = state.w;
+      s.vx = state.vx;
+      s.vy = state.vy;
+      s.vz = state.vz;
+      s.p = state.p;
+      s.q = state.q;
+      s.r = state.r;
+      s.depth = state.depth;
+      s.alt = state.alt;
+
+#if defined(DUNE_NAVIGATION_STATE_HISTORY_GCC)
+      size_t head = m_head;
+      __sync_synchronize();
+      m_ring[head & m_mask] = s;
+      __sync_synchronize();
+      m_head = head + 1;
+#else
+      Concurrency::ScopedMutex l(m_lock);
+      m_ring[m_head & m_mask] = s;
+      m_head = m_head + 1;
+#endif
+
+      m_last_time = time;
+      return true;
+    }
+
+    void
+    StateHistory::clear(void)
+    {
+#if defined(DUNE_NAVIGATION_STATE_HISTORY_GCC)
+      m_tail = m_head;
+      __sync_synchronize();
+#else
+      Concurrency::ScopedMutex l(m_lock);
+      m_tail = m_head;
+#endif
+    }
+
+    unsigned
+    StateHistory::size(void) const
+    {
+      size_t head = m_head;
+      size_t tail = m_tail;
+      size_t count = (head > tail) ? (head - tail) : 0;
+      return (count > m_capacity) ? m_capacity : count;
+    }
+
+    size_t
+    StateHistory::search(double time, size_t lo, size_t hi) const
+    {
+      while (lo < hi)
+      {
+        size_t mid = lo + (hi - lo) / 2;
+        if (m_ring[mid & m_mask].time <= time)
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+
+      return lo;
+    }
+
+    unsigned
+    StateHistory::find(double time, Sample& a, Sample& b) const
+    {
+#if !defined(DUNE_NAVIGATION_STATE_HISTORY_GCC)
+      Concurrency::ScopedMutex l(m_lock);
+#endif
+
+      while (true)
+      {
+        size_t head = m_head;
+        size_t lo = m_tail;
+#if defined(DUNE_NAVIGATION_STATE_HISTORY_GCC)
+        __sync_synchronize();
+#endif
+        if (head - lo > m_capacity)
+          lo = head - m_capacity;
+
+        unsigned found = 0;
+        if (head > lo)
+        {
+          size_t i = search(time, lo, head);
+
+          if (i > lo)
+          {
+            a = m_ring[(i - 1) & m_mask];
+            found |= FF_BEFORE;
+          }
+
+          if (i < head)
+          {
+            b = m_ring[i & m_mask];
+            found |= FF_AFTER;
+          }
+        }
+
+#if defined(DUNE_NAVIGATION_STATE_HISTORY_GCC)
+        __sync_synchronize();
+#endif
+
+        // The writer may be storing the state after the newest one
+        // published, which overwrites the state one ring size
+        // older. Anything read is consistent if that state is older
+        // than the oldest state searched.
+        if (m_head - lo <= m_mask)
+          return found;
+      }
+    }
+
+    bool
+    StateHistory::interpolate(double time, IMC::EstimatedState& state) const
+    {
+      Sample a;
+      Sample b;
+      unsigned found = find(time, a, b);
+
+      if (found != (FF_BEFORE | FF_AFTER))
+      {
+        if ((found & FF_BEFORE) && a.time == time)
+        {
+          toState(a, state);
+          return true;
+        }
+
+        return false;
+      }
+
+      double dt = b.time - a.time;
+      if (dt > m_max_gap)
+        return false;
+
+      double k = (time - a.time) / dt;
+
+      // Express the position of the second state in the frame of
+      // the first one if their references differ.
+      double bx = b.x;
+      double by = b.y;
+      double bz = b.z;
+      if (a.lat != b.lat || a.lon != b.lon || a.height != b.height)
+      {
+        double lat = b.lat;
+        double lon = b.lon;
+        double hae = b.height;
+        Coordinates::WGS84::displace(b.x, b.y, b.z, &lat, &lon, &hae);
+        Coordinates::WGS84::displacement(a.lat, a.lon, a.height, lat, lon, hae, &bx, &by, &bz);
+      }
+
+      Sample s = a;
+      s.time = time;
+      s.x = lerp(a.x, bx, k);
+      s.y = lerp(a.y, by, k);
+      s.z = lerp(a.z, bz, k);
+      s.u = lerp(a.u, b.u, k);
+      s.v = lerp(a.v, b.v, k);
+      s.w = lerp(a.w, b.w, k);
+      s.vx = lerp(a.vx, b.vx, k);
+      s.vy = lerp(a.vy, b.vy, k);
+      s.vz = lerp(a.vz, b.vz, k);
+      s.p = lerp(a.p, b.p, k);
+      s.q = lerp(a.q, b.q, k);
+      s.r = lerp(a.r, b.r, k);
+      s.depth = lerp(a.depth, b.depth, k);
+
+      // Negative altitudes are invalid and must not be blended.
+      if (a.alt >= 0 && b.alt >= 0)
+        s.alt = lerp(a.alt, b.alt, k);
+      else
+        s.alt = (k < 0.5) ? a.alt : b.alt;
+
+      double qa[4];
+      double qb[4];
+      double q[4];
+      toQuaternion(a.phi, a.theta, a.psi, qa);
+      toQuaternion(b.phi, b.theta, b.psi, qb);
+      slerp(qa, qb, k, q);
+      toEulerAngles(q, s.phi, s.theta, s.psi);
+
+      toState(s, state);
+      return true;
+    }
+
+    bool
+    StateHistory::nearest(double time, IMC::EstimatedState& state, double& delta) const
+    {
+      Sample a;
+      Sample b;
+      unsigned found = find(time, a, b);
+
+      const Sample* s = NULL;
+      if (found & FF_BEFORE)
+        s = &a;
+
+      if ((found & FF_AFTER) && (s == NULL || b.time - time < time - a.time))
+        s = &b;
+
+      if (s == NULL)
+        return false;
+
+      delta = s->time - time;
+      if (std::fabs(delta) > m_max_gap)
+        return false;
+
+      toState(*s, state);
+      return true;
+    }
+
+    void
+    StateHistory::toState(const Sample& sample, IMC::EstimatedState& state)
+    {
+      state.setTimeStamp(sample.time);
+      state.setSource(sample.src);
+      state.setSourceEntity(sample.src_ent);
+      state.lat = sample.lat;
+      state.lon = sample.lon;
+      state.height = sample.height;
+      state.x = sample.x;
+      state.y = sample.y;
+      state.z = sample.z;
+      state.phi = sample.phi;
+      state.theta = sample.theta;
+      state.psi = sample.psi;
+      state.u = sample.u;
+      state.v = sample.v;
+      state.w = sample.w;
+      state.vx = sample.vx;
+      state.vy = sample.vy;
+      state.vz = sample.vz;
+      state.p = sample.p;
+      state.q = sample.q;
+      state.r = sample.r;
+      state.depth = sample.depth;
+      state.alt = sample.alt;
+    }
+  }
+}
@@ -0,0 +1,215 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef DUNE_NAVIGATION_STATE_HISTORY_HPP_INCLUDED_
+#define DUNE_NAVIGATION_STATE_HISTORY_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/IMC/Definitions.hpp>
+
+namespace DUNE
+{
+  namespace Navigation
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM StateHistory;
+
+    //! Time-indexed history of estimated states, meant to
+    //! georeference sensor data (sonar pings, camera frames) by
+    //! timestamp. States are kept in a ring buffer of fixed size, so
+    //! memory is bounded and adding a state never allocates.
+    //! Lookups use binary search and interpolate position and
+    //! velocities linearly and attitude by spherical linear
+    //! interpolation.
+    //!
+    //! One thread may add states while any number of threads look
+    //! them up. Lookups take no locks: they copy the states they
+    //! need and retry if the writer overwrote them meanwhile.
+    class StateHistory
+    {
+    public:
+      //! Constructor.
+      //! @param[in] capacity number of states kept.
+      //! @param[in] max_gap largest time, in seconds, between two
+      //! states that are interpolated or between the requested time
+      //! and the nearest state.
+      StateHistory(unsigned capacity, double max_gap = 1.0);
+
+      //! Destructor.
+      ~StateHistory(void);
+
+      //! Add a state. States must be added in increasing timestamp
+      //! order; once the history is full the oldest state is
+      //! dropped. Only one thread may add states.
+      //! @param[in] state estimated state.
+      //! @return true if the state was added, false if it is not
+      //! newer than the latest state.
+      bool
+      push(const IMC::EstimatedState& state);
+
+      //! Remove all states. Must be called from the thread that adds
+      //! states; concurrent lookups may still return older states.
+      void
+      clear(void);
+
+      //! Retrieve the number of states kept.
+      //! @return number of states.
+      unsigned
+      size(void) const;
+
+      //! Test if there are no states.
+      //! @return true if the history is empty, false otherwise.
+      bool
+      empty(void) const
+      {
+        return size() == 0;
+      }
+
+      //! Retrieve the maximum number of states kept.
+      //! @return history capacity.
+      unsigned
+      getCapacity(void) const
+      {
+        return m_capacity;
+      }
+
+      //! Compute the state at a given time by interpolating the
+      //! states immediately before and after it. There is no
+      //! extrapolation.
+      //! @param[in] time time in seconds since the Unix Epoch.
+      //! @param[out] state interpolated state, timestamped with the
+      //! requested time.
+      //! @return true if the time lies between two states no more
+      //! than the maximum gap apart, false otherwise.
+      bool
+      interpolate(double time, IMC::EstimatedState& state) const;
+
+      //! Retrieve the state closest to a given time.
+      //! @param[in] time time in seconds since the Unix Epoch.
+      //! @param[out] state closest state.
+      //! @param[out] delta time of the state minus requested time.
+      //! @return true if a state no more than the maximum gap away
+      //! from the requested time was found, false otherwise.
+      bool
+      nearest(double time, IMC::EstimatedState& state, double& delta) const;
+
+    private:
+      //! Stored state, a plain copy of the fields of an
+      //! EstimatedState message so that lookups can copy it while
+      //! it is being overwritten.
+      struct Sample
+      {
+        fp64_t time;
+        uint16_t src;
+        uint8_t src_ent;
+        fp64_t lat;
+        fp64_t lon;
+        fp32_t height;
+        fp32_t x;
+        fp32_t y;
+        fp32_t z;
+        fp32_t phi;
+        fp32_t theta;
+        fp32_t psi;
+        fp32_t u;
+        fp32_t v;
+        fp32_t w;
+        fp32_t vx;
+        fp32_t vy;
+        fp32_t vz;
+        fp32_t p;
+        fp32_t q;
+        fp32_t r;
+        fp32_t depth;
+        fp32_t alt;
+      };
+
+      //! Ring buffer.
+      Sample* m_ring;
+      //! Ring buffer size minus one.
+      size_t m_mask;
+      //! Number of states readable by lookups.
+      unsigned m_capacity;
+      //! Largest gap between states.
+      double m_max_gap;
+      //! Number of states ever added.
+      volatile size_t m_head;
+      //! Number of states added before the last clear().
+      volatile size_t m_tail;
+      //! Timestamp of the latest state.
+      double m_last_time;
+      //! Lock used when atomic operations are not available.
+      mutable Concurrency::Mutex m_lock;
+
+      //! Flags of states found around a given time.
+      enum FoundFlags
+      {
+        //! Found a state not newer than the given time.
+        FF_BEFORE = 0x01,
+        //! Found a state newer than the given time.
+        FF_AFTER = 0x02
+      };
+
+      //! Find the states around a given time.
+      //! @param[in] time time in seconds since the Unix Epoch.
+      //! @param[out] a latest state not newer than time.
+      //! @param[out] b earliest state newer than time.
+      //! @return states found (see FoundFlags).
+      unsigned
+      find(double time, Sample& a, Sample& b) const;
+
+      //! Search the ring buffer.
+      //! @param[in] time time in seconds since the Unix Epoch.
+      //! @param[in] lo index of the oldest state.
+      //! @param[in] hi index past the newest state.
+      //! @return index of the first state newer than time.
+      size_t
+      search(double time, size_t lo, size_t hi) const;
+
+      //! Fill an estimated state message from a sample.
+      //! @param[in] sample sample.
+      //! @param[out] state estimated state.
+      static void
+      toState(const Sample& sample, IMC::EstimatedState& state);
+
+      // Non-copyable.
+      StateHistory(const StateHistory&);
+
+      StateHistory&
+      operator=(const StateHistory&);
+    };
+  }
+}
+
+#endif
@@ -28,6 +28,7 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <cerrno>
 #include <cstring>
 #include <sstream>
 #include <iostream>
@@ -252,6 +253,55 @@ namespace DUNE
       return static_cast<size_t>(rv);
     }
 
+    size_t
+    TCPSocket::writeNonBlocking(const uint8_t* const* bfrs, const size_t* sizes, unsigned count)
+    {
+      if (count > c_max_write_buffers)
+        count = c_max_write_buffers;
+
+#if defined(DUNE_OS_POSIX)
+      iovec iov[c_max_write_buffers];
+      for (unsigned i = 0; i < count; ++i)
+      {
+        iov[i].iov_base = const_cast<uint8_t*>(bfrs[i]);
+        iov[i].iov_len = sizes[i];
+      }
+
+      msghdr msg;
+      std::memset(&msg, 0, sizeof(msg));
+      msg.msg_iov = iov;
+      msg.msg_iovlen = count;
+
+      int flags = MSG_DONTWAIT;
+#  if defined(MSG_NOSIGNAL)
+      flags |= MSG_NOSIGNAL;
+#  endif
+
+      ssize_t rv = ::sendmsg(m_handle, &msg, flags);
+      if (rv < 0)
+      {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+          return 0;
+        if (errno == EPIPE || errno == ECONNRESET)
+          throw ConnectionClosed();
+        throw NetworkError(DTR("error sending data"), getLastErrorMessage());
+      }
+
+      return static_cast<size_t>(rv);
+#else
+      size_t total = 0;
+      for (unsigned i = 0; i < count; ++i)
+      {
+        size_t rv = doWrite(bfrs[i], sizes[i]);
+        total += rv;
+        if (rv < sizes[i])
+          break;
+      }
+
+      return total;
+#endif
+    }
+
     void
     TCPSocket::doFlushInput(void)
     {
@@ -77,6 +77,20 @@ namespace DUNE
       bool
       writeFile(const char* filename, int64_t off_end, int64_t off_beg = -1);
 
+      //! Write a sequence of buffers with a single system call,
+      //! without blocking. Only part of the data is written if the
+      //! socket send buffer fills up.
+      //! @param[in] bfrs buffers.
+      //! @param[in] sizes size of each buffer.
+      //! @param[in] count number of buffers, at most
+      //! c_max_write_buffers are used.
+      //! @return number of bytes written, 0 if the send buffer is full.
+      size_t
+      writeNonBlocking(const uint8_t* const* bfrs, const size_t* sizes, unsigned count);
+
+      //! Maximum number of buffers used by writeNonBlocking().
+      static const unsigned c_max_write_buffers = 64;
+
       //! Enable/disable keep-alive messages. When enabled connections
       //! are kept active by periodically transmitting messages.
       //! @param[in] enabled true to enable this feature, false to
@@ -29,6 +29,7 @@
 
 // ISO C++ 98 headers.
 #include <cerrno>
+#include <cstring>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
@@ -36,6 +37,7 @@
 #include <DUNE/Network/UDPSocket.hpp>
 #include <DUNE/Network/Exceptions.hpp>
 #include <DUNE/Utils/ByteCopy.hpp>
+#include <DUNE/IO/Poll.hpp>
 
 // Win32 headers.
 #if defined(DUNE_SYS_HAS_WINSOCK2_H)
@@ -94,7 +96,9 @@ namespace DUNE
   namespace Network
   {
     UDPSocket::UDPSocket(void):
-      m_con_port(0)
+      m_con_port(0),
+      m_drop_counter(false),
+      m_drops(0)
     {
       //  POSIX / Win32
 #if defined(DUNE_SYS_HAS_SOCKET)
@@ -232,6 +236,159 @@ namespace DUNE
       return rv;
     }
 
+    unsigned
+    UDPSocket::writeMultiple(const uint8_t* buffer, size_t size, const Address* addrs,
+                             const uint16_t* ports, unsigned count)
+    {
+      unsigned sent = 0;
+
+#if defined(DUNE_SYS_HAS_SENDMMSG)
+      mmsghdr msgs[c_max_batch];
+      sockaddr_in hosts[c_max_batch];
+      iovec iov;
+      iov.iov_base = const_cast<uint8_t*>(buffer);
+      iov.iov_len = size;
+
+      unsigned next = 0;
+      while (next < count)
+      {
+        unsigned n = count - next;
+        if (n > c_max_batch)
+          n = c_max_batch;
+
+        std::memset(msgs, 0, n * sizeof(mmsghdr));
+        for (unsigned i = 0; i < n; ++i)
+        {
+          hosts[i].sin_family = AF_INET;
+          hosts[i].sin_port = Utils::ByteCopy::toBE(ports[next + i]);
+          hosts[i].sin_addr.s_addr = addrs[next + i].toInteger();
+          msgs[i].msg_hdr.msg_name = &hosts[i];
+          msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+          msgs[i].msg_hdr.msg_iov = &iov;
+          msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        // Datagrams after the first failed one are retried.
+        int rv = sendmmsg(m_handle, msgs, n, 0);
+        if (rv > 0)
+        {
+          sent += rv;
+          next += rv;
+        }
+        else
+        {
+          ++next;
+        }
+      }
+#else
+      for (unsigned i = 0; i < count; ++i)
+      {
+        try
+        {
+          write(buffer, size, addrs[i], ports[i]);
+          ++sent;
+        }
+        catch (std::runtime_error&)
+        { }
+      }
+#endif
+
+      return sent;
+    }
+
+    unsigned
+    UDPSocket::readMultiple(uint8_t* const* buffers, size_t size, size_t* sizes,
+                            Address* addrs, uint16_t* ports, unsigned count)
+    {
+#if defined(DUNE_SYS_HAS_RECVMMSG)
+      mmsghdr msgs[c_max_batch];
+      sockaddr_in hosts[c_max_batch];
+      iovec iovs[c_max_batch];
+#  if defined(SO_RXQ_OVFL)
+      uint8_t ctls[c_max_batch][CMSG_SPACE(sizeof(uint32_t))];
+#  endif
+
+      unsigned n = count;
+      if (n > c_max_batch)
+        n = c_max_batch;
+
+      std::memset(msgs, 0, n * sizeof(mmsghdr));
+      for (unsigned i = 0; i < n; ++i)
+      {
+        iovs[i].iov_base = buffers[i];
+        iovs[i].iov_len = size;
+        msgs[i].msg_hdr.msg_name = &hosts[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+#  if defined(SO_RXQ_OVFL)
+        if (m_drop_counter)
+        {
+          msgs[i].msg_hdr.msg_control = ctls[i];
+          msgs[i].msg_hdr.msg_controllen = sizeof(ctls[i]);
+        }
+#  endif
+      }
+
+      int rv = recvmmsg(m_handle, msgs, n, MSG_DONTWAIT, NULL);
+      if (rv < 0)
+      {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+          return 0;
+
+        throw NetworkError(DTR("error receiving data"), DUNE_SOCKET_ERROR);
+      }
+
+      for (int i = 0; i < rv; ++i)
+      {
+        sizes[i] = msgs[i].msg_len;
+
+        if (addrs != NULL)
+          addrs[i] = (::sockaddr*)&hosts[i];
+
+        if (ports != NULL)
+          ports[i] = Utils::ByteCopy::fromBE(hosts[i].sin_port);
+
+#  if defined(SO_RXQ_OVFL)
+        if (!m_drop_counter)
+          continue;
+
+        msghdr* hdr = &msgs[i].msg_hdr;
+        for (cmsghdr* cmsg = CMSG_FIRSTHDR(hdr); cmsg != NULL; cmsg = CMSG_NXTHDR(hdr, cmsg))
+        {
+          if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_RXQ_OVFL)
+            std::memcpy(&m_drops, CMSG_DATA(cmsg), sizeof(m_drops));
+        }
+#  endif
+      }
+
+      return rv;
+#else
+      (void)count;
+
+      if (!IO::Poll::poll(*this, 0))
+        return 0;
+
+      sizes[0] = read(buffers[0], size, addrs, ports);
+      return 1;
+#endif
+    }
+
+    bool
+    UDPSocket::enableDropCounter(void)
+    {
+#if defined(DUNE_SYS_HAS_RECVMMSG) && defined(SO_RXQ_OVFL)
+      int on = 1;
+      if (setsockopt(m_handle, SOL_SOCKET, SO_RXQ_OVFL, (char*)&on, sizeof(on)) < 0)
+        return false;
+
+      m_drop_counter = true;
+      return true;
+#else
+      return false;
+#endif
+    }
+
     void
     UDPSocket::createEventHandle(void)
     {
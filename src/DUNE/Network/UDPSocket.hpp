@@ -97,6 +97,53 @@ namespace DUNE
       size_t
       read(uint8_t* buffer, size_t size, Address* addr = NULL, uint16_t* port = NULL);
 
+      //! Send the same datagram to several hosts. Where sendmmsg()
+      //! is available each batch of hosts costs a single system
+      //! call. Failures to reach individual hosts are not reported.
+      //! @param[in] buffer datagram.
+      //! @param[in] size datagram length.
+      //! @param[in] addrs destination addresses.
+      //! @param[in] ports destination ports.
+      //! @param[in] count number of destinations.
+      //! @return number of hosts the datagram was sent to.
+      unsigned
+      writeMultiple(const uint8_t* buffer, size_t size, const Address* addrs,
+                    const uint16_t* ports, unsigned count);
+
+      //! Receive the datagrams queued in the socket without blocking.
+      //! Where recvmmsg() is available up to c_max_batch datagrams
+      //! are received with a single system call.
+      //! @param[in] buffers destination buffers.
+      //! @param[in] size capacity of each destination buffer.
+      //! @param[out] sizes length of each received datagram.
+      //! @param[out] addrs source addresses (may be NULL).
+      //! @param[out] ports source ports (may be NULL).
+      //! @param[in] count number of destination buffers.
+      //! @return number of received datagrams, 0 if none was queued.
+      unsigned
+      readMultiple(uint8_t* const* buffers, size_t size, size_t* sizes,
+                   Address* addrs, uint16_t* ports, unsigned count);
+
+      //! Ask the system to report the number of datagrams dropped
+      //! because the receive buffer was full. See getDropCount().
+      //! @return true if supported, false otherwise.
+      bool
+      enableDropCounter(void);
+
+      //! Retrieve the number of datagrams dropped by the system, as
+      //! reported along with the last datagrams received with
+      //! readMultiple().
+      //! @return number of dropped datagrams since the socket was
+      //! created.
+      uint32_t
+      getDropCount(void) const
+      {
+        return m_drops;
+      }
+
+      //! Maximum number of datagrams handled per system call.
+      static const unsigned c_max_batch = 64;
+
     private:
       //! Platform specific handle.
 #if defined(DUNE_OS_WINDOWS)
@@ -110,6 +157,10 @@ namespace DUNE
       Address m_con_addr;
       //! Connected port.
       unsigned m_con_port;
+      //! True if the drop counter is enabled.
+      bool m_drop_counter;
+      //! Datagrams dropped by the system.
+      uint32_t m_drops;
 
       IO::NativeHandle
       doGetNative(void) const
@@ -0,0 +1,476 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/System/Error.hpp>
+#include <DUNE/Simulation/Terrain.hpp>
+
+#if defined(DUNE_SYS_HAS_MMAP)
+#  include <sys/mman.h>
+#  include <sys/types.h>
+#  include <sys/stat.h>
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+namespace DUNE
+{
+  namespace Simulation
+  {
+    //! File magic.
+    static const char c_magic[] = {'D', 'T', 'R', 'N'};
+    //! Byte order marker, files are written in host byte order.
+    static const uint32_t c_byte_order = 0x01020304;
+    //! File version.
+    static const uint32_t c_version = 2;
+    //! Size of the file header, keeps node data 8-byte aligned.
+    static const size_t c_header_size = 80;
+    //! Maximum number of nodes.
+    static const uint64_t c_max_nodes = 1 << 28;
+    //! Number of bisections to refine a ray hit.
+    static const unsigned c_ray_refinements = 8;
+
+    //! Node without depth.
+    static inline bool
+    isEmpty(float value)
+    {
+      return value != value;
+    }
+
+    Terrain::Terrain(void):
+      m_tile_cols(0),
+      m_nodes(NULL),
+      m_map(NULL),
+      m_map_size(0)
+    {
+      std::memset(&m_header, 0, sizeof(m_header));
+    }
+
+    Terrain::~Terrain(void)
+    {
+      clear();
+    }
+
+    size_t
+    Terrain::getStorageSize(void) const
+    {
+      size_t tile_rows = (m_header.rows + c_tile - 1) / c_tile;
+      return tile_rows * m_tile_cols * c_tile * c_tile;
+    }
+
+    void
+    Terrain::clear(void)
+    {
+#if defined(DUNE_SYS_HAS_MMAP)
+      if (m_map != NULL)
+        munmap(m_map, m_map_size);
+#endif
+
+      m_map = NULL;
+      m_map_size = 0;
+      m_nodes = NULL;
+      m_storage.clear();
+    }
+
+    void
+    Terrain::allocate(unsigned rows, unsigned cols)
+    {
+      if ((uint64_t)rows * cols > c_max_nodes)
+        throw Error("grid too large, increase the cell size");
+
+      clear();
+      m_header.rows = rows;
+      m_header.cols = cols;
+      m_tile_cols = (cols + c_tile - 1) / c_tile;
+      m_storage.assign(getStorageSize(), std::numeric_limits<float>::quiet_NaN());
+      m_nodes = &m_storage[0];
+    }
+
+    void
+    Terrain::build(const std::vector<Sample>& samples, double cell, double radius)
+    {
+      if (samples.empty())
+        throw Error("no samples");
+
+      m_header.build_cell = cell;
+      m_header.build_radius = radius;
+
+      double min_x = samples[0].x;
+      double max_x = samples[0].x;
+      double min_y = samples[0].y;
+      double max_y = samples[0].y;
+
+      for (size_t i = 1; i < samples.size(); ++i)
+      {
+        min_x = std::min(min_x, samples[i].x);
+        max_x = std::max(max_x, samples[i].x);
+        min_y = std::min(min_y, samples[i].y);
+        max_y = std::max(max_y, samples[i].y);
+      }
+
+      if (cell <= 0)
+      {
+        double area = std::max((max_x - min_x) * (max_y - min_y), 1.0);
+        cell = std::sqrt(area / samples.size());
+      }
+
+      double rows = std::floor((max_x - min_x) / cell) + 2;
+      double cols = std::floor((max_y - min_y) / cell) + 2;
+      if (rows * cols > c_max_nodes)
+        throw Error("grid too large, increase the cell size");
+
+      m_header.origin_x = min_x;
+      m_header.origin_y = min_y;
+      m_header.cell = cell;
+      allocate((unsigned)rows, (unsigned)cols);
+
+      // Work in row-major order, distances to the source sample of
+      // each node.
+      size_t count = m_header.rows * m_header.cols;
+      std::vector<float> depth(count, std::numeric_limits<float>::quiet_NaN());
+      std::vector<float> dist(count, std::numeric_limits<float>::infinity());
+
+      for (size_t i = 0; i < samples.size(); ++i)
+      {
+        double gx = (samples[i].x - min_x) / cell;
+        double gy = (samples[i].y - min_y) / cell;
+        unsigned r = (unsigned)(gx + 0.5);
+        unsigned c = (unsigned)(gy + 0.5);
+        float d = (float)(cell * std::sqrt((gx - r) * (gx - r) + (gy - c) * (gy - c)));
+
+        size_t n = r * m_header.cols + c;
+        if (d < dist[n])
+        {
+          dist[n] = d;
+          depth[n] = (float)samples[i].depth;
+        }
+      }
+
+      // Grow covered areas one node per pass.
+      unsigned passes = (unsigned)std::ceil(radius / cell);
+      std::vector<float> prev_depth;
+      std::vector<float> prev_dist;
+
+      for (unsigned pass = 0; pass < passes; ++pass)
+      {
+        prev_depth = depth;
+        prev_dist = dist;
+        bool grown = false;
+
+        for (unsigned r = 0; r < m_header.rows; ++r)
+        {
+          for (unsigned c = 0; c < m_header.cols; ++c)
+          {
+            size_t n = r * m_header.cols + c;
+            if (!isEmpty(prev_depth[n]))
+              continue;
+
+            for (int i = -1; i <= 1; ++i)
+            {
+              for (int j = -1; j <= 1; ++j)
+              {
+                int nr = (int)r + i;
+                int nc = (int)c + j;
+                if (nr < 0 || nc < 0 || nr >= (int)m_header.rows || nc >= (int)m_header.cols)
+                  continue;
+
+                size_t m = nr * m_header.cols + nc;
+                if (isEmpty(prev_depth[m]))
+                  continue;
+
+                float d = prev_dist[m] + (float)(cell * std::sqrt((double)(i * i + j * j)));
+                if (d <= radius && d < dist[n])
+                {
+                  dist[n] = d;
+                  depth[n] = prev_depth[m];
+                  grown = true;
+                }
+              }
+            }
+          }
+        }
+
+        if (!grown)
+          break;
+      }
+
+      for (unsigned r = 0; r < m_header.rows; ++r)
+      {
+        for (unsigned c = 0; c < m_header.cols; ++c)
+          m_storage[index(r, c)] = depth[r * m_header.cols + c];
+      }
+    }
+
+    void
+    Terrain::load(const std::string& file)
+    {
+      clear();
+
+      char hdr[c_header_size];
+      const char* base = NULL;
+      size_t size = 0;
+
+#if defined(DUNE_SYS_HAS_MMAP)
+      int fd = open(file.c_str(), O_RDONLY);
+      if (fd < 0)
+        throw System::Error(errno, "opening terrain", file);
+
+      struct stat st;
+      if (fstat(fd, &st) != 0)
+      {
+        int error = errno;
+        ::close(fd);
+        throw System::Error(error, "opening terrain", file);
+      }
+
+      size = st.st_size;
+      if (size >= c_header_size)
+      {
+        void* addr = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED)
+        {
+          int error = errno;
+          ::close(fd);
+          throw System::Error(error, "mapping terrain", file);
+        }
+
+        m_map = addr;
+        m_map_size = size;
+        base = static_cast<const char*>(addr);
+      }
+
+      ::close(fd);
+
+      if (base == NULL)
+        throw Error("truncated file: " + file);
+
+      std::memcpy(hdr, base, c_header_size);
+#else
+      std::ifstream ifs(file.c_str(), std::ios::binary);
+      if (!ifs.is_open())
+        throw System::Error(errno, "opening terrain", file);
+
+      ifs.seekg(0, std::ios::end);
+      size = ifs.tellg();
+      ifs.seekg(0, std::ios::beg);
+      if (!ifs.read(hdr, c_header_size))
+        throw Error("truncated file: " + file);
+#endif
+
+      uint32_t order = 0;
+      uint32_t version = 0;
+      uint32_t tile = 0;
+      std::memcpy(&order, hdr + 4, 4);
+      std::memcpy(&version, hdr + 8, 4);
+      std::memcpy(&m_header.rows, hdr + 12, 4);
+      std::memcpy(&m_header.cols, hdr + 16, 4);
+      std::memcpy(&tile, hdr + 20, 4);
+      std::memcpy(&m_header.origin_x, hdr + 24, 8);
+      std::memcpy(&m_header.origin_y, hdr + 32, 8);
+      std::memcpy(&m_header.cell, hdr + 40, 8);
+      std::memcpy(&m_header.ref_lat, hdr + 48, 8);
+      std::memcpy(&m_header.ref_lon, hdr + 56, 8);
+      std::memcpy(&m_header.build_cell, hdr + 64, 8);
+      std::memcpy(&m_header.build_radius, hdr + 72, 8);
+
+      if (std::memcmp(hdr, c_magic, sizeof(c_magic)) != 0 || version != c_version)
+      {
+        clear();
+        throw Error("invalid file: " + file);
+      }
+
+      if (order != c_byte_order || tile != c_tile)
+      {
+        clear();
+        throw Error("file built for another system: " + file);
+      }
+
+      m_tile_cols = (m_header.cols + c_tile - 1) / c_tile;
+      size_t count = getStorageSize();
+      if ((uint64_t)m_header.rows * m_header.cols > c_max_nodes
+          || size < c_header_size + count * sizeof(float))
+      {
+        clear();
+        throw Error("truncated file: " + file);
+      }
+
+#if defined(DUNE_SYS_HAS_MMAP)
+      m_nodes = reinterpret_cast<const float*>(base + c_header_size);
+#else
+      m_storage.resize(count);
+      ifs.read(reinterpret_cast<char*>(&m_storage[0]), count * sizeof(float));
+      m_nodes = &m_storage[0];
+#endif
+    }
+
+    void
+    Terrain::save(const std::string& file) const
+    {
+      if (m_nodes == NULL)
+        throw Error("saving empty terrain");
+
+      char hdr[c_header_size];
+      std::memset(hdr, 0, sizeof(hdr));
+      uint32_t tile = c_tile;
+      std::memcpy(hdr, c_magic, sizeof(c_magic));
+      std::memcpy(hdr + 4, &c_byte_order, 4);
+      std::memcpy(hdr + 8, &c_version, 4);
+      std::memcpy(hdr + 12, &m_header.rows, 4);
+      std::memcpy(hdr + 16, &m_header.cols, 4);
+      std::memcpy(hdr + 20, &tile, 4);
+      std::memcpy(hdr + 24, &m_header.origin_x, 8);
+      std::memcpy(hdr + 32, &m_header.origin_y, 8);
+      std::memcpy(hdr + 40, &m_header.cell, 8);
+      std::memcpy(hdr + 48, &m_header.ref_lat, 8);
+      std::memcpy(hdr + 56, &m_header.ref_lon, 8);
+      std::memcpy(hdr + 64, &m_header.build_cell, 8);
+      std::memcpy(hdr + 72, &m_header.build_radius, 8);
+
+      std::string tmp = file + ".tmp";
+      std::ofstream ofs(tmp.c_str(), std::ios::binary);
+      if (!ofs.is_open())
+        throw System::Error(errno, "creating terrain", tmp);
+
+      ofs.write(hdr, c_header_size);
+      ofs.write(reinterpret_cast<const char*>(m_nodes), getStorageSize() * sizeof(float));
+      ofs.close();
+
+      if (!ofs)
+      {
+        int error = errno;
+        std::remove(tmp.c_str());
+        throw System::Error(error, "writing terrain", tmp);
+      }
+
+#if defined(DUNE_OS_WINDOWS)
+      // Windows does not replace existing files on rename.
+      std::remove(file.c_str());
+#endif
+
+      if (std::rename(tmp.c_str(), file.c_str()) != 0)
+      {
+        int error = errno;
+        std::remove(tmp.c_str());
+        throw System::Error(error, "renaming terrain", file);
+      }
+    }
+
+    bool
+    Terrain::depthAt(double x, double y, double& depth) const
+    {
+      if (m_nodes == NULL)
+        return false;
+
+      double gx = (x - m_header.origin_x) / m_header.cell;
+      double gy = (y - m_header.origin_y) / m_header.cell;
+      if (!(gx >= 0 && gy >= 0 && gx <= m_header.rows - 1 && gy <= m_header.cols - 1))
+        return false;
+
+      unsigned r0 = (unsigned)gx;
+      unsigned c0 = (unsigned)gy;
+      unsigned r1 = std::min(r0 + 1, m_header.rows - 1);
+      unsigned c1 = std::min(c0 + 1, m_header.cols - 1);
+      double fx = gx - r0;
+      double fy = gy - c0;
+
+      float v[4] = {m_nodes[index(r0, c0)], m_nodes[index(r0, c1)],
+                    m_nodes[index(r1, c0)], m_nodes[index(r1, c1)]};
+      double w[4] = {(1 - fx) * (1 - fy), (1 - fx) * fy,
+                     fx * (1 - fy), fx * fy};
+
+      double sum = 0;
+      double weight = 0;
+      for (unsigned i = 0; i < 4; ++i)
+      {
+        if (isEmpty(v[i]))
+          continue;
+
+        sum += w[i] * v[i];
+        weight += w[i];
+      }
+
+      if (weight <= 0)
+        return false;
+
+      depth = sum / weight;
+      return true;
+    }
+
+    bool
+    Terrain::rayCast(double x, double y, double z, double dx, double dy, double dz,
+                     double max_range, double& range) const
+    {
+      if (m_nodes == NULL)
+        return false;
+
+      // March at half the node spacing, bilinear depths cannot
+      // change slope in between.
+      double step = m_header.cell / 2;
+      double prev = 0;
+
+      for (double t = 0; ; t += step)
+      {
+        if (t > max_range)
+          t = max_range;
+
+        double d;
+        if (depthAt(x + t * dx, y + t * dy, d) && z + t * dz >= d)
+        {
+          double lo = prev;
+          double hi = t;
+          for (unsigned i = 0; i < c_ray_refinements && hi > lo; ++i)
+          {
+            double mid = (lo + hi) / 2;
+            if (depthAt(x + mid * dx, y + mid * dy, d) && z + mid * dz >= d)
+              hi = mid;
+            else
+              lo = mid;
+          }
+
+          range = hi;
+          return true;
+        }
+
+        if (t >= max_range)
+          return false;
+
+        prev = t;
+      }
+    }
+  }
+}
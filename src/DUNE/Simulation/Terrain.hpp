@@ -0,0 +1,269 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef DUNE_SIMULATION_TERRAIN_HPP_INCLUDED_
+#define DUNE_SIMULATION_TERRAIN_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Simulation
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Terrain;
+
+    //! Gridded depth map. Depths are stored in square tiles of
+    //! c_tile x c_tile nodes so that neighbouring nodes share cache
+    //! lines, and can be saved to and memory mapped from a binary
+    //! file. Coordinates are north/east offsets in meters from a
+    //! WGS-84 reference.
+    class Terrain
+    {
+    public:
+      //! Terrain error.
+      class Error: public std::runtime_error
+      {
+      public:
+        Error(const std::string& msg):
+          std::runtime_error("terrain error: " + msg)
+        { }
+      };
+
+      //! Scattered depth measurement.
+      struct Sample
+      {
+        //! North offset (m).
+        double x;
+        //! East offset (m).
+        double y;
+        //! Depth (m).
+        double depth;
+      };
+
+      //! Tile side in nodes.
+      static const unsigned c_tile = 16;
+
+      //! Constructor.
+      Terrain(void);
+
+      //! Destructor.
+      ~Terrain(void);
+
+      //! Grid scattered samples. Each node takes the depth of the
+      //! nearest sample in its cell, nodes without samples take the
+      //! depth of the nearest node with one, up to a given radius.
+      //! @param[in] samples depth samples.
+      //! @param[in] cell node spacing (m), zero to estimate it from
+      //! the sample density.
+      //! @param[in] radius maximum distance (m) between a node and
+      //! the sample that defines its depth.
+      void
+      build(const std::vector<Sample>& samples, double cell, double radius);
+
+      //! Load a terrain file. The file is memory mapped when the
+      //! system supports it.
+      //! @param[in] file terrain file.
+      void
+      load(const std::string& file);
+
+      //! Save the terrain to a file. The file is written under a
+      //! temporary name and renamed into place, so readers never see
+      //! a partially written file.
+      //! @param[in] file terrain file.
+      void
+      save(const std::string& file) const;
+
+      //! Set the WGS-84 reference of the offsets.
+      //! @param[in] lat latitude (rad).
+      //! @param[in] lon longitude (rad).
+      void
+      setReference(double lat, double lon)
+      {
+        m_header.ref_lat = lat;
+        m_header.ref_lon = lon;
+      }
+
+      //! Get the reference latitude.
+      //! @return latitude (rad).
+      double
+      getReferenceLatitude(void) const
+      {
+        return m_header.ref_lat;
+      }
+
+      //! Get the reference longitude.
+      //! @return longitude (rad).
+      double
+      getReferenceLongitude(void) const
+      {
+        return m_header.ref_lon;
+      }
+
+      //! Get the number of node rows (north).
+      unsigned
+      getRows(void) const
+      {
+        return m_header.rows;
+      }
+
+      //! Get the number of node columns (east).
+      unsigned
+      getColumns(void) const
+      {
+        return m_header.cols;
+      }
+
+      //! Get the node spacing.
+      //! @return spacing (m).
+      double
+      getCellSize(void) const
+      {
+        return m_header.cell;
+      }
+
+      //! Get the node spacing requested when the terrain was built.
+      //! @return requested spacing (m), zero if it was estimated.
+      double
+      getRequestedCellSize(void) const
+      {
+        return m_header.build_cell;
+      }
+
+      //! Get the interpolation radius the terrain was built with.
+      //! @return radius (m).
+      double
+      getInterpolationRadius(void) const
+      {
+        return m_header.build_radius;
+      }
+
+      //! Check if the terrain is memory mapped.
+      bool
+      isMapped(void) const
+      {
+        return m_map != NULL;
+      }
+
+      //! Bilinear depth interpolation. Nodes without depth are left
+      //! out of the interpolation.
+      //! @param[in] x north offset (m).
+      //! @param[in] y east offset (m).
+      //! @param[out] depth depth (m).
+      //! @return true if the position is covered by the terrain.
+      bool
+      depthAt(double x, double y, double& depth) const;
+
+      //! Find where a ray meets the bottom.
+      //! @param[in] x north offset of the origin (m).
+      //! @param[in] y east offset of the origin (m).
+      //! @param[in] z depth of the origin (m).
+      //! @param[in] dx north component of the unit direction.
+      //! @param[in] dy east component of the unit direction.
+      //! @param[in] dz down component of the unit direction.
+      //! @param[in] max_range maximum range (m).
+      //! @param[out] range distance to the bottom (m).
+      //! @return true if the bottom is hit within the maximum range.
+      bool
+      rayCast(double x, double y, double z, double dx, double dy, double dz,
+              double max_range, double& range) const;
+
+    private:
+      //! File and grid description.
+      struct Header
+      {
+        //! Number of node rows.
+        uint32_t rows;
+        //! Number of node columns.
+        uint32_t cols;
+        //! North offset of the first node (m).
+        double origin_x;
+        //! East offset of the first node (m).
+        double origin_y;
+        //! Node spacing (m).
+        double cell;
+        //! Reference latitude (rad).
+        double ref_lat;
+        //! Reference longitude (rad).
+        double ref_lon;
+        //! Node spacing given to build() (m).
+        double build_cell;
+        //! Interpolation radius given to build() (m).
+        double build_radius;
+      };
+
+      //! Grid description.
+      Header m_header;
+      //! Number of tile columns.
+      unsigned m_tile_cols;
+      //! Node depths, tile by tile.
+      const float* m_nodes;
+      //! Node storage when not mapped.
+      std::vector<float> m_storage;
+      //! Mapped file.
+      void* m_map;
+      //! Size of the mapped file.
+      size_t m_map_size;
+
+      //! Get the index of a node.
+      size_t
+      index(unsigned row, unsigned col) const
+      {
+        return ((row / c_tile) * m_tile_cols + col / c_tile) * c_tile * c_tile
+        + (row % c_tile) * c_tile + col % c_tile;
+      }
+
+      //! Get the number of stored nodes, including padding.
+      size_t
+      getStorageSize(void) const;
+
+      //! Allocate storage for a given grid.
+      void
+      allocate(unsigned rows, unsigned cols);
+
+      //! Release the current grid.
+      void
+      clear(void);
+
+      // Non-copyable.
+      Terrain(const Terrain&);
+
+      Terrain&
+      operator=(const Terrain&);
+    };
+  }
+}
+
+#endif
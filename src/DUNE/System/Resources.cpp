@@ -225,5 +225,17 @@ namespace DUNE
       (void)length;
 #endif
     }
+
+    unsigned
+    Resources::getProcessorCount(void)
+    {
+#if defined(DUNE_SYS_HAS_UNISTD_H) && defined(_SC_NPROCESSORS_ONLN)
+      long count = sysconf(_SC_NPROCESSORS_ONLN);
+      if (count > 0)
+        return (unsigned)count;
+#endif
+
+      return 1;
+    }
   }
 }
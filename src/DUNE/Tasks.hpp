@@ -47,6 +47,9 @@ namespace DUNE
 #include <DUNE/Tasks/Manager.hpp>
 #include <DUNE/Tasks/AbstractConsumer.hpp>
 #include <DUNE/Tasks/Recipient.hpp>
+#include <DUNE/Tasks/Mailbox.hpp>
+#include <DUNE/Tasks/TimerWheel.hpp>
+#include <DUNE/Tasks/WorkerPool.hpp>
 #include <DUNE/Tasks/AbstractCreator.hpp>
 #include <DUNE/Tasks/ParameterTable.hpp>
 #include <DUNE/Tasks/SimpleTransport.hpp>
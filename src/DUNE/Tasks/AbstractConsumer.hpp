@@ -32,6 +32,7 @@
 
 // DUNE headers.
 #include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/SharedMessage.hpp>
 
 namespace DUNE
 {
@@ -49,6 +50,17 @@ namespace DUNE
       virtual void
       consume(const IMC::Message*) = 0;
 
+      //! Consume a shared message. Consumers that need to keep or
+      //! modify the message should override this function, the
+      //! default implementation forwards a read-only view of the
+      //! message to consume(const IMC::Message*).
+      //! @param msg message handle.
+      virtual void
+      consume(const IMC::SharedMessage& msg)
+      {
+        consume(msg.get());
+      }
+
       virtual
       ~AbstractConsumer(void)
       { }
@@ -37,6 +37,7 @@
 // DUNE headers.
 #include <DUNE/Concurrency/Thread.hpp>
 #include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/SharedMessage.hpp>
 
 namespace DUNE
 {
@@ -56,10 +57,20 @@ namespace DUNE
       ~AbstractTask(void)
       { }
 
-      //! Queue a message for later consumption.
-      //! @param msg message object.
+      //! Queue a message for later consumption. The message is
+      //! shared with other recipients and must not be modified.
+      //! @param msg message handle.
       virtual void
-      receive(const IMC::Message* msg) = 0;
+      receive(const IMC::SharedMessage& msg) = 0;
+
+      //! Retrieve the number of messages queued for consumption.
+      //! Any thread may call this function.
+      //! @return approximate number of queued messages.
+      virtual unsigned
+      getBacklog(void) const
+      {
+        return 0;
+      }
 
       //! Retrieve task name.
       //! @return task name.
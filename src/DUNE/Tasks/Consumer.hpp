@@ -62,6 +62,42 @@ namespace DUNE
       T& m_obj;
       Routine m_fun;
     };
+
+    //! Consumer of shared message handles. The consumer method may
+    //! keep a copy of the handle to retain the message without
+    //! copying it, or use SharedMessage::getMutable() to obtain a
+    //! private modifiable copy.
+    template <typename T>
+    class SharedConsumer: public AbstractConsumer
+    {
+    public:
+      typedef void (T::* Routine)(const IMC::SharedMessage&);
+
+      //! Constructor.
+      SharedConsumer(T& o, Routine f):
+        m_obj(o),
+        m_fun(f)
+      { }
+
+      void
+      consume(const IMC::Message* msg)
+      {
+        ((m_obj).*(m_fun))(IMC::SharedMessage::copy(*msg));
+      }
+
+      void
+      consume(const IMC::SharedMessage& msg)
+      {
+        ((m_obj).*(m_fun))(msg);
+      }
+
+      ~SharedConsumer(void)
+      { }
+
+    private:
+      T& m_obj;
+      Routine m_fun;
+    };
   }
 }
 
@@ -27,6 +27,9 @@
 // Author: Ricardo Martins                                                  *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <cstddef>
+
 // DUNE headers.
 #include <DUNE/System/Environment.hpp>
 #include <DUNE/Tasks/Context.hpp>
@@ -37,7 +40,9 @@ namespace DUNE
 {
   namespace Tasks
   {
-    Context::Context(void)
+    Context::Context(void):
+      workers(NULL),
+      timers(NULL)
     {
       using FileSystem::Path;
 
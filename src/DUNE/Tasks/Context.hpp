@@ -47,6 +47,10 @@ namespace DUNE
 {
   namespace Tasks
   {
+    // Forward declarations.
+    class TimerWheel;
+    class WorkerPool;
+
     // Export DLL Symbol.
     struct DUNE_DLL_SYM Context;
 
@@ -66,6 +70,11 @@ namespace DUNE
       Entities::EntityDataBase entities;
       //! Execution profiles.
       Profiles profiles;
+      //! Worker pool shared by tasks that do not own a thread (may
+      //! be NULL).
+      WorkerPool* workers;
+      //! Timer wheel driving periodic tasks (may be NULL).
+      TimerWheel* timers;
       //! DUNE's directory.
       FileSystem::Path dir_app;
       //! Path to configuration directory.
@@ -0,0 +1,465 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/IO/Reactor.hpp>
+#include <DUNE/Tasks/Mailbox.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    //! Number of slots of messages coalesced by source.
+    static const unsigned c_source_slots = 32;
+
+    //! Counts a thread as a producer while in scope.
+    struct ProducerScope
+    {
+      ProducerScope(Concurrency::AtomicCounter& counter):
+        m_counter(counter)
+      {
+        m_counter.add(1);
+      }
+
+      ~ProducerScope(void)
+      {
+        m_counter.sub(1);
+      }
+
+      //! Number of producers.
+      Concurrency::AtomicCounter& m_counter;
+    };
+
+    Mailbox::Mailbox(unsigned capacity):
+      m_queue(new Queue(capacity))
+    { }
+
+    Mailbox::~Mailbox(void)
+    {
+      m_old_queues.push_back(m_queue.get());
+
+      for (size_t i = 0; i < m_old_queues.size(); ++i)
+      {
+        Entry entry;
+        while (m_old_queues[i]->pop(entry))
+          discard(entry);
+
+        delete m_old_queues[i];
+      }
+
+      for (size_t i = 0; i < m_evicted.size(); ++i)
+        discard(m_evicted[i]);
+
+      for (size_t i = 0; i < m_overflow.size(); ++i)
+        discard(m_overflow[i]);
+
+      for (size_t i = 0; i < m_slots.size(); ++i)
+      {
+        for (unsigned j = 0; j < m_slots[i].second; ++j)
+          IMC::SharedMessage::adopt(m_slots[i].first[j].msg.get());
+
+        delete [] m_slots[i].first;
+      }
+
+      delete m_settings.get();
+      for (size_t i = 0; i < m_retired.size(); ++i)
+        delete m_retired[i];
+    }
+
+    void
+    Mailbox::setCapacity(unsigned capacity)
+    {
+      Queue* old = m_queue.get();
+      if (capacity == old->getCapacity())
+        return;
+
+      m_queue.set(new Queue(capacity));
+      m_old_queues.push_back(old);
+    }
+
+    void
+    Mailbox::setOverflowPolicy(uint16_t id, OverflowPolicy policy)
+    {
+      Concurrency::ScopedMutex l(m_settings_lock);
+
+      const SettingsMap* current = m_settings.get();
+      SettingsMap* settings = (current == NULL) ? new SettingsMap : new SettingsMap(*current);
+      if (settings->find(id) == settings->end())
+      {
+        Settings& entry = (*settings)[id];
+        entry.policy = OP_GROW;
+        entry.slots = NULL;
+        entry.slot_count = 0;
+      }
+
+      unsigned slot_count = 0;
+      if (policy == OP_COALESCE_LATEST)
+        slot_count = 1;
+      else if (policy == OP_COALESCE_LATEST_BY_SOURCE)
+        slot_count = c_source_slots;
+
+      Settings& entry = (*settings)[id];
+      if (entry.policy != policy || entry.slot_count != slot_count)
+      {
+        entry.policy = policy;
+        entry.slots = NULL;
+        entry.slot_count = slot_count;
+
+        if (slot_count > 0)
+        {
+          entry.slots = new Slot[slot_count];
+          m_slots.push_back(std::make_pair(entry.slots, slot_count));
+        }
+      }
+
+      // Producers might still be using the old settings, they can
+      // only be reclaimed once no producer is delivering.
+      m_settings.set(settings);
+      if (current != NULL)
+        m_retired.push_back(current);
+
+      if (m_producers.value() == 0)
+      {
+        for (size_t i = 0; i < m_retired.size(); ++i)
+          delete m_retired[i];
+        m_retired.clear();
+      }
+    }
+
+    Mailbox::OverflowPolicy
+    Mailbox::getOverflowPolicy(uint16_t id) const
+    {
+      const SettingsMap* settings = m_settings.get();
+      if (settings == NULL)
+        return OP_GROW;
+
+      SettingsMap::const_iterator itr = settings->find(id);
+      if (itr == settings->end())
+        return OP_GROW;
+
+      return itr->second.policy;
+    }
+
+    bool
+    Mailbox::push(const IMC::SharedMessage& msg)
+    {
+      ProducerScope scope(m_producers);
+      Queue* queue = m_queue.get();
+      OverflowPolicy policy = OP_GROW;
+      Slot* slot = NULL;
+
+      const SettingsMap* settings = m_settings.get();
+      if (settings != NULL)
+      {
+        SettingsMap::const_iterator itr = settings->find(msg->getId());
+        if (itr != settings->end())
+        {
+          policy = itr->second.policy;
+          slot = findSlot(itr->second, msg.get());
+        }
+      }
+
+      Entry entry;
+
+      if (slot != NULL)
+      {
+        // Replace the latest message. If the slot was empty, the
+        // owner must be told to look at it.
+        IMC::SharedMessage handle(msg);
+        IMC::Message* old = slot->msg.swap(handle.detach());
+        if (old != NULL)
+        {
+          IMC::SharedMessage::adopt(old);
+          return true;
+        }
+
+        entry.slot = slot;
+        pushForced(queue, entry);
+        notify();
+        return true;
+      }
+
+      entry.msg = msg;
+      entry.lossless = (policy == OP_GROW);
+
+      // Once messages overflow, newer ones must queue behind them.
+      if (entry.lossless && m_spilled.value() != 0)
+      {
+        pushOverflow(entry);
+        notify();
+        return true;
+      }
+
+      if (queue->push(entry))
+      {
+        notify();
+        return true;
+      }
+
+      if (entry.lossless)
+      {
+        pushOverflow(entry);
+        notify();
+        return true;
+      }
+
+      if (policy == OP_DROP_OLDEST)
+      {
+        pushForced(queue, entry);
+        notify();
+        return true;
+      }
+
+      m_dropped.add(1);
+      return false;
+    }
+
+    unsigned
+    Mailbox::pop(IMC::SharedMessage* msgs, unsigned count)
+    {
+      unsigned n = 0;
+
+      // Messages left in replaced queues come first.
+      while (!m_old_queues.empty() && n < count)
+      {
+        Queue* queue = m_old_queues.front();
+        n += pop(queue, msgs + n, count - n);
+        if (n == count)
+          return n;
+
+        // The queue is drained and was unpublished before being
+        // retired: once no producer is delivering, nobody can still
+        // hold it.
+        if (m_producers.value() != 0 || !queue->empty())
+          break;
+
+        delete queue;
+        m_old_queues.erase(m_old_queues.begin());
+      }
+
+      // Entries set aside to make room are older than the queued ones.
+      if (n < count && m_spilled.value() != 0)
+        n += popSpilled(m_evicted, msgs + n, count - n);
+
+      n += pop(m_queue.get(), msgs + n, count - n);
+
+      // The overflow list is newer than anything in the queue.
+      if (n < count && m_spilled.value() != 0 && m_queue.get()->empty())
+        n += popSpilled(m_overflow, msgs + n, count - n);
+
+      return n;
+    }
+
+    unsigned
+    Mailbox::popSpilled(std::deque<Entry>& list, IMC::SharedMessage* msgs, unsigned count)
+    {
+      Concurrency::ScopedMutex l(m_overflow_lock);
+
+      unsigned n = 0;
+      while (n < count && !list.empty())
+      {
+        msgs[n++] = list.front().msg;
+        list.pop_front();
+        m_spilled.sub(1);
+      }
+
+      return n;
+    }
+
+    unsigned
+    Mailbox::pop(Queue* queue, IMC::SharedMessage* msgs, unsigned count)
+    {
+      unsigned n = 0;
+      Entry entry;
+
+      while (n < count && queue->pop(entry))
+      {
+        if (entry.slot == NULL)
+        {
+          msgs[n++] = entry.msg;
+          entry.msg.reset();
+          continue;
+        }
+
+        IMC::Message* msg = entry.slot->msg.swap(NULL);
+        if (msg != NULL)
+          msgs[n++] = IMC::SharedMessage::adopt(msg);
+      }
+
+      return n;
+    }
+
+    bool
+    Mailbox::wait(double timeout)
+    {
+      if (!empty())
+        return true;
+
+      if (m_interrupted.compareAndSwap(1, 0))
+        return !empty();
+
+      Concurrency::ScopedCondition l(m_cond);
+
+      // Producers check this flag after queuing a message. Either
+      // they see it or we see their message.
+      m_waiting.add(1);
+      if (empty() && m_interrupted.value() == 0)
+        m_cond.wait(timeout);
+      m_waiting.sub(1);
+
+      m_interrupted.compareAndSwap(1, 0);
+      return !empty();
+    }
+
+    bool
+    Mailbox::waitInterrupt(double timeout)
+    {
+      if (m_interrupted.compareAndSwap(1, 0))
+        return true;
+
+      Concurrency::ScopedCondition l(m_cond);
+
+      if (m_interrupted.value() == 0)
+        m_cond.wait(timeout);
+
+      return m_interrupted.compareAndSwap(1, 0);
+    }
+
+    void
+    Mailbox::interrupt(void)
+    {
+      if (!m_interrupted.compareAndSwap(0, 1))
+        return;
+
+      IO::Reactor* reactor = m_reactor.get();
+      if (reactor != NULL)
+        reactor->wakeUp();
+
+      // Always signal, the owner may be waiting in waitInterrupt()
+      // which producers do not wake up.
+      Concurrency::ScopedCondition l(m_cond);
+      m_cond.signal();
+    }
+
+    void
+    Mailbox::pushForced(Queue* queue, const Entry& entry)
+    {
+      Entry old;
+      while (!queue->push(entry))
+      {
+        if (!queue->pop(old))
+          continue;
+
+        if (!old.lossless)
+        {
+          discard(old);
+          continue;
+        }
+
+        Concurrency::ScopedMutex l(m_overflow_lock);
+        m_evicted.push_back(old);
+        m_spilled.add(1);
+      }
+    }
+
+    void
+    Mailbox::pushOverflow(const Entry& entry)
+    {
+      Concurrency::ScopedMutex l(m_overflow_lock);
+      m_overflow.push_back(entry);
+      m_spilled.add(1);
+      m_overflowed.add(1);
+    }
+
+    Mailbox::Slot*
+    Mailbox::findSlot(const Settings& settings, const IMC::Message* msg)
+    {
+      if (settings.slot_count == 0)
+        return NULL;
+
+      if (settings.policy == OP_COALESCE_LATEST)
+        return settings.slots;
+
+      // Open addressing, slots are claimed by the first message of a
+      // given source and never released.
+      int key = ((msg->getSource() << 8) | msg->getSourceEntity()) + 1;
+      unsigned start = (msg->getSource() * 31 + msg->getSourceEntity()) % settings.slot_count;
+
+      for (unsigned i = 0; i < settings.slot_count; ++i)
+      {
+        Slot* slot = &settings.slots[(start + i) % settings.slot_count];
+        int current = slot->key.value();
+
+        if (current == 0)
+        {
+          if (slot->key.compareAndSwap(0, key))
+            return slot;
+
+          current = slot->key.value();
+        }
+
+        if (current == key)
+          return slot;
+      }
+
+      // Too many sources, queue the message normally.
+      return NULL;
+    }
+
+    void
+    Mailbox::discard(Entry& entry)
+    {
+      if (entry.slot != NULL)
+        IMC::SharedMessage::adopt(entry.slot->msg.swap(NULL));
+
+      entry.msg.reset();
+      entry.slot = NULL;
+      m_dropped.add(1);
+    }
+
+    void
+    Mailbox::notify(void)
+    {
+      IO::Reactor* reactor = m_reactor.get();
+      if (reactor != NULL)
+        reactor->wakeUp();
+
+      if (m_waiting.value() == 0)
+        return;
+
+      Concurrency::ScopedCondition l(m_cond);
+      m_cond.signal();
+    }
+  }
+}
@@ -0,0 +1,360 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef DUNE_TASKS_MAILBOX_HPP_INCLUDED_
+#define DUNE_TASKS_MAILBOX_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <deque>
+#include <map>
+#include <utility>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/SharedMessage.hpp>
+#include <DUNE/Concurrency/AtomicCounter.hpp>
+#include <DUNE/Concurrency/AtomicPointer.hpp>
+#include <DUNE/Concurrency/BoundedQueue.hpp>
+#include <DUNE/Concurrency/Condition.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+
+namespace DUNE
+{
+  namespace IO
+  {
+    class Reactor;
+  }
+
+  namespace Tasks
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Mailbox;
+
+    //! Message queue of a task. Any number of threads may deliver
+    //! messages but only the owner task may retrieve them. Up to the
+    //! capacity of the mailbox, delivery never blocks nor locks. When
+    //! the mailbox is full the overflow policy of the message
+    //! identifier decides what happens: by default messages are kept
+    //! in a locked overflow list, so nothing is lost, while bulk
+    //! messages can be set to drop or coalesce.
+    class Mailbox
+    {
+    public:
+      //! Overflow policies.
+      enum OverflowPolicy
+      {
+        //! Keep the incoming message in the overflow list. Messages
+        //! with this policy are never dropped.
+        OP_GROW,
+        //! Drop the incoming message.
+        OP_DROP_NEWEST,
+        //! Drop the oldest queued message.
+        OP_DROP_OLDEST,
+        //! Keep only the latest message, an incoming message replaces
+        //! a queued message with the same identifier.
+        OP_COALESCE_LATEST,
+        //! Keep only the latest message of each source system and
+        //! entity, an incoming message replaces a queued message with
+        //! the same identifier, source and source entity.
+        OP_COALESCE_LATEST_BY_SOURCE
+      };
+
+      //! Constructor.
+      //! @param[in] capacity maximum number of queued messages.
+      Mailbox(unsigned capacity);
+
+      //! Destructor.
+      ~Mailbox(void);
+
+      //! Change the maximum number of queued messages. Messages
+      //! queued before the change are still retrieved. This function
+      //! must not be called concurrently with pop().
+      //! @param[in] capacity maximum number of queued messages.
+      void
+      setCapacity(unsigned capacity);
+
+      //! Retrieve the maximum number of queued messages.
+      //! @return mailbox capacity.
+      unsigned
+      getCapacity(void) const
+      {
+        return m_queue.get()->getCapacity();
+      }
+
+      //! Set the overflow policy of a given message identifier. The
+      //! default policy is OP_GROW.
+      //! @param[in] id message identifier.
+      //! @param[in] policy overflow policy.
+      void
+      setOverflowPolicy(uint16_t id, OverflowPolicy policy);
+
+      //! Retrieve the overflow policy of a given message identifier.
+      //! @param[in] id message identifier.
+      //! @return overflow policy.
+      OverflowPolicy
+      getOverflowPolicy(uint16_t id) const;
+
+      //! Deliver a message.
+      //! @param[in] msg message handle.
+      //! @return true if the message was queued, false if it was
+      //! dropped.
+      bool
+      push(const IMC::SharedMessage& msg);
+
+      //! Retrieve queued messages in delivery order.
+      //! @param[out] msgs array of message handles.
+      //! @param[in] count maximum number of messages to retrieve.
+      //! @return number of retrieved messages.
+      unsigned
+      pop(IMC::SharedMessage* msgs, unsigned count);
+
+      //! Wait for messages to be delivered or for a call to
+      //! interrupt(). A pending interruption is cleared.
+      //! @param[in] timeout timeout in seconds, use a negative number
+      //! to wait forever.
+      //! @return true if at least one message is queued, false
+      //! otherwise.
+      bool
+      wait(double timeout);
+
+      //! Wait for a call to interrupt(), ignoring message delivery.
+      //! A pending interruption is cleared.
+      //! @param[in] timeout timeout in seconds, use a negative number
+      //! to wait forever.
+      //! @return true if interrupted, false otherwise.
+      bool
+      waitInterrupt(double timeout);
+
+      //! Wake up the owner task from wait() or waitInterrupt(). If
+      //! the owner is not waiting, its next wait returns immediately.
+      void
+      interrupt(void);
+
+      //! Make deliveries and interruptions also wake up an I/O
+      //! reactor, so that the owner task can wait for messages and
+      //! I/O handles together.
+      //! @param[in] reactor reactor or NULL to stop waking it up.
+      void
+      setReactor(IO::Reactor* reactor)
+      {
+        m_reactor.set(reactor);
+      }
+
+      //! Retrieve the number of queued messages. Only the owner
+      //! task may call this function.
+      //! @return number of queued messages.
+      unsigned
+      size(void) const
+      {
+        unsigned count = m_queue.get()->size() + m_spilled.value();
+        for (size_t i = 0; i < m_old_queues.size(); ++i)
+          count += m_old_queues[i]->size();
+
+        return count;
+      }
+
+      //! Retrieve an estimate of the number of queued messages. Any
+      //! thread may call this function; messages left in queues
+      //! replaced by setCapacity() are not counted.
+      //! @return approximate number of queued messages.
+      unsigned
+      getBacklog(void) const
+      {
+        return m_queue.get()->size() + m_spilled.value();
+      }
+
+      //! Test if there are no queued messages. Only the owner task
+      //! may call this function.
+      //! @return true if the mailbox is empty, false otherwise.
+      bool
+      empty(void) const
+      {
+        return size() == 0;
+      }
+
+      //! Retrieve and reset the number of messages lost to overflow.
+      //! @return number of dropped messages.
+      unsigned
+      takeDropCount(void)
+      {
+        int count = m_dropped.value();
+        m_dropped.sub(count);
+        return count;
+      }
+
+      //! Retrieve and reset the number of messages delivered while
+      //! the mailbox was full and kept in the overflow list.
+      //! @return number of overflowed messages.
+      unsigned
+      takeOverflowCount(void)
+      {
+        int count = m_overflowed.value();
+        m_overflowed.sub(count);
+        return count;
+      }
+
+    private:
+      //! Latest message of a coalesced message identifier.
+      struct Slot
+      {
+        //! Source and source entity of the message plus one, zero if
+        //! the slot was not claimed yet.
+        Concurrency::AtomicCounter key;
+        //! Message, holds one reference.
+        Concurrency::AtomicPointer<IMC::Message> msg;
+      };
+
+      //! Queue entry, either a message or a reference to a slot.
+      struct Entry
+      {
+        Entry(void):
+          slot(NULL),
+          lossless(false)
+        { }
+
+        //! Message.
+        IMC::SharedMessage msg;
+        //! Slot.
+        Slot* slot;
+        //! True if the message must not be dropped.
+        bool lossless;
+      };
+
+      //! Message identifier settings.
+      struct Settings
+      {
+        //! Overflow policy.
+        OverflowPolicy policy;
+        //! Slots for coalesced messages.
+        Slot* slots;
+        //! Number of slots.
+        unsigned slot_count;
+      };
+
+      //! Immutable map of message identifier settings.
+      typedef std::map<uint16_t, Settings> SettingsMap;
+
+      //! Queue of entries.
+      typedef Concurrency::BoundedQueue<Entry> Queue;
+
+      //! Queued entries.
+      Concurrency::AtomicPointer<Queue> m_queue;
+      //! Queues replaced by setCapacity(), freed once drained and no
+      //! longer reachable by producers.
+      std::vector<Queue*> m_old_queues;
+      //! Current message identifier settings.
+      Concurrency::AtomicPointer<const SettingsMap> m_settings;
+      //! Settings replaced by newer ones, freed when no producer is
+      //! delivering.
+      std::vector<const SettingsMap*> m_retired;
+      //! Allocated slots.
+      std::vector<std::pair<Slot*, unsigned> > m_slots;
+      //! Lock for settings changes.
+      Concurrency::Mutex m_settings_lock;
+      //! Condition used to wake up the owner task.
+      Concurrency::Condition m_cond;
+      //! Non-zero if the owner task is waiting for messages.
+      Concurrency::AtomicCounter m_waiting;
+      //! Non-zero if an interruption is pending.
+      Concurrency::AtomicCounter m_interrupted;
+      //! Number of dropped messages.
+      Concurrency::AtomicCounter m_dropped;
+      //! Reactor woken up on delivery.
+      Concurrency::AtomicPointer<IO::Reactor> m_reactor;
+      //! Number of threads inside push().
+      Concurrency::AtomicCounter m_producers;
+      //! Lossless entries evicted from the queue to make room for
+      //! other entries, older than any queued entry.
+      std::deque<Entry> m_evicted;
+      //! Lossless entries delivered while the queue was full, newer
+      //! than any queued entry.
+      std::deque<Entry> m_overflow;
+      //! Lock for m_evicted and m_overflow.
+      Concurrency::Mutex m_overflow_lock;
+      //! Number of entries in m_evicted and m_overflow.
+      mutable Concurrency::AtomicCounter m_spilled;
+      //! Number of messages added to the overflow list.
+      Concurrency::AtomicCounter m_overflowed;
+
+      //! Add an entry, dropping the oldest entries until there is
+      //! room for it. Lossless entries are set aside instead.
+      //! @param[in] queue queue.
+      //! @param[in] entry queue entry.
+      void
+      pushForced(Queue* queue, const Entry& entry);
+
+      //! Add an entry to the overflow list.
+      //! @param[in] entry queue entry.
+      void
+      pushOverflow(const Entry& entry);
+
+      //! Retrieve entries from a list of spilled entries.
+      //! @param[in] list list of entries.
+      //! @param[out] msgs array of message handles.
+      //! @param[in] count maximum number of messages to retrieve.
+      //! @return number of retrieved messages.
+      unsigned
+      popSpilled(std::deque<Entry>& list, IMC::SharedMessage* msgs, unsigned count);
+
+      //! Retrieve queued messages from a given queue.
+      //! @param[in] queue queue.
+      //! @param[out] msgs array of message handles.
+      //! @param[in] count maximum number of messages to retrieve.
+      //! @return number of retrieved messages.
+      unsigned
+      pop(Queue* queue, IMC::SharedMessage* msgs, unsigned count);
+
+      //! Find the slot of a coalesced message.
+      //! @param[in] settings message identifier settings.
+      //! @param[in] msg message.
+      //! @return slot or NULL if the message cannot be coalesced.
+      static Slot*
+      findSlot(const Settings& settings, const IMC::Message* msg);
+
+      //! Discard an entry removed from the queue by a producer.
+      //! @param[in] entry queue entry.
+      void
+      discard(Entry& entry);
+
+      //! Wake up the owner task if it is waiting.
+      void
+      notify(void);
+
+      //! Non - copyable.
+      Mailbox(Mailbox const&);
+
+      //! Non - assignable.
+      Mailbox&
+      operator=(Mailbox const&);
+    };
+  }
+}
+
+#endif
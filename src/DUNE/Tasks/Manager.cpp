@@ -41,12 +41,16 @@
 #include <DUNE/Tasks/Factory.hpp>
 #include <DUNE/Tasks/Exceptions.hpp>
 #include <DUNE/Tasks/Manager.hpp>
+#include <DUNE/Tasks/TimerWheel.hpp>
+#include <DUNE/Tasks/WorkerPool.hpp>
 
 namespace DUNE
 {
   namespace Tasks
   {
     static const int c_high_task_cpu_usage = 10;
+    //! Execution mode of tasks that run on the worker pool.
+    static const char* c_pool_mode = "Pool";
 
     struct TaskCpuUsage
     {
@@ -63,8 +67,16 @@ namespace DUNE
     };
 
     Manager::Manager(Context& ctx):
-      m_ctx(ctx)
+      m_ctx(ctx),
+      m_timers(NULL),
+      m_workers(NULL),
+      m_latency_max(0)
     {
+      m_timers = new TimerWheel;
+      m_ctx.timers = m_timers;
+
+      createWorkerPool();
+
       // Get all sections.
       std::vector<std::string> vec = m_ctx.config.sections();
 
@@ -84,6 +96,33 @@ namespace DUNE
       }
     }
 
+    void
+    Manager::createWorkerPool(void)
+    {
+      std::vector<std::string> vec = m_ctx.config.sections();
+      bool needed = false;
+
+      for (unsigned int i = 0; i < vec.size() && !needed; ++i)
+      {
+        if (!Factory::exists(getTaskName(vec[i])))
+          continue;
+
+        std::string mode;
+        m_ctx.config.get(vec[i], "Execution Mode", "Thread", mode);
+        needed = (mode == c_pool_mode);
+      }
+
+      if (!needed)
+        return;
+
+      unsigned size = 0;
+      m_ctx.config.get("General", "Worker Pool - Threads", "2", size);
+      m_ctx.config.get("General", "Worker Pool - Maximum Latency", "0.25", m_latency_max);
+
+      m_workers = new WorkerPool(size, *m_timers);
+      m_ctx.workers = m_workers;
+    }
+
     void
     Manager::createTask(const std::string& section)
     {
@@ -134,6 +173,15 @@ namespace DUNE
         delete m_tasks[m_list[i]];
         m_tasks[m_list[i]] = NULL;
       }
+
+      if (m_workers != NULL)
+      {
+        m_ctx.workers = NULL;
+        delete m_workers;
+      }
+
+      m_ctx.timers = NULL;
+      delete m_timers;
     }
 
     void
@@ -245,6 +293,29 @@ namespace DUNE
       }
     }
 
+    void
+    Manager::reportQueueLatency(void)
+    {
+      std::map<std::string, Task*>::const_iterator itr = m_tasks.begin();
+
+      for ( ; itr != m_tasks.end(); ++itr)
+      {
+        Task* task = itr->second;
+        if (!task->isPooled())
+          continue;
+
+        Task::QueueLatency latency = task->takeQueueLatency();
+        if (latency.count == 0)
+          continue;
+
+        task->debug(DTR("queue latency: mean %0.1f ms, maximum %0.1f ms, %u steps"),
+                    latency.mean * 1000.0, latency.max * 1000.0, latency.count);
+
+        if (latency.max > m_latency_max)
+          task->war(DTR("queue latency of %0.1f ms on the worker pool"), latency.max * 1000.0);
+      }
+    }
+
     void
     Manager::lowerHogPriority(Task* task, int cpu_usage)
     {
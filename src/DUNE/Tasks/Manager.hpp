@@ -48,6 +48,8 @@ namespace DUNE
     // Forward declarations
     struct Context;
     class Task;
+    class TimerWheel;
+    class WorkerPool;
 
     class Manager
     {
@@ -110,6 +112,11 @@ namespace DUNE
       void
       adjustPriorities(void);
 
+      //! Report the queue latency of tasks running on the worker
+      //! pool since the last call to this function.
+      void
+      reportQueueLatency(void);
+
     private:
       struct TaskCpuUsage
       {
@@ -135,6 +142,15 @@ namespace DUNE
       std::priority_queue<TaskCpuUsage> m_cpu_usage_hogs;
       //! Buffer message to dispatch CPU usage of tasks.
       IMC::CpuUsage m_task_cpu_usage;
+      //! Timer wheel driving periodic tasks.
+      TimerWheel* m_timers;
+      //! Worker pool or NULL if no task uses it.
+      WorkerPool* m_workers;
+      //! Queue latency above which a warning is issued (s).
+      double m_latency_max;
+
+      void
+      createWorkerPool(void);
 
       void
       createTask(const std::string& section);
@@ -33,6 +33,7 @@
 
 // DUNE headers.
 #include <DUNE/IMC/Bus.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/Periodic.hpp>
 #include <DUNE/Time/Clock.hpp>
@@ -42,46 +43,211 @@ namespace DUNE
 {
   namespace Tasks
   {
+    //! Period of jitter reports.
+    static const double c_jitter_period = 10.0;
+    //! Maximum time waiting for a cycle before checking if the task
+    //! must stop.
+    static const double c_max_wait = 1.0;
+
     Periodic::Periodic(const std::string& name, Context& ctx):
       Task(name, ctx),
       m_run_count(0),
-      m_run_time(0)
+      m_run_time(0),
+      m_wake_on_messages(false),
+      m_skip_late(true),
+      m_tick_timer(*this),
+      m_ticks(0),
+      m_tick_deadline(0),
+      m_jitter_sum(0),
+      m_jitter_timer(c_jitter_period)
     {
       param(DTR_RT("Execution Frequency"), m_frequency)
       .units(Units::Hertz)
       .defaultValue("1.0")
       .description(DTR("Frequency at which task is executed"));
+
+      param(DTR_RT("Wake On Messages"), m_wake_on_messages)
+      .defaultValue("false")
+      .description(DTR("Consume messages as soon as they arrive instead of on each cycle"));
+
+      param(DTR_RT("Skip Late Cycles"), m_skip_late)
+      .defaultValue("true")
+      .description(DTR("Skip cycles that become due while a cycle is running "
+                       "instead of running them back to back"));
+
+      m_jitter.count = 0;
+      m_jitter.mean = 0;
+      m_jitter.max = 0;
+      m_jitter.overruns = 0;
+    }
+
+    Periodic::~Periodic(void)
+    {
+      if (m_ctx.timers != NULL)
+        m_ctx.timers->cancel(&m_tick_timer);
     }
 
     void
     Periodic::onMain(void)
     {
-      double now = Time::Clock::get();
-      double delay = (1 / m_frequency);
-      double next_inv = now + delay;
-      m_run_time = now;
+      // Without a timer wheel each task keeps its own schedule.
+      if (m_ctx.timers == NULL)
+      {
+        double now = Time::Clock::get();
+        double delay = (1 / m_frequency);
+        double next_inv = now + delay;
+        m_run_time = now;
+
+        while (!stopping())
+        {
+          delay = (1.0 / m_frequency);
+
+          if (next_inv > now)
+            Time::Delay::wait(next_inv - now);
+
+          next_inv += delay;
+          now = Time::Clock::get();
+          m_run_time = now;
+
+          // Perform job.
+          consumeMessages();
+          if (!stopping())
+          {
+            task();
+            ++m_run_count;
+          }
+
+          now = Time::Clock::get();
+        }
+
+        return;
+      }
+
+      startTicks();
 
       while (!stopping())
       {
-        delay = (1.0 / m_frequency);
+        if (m_wake_on_messages)
+          waitForMessages(c_max_wait);
+        else
+          waitForWakeUp(c_max_wait);
 
-        if (next_inv > now)
-          Time::Delay::wait(next_inv - now);
+        runCycle();
+      }
 
-        next_inv += delay;
-        now = Time::Clock::get();
-        m_run_time = now;
+      m_ctx.timers->cancel(&m_tick_timer);
+    }
+
+    double
+    Periodic::onStep(bool first)
+    {
+      if (first)
+        startTicks();
 
-        // Perform job.
+      if (m_wake_on_messages)
         consumeMessages();
-        if (!stopping())
-        {
-          task();
-          ++m_run_count;
-        }
 
-        now = Time::Clock::get();
+      runCycle();
+      return -1.0;
+    }
+
+    void
+    Periodic::startTicks(void)
+    {
+      {
+        Concurrency::ScopedMutex l(m_tick_lock);
+        m_ticks = 0;
       }
+
+      m_ctx.timers->schedule(&m_tick_timer, Time::Clock::get() + 1.0 / m_frequency);
+    }
+
+    double
+    Periodic::onTick(double deadline)
+    {
+      {
+        Concurrency::ScopedMutex l(m_tick_lock);
+        if (m_ticks == 0)
+          m_tick_deadline = deadline;
+        ++m_ticks;
+      }
+
+      wakeUp();
+      return deadline + 1.0 / m_frequency;
+    }
+
+    void
+    Periodic::runCycle(void)
+    {
+      unsigned ticks = 0;
+      double deadline = 0;
+
+      {
+        Concurrency::ScopedMutex l(m_tick_lock);
+        ticks = m_ticks;
+        deadline = m_tick_deadline;
+        m_ticks = 0;
+      }
+
+      if (ticks == 0)
+        return;
+
+      double now = Time::Clock::get();
+      double jitter = (now > deadline) ? (now - deadline) : 0.0;
+      unsigned runs = m_skip_late ? 1 : ticks;
+
+      {
+        Concurrency::ScopedMutex l(m_tick_lock);
+        m_jitter_sum += jitter;
+        ++m_jitter.count;
+        m_jitter.overruns += ticks - runs;
+        if (jitter > m_jitter.max)
+          m_jitter.max = jitter;
+      }
+
+      m_run_time = now;
+
+      // Perform job.
+      consumeMessages();
+      for (unsigned i = 0; i < runs && !stopping(); ++i)
+      {
+        task();
+        ++m_run_count;
+      }
+
+      reportJitter();
+    }
+
+    Periodic::Jitter
+    Periodic::takeJitter(void)
+    {
+      Concurrency::ScopedMutex l(m_tick_lock);
+
+      Jitter jitter = m_jitter;
+      if (jitter.count > 0)
+        jitter.mean = m_jitter_sum / jitter.count;
+
+      m_jitter.count = 0;
+      m_jitter.max = 0;
+      m_jitter.overruns = 0;
+      m_jitter_sum = 0;
+      return jitter;
+    }
+
+    void
+    Periodic::reportJitter(void)
+    {
+      if (!m_jitter_timer.overflow())
+        return;
+
+      m_jitter_timer.reset();
+
+      Jitter jitter = takeJitter();
+      debug(DTR("cycle jitter: mean %0.2f ms, maximum %0.2f ms, %u cycles"),
+            jitter.mean * 1000.0, jitter.max * 1000.0, jitter.count);
+
+      if (jitter.overruns > 0)
+        war(DTR("skipped %u cycles"), jitter.overruns);
     }
   }
 }
@@ -37,7 +37,10 @@
 #include <string>
 
 // Local headers.
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Time/Counter.hpp>
 #include <DUNE/Tasks/Task.hpp>
+#include <DUNE/Tasks/TimerWheel.hpp>
 
 namespace DUNE
 {
@@ -49,17 +52,34 @@ namespace DUNE
     // Forward declarations
     struct Context;
 
-    //! Periodic task.
+    //! Periodic task. Cycles are driven by the timer wheel of the
+    //! task context: deadlines follow the configured frequency
+    //! without drift and, unless configured otherwise, cycles that
+    //! cannot run on time are skipped.
+    //! Optionally, messages are consumed as soon as they arrive
+    //! instead of at the start of each cycle.
     class Periodic: public Task
     {
     public:
+      //! Cycle jitter statistics.
+      struct Jitter
+      {
+        //! Number of cycles.
+        unsigned count;
+        //! Mean delay between deadline and start of a cycle (s).
+        double mean;
+        //! Maximum delay between deadline and start of a cycle (s).
+        double max;
+        //! Number of skipped cycles.
+        unsigned overruns;
+      };
+
       //! Constructor.
       Periodic(const std::string& name, Context& ctx);
 
       //! Destructor.
       virtual
-      ~Periodic(void)
-      { }
+      ~Periodic(void);
 
       //! Set the task frequency programmatically. The frequency of a
       //! task might change when configuration parameters are updated.
@@ -95,21 +115,101 @@ namespace DUNE
         return m_run_count;
       }
 
+      //! Retrieve the cycle jitter statistics gathered since the
+      //! last call to this function.
+      //! @return jitter statistics.
+      Jitter
+      takeJitter(void);
+
       //! The task to be executed on each cycle.
       virtual void
       task(void) = 0;
 
     private:
+      //! Timer that signals the start of a cycle.
+      class TickTimer: public TimerWheel::Timer
+      {
+      public:
+        TickTimer(Periodic& task):
+          m_task(task)
+        { }
+
+      private:
+        //! Task.
+        Periodic& m_task;
+
+        double
+        onExpiry(double deadline)
+        {
+          return m_task.onTick(deadline);
+        }
+      };
+
       //! Number of executions thus far.
       unsigned m_run_count;
       //! Time of last run.
       double m_run_time;
       //! Task frequency (Hz).
       double m_frequency;
+      //! True to consume messages as soon as they arrive.
+      bool m_wake_on_messages;
+      //! True to skip late cycles, false to run them back to back.
+      bool m_skip_late;
+      //! Cycle timer.
+      TickTimer m_tick_timer;
+      //! Number of cycles due.
+      unsigned m_ticks;
+      //! Deadline of the oldest cycle due.
+      double m_tick_deadline;
+      //! Lock of pending cycles.
+      Concurrency::Mutex m_tick_lock;
+      //! Jitter statistics.
+      Jitter m_jitter;
+      //! Sum of cycle delays.
+      double m_jitter_sum;
+      //! Timer to report jitter statistics.
+      Time::Counter<double> m_jitter_timer;
 
       //! Task entry point.
       void
       onMain(void);
+
+      //! Start the cycle timer.
+      void
+      startTicks(void);
+
+      //! Called by the timer wheel when a cycle is due.
+      //! @param[in] deadline deadline of the cycle.
+      //! @return deadline of the next cycle.
+      double
+      onTick(double deadline);
+
+      //! Run one cycle if any is due.
+      void
+      runCycle(void);
+
+      //! Report jitter statistics periodically.
+      void
+      reportJitter(void);
+
+      //! Periodic tasks can run on the worker pool.
+      bool
+      isPoolable(void) const
+      {
+        return true;
+      }
+
+      //! Messages are consumed on each cycle unless configured
+      //! otherwise.
+      bool
+      wakesOnMessages(void) const
+      {
+        return m_wake_on_messages;
+      }
+
+      //! Consume messages or run one cycle if it is due.
+      double
+      onStep(bool first);
     };
   }
 }
@@ -28,10 +28,12 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <algorithm>
 #include <cstddef>
 
 // DUNE headers.
 #include <DUNE/IMC/Bus.hpp>
+#include <DUNE/I18N.hpp>
 #include <DUNE/IMC/Factory.hpp>
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/Recipient.hpp>
@@ -40,21 +42,23 @@ namespace DUNE
 {
   namespace Tasks
   {
+    //! Default number of messages queued without locking.
+    static const unsigned c_capacity = 1024;
+    //! Minimum period between reports of lost or overflowed messages.
+    static const double c_dropped_period = 5.0;
+
     Recipient::Recipient(AbstractTask* task, Context& ctx):
       m_task(task),
-      m_ctx(ctx)
+      m_ctx(ctx),
+      m_mbox(c_capacity),
+      m_dropped(0),
+      m_overflowed(0),
+      m_dropped_timer(c_dropped_period)
     { }
 
     Recipient::~Recipient(void)
     {
       unbindAll();
-
-      while (!m_mqueue.empty())
-      {
-        IMC::Message* msg = m_mqueue.pop();
-        if (msg)
-          delete msg;
-      }
     }
 
     void
@@ -86,32 +90,56 @@ namespace DUNE
     void
     Recipient::waitForMessages(double timeout)
     {
-      if (m_mqueue.waitForItems(timeout))
+      if (m_mbox.wait(timeout))
         runCallBacks();
     }
 
     void
-    Recipient::put(const IMC::Message* msg)
+    Recipient::put(const IMC::SharedMessage& msg)
     {
-      m_mqueue.push(msg->clone());
+      m_mbox.push(msg);
     }
 
     void
     Recipient::runCallBacks(void)
     {
-      unsigned int size = m_mqueue.size();
+      // Only consume messages that are already queued, otherwise a
+      // fast producer could keep us here forever.
+      unsigned remaining = m_mbox.size();
 
-      for (unsigned int i = 0; i < size; ++i)
+      while (remaining > 0)
       {
-        const IMC::Message* msg = m_mqueue.pop();
-        if (msg)
+        unsigned count = m_mbox.pop(m_batch, std::min(remaining, c_batch_size));
+        if (count == 0)
+          break;
+
+        remaining -= std::min(remaining, count);
+
+        for (unsigned i = 0; i < count; ++i)
         {
-          uint32_t id = msg->getId();
-          for (size_t j = 0; j < m_cbacks[id].size(); ++j)
-            m_cbacks[id][j]->consume(msg);
-          delete msg;
+          uint32_t id = m_batch[i]->getId();
+          std::vector<AbstractConsumer*>& cbacks = m_cbacks[id];
+          for (size_t j = 0; j < cbacks.size(); ++j)
+            cbacks[j]->consume(m_batch[i]);
+
+          m_batch[i].reset();
         }
       }
+
+      m_dropped += m_mbox.takeDropCount();
+      m_overflowed += m_mbox.takeOverflowCount();
+      if ((m_dropped > 0 || m_overflowed > 0) && m_dropped_timer.overflow())
+      {
+        if (m_dropped > 0)
+          m_task->war(DTR("message queue full, dropped %u messages"), m_dropped);
+
+        if (m_overflowed > 0)
+          m_task->war(DTR("message queue full, %u messages queued beyond capacity"), m_overflowed);
+
+        m_dropped = 0;
+        m_overflowed = 0;
+        m_dropped_timer.reset();
+      }
     }
   }
 }
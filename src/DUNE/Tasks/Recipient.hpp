@@ -35,8 +35,9 @@
 #include <vector>
 
 // DUNE headers.
-#include <DUNE/Concurrency/TSQueue.hpp>
+#include <DUNE/Time/Counter.hpp>
 #include <DUNE/Tasks/Consumer.hpp>
+#include <DUNE/Tasks/Mailbox.hpp>
 #include <DUNE/Tasks/AbstractTask.hpp>
 
 namespace DUNE
@@ -62,7 +63,7 @@ namespace DUNE
       unbindAll(void);
 
       void
-      put(const IMC::Message*);
+      put(const IMC::SharedMessage& msg);
 
       void
       bind(uint32_t id, AbstractConsumer* c);
@@ -73,7 +74,62 @@ namespace DUNE
       void
       runCallBacks(void);
 
+      //! Wait for a call to wakeUp(), ignoring message delivery.
+      //! @param[in] timeout timeout in seconds.
+      //! @return true if woken up, false otherwise.
+      bool
+      waitForWakeUp(double timeout)
+      {
+        return m_mbox.waitInterrupt(timeout);
+      }
+
+      //! Wake up the owner task from waitForMessages() or
+      //! waitForWakeUp().
+      void
+      wakeUp(void)
+      {
+        m_mbox.interrupt();
+      }
+
+      //! Wake up an I/O reactor whenever a message is delivered or
+      //! the owner task is woken up. See Mailbox::setReactor().
+      //! @param[in] reactor reactor or NULL.
+      void
+      setReactor(IO::Reactor* reactor)
+      {
+        m_mbox.setReactor(reactor);
+      }
+
+      //! Retrieve an estimate of the number of queued messages. See
+      //! Mailbox::getBacklog().
+      //! @return approximate number of queued messages.
+      unsigned
+      getBacklog(void) const
+      {
+        return m_mbox.getBacklog();
+      }
+
+      //! Change the number of messages queued without locking. See
+      //! Mailbox::setCapacity().
+      //! @param[in] capacity mailbox capacity.
+      void
+      setCapacity(unsigned capacity)
+      {
+        m_mbox.setCapacity(capacity);
+      }
+
+      //! Set the overflow policy of a given message identifier.
+      //! @param[in] id message identifier.
+      //! @param[in] policy overflow policy.
+      void
+      setOverflowPolicy(uint32_t id, Mailbox::OverflowPolicy policy)
+      {
+        m_mbox.setOverflowPolicy(id, policy);
+      }
+
     private:
+      //! Maximum number of messages retrieved from the mailbox at once.
+      static const unsigned c_batch_size = 32;
       //! Task.
       AbstractTask* m_task;
       //! Context.
@@ -81,7 +137,15 @@ namespace DUNE
       //! Callbacks.
       std::map<uint32_t, std::vector<AbstractConsumer*> > m_cbacks;
       //! Message queue.
-      Concurrency::TSQueue<IMC::Message*> m_mqueue;
+      Mailbox m_mbox;
+      //! Messages retrieved from the mailbox.
+      IMC::SharedMessage m_batch[c_batch_size];
+      //! Number of messages lost to mailbox overflow.
+      unsigned m_dropped;
+      //! Number of messages kept beyond the mailbox capacity.
+      unsigned m_overflowed;
+      //! Timer to report lost messages.
+      Time::Counter<double> m_dropped_timer;
     };
   }
 }
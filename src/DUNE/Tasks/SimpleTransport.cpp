@@ -36,9 +36,15 @@ namespace DUNE
 {
   namespace Tasks
   {
+    //! Polling period used when no data handles are registered.
+    static const double c_poll_period = 0.005;
+    //! Maximum time to wait for messages or data.
+    static const double c_idle_timeout = 1.0;
+
     SimpleTransport::SimpleTransport(const std::string& name, Tasks::Context& ctx):
       Tasks::Task(name, ctx),
-      m_buf(2048)
+      m_buf(2048),
+      m_flush(false)
     {
       param("Transports", m_gargs.transports)
       .defaultValue("")
@@ -81,6 +87,7 @@ namespace DUNE
         inf(DTR("outgoing: %s"), msg->getName());
 
       onDataTransmission(p, n);
+      m_flush = true;
     }
 
     void
@@ -89,31 +96,48 @@ namespace DUNE
       m_rl.setupRates(m_gargs.rlim);
       m_rl.setupEntities(m_gargs.entities_flt, this);
       bind(this, m_gargs.transports);
+      attachReactor(m_reactor);
 
       while (!stopping())
       {
         consumeMessages();
 
-        onDataReception(m_buf.getBuffer(), m_buf.getCapacity(), 0.005);
+        if (m_flush)
+        {
+          m_flush = false;
+          onDataFlush();
+        }
+
+        if (m_reactor.size() == 0)
+        {
+          onDataReception(m_buf.getBuffer(), m_buf.getCapacity(), c_poll_period);
+          continue;
+        }
+
+        if (!m_reactor.wait(c_idle_timeout))
+          continue;
+
+        if (m_reactor.getTriggeredCount() > 0 || m_reactor.getWritableCount() > 0)
+          onDataReception(m_buf.getBuffer(), m_buf.getCapacity(), 0.0);
       }
+
+      detachReactor();
     }
 
     void
     SimpleTransport::handleData(IMC::Parser& parser, const uint8_t* p, unsigned int n)
     {
-      for (const uint8_t* e = p + n; p != e; ++p)
-      {
-        IMC::Message* m = parser.parse(*p);
+      parser.feed(p, n);
 
-        if (m)
-        {
-          dispatch(m, DF_KEEP_TIME | DF_KEEP_SRC_EID);
+      IMC::Message* m = NULL;
+      while ((m = parser.nextMessage()) != NULL)
+      {
+        dispatch(m, DF_KEEP_TIME | DF_KEEP_SRC_EID);
 
-          if (m_gargs.trace_in)
-            inf(DTR("incoming: %s"), m->getName());
+        if (m_gargs.trace_in)
+          inf(DTR("incoming: %s"), m->getName());
 
-          delete m;
-        }
+        delete m;
       }
     }
   }
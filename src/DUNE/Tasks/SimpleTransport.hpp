@@ -37,6 +37,8 @@
 #include <DUNE/Config.hpp>
 #include <DUNE/Utils/ByteBuffer.hpp>
 #include <DUNE/IMC/Parser.hpp>
+#include <DUNE/IO/Handle.hpp>
+#include <DUNE/IO/Reactor.hpp>
 #include <DUNE/Tasks/Task.hpp>
 #include <DUNE/Tasks/MessageFilter.hpp>
 
@@ -67,9 +69,69 @@ namespace DUNE
       virtual void
       onDataReception(uint8_t* p, unsigned int n, double timeout) = 0;
 
+      //! Called after a batch of queued messages was passed to
+      //! onDataTransmission(), allowing implementations that buffer
+      //! outgoing data to write it with fewer system calls.
+      virtual void
+      onDataFlush(void)
+      { }
+
       void
       handleData(IMC::Parser& parser, const uint8_t* p, unsigned int n);
 
+    protected:
+      //! Wait for data on a given I/O handle. While at least one
+      //! handle is registered, the main loop sleeps until a message
+      //! is received or a handle becomes readable, and then calls
+      //! onDataReception() with a null timeout. Without handles
+      //! onDataReception() is called in short polling slices.
+      //! @param[in] handle I/O handle.
+      void
+      addDataHandle(const IO::Handle& handle)
+      {
+        m_reactor.add(handle);
+      }
+
+      //! Stop waiting for data on a given I/O handle. Must be called
+      //! before the handle is closed.
+      //! @param[in] handle I/O handle.
+      void
+      removeDataHandle(const IO::Handle& handle)
+      {
+        m_reactor.remove(handle);
+      }
+
+      //! Enable or disable waiting for a data handle to become
+      //! writable. While enabled, onDataReception() is also called
+      //! when the handle can be written to.
+      //! @param[in] handle I/O handle.
+      //! @param[in] enabled true to wait for writability.
+      void
+      setWriteInterest(const IO::Handle& handle, bool enabled)
+      {
+        m_reactor.setWriteInterest(handle, enabled);
+      }
+
+      //! Test if a data handle was readable when the current call to
+      //! onDataReception() was made.
+      //! @param[in] handle I/O handle.
+      //! @return true if readable, false otherwise.
+      bool
+      isReadable(const IO::Handle& handle) const
+      {
+        return m_reactor.wasTriggered(handle);
+      }
+
+      //! Test if a data handle was writable when the current call to
+      //! onDataReception() was made. See setWriteInterest().
+      //! @param[in] handle I/O handle.
+      //! @return true if writable, false otherwise.
+      bool
+      isWritable(const IO::Handle& handle) const
+      {
+        return m_reactor.wasWritable(handle);
+      }
+
     private:
       struct GArguments
       {
@@ -87,6 +149,10 @@ namespace DUNE
       GArguments m_gargs;
       Utils::ByteBuffer m_buf;
       MessageFilter m_rl;
+      // Waits for messages and data handles.
+      IO::Reactor m_reactor;
+      // True if data was transmitted since the last flush.
+      bool m_flush;
     };
   }
 }
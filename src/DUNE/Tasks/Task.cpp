@@ -35,6 +35,8 @@
 // DUNE headers.
 #include <DUNE/IMC/Constants.hpp>
 #include <DUNE/IMC/Bus.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Time/Clock.hpp>
 #include <DUNE/Time/Delay.hpp>
 #include <DUNE/Time/PeriodicDelay.hpp>
 #include <DUNE/Time/Counter.hpp>
@@ -63,9 +65,21 @@ namespace DUNE
       m_name(n),
       m_entity(NULL),
       m_debug_level(DEBUG_LEVEL_NONE),
-      m_honours_active(false)
+      m_honours_active(false),
+      m_pool(NULL),
+      m_pool_wake(false),
+      m_job_queued(0),
+      m_step_timer(*this),
+      m_step_phase(SP_START),
+      m_step_first(true),
+      m_step_restart(0),
+      m_latency_sum(0)
     {
       m_args.priority = 10;
+      m_args.mbox_capacity = 1024;
+      m_latency.count = 0;
+      m_latency.mean = 0;
+      m_latency.max = 0;
       m_args.act_time = 0;
       m_args.deact_time = 0;
       m_args.active = false;
@@ -78,6 +92,17 @@ namespace DUNE
       .defaultValue("10")
       .description(DTR("Execution priority"));
 
+      param(DTR_RT("Mailbox Capacity"), m_args.mbox_capacity)
+      .defaultValue("1024")
+      .minimumValue("16")
+      .description(DTR("Number of messages queued without locking, messages beyond it "
+                       "are kept unless their overflow policy drops them"));
+
+      param(DTR_RT("Execution Mode"), m_args.exec_mode)
+      .defaultValue("Thread")
+      .values("Thread, Pool")
+      .description(DTR("Run task on a dedicated thread or on the shared worker pool"));
+
       param(DTR_RT("Activation Time"), m_args.act_time)
       .defaultValue("0");
 
@@ -349,6 +374,17 @@ namespace DUNE
       m_entity->failDeactivation(reason);
     }
 
+    void
+    Task::requestInitialActivation(void)
+    {
+      if (!m_honours_active)
+        return;
+
+      Parameter::Scope active_scope = Parameter::scopeFromString(m_args.active_scope);
+      if (m_args.active && ((active_scope == Parameter::SCOPE_GLOBAL) || (active_scope == Parameter::SCOPE_IDLE)))
+        requestActivation();
+    }
+
     void
     Task::run(void)
     {
@@ -363,6 +399,9 @@ namespace DUNE
       catch (...)
       { }
 
+      // Virtual time only advances while this thread is idle.
+      Time::Clock::attach();
+
       while (!stopping())
       {
         try
@@ -371,13 +410,7 @@ namespace DUNE
           releaseResources();
           acquireResources();
           initializeResources();
-
-          if (m_honours_active)
-          {
-            Parameter::Scope active_scope = Parameter::scopeFromString(m_args.active_scope);
-            if (m_args.active && ((active_scope == Parameter::SCOPE_GLOBAL) || (active_scope == Parameter::SCOPE_IDLE)))
-              requestActivation();
-          }
+          requestInitialActivation();
 
           onMain();
           releaseResources();
@@ -421,6 +454,183 @@ namespace DUNE
           err(DTR("task died with uncaught exception: %s: restarting"), e.what());
         }
       }
+
+      Time::Clock::detach();
+    }
+
+    void
+    Task::startImpl(void)
+    {
+      if (m_pool == NULL)
+      {
+        Time::Clock::reserve();
+        Thread::startImpl();
+        return;
+      }
+
+      m_pool_wake = wakesOnMessages();
+      m_step_phase = SP_START;
+      setStateImpl(StateRunning);
+      m_pool->attach(this);
+    }
+
+    void
+    Task::stopImpl(void)
+    {
+      Thread::stopImpl();
+
+      // Tasks waiting for messages or on a reactor must notice the
+      // request without waiting for their timeout.
+      wakeUp();
+    }
+
+    void
+    Task::joinImpl(void)
+    {
+      if (m_pool == NULL)
+      {
+        Thread::joinImpl();
+        return;
+      }
+
+      while (!isDead())
+        Time::Delay::wait(0.01);
+    }
+
+    void
+    Task::setDefaultMailboxCapacity(unsigned capacity)
+    {
+      std::map<std::string, Parameter*>::iterator itr = m_params.find(DTR_RT("Mailbox Capacity"));
+      if (itr != m_params.end())
+        itr->second->defaultValue(Utils::String::str(capacity));
+    }
+
+    void
+    Task::wakeUp(void)
+    {
+      if (m_pool != NULL)
+        m_pool->schedule(this);
+      else
+        m_recipient->wakeUp();
+    }
+
+    double
+    Task::runStep(void)
+    {
+      try
+      {
+        if (stopping())
+        {
+          releaseResources();
+          setStateImpl(StateDead);
+          return -1.0;
+        }
+
+        if (m_step_phase == SP_RESTART)
+        {
+          double remaining = m_step_restart - Time::Clock::get();
+          if (remaining > 0)
+          {
+            reportEntityState();
+            return (remaining < 1.0) ? remaining : 1.0;
+          }
+
+          try
+          {
+            updateParameters();
+          }
+          catch (std::runtime_error& pe)
+          {
+            err(DTR("failed to update parameters: %s"), pe.what());
+          }
+
+          m_step_phase = SP_START;
+        }
+
+        if (m_step_phase == SP_START)
+        {
+          resolveEntities();
+          releaseResources();
+          acquireResources();
+          m_step_phase = SP_INITIALIZE;
+        }
+
+        if (m_step_phase == SP_INITIALIZE)
+        {
+          try
+          {
+            onResourceInitialization();
+          }
+          catch (std::exception& e)
+          {
+            err("%s", e.what());
+            return 1.0;
+          }
+
+          m_step_phase = SP_RUN;
+          m_step_first = true;
+          requestInitialActivation();
+        }
+
+        double delay = onStep(m_step_first);
+        m_step_first = false;
+        return delay;
+      }
+      catch (RestartNeeded& e)
+      {
+        unsigned delay = e.getDelay();
+
+        if (e.isError())
+        {
+          setEntityState(IMC::EntityState::ESTA_FAILURE, DTR("restarting"));
+
+          if (delay == 0)
+            err(DTR("restarting immediately due to error: %s"), e.getError());
+          else
+            err(DTR("restarting in %u seconds due to error: %s"), delay, e.getError());
+        }
+
+        m_step_phase = SP_RESTART;
+        m_step_restart = Time::Clock::get() + delay;
+        return 0.0;
+      }
+      catch (std::exception& e)
+      {
+        IMC::EntityState estate;
+        setEntityState(IMC::EntityState::ESTA_FAILURE, e.what());
+        dispatch(estate);
+        err(DTR("task died with uncaught exception: %s: restarting"), e.what());
+        m_step_phase = SP_START;
+        return 0.0;
+      }
+    }
+
+    void
+    Task::recordQueueLatency(double value)
+    {
+      if (value < 0)
+        value = 0;
+
+      Concurrency::ScopedMutex l(m_latency_lock);
+      m_latency_sum += value;
+      ++m_latency.count;
+      if (value > m_latency.max)
+        m_latency.max = value;
+    }
+
+    Task::QueueLatency
+    Task::takeQueueLatency(void)
+    {
+      Concurrency::ScopedMutex l(m_latency_lock);
+
+      QueueLatency latency = m_latency;
+      if (latency.count > 0)
+        latency.mean = m_latency_sum / latency.count;
+
+      m_latency.count = 0;
+      m_latency.max = 0;
+      m_latency_sum = 0;
+      return latency;
     }
 
     void
@@ -717,6 +927,22 @@ namespace DUNE
       {
         err(DTR("unable to load parameters: %s"), e.getError());
       }
+
+      // The message queue can only be resized before messages are
+      // delivered, i.e., before the task starts.
+      m_recipient->setCapacity(m_args.mbox_capacity);
+
+      // The execution mode can only be chosen before the task starts.
+      m_pool = NULL;
+      if (m_args.exec_mode == "Pool")
+      {
+        if (m_ctx.workers == NULL)
+          war(DTR("worker pool is not available, using a dedicated thread"));
+        else if (!isPoolable())
+          war(DTR("task cannot run on the worker pool, using a dedicated thread"));
+        else
+          m_pool = m_ctx.workers;
+      }
     }
   }
 }
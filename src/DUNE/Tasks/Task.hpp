@@ -39,6 +39,8 @@
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/AtomicCounter.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
 #include <DUNE/Concurrency/Thread.hpp>
 #include <DUNE/Concurrency/TSQueue.hpp>
 #include <DUNE/Tasks/Recipient.hpp>
@@ -54,6 +56,8 @@
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/BasicParameterParser.hpp>
 #include <DUNE/Tasks/ParameterTable.hpp>
+#include <DUNE/Tasks/TimerWheel.hpp>
+#include <DUNE/Tasks/WorkerPool.hpp>
 #include <DUNE/Entities/BasicEntity.hpp>
 #include <DUNE/Entities/StatefulEntity.hpp>
 
@@ -109,7 +113,21 @@ namespace DUNE
     //! Task.
     class Task: public AbstractTask
     {
+      friend class WorkerPool;
+
     public:
+      //! Queue latency statistics of a task running on the worker
+      //! pool.
+      struct QueueLatency
+      {
+        //! Number of executed steps.
+        unsigned count;
+        //! Mean time between scheduling and execution (s).
+        double mean;
+        //! Maximum time between scheduling and execution (s).
+        double max;
+      };
+
       //! Construct a task object.
       //! @param[in] name name of the task.
       //! @param[in] context task context.
@@ -329,13 +347,49 @@ namespace DUNE
       }
 
       //! Queue a message for later consumption.
+      //! @param msg message handle.
+      void
+      receive(const IMC::SharedMessage& msg)
+      {
+        m_recipient->put(msg);
+        if (m_pool_wake)
+          wakeUp();
+      }
+
+      //! Queue a copy of a message for later consumption.
       //! @param msg message object.
       void
       receive(const IMC::Message* msg)
       {
-        m_recipient->put(msg);
+        m_recipient->put(IMC::SharedMessage::copy(*msg));
+        if (m_pool_wake)
+          wakeUp();
       }
 
+      //! Retrieve the number of messages queued for consumption.
+      //! @return approximate number of queued messages.
+      unsigned
+      getBacklog(void) const
+      {
+        return m_recipient->getBacklog();
+      }
+
+      //! Test if the task runs on the worker pool instead of a
+      //! dedicated thread.
+      //! @return true if the task runs on the worker pool, false
+      //! otherwise.
+      bool
+      isPooled(void) const
+      {
+        return m_pool != NULL;
+      }
+
+      //! Retrieve the queue latency statistics gathered since the
+      //! last call to this function.
+      //! @return queue latency statistics.
+      QueueLatency
+      takeQueueLatency(void);
+
       //! Instruct task to reserve all entity identifiers that it
       //! needs for normal execution.
       void
@@ -496,6 +550,48 @@ namespace DUNE
         m_recipient->waitForMessages(timeout);
       }
 
+      //! Wait for a call to wakeUp(), leaving queued messages
+      //! untouched.
+      //! @param[in] timeout wait for timeout seconds.
+      //! @return true if woken up, false otherwise.
+      bool
+      waitForWakeUp(double timeout)
+      {
+        return m_recipient->waitForWakeUp(timeout);
+      }
+
+      //! Make message deliveries and calls to wakeUp() also wake up
+      //! an I/O reactor, allowing the task to wait for messages and
+      //! I/O handles in a single call to IO::Reactor::wait().
+      //! @param[in] reactor reactor owned by the task.
+      void
+      attachReactor(IO::Reactor& reactor)
+      {
+        m_recipient->setReactor(&reactor);
+      }
+
+      //! Stop waking up the reactor given to attachReactor().
+      void
+      detachReactor(void)
+      {
+        m_recipient->setReactor(NULL);
+      }
+
+      //! Wake up the task. A task running on a dedicated thread
+      //! returns from waitForMessages() or waitForWakeUp(); a task
+      //! running on the worker pool has a step scheduled. This
+      //! function can be called from any thread.
+      void
+      wakeUp(void);
+
+      //! Change the default number of messages queued without
+      //! locking, for tasks that consume high rate traffic. Must be
+      //! called from the constructor; the "Mailbox Capacity"
+      //! parameter still overrides it.
+      //! @param[in] capacity mailbox capacity.
+      void
+      setDefaultMailboxCapacity(unsigned capacity);
+
       //! Call the consumers of all messages currently in the
       //! receiving queue.
       void
@@ -570,6 +666,53 @@ namespace DUNE
         bind(M::getIdStatic(), new Consumer<T, M>(*task_obj, consumer));
       }
 
+      //! Bind a message to a consumer method that receives shared
+      //! message handles. See SharedConsumer.
+      //! @param task_obj consumer task.
+      //! @param consumer consumer method.
+      template <typename M, typename T>
+      void
+      bind(T* task_obj, void (T::* consumer)(const IMC::SharedMessage&))
+      {
+        bind(M::getIdStatic(), new SharedConsumer<T>(*task_obj, consumer));
+      }
+
+      //! Bind a message to a consumer method, keeping only the latest
+      //! message of each source system and entity. Messages received
+      //! while older ones are still queued replace them, which
+      //! suits consumers that only care about the current value of
+      //! periodic state messages.
+      //! @param task_obj consumer task.
+      //! @param consumer consumer method.
+      template <typename M, typename T>
+      void
+      bindLatest(T* task_obj, void (T::* consumer)(const M*) = &T::consume)
+      {
+        bind<M>(task_obj, consumer);
+        setOverflowPolicy<M>(Mailbox::OP_COALESCE_LATEST_BY_SOURCE);
+      }
+
+      //! Set the policy used when the message queue is full and a
+      //! message with a given identifier is received.
+      //! @param[in] id message identifier.
+      //! @param[in] policy overflow policy.
+      void
+      setOverflowPolicy(unsigned int id, Mailbox::OverflowPolicy policy)
+      {
+        m_recipient->setOverflowPolicy(id, policy);
+      }
+
+      //! Set the policy used when the message queue is full and a
+      //! message of a given type is received.
+      //! @tparam M message type.
+      //! @param[in] policy overflow policy.
+      template <typename M>
+      void
+      setOverflowPolicy(Mailbox::OverflowPolicy policy)
+      {
+        setOverflowPolicy(M::getIdStatic(), policy);
+      }
+
       //! Bind multiple messages to a default consumer method.
       //! @param task_obj consumer object.
       //! @param list list of message identifiers.
@@ -757,7 +900,75 @@ namespace DUNE
       virtual void
       onMain(void) = 0;
 
+      //! Test if this task can run on the worker pool. Tasks that
+      //! block waiting for I/O or that do their work in onMain()
+      //! must run on a dedicated thread.
+      //! @return true if the task can run on the worker pool, false
+      //! otherwise.
+      virtual bool
+      isPoolable(void) const
+      {
+        return false;
+      }
+
+      //! Test if the arrival of a message schedules a step of the
+      //! task when running on the worker pool.
+      //! @return true if messages schedule steps, false otherwise.
+      virtual bool
+      wakesOnMessages(void) const
+      {
+        return true;
+      }
+
+      //! Execute one step of the task when running on the worker
+      //! pool. This replaces onMain() and must not block.
+      //! @param[in] first true if this is the first step after the
+      //! task (re)started.
+      //! @return time in seconds until the next step or a negative
+      //! value if the task only runs on events.
+      virtual double
+      onStep(bool first)
+      {
+        (void)first;
+        consumeMessages();
+        return -1.0;
+      }
+
     private:
+      //! Timer that schedules a step on the worker pool.
+      class StepTimer: public TimerWheel::Timer
+      {
+      public:
+        StepTimer(Task& task):
+          m_task(task)
+        { }
+
+      private:
+        //! Task.
+        Task& m_task;
+
+        double
+        onExpiry(double deadline)
+        {
+          (void)deadline;
+          m_task.wakeUp();
+          return -1.0;
+        }
+      };
+
+      //! Phases of a task running on the worker pool.
+      enum StepPhase
+      {
+        //! Acquire resources.
+        SP_START,
+        //! Initialize resources.
+        SP_INITIALIZE,
+        //! Normal execution.
+        SP_RUN,
+        //! Waiting to restart.
+        SP_RESTART
+      };
+
       struct BasicArguments
       {
         //! Main entity label.
@@ -768,6 +979,10 @@ namespace DUNE
         uint16_t deact_time;
         //! Scheduling priority.
         unsigned int priority;
+        //! Maximum number of queued messages.
+        unsigned int mbox_capacity;
+        //! Execution mode.
+        std::string exec_mode;
         //! True if task is active.
         bool active;
         //! Scope of 'Active' parameter.
@@ -796,6 +1011,28 @@ namespace DUNE
       bool m_honours_active;
       //! Name of parameter section editor.
       std::string m_param_editor;
+      //! Worker pool running this task or NULL.
+      WorkerPool* m_pool;
+      //! True if messages schedule steps on the worker pool.
+      bool m_pool_wake;
+      //! Job state (see WorkerPool).
+      Concurrency::AtomicCounter m_job_state;
+      //! Time at which the current job was queued.
+      double m_job_queued;
+      //! Timer of the next timed step on the worker pool.
+      StepTimer m_step_timer;
+      //! Current phase when running on the worker pool.
+      StepPhase m_step_phase;
+      //! True if the next step is the first after (re)starting.
+      bool m_step_first;
+      //! Time at which a task waiting to restart resumes.
+      double m_step_restart;
+      //! Queue latency statistics.
+      QueueLatency m_latency;
+      //! Sum of queue latencies.
+      double m_latency_sum;
+      //! Lock of queue latency statistics.
+      Concurrency::Mutex m_latency_lock;
 
       //! Report current entity states by dispatching EntityState
       //! messages. This function will at least report the state of
@@ -809,6 +1046,32 @@ namespace DUNE
       void
       run(void);
 
+      void
+      startImpl(void);
+
+      void
+      stopImpl(void);
+
+      void
+      joinImpl(void);
+
+      //! Request activation if the 'Active' parameter demands it when
+      //! the task starts.
+      void
+      requestInitialActivation(void);
+
+      //! Execute one step on behalf of the worker pool, handling
+      //! resource acquisition, restarts and termination.
+      //! @return time in seconds until the next step or a negative
+      //! value if there is no timed step.
+      double
+      runStep(void);
+
+      //! Add a sample to the queue latency statistics.
+      //! @param[in] value queue latency (s).
+      void
+      recordQueueLatency(double value);
+
       //! Register a consumer for a given message identifier.
       //! @param[in] message_id message identifier.
       //! @param[in] consumer consumer object.
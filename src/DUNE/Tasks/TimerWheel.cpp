@@ -0,0 +1,291 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Tasks/TimerWheel.hpp>
+
+#if defined(DUNE_OS_LINUX)
+#  include <sys/prctl.h>
+#endif
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    //! Maximum time the wheel thread sleeps before checking if it
+    //! must stop.
+    static const double c_max_sleep = 1.0;
+
+    TimerWheel::TimerWheel(double resolution):
+      m_resolution(resolution),
+      m_base(Time::Clock::get()),
+      m_tick(0),
+      m_wake_tick(0),
+      m_count(0),
+      m_expired(NULL),
+      m_firing(NULL),
+      m_firing_cancelled(false)
+    {
+      for (unsigned i = 0; i < c_levels; ++i)
+      {
+        for (unsigned j = 0; j < c_slots; ++j)
+          m_slots[i][j] = NULL;
+      }
+
+      Time::Clock::reserve();
+      start();
+    }
+
+    TimerWheel::~TimerWheel(void)
+    {
+      stop();
+
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        m_cond.signal();
+      }
+
+      join();
+    }
+
+    unsigned
+    TimerWheel::getCount(void)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      return m_count;
+    }
+
+    void
+    TimerWheel::schedule(Timer* timer, double deadline)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      if (timer->m_head != NULL)
+        unlink(timer);
+
+      arm(timer, deadline);
+
+      if (timer->m_expiry < m_wake_tick)
+        m_cond.signal();
+    }
+
+    void
+    TimerWheel::cancel(Timer* timer)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      if (timer->m_head != NULL)
+        unlink(timer);
+
+      if (m_firing != timer)
+        return;
+
+      m_firing_cancelled = true;
+      while (m_firing == timer)
+        m_cond.wait();
+    }
+
+    uint64_t
+    TimerWheel::toTicks(double value) const
+    {
+      if (value <= m_base)
+        return 0;
+
+      return static_cast<uint64_t>(std::ceil((value - m_base) / m_resolution));
+    }
+
+    void
+    TimerWheel::arm(Timer* timer, double deadline)
+    {
+      timer->m_deadline = deadline;
+      timer->m_expiry = toTicks(deadline);
+
+      // The current tick was already processed, expired timers are
+      // due on the next one.
+      if (timer->m_expiry <= m_tick)
+        timer->m_expiry = m_tick + 1;
+
+      link(timer);
+    }
+
+    void
+    TimerWheel::link(Timer* timer)
+    {
+      uint64_t delta = timer->m_expiry - m_tick;
+      unsigned level = 0;
+      while (level < c_levels - 1 && delta >= ((uint64_t)1 << (c_slot_bits * (level + 1))))
+        ++level;
+
+      // Too far in the future: park in the coarsest level, the timer
+      // will be placed again when the slot is cascaded.
+      uint64_t expiry = timer->m_expiry;
+      if (delta >= ((uint64_t)1 << (c_slot_bits * c_levels)))
+        expiry = m_tick + ((uint64_t)1 << (c_slot_bits * c_levels)) - 1;
+
+      Timer** head = &m_slots[level][(expiry >> (c_slot_bits * level)) & c_slot_mask];
+      timer->m_head = head;
+      timer->m_prev = NULL;
+      timer->m_next = *head;
+      if (*head != NULL)
+        (*head)->m_prev = timer;
+      *head = timer;
+
+      ++m_count;
+    }
+
+    void
+    TimerWheel::unlink(Timer* timer)
+    {
+      if (timer->m_prev != NULL)
+        timer->m_prev->m_next = timer->m_next;
+      else
+        *timer->m_head = timer->m_next;
+
+      if (timer->m_next != NULL)
+        timer->m_next->m_prev = timer->m_prev;
+
+      timer->m_next = NULL;
+      timer->m_prev = NULL;
+      timer->m_head = NULL;
+
+      --m_count;
+    }
+
+    void
+    TimerWheel::cascade(unsigned level)
+    {
+      Timer** head = &m_slots[level][(m_tick >> (c_slot_bits * level)) & c_slot_mask];
+
+      while (*head != NULL)
+      {
+        Timer* timer = *head;
+        unlink(timer);
+        link(timer);
+      }
+    }
+
+    void
+    TimerWheel::advance(void)
+    {
+      ++m_tick;
+
+      // Cascade a level when the finer levels complete a rotation.
+      for (unsigned level = 1; level < c_levels; ++level)
+      {
+        if (((m_tick >> (c_slot_bits * (level - 1))) & c_slot_mask) != 0)
+          break;
+
+        cascade(level);
+      }
+
+      // Expired timers stay linked until they are called, so that
+      // they can still be cancelled or rescheduled.
+      m_expired = m_slots[0][m_tick & c_slot_mask];
+      m_slots[0][m_tick & c_slot_mask] = NULL;
+      for (Timer* timer = m_expired; timer != NULL; timer = timer->m_next)
+        timer->m_head = &m_expired;
+
+      while (m_expired != NULL)
+      {
+        Timer* timer = m_expired;
+        unlink(timer);
+
+        m_firing = timer;
+        m_firing_cancelled = false;
+
+        m_cond.unlock();
+        double next = timer->onExpiry(timer->m_deadline);
+        m_cond.lock();
+
+        m_firing = NULL;
+
+        if (m_firing_cancelled)
+          m_cond.broadcast();
+        else if (next >= 0 && timer->m_head == NULL)
+          arm(timer, next);
+      }
+    }
+
+    uint64_t
+    TimerWheel::getNextTick(void) const
+    {
+      if (m_count == 0)
+        return m_tick + static_cast<uint64_t>(c_max_sleep / m_resolution);
+
+      // Timers of the first level are due before the end of the
+      // current rotation, the others are cascaded at its end.
+      for (uint64_t tick = m_tick + 1; ; ++tick)
+      {
+        if ((tick & c_slot_mask) == 0)
+          return tick;
+
+        if (m_slots[0][tick & c_slot_mask] != NULL)
+          return tick;
+      }
+    }
+
+    void
+    TimerWheel::run(void)
+    {
+#if defined(DUNE_OS_LINUX)
+      prctl(PR_SET_NAME, "Timer Wheel", 0, 0, 0);
+#endif
+
+      Time::Clock::attach();
+
+      Concurrency::ScopedCondition l(m_cond);
+
+      while (!isStopping())
+      {
+        double now = Time::Clock::get();
+        uint64_t target = static_cast<uint64_t>((now - m_base) / m_resolution);
+
+        while (m_tick < target)
+          advance();
+
+        m_wake_tick = getNextTick();
+
+        double timeout = m_base + m_wake_tick * m_resolution - Time::Clock::get();
+        if (timeout > c_max_sleep)
+          timeout = c_max_sleep;
+
+        if (timeout > 0)
+          m_cond.wait(timeout);
+      }
+
+      Time::Clock::detach();
+    }
+  }
+}
@@ -0,0 +1,212 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef DUNE_TASKS_TIMER_WHEEL_HPP_INCLUDED_
+#define DUNE_TASKS_TIMER_WHEEL_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Condition.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM TimerWheel;
+
+    //! Hierarchical timer wheel. A single thread keeps track of any
+    //! number of timers, scheduling and cancelling a timer takes
+    //! constant time. Deadlines are rounded up to the resolution of
+    //! the wheel, so timers never expire early. The thread only
+    //! wakes up when a timer expires or when timers must move to a
+    //! finer level of the wheel.
+    class TimerWheel: public Concurrency::Thread
+    {
+    public:
+      //! Timer that can be scheduled on a wheel.
+      class Timer
+      {
+      public:
+        //! Constructor.
+        Timer(void):
+          m_next(NULL),
+          m_prev(NULL),
+          m_head(NULL),
+          m_deadline(-1.0),
+          m_expiry(0)
+        { }
+
+        //! Destructor. The timer must be cancelled beforehand.
+        virtual
+        ~Timer(void)
+        { }
+
+      protected:
+        //! Called by the wheel thread when the timer expires. The
+        //! wheel is not locked, this function may schedule and cancel
+        //! other timers but must not cancel its own timer (return a
+        //! negative value instead). A deadline set with schedule()
+        //! while this function runs replaces the returned one.
+        //! @param[in] deadline time at which the timer was due
+        //! (monotonic clock).
+        //! @return next deadline of the timer or a negative value to
+        //! disarm it.
+        virtual double
+        onExpiry(double deadline) = 0;
+
+      private:
+        friend class TimerWheel;
+
+        //! Next timer in the same slot.
+        Timer* m_next;
+        //! Previous timer in the same slot.
+        Timer* m_prev;
+        //! Slot holding this timer or NULL if disarmed.
+        Timer** m_head;
+        //! Deadline (monotonic clock).
+        double m_deadline;
+        //! Deadline (wheel ticks).
+        uint64_t m_expiry;
+      };
+
+      //! Constructor. Starts the wheel thread.
+      //! @param[in] resolution duration of a tick in seconds.
+      TimerWheel(double resolution = 0.001);
+
+      //! Destructor. Stops and joins the wheel thread.
+      ~TimerWheel(void);
+
+      //! Retrieve the duration of a tick.
+      //! @return duration of a tick in seconds.
+      double
+      getResolution(void) const
+      {
+        return m_resolution;
+      }
+
+      //! Retrieve the number of scheduled timers.
+      //! @return number of scheduled timers.
+      unsigned
+      getCount(void);
+
+      //! Schedule a timer, replacing its previous deadline.
+      //! @param[in] timer timer.
+      //! @param[in] deadline deadline (monotonic clock).
+      void
+      schedule(Timer* timer, double deadline);
+
+      //! Cancel a timer. When this function returns the timer is not
+      //! expiring and will not expire: if it is expiring the call
+      //! waits for onExpiry() to return.
+      //! @param[in] timer timer.
+      void
+      cancel(Timer* timer);
+
+    private:
+      //! Number of levels.
+      static const unsigned c_levels = 4;
+      //! Bits of the tick count per level.
+      static const unsigned c_slot_bits = 8;
+      //! Number of slots per level.
+      static const unsigned c_slots = 1 << c_slot_bits;
+      //! Mask of the slot index.
+      static const uint64_t c_slot_mask = c_slots - 1;
+
+      //! Duration of a tick.
+      double m_resolution;
+      //! Time of tick zero.
+      double m_base;
+      //! Current tick.
+      uint64_t m_tick;
+      //! Tick at which the thread will wake up.
+      uint64_t m_wake_tick;
+      //! Number of scheduled timers.
+      unsigned m_count;
+      //! Slots of each level.
+      Timer* m_slots[c_levels][c_slots];
+      //! Expired timers waiting to be called.
+      Timer* m_expired;
+      //! Timer being called or NULL.
+      Timer* m_firing;
+      //! True if the timer being called was cancelled.
+      bool m_firing_cancelled;
+      //! Lock and condition used to wait for the next tick.
+      Concurrency::Condition m_cond;
+
+      //! Set the deadline of a timer and insert it in the wheel.
+      //! @param[in] timer timer.
+      //! @param[in] deadline deadline (monotonic clock).
+      void
+      arm(Timer* timer, double deadline);
+
+      //! Insert an armed timer in the slot matching its expiry.
+      //! @param[in] timer timer.
+      void
+      link(Timer* timer);
+
+      //! Remove a timer from its slot.
+      //! @param[in] timer timer.
+      void
+      unlink(Timer* timer);
+
+      //! Advance one tick, moving timers to finer levels and calling
+      //! expired timers. The wheel is unlocked while each timer is
+      //! called.
+      void
+      advance(void);
+
+      //! Move the timers of the current slot of a level to finer
+      //! levels.
+      //! @param[in] level level.
+      void
+      cascade(unsigned level);
+
+      //! Compute the next tick at which something must be done.
+      //! @return tick.
+      uint64_t
+      getNextTick(void) const;
+
+      //! Convert a time to ticks, rounding up.
+      //! @param[in] value time (monotonic clock).
+      //! @return ticks.
+      uint64_t
+      toTicks(double value) const;
+
+      void
+      run(void);
+    };
+  }
+}
+
+#endif
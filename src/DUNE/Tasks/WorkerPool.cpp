@@ -0,0 +1,273 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <deque>
+
+// DUNE headers.
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Tasks/Task.hpp>
+#include <DUNE/Tasks/WorkerPool.hpp>
+
+#if defined(DUNE_OS_LINUX)
+#  include <sys/prctl.h>
+#endif
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    //! Maximum time an idle worker sleeps before checking if it
+    //! must stop.
+    static const double c_idle_timeout = 1.0;
+
+    //! Worker thread.
+    class WorkerPool::Worker: public Concurrency::Thread
+    {
+    public:
+      Worker(WorkerPool& pool, unsigned index):
+        m_pool(pool),
+        m_index(index)
+      { }
+
+      //! Add a job to the back of the queue.
+      void
+      push(Task* task)
+      {
+        Concurrency::ScopedMutex l(m_lock);
+        m_queue.push_back(task);
+      }
+
+      //! Retrieve a job from the front of the queue (owner) or from
+      //! the back of the queue (thieves).
+      Task*
+      pop(bool steal)
+      {
+        Concurrency::ScopedMutex l(m_lock);
+        if (m_queue.empty())
+          return NULL;
+
+        Task* task = NULL;
+        if (steal)
+        {
+          task = m_queue.back();
+          m_queue.pop_back();
+        }
+        else
+        {
+          task = m_queue.front();
+          m_queue.pop_front();
+        }
+
+        return task;
+      }
+
+    private:
+      //! Pool.
+      WorkerPool& m_pool;
+      //! Index of this worker.
+      unsigned m_index;
+      //! Queued jobs.
+      std::deque<Task*> m_queue;
+      //! Lock of the job queue.
+      Concurrency::Mutex m_lock;
+
+      void
+      run(void)
+      {
+#if defined(DUNE_OS_LINUX)
+        prctl(PR_SET_NAME, "Worker", 0, 0, 0);
+#endif
+
+        Time::Clock::attach();
+
+        while (!isStopping())
+        {
+          Task* task = m_pool.take(m_index);
+          if (task == NULL)
+            m_pool.idle(c_idle_timeout);
+          else
+            m_pool.execute(task);
+        }
+
+        Time::Clock::detach();
+      }
+    };
+
+    WorkerPool::WorkerPool(unsigned size, TimerWheel& timers):
+      m_timers(timers)
+    {
+      if (size == 0)
+        size = 1;
+
+      for (unsigned i = 0; i < size; ++i)
+        m_workers.push_back(new Worker(*this, i));
+
+      for (unsigned i = 0; i < size; ++i)
+      {
+        Time::Clock::reserve();
+        m_workers[i]->start();
+      }
+    }
+
+    WorkerPool::~WorkerPool(void)
+    {
+      for (unsigned i = 0; i < m_workers.size(); ++i)
+        m_workers[i]->stop();
+
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        m_cond.broadcast();
+      }
+
+      for (unsigned i = 0; i < m_workers.size(); ++i)
+      {
+        m_workers[i]->join();
+        delete m_workers[i];
+      }
+    }
+
+    void
+    WorkerPool::attach(Task* task)
+    {
+      // A task that was stopped may be started again.
+      task->m_job_state.compareAndSwap(JS_DONE, JS_IDLE);
+      schedule(task);
+    }
+
+    void
+    WorkerPool::schedule(Task* task)
+    {
+      while (true)
+      {
+        int state = task->m_job_state.value();
+
+        if (state == JS_IDLE)
+        {
+          if (!task->m_job_state.compareAndSwap(JS_IDLE, JS_QUEUED))
+            continue;
+
+          task->m_job_queued = Time::Clock::get();
+          enqueue(task);
+          return;
+        }
+
+        if (state == JS_RUNNING)
+        {
+          if (!task->m_job_state.compareAndSwap(JS_RUNNING, JS_RUNNING_PENDING))
+            continue;
+          return;
+        }
+
+        // Already queued, pending or dead.
+        return;
+      }
+    }
+
+    void
+    WorkerPool::enqueue(Task* task)
+    {
+      unsigned index = static_cast<unsigned>(m_next.add(1)) % m_workers.size();
+      m_workers[index]->push(task);
+      m_pending.add(1);
+
+      // Workers check m_pending after announcing they are idle.
+      // Either they see this job or we see them.
+      if (m_idle.value() > 0)
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        m_cond.signal();
+      }
+    }
+
+    Task*
+    WorkerPool::take(unsigned index)
+    {
+      if (m_pending.value() <= 0)
+        return NULL;
+
+      Task* task = m_workers[index]->pop(false);
+      for (unsigned i = 1; task == NULL && i < m_workers.size(); ++i)
+        task = m_workers[(index + i) % m_workers.size()]->pop(true);
+
+      if (task != NULL)
+        m_pending.sub(1);
+
+      return task;
+    }
+
+    void
+    WorkerPool::idle(double timeout)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      m_idle.add(1);
+      if (m_pending.value() <= 0)
+        m_cond.wait(timeout);
+      m_idle.sub(1);
+    }
+
+    void
+    WorkerPool::execute(Task* task)
+    {
+      task->m_job_state.compareAndSwap(JS_QUEUED, JS_RUNNING);
+
+      double start = Time::Clock::get();
+      task->recordQueueLatency(start - task->m_job_queued);
+
+      double delay = task->runStep();
+
+      if (task->isDead())
+      {
+        m_timers.cancel(&task->m_step_timer);
+        task->m_job_state.compareAndSwap(JS_RUNNING, JS_DONE);
+        task->m_job_state.compareAndSwap(JS_RUNNING_PENDING, JS_DONE);
+        return;
+      }
+
+      if (delay >= 0)
+        m_timers.schedule(&task->m_step_timer, Time::Clock::get() + delay);
+      else
+        m_timers.cancel(&task->m_step_timer);
+
+      if (task->m_job_state.compareAndSwap(JS_RUNNING, JS_IDLE))
+        return;
+
+      // An event arrived while the step was running.
+      task->m_job_queued = Time::Clock::get();
+      task->m_job_state.compareAndSwap(JS_RUNNING_PENDING, JS_QUEUED);
+      enqueue(task);
+    }
+  }
+}
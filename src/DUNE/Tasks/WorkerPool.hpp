@@ -0,0 +1,155 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef DUNE_TASKS_WORKER_POOL_HPP_INCLUDED_
+#define DUNE_TASKS_WORKER_POOL_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/AtomicCounter.hpp>
+#include <DUNE/Concurrency/Condition.hpp>
+#include <DUNE/Tasks/TimerWheel.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    // Forward declarations.
+    class Task;
+
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM WorkerPool;
+
+    //! Fixed number of threads executing tasks as jobs. A task
+    //! attached to the pool does not own a thread: it runs one step
+    //! at a time whenever an event (message arrival, timer expiration
+    //! or stop request) is scheduled for it. Steps of the same task
+    //! never run concurrently. Each worker has its own job queue and
+    //! idle workers steal jobs from the others. Timed steps are
+    //! scheduled on a timer wheel.
+    class WorkerPool
+    {
+    public:
+      //! Constructor.
+      //! @param[in] size number of worker threads.
+      //! @param[in] timers timer wheel used to schedule timed steps.
+      WorkerPool(unsigned size, TimerWheel& timers);
+
+      //! Destructor. Stops and joins all worker threads, tasks must
+      //! be stopped beforehand.
+      ~WorkerPool(void);
+
+      //! Retrieve the number of worker threads.
+      //! @return number of worker threads.
+      unsigned
+      getSize(void) const
+      {
+        return m_workers.size();
+      }
+
+      //! Start running a task on the pool. Its first step is
+      //! scheduled immediately.
+      //! @param[in] task task.
+      void
+      attach(Task* task);
+
+      //! Schedule a step of a task as soon as possible. If a step is
+      //! already queued nothing is done; if a step is running another
+      //! one is queued after it completes.
+      //! @param[in] task task.
+      void
+      schedule(Task* task);
+
+    private:
+      class Worker;
+
+      //! Job states.
+      enum JobState
+      {
+        //! Nothing to do.
+        JS_IDLE,
+        //! Waiting in a worker queue.
+        JS_QUEUED,
+        //! Step in progress.
+        JS_RUNNING,
+        //! Step in progress, another one must follow.
+        JS_RUNNING_PENDING,
+        //! Task is dead.
+        JS_DONE
+      };
+
+      //! Worker threads.
+      std::vector<Worker*> m_workers;
+      //! Timer wheel.
+      TimerWheel& m_timers;
+      //! Worker that receives the next job submitted from outside.
+      Concurrency::AtomicCounter m_next;
+      //! Number of queued jobs.
+      Concurrency::AtomicCounter m_pending;
+      //! Number of workers waiting for jobs.
+      Concurrency::AtomicCounter m_idle;
+      //! Condition used to wake up idle workers.
+      Concurrency::Condition m_cond;
+
+      //! Place a job in the queue of a worker.
+      //! @param[in] task task.
+      void
+      enqueue(Task* task);
+
+      //! Retrieve a job for a given worker, stealing from the other
+      //! workers if its own queue is empty.
+      //! @param[in] index worker index.
+      //! @return task or NULL if there are no jobs.
+      Task*
+      take(unsigned index);
+
+      //! Wait until there are jobs or a timeout expires.
+      //! @param[in] timeout timeout in seconds.
+      void
+      idle(double timeout);
+
+      //! Run one step of a task.
+      //! @param[in] task task.
+      void
+      execute(Task* task);
+
+      //! Non-copyable.
+      WorkerPool(const WorkerPool&);
+
+      //! Non-assignable.
+      WorkerPool&
+      operator=(const WorkerPool&);
+    };
+  }
+}
+
+#endif
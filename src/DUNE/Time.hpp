@@ -42,6 +42,8 @@ namespace DUNE
 #include <DUNE/Time/BrokenDown.hpp>
 #include <DUNE/Time/Delay.hpp>
 #include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/ClockSource.hpp>
+#include <DUNE/Time/VirtualClock.hpp>
 #include <DUNE/Time/Utils.hpp>
 #include <DUNE/Time/Delta.hpp>
 #include <DUNE/Time/Counter.hpp>
@@ -55,8 +55,20 @@ namespace DUNE
 {
   namespace Time
   {
+    //! Installed time source.
+    static ClockSource* s_source = NULL;
+
     uint64_t
     Clock::getNsec(void)
+    {
+      if (s_source != NULL)
+        return s_source->getNsec();
+
+      return getSystemNsec();
+    }
+
+    uint64_t
+    Clock::getSystemNsec(void)
     {
       // POSIX RT.
 #if defined(DUNE_SYS_HAS_CLOCK_GETTIME)
@@ -73,14 +85,23 @@ namespace DUNE
         QueryPerformanceCounter(&li);
         return (uint64_t)(li.QuadPart * (1000000000L / (double)frequency.QuadPart));
       }
-      return getSinceEpochNsec();
+      return getSystemSinceEpochNsec();
 #else
-      return getSinceEpochNsec();
+      return getSystemSinceEpochNsec();
 #endif
     }
 
     uint64_t
     Clock::getSinceEpochNsec(void)
+    {
+      if (s_source != NULL)
+        return s_source->getSinceEpochNsec();
+
+      return getSystemSinceEpochNsec();
+    }
+
+    uint64_t
+    Clock::getSystemSinceEpochNsec(void)
     {
       // POSIX RT.
 #if defined(DUNE_SYS_HAS_CLOCK_GETTIME)
@@ -109,7 +130,7 @@ namespace DUNE
 
       // Unsupported system.
 #else
-#  error Clock::getSinceEpochNsec() is not yet implemented in this system.
+#  error Clock::getSystemSinceEpochNsec() is not yet implemented in this system.
 
 #endif
     }
@@ -117,6 +138,9 @@ namespace DUNE
     void
     Clock::set(double value)
     {
+      if (s_source != NULL)
+        return;
+
 #if defined(DUNE_SYS_HAS_SETTIMEOFDAY)
       timeval tv;
       tv.tv_sec = static_cast<time_t>(value);
@@ -127,5 +151,38 @@ namespace DUNE
       (void)value;
 #endif
     }
+
+    void
+    Clock::setSource(ClockSource* source)
+    {
+      s_source = source;
+    }
+
+    ClockSource*
+    Clock::getSource(void)
+    {
+      return s_source;
+    }
+
+    void
+    Clock::attach(void)
+    {
+      if (s_source != NULL)
+        s_source->attach();
+    }
+
+    void
+    Clock::detach(void)
+    {
+      if (s_source != NULL)
+        s_source->detach();
+    }
+
+    void
+    Clock::reserve(void)
+    {
+      if (s_source != NULL)
+        s_source->reserve();
+    }
   }
 }
@@ -33,6 +33,7 @@
 // DUNE headers.
 #include <DUNE/Config.hpp>
 #include <DUNE/Time/Constants.hpp>
+#include <DUNE/Time/ClockSource.hpp>
 
 namespace DUNE
 {
@@ -116,10 +117,51 @@ namespace DUNE
       }
 
       //! Set current time in the form of seconds elapsed since the
-      //! UNIX Epoch (Midnight UTC of January 1, 1970).
+      //! UNIX Epoch (Midnight UTC of January 1, 1970). Ignored while
+      //! a clock source is installed.
       //! @param value time in seconds.
       static void
       set(double value);
+
+      //! Same as getNsec() but always reads the operating system
+      //! clock, even if a clock source is installed.
+      //! @return time in nanoseconds.
+      static uint64_t
+      getSystemNsec(void);
+
+      //! Same as getSinceEpochNsec() but always reads the operating
+      //! system clock, even if a clock source is installed.
+      //! @return time in nanoseconds.
+      static uint64_t
+      getSystemSinceEpochNsec(void);
+
+      //! Install an alternative time source. Must be called before
+      //! any other thread is started and the source must outlive
+      //! all of them.
+      //! @param[in] source time source or NULL to use the operating
+      //! system clock.
+      static void
+      setSource(ClockSource* source);
+
+      //! Get the installed time source.
+      //! @return time source or NULL if the operating system clock
+      //! is in use.
+      static ClockSource*
+      getSource(void);
+
+      //! Declare the calling thread a participant of the installed
+      //! time source, if any.
+      static void
+      attach(void);
+
+      //! Revert attach() for the calling thread.
+      static void
+      detach(void);
+
+      //! Reserve a participant slot for a thread that is about to
+      //! be started and will call attach().
+      static void
+      reserve(void);
     };
   }
 }
@@ -0,0 +1,157 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef DUNE_TIME_CLOCK_SOURCE_HPP_INCLUDED_
+#define DUNE_TIME_CLOCK_SOURCE_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Time
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM ClockSource;
+
+    //! Alternative time source for Clock, Delay and timed waits on
+    //! Concurrency::Condition. When a source is installed with
+    //! Clock::setSource() every time query and timed wait is
+    //! forwarded to it.
+    class ClockSource
+    {
+    public:
+      //! Thread blocked in a timed or untimed wait.
+      class Waiter
+      {
+      public:
+        //! Deadline of untimed waits.
+        static const uint64_t c_forever = ~static_cast<uint64_t>(0);
+
+        //! Waiter states.
+        enum State
+        {
+          //! Still waiting.
+          WS_PENDING,
+          //! Woken up by notify().
+          WS_NOTIFIED,
+          //! Deadline reached.
+          WS_EXPIRED
+        };
+
+        //! Constructor.
+        //! @param[in] obj waited object, used to match notify().
+        //! @param[in] dl deadline in nanoseconds, as returned by
+        //! ClockSource::getNsec(), or c_forever.
+        Waiter(const void* obj, uint64_t dl):
+          object(obj),
+          deadline(dl),
+          state(WS_PENDING),
+          participant(false)
+        { }
+
+        virtual
+        ~Waiter(void)
+        { }
+
+        //! Wake up the waiting thread. Called with the source locked
+        //! when the waiter is released by notify() or by reaching
+        //! its deadline, must not block.
+        virtual void
+        wake(void) = 0;
+
+        //! Waited object.
+        const void* object;
+        //! Deadline.
+        uint64_t deadline;
+        //! Current state.
+        State state;
+        //! True if the waiting thread is attached to the source.
+        bool participant;
+      };
+
+      virtual
+      ~ClockSource(void)
+      { }
+
+      //! @see Clock::getNsec().
+      virtual uint64_t
+      getNsec(void) = 0;
+
+      //! @see Clock::getSinceEpochNsec().
+      virtual uint64_t
+      getSinceEpochNsec(void) = 0;
+
+      //! @see Delay::waitNsec().
+      virtual void
+      waitNsec(uint64_t nsec) = 0;
+
+      //! Declare the calling thread a participant. Sources that
+      //! advance on demand only do so when all participants are
+      //! waiting.
+      virtual void
+      attach(void) = 0;
+
+      //! Revert attach() for the calling thread.
+      virtual void
+      detach(void) = 0;
+
+      //! Count a thread that is about to be started as running
+      //! until it calls attach(). Called by the creator so that time
+      //! does not advance before the new thread gets to run.
+      virtual void
+      reserve(void) = 0;
+
+      //! Register a waiter. The waiter must stay registered until
+      //! removeWaiter() is called.
+      //! @param[in] waiter waiter.
+      virtual void
+      addWaiter(Waiter& waiter) = 0;
+
+      //! Unregister a waiter.
+      //! @param[in] waiter waiter.
+      //! @return final state of the waiter.
+      virtual Waiter::State
+      removeWaiter(Waiter& waiter) = 0;
+
+      //! Get the state of a registered waiter.
+      //! @param[in] waiter waiter.
+      //! @return waiter state.
+      virtual Waiter::State
+      getState(const Waiter& waiter) = 0;
+
+      //! Mark all waiters of an object as notified and wake them up.
+      //! @param[in] object waited object.
+      virtual void
+      notify(const void* object) = 0;
+    };
+  }
+}
+
+#endif
@@ -29,6 +29,7 @@
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
+#include <DUNE/Time/Clock.hpp>
 #include <DUNE/Time/Delay.hpp>
 #include <DUNE/Time/Constants.hpp>
 
@@ -48,6 +49,13 @@ namespace DUNE
     void
     Delay::waitNsec(uint64_t nsec)
     {
+      ClockSource* source = Clock::getSource();
+      if (source != NULL)
+      {
+        source->waitNsec(nsec);
+        return;
+      }
+
       // Microsoft Windows.
 #if defined(DUNE_SYS_HAS_CREATE_WAITABLE_TIMER)
       HANDLE t = CreateWaitableTimer(0, TRUE, 0);
@@ -0,0 +1,246 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/VirtualClock.hpp>
+#include <DUNE/Concurrency/Condition.hpp>
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+
+namespace DUNE
+{
+  namespace Time
+  {
+    VirtualClock::VirtualClock(double epoch):
+      m_now(Clock::getSystemNsec()),
+      m_busy(0),
+      m_reserved(0)
+    {
+      uint64_t since_epoch = Clock::getSystemSinceEpochNsec();
+      if (epoch >= 0)
+        since_epoch = static_cast<uint64_t>(epoch * c_nsec_per_sec_fp);
+
+      m_epoch_offset = since_epoch - m_now;
+    }
+
+    VirtualClock::~VirtualClock(void)
+    { }
+
+    uint64_t
+    VirtualClock::getNsec(void)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      return m_now;
+    }
+
+    uint64_t
+    VirtualClock::getSinceEpochNsec(void)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      return m_now + m_epoch_offset;
+    }
+
+    void
+    VirtualClock::waitNsec(uint64_t nsec)
+    {
+      uint64_t deadline = getNsec() + nsec;
+
+      // Condition waits are forwarded back to this clock.
+      Concurrency::Condition cond;
+      Concurrency::ScopedCondition c(cond);
+
+      uint64_t now = getNsec();
+      while (now < deadline)
+      {
+        cond.wait((deadline - now) / c_nsec_per_sec_fp);
+        now = getNsec();
+      }
+    }
+
+    void
+    VirtualClock::attach(void)
+    {
+      if (m_attached.get() != NULL)
+        return;
+
+      m_attached.set(this);
+
+      Concurrency::ScopedMutex l(m_lock);
+      if (m_reserved > 0)
+        --m_reserved;
+      else
+        ++m_busy;
+    }
+
+    void
+    VirtualClock::detach(void)
+    {
+      if (m_attached.get() == NULL)
+        return;
+
+      m_attached.set(NULL);
+
+      Concurrency::ScopedMutex l(m_lock);
+      --m_busy;
+      advance();
+    }
+
+    void
+    VirtualClock::reserve(void)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      ++m_reserved;
+      ++m_busy;
+    }
+
+    void
+    VirtualClock::addWaiter(Waiter& waiter)
+    {
+      waiter.participant = (m_attached.get() != NULL);
+      waiter.state = Waiter::WS_PENDING;
+
+      Concurrency::ScopedMutex l(m_lock);
+
+      if (waiter.deadline <= m_now)
+      {
+        waiter.state = Waiter::WS_EXPIRED;
+        return;
+      }
+
+      m_waiters.push_back(&waiter);
+      if (waiter.participant)
+        --m_busy;
+
+      advance();
+    }
+
+    ClockSource::Waiter::State
+    VirtualClock::removeWaiter(Waiter& waiter)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+
+      if (waiter.state == Waiter::WS_PENDING)
+      {
+        for (size_t i = 0; i < m_waiters.size(); ++i)
+        {
+          if (m_waiters[i] == &waiter)
+          {
+            release(i, Waiter::WS_NOTIFIED);
+            break;
+          }
+        }
+      }
+
+      return waiter.state;
+    }
+
+    ClockSource::Waiter::State
+    VirtualClock::getState(const Waiter& waiter)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      return waiter.state;
+    }
+
+    void
+    VirtualClock::notify(const void* object)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+
+      for (size_t i = 0; i < m_waiters.size(); )
+      {
+        Waiter* waiter = m_waiters[i];
+        if (waiter->object == object)
+        {
+          release(i, Waiter::WS_NOTIFIED);
+          waiter->wake();
+        }
+        else
+        {
+          ++i;
+        }
+      }
+    }
+
+    unsigned
+    VirtualClock::getBusyCount(void)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      return m_busy;
+    }
+
+    void
+    VirtualClock::release(size_t index, Waiter::State state)
+    {
+      Waiter* waiter = m_waiters[index];
+      waiter->state = state;
+      if (waiter->participant)
+        ++m_busy;
+
+      m_waiters[index] = m_waiters.back();
+      m_waiters.pop_back();
+    }
+
+    void
+    VirtualClock::advance(void)
+    {
+      while (m_busy == 0 && !m_waiters.empty())
+      {
+        uint64_t next = Waiter::c_forever;
+        for (size_t i = 0; i < m_waiters.size(); ++i)
+        {
+          if (m_waiters[i]->deadline < next)
+            next = m_waiters[i]->deadline;
+        }
+
+        // Everybody is waiting for somebody else.
+        if (next == Waiter::c_forever)
+          return;
+
+        if (next > m_now)
+          m_now = next;
+
+        for (size_t i = 0; i < m_waiters.size(); )
+        {
+          Waiter* waiter = m_waiters[i];
+          if (waiter->deadline <= m_now)
+          {
+            release(i, Waiter::WS_EXPIRED);
+            waiter->wake();
+          }
+          else
+          {
+            ++i;
+          }
+        }
+      }
+    }
+  }
+}
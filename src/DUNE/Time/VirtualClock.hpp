@@ -0,0 +1,142 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef DUNE_TIME_VIRTUAL_CLOCK_HPP_INCLUDED_
+#define DUNE_TIME_VIRTUAL_CLOCK_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Time/ClockSource.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/RawTLS.hpp>
+
+namespace DUNE
+{
+  namespace Time
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM VirtualClock;
+
+    //! Discrete event clock. Virtual time stands still while any
+    //! attached thread is running; as soon as all attached threads
+    //! are blocked in Delay or Concurrency::Condition waits it jumps
+    //! to the earliest pending deadline and wakes the threads waiting
+    //! for it. Threads that are not attached follow virtual time but
+    //! do not hold it back.
+    //!
+    //! Usage: install with Clock::setSource() before starting any
+    //! thread and call Clock::attach() at the start of every thread
+    //! that takes part in the simulation.
+    class VirtualClock: public ClockSource
+    {
+    public:
+      //! Constructor.
+      //! @param[in] epoch initial time in seconds since the UNIX
+      //! Epoch, negative to start at the current system time.
+      VirtualClock(double epoch = -1.0);
+
+      //! Destructor.
+      ~VirtualClock(void);
+
+      uint64_t
+      getNsec(void);
+
+      uint64_t
+      getSinceEpochNsec(void);
+
+      void
+      waitNsec(uint64_t nsec);
+
+      void
+      attach(void);
+
+      void
+      detach(void);
+
+      void
+      reserve(void);
+
+      void
+      addWaiter(Waiter& waiter);
+
+      Waiter::State
+      removeWaiter(Waiter& waiter);
+
+      Waiter::State
+      getState(const Waiter& waiter);
+
+      void
+      notify(const void* object);
+
+      //! Get the number of attached threads that are not waiting.
+      //! @return number of running participants.
+      unsigned
+      getBusyCount(void);
+
+    private:
+      //! Current monotonic time in nanoseconds.
+      uint64_t m_now;
+      //! Difference between time since the epoch and monotonic time.
+      uint64_t m_epoch_offset;
+      //! Number of attached threads that are not waiting, including
+      //! reserved slots.
+      unsigned m_busy;
+      //! Number of reserved slots.
+      unsigned m_reserved;
+      //! Pending waiters.
+      std::vector<Waiter*> m_waiters;
+      //! Attached flag of each thread.
+      Concurrency::RawTLS m_attached;
+      //! Lock of the clock state.
+      Concurrency::Mutex m_lock;
+
+      //! Release a waiter, must be called with the lock held.
+      //! @param[in] index waiter index.
+      //! @param[in] state final state.
+      void
+      release(size_t index, Waiter::State state);
+
+      //! Advance time while no participant is running, must be
+      //! called with the lock held.
+      void
+      advance(void);
+
+      // Non-copyable.
+      VirtualClock(const VirtualClock&);
+
+      VirtualClock&
+      operator=(const VirtualClock&);
+    };
+  }
+}
+
+#endif
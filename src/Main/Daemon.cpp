@@ -168,6 +168,7 @@ runDaemon(DUNE::Daemon& daemon)
   try
   {
     daemon.start();
+    Time::Clock::detach();
 
     while (!s_stop)
     {
@@ -238,7 +239,9 @@ main(int argc, char** argv)
   .add("-V", "--vehicle",
        "Vehicle name override", "VEHICLE")
   .add("-X", "--dump-params-xml",
-       "Dump parameters XML to folder DIR", "DIR");
+       "Dump parameters XML to folder DIR", "DIR")
+  .add("-t", "--virtual-time",
+       "Run on a virtual clock, advancing time whenever all tasks are idle");
 
   // Parse command line arguments.
   if (!options.parse(argc, argv))
@@ -307,6 +310,15 @@ main(int argc, char** argv)
   if (!options.value("--vehicle").empty())
     context.config.set("General", "Vehicle", options.value("--vehicle"));
 
+  // If requested, run on virtual time. The main thread holds time
+  // still until all tasks are started.
+  if (!options.value("--virtual-time").empty())
+  {
+    static Time::VirtualClock s_virtual_clock;
+    Time::Clock::setSource(&s_virtual_clock);
+    Time::Clock::attach();
+  }
+
   try
   {
     DUNE::Daemon daemon(context, options.value("--profiles"));
@@ -54,6 +54,48 @@ namespace Maneuver
       //! Vector for Entity Mapping.
       typedef std::vector<uint32_t> Entities;
 
+      //! Copy N consecutive rows of a dynamic matrix column.
+      //! @param[in] m source matrix.
+      //! @param[in] row first row.
+      //! @param[in] col column.
+      //! @return column segment.
+      template <unsigned N>
+      static inline Math::FixedMatrix<N, 1>
+      segment(const Matrix& m, unsigned row, unsigned col)
+      {
+        Math::FixedMatrix<N, 1> v;
+        for (unsigned i = 0; i < N; ++i)
+          v(i) = m(row + i, col);
+        return v;
+      }
+
+      //! Copy N consecutive rows of a fixed-size column vector.
+      //! @param[in] m source vector.
+      //! @param[in] row first row.
+      //! @return vector segment.
+      template <unsigned N, unsigned M>
+      static inline Math::FixedMatrix<N, 1>
+      segment(const Math::FixedMatrix<M, 1>& m, unsigned row)
+      {
+        Math::FixedMatrix<N, 1> v;
+        for (unsigned i = 0; i < N; ++i)
+          v(i) = m(row + i);
+        return v;
+      }
+
+      //! Store a fixed-size column vector into a dynamic matrix column.
+      //! @param[out] m destination matrix.
+      //! @param[in] row first row.
+      //! @param[in] col column.
+      //! @param[in] v source vector.
+      template <unsigned N>
+      static inline void
+      setSegment(Matrix& m, unsigned row, unsigned col, const Math::FixedMatrix<N, 1>& v)
+      {
+        for (unsigned i = 0; i < N; ++i)
+          m(row + i, col) = v(i);
+      }
+
       struct Arguments
       {
         //! Command source
@@ -2378,7 +2420,6 @@ namespace Maneuver
           //! Temporary prediction variables initialization
           Matrix vd_pos(6, 1, 0.0);
           Matrix vd_vel(6, 1, 0.0);
-          UAVSimulation model;
           double mt_vehicle_accel[3] = {0, 0, 0};
           double d_cos_psi;
           double d_sin_psi;
@@ -2390,7 +2431,7 @@ namespace Maneuver
           //! - Leader state prediction - Update the simulated vehicle state
           if (m_team_leader_init)
           {
-            model = *m_model;
+            UAVSimulation model(*m_model);
             model.update(d_time - m_last_state_estim(0));
             vd_pos = model.getPosition();
             vd_vel = model.getVelocity();
@@ -2417,7 +2458,7 @@ namespace Maneuver
             {
               //spew("Assynchronous update 2.1");
               //!  * Retrieve current vehicle model
-              model = *m_models[ind_uav];
+              UAVSimulation model(*m_models[ind_uav]);
 
               //spew("Assynchronous update 2.2");
               //!  * State update
@@ -2464,8 +2505,10 @@ namespace Maneuver
           //debug("formationControl - start");
 
           //! Control parameters
-          double mt_gain_mtx[2] = {m_k_longitudinal, m_k_lateral};
-          Matrix md_gain_mtx = Matrix(mt_gain_mtx, 2) * m_speed_cmd_leader/2.5;
+          Matrix2 md_gain_mtx;
+          md_gain_mtx(0, 0) = m_k_longitudinal;
+          md_gain_mtx(1, 1) = m_k_lateral;
+          md_gain_mtx *= m_speed_cmd_leader/2.5;
           double d_ss_bnd_layer = m_k_boundary * m_speed_cmd_leader;
           double d_deconfliction_dist = m_safe_dist + m_deconfliction_offset;
           double k_form_ref = (m_uav_n > 1)?m_k_leader*(m_uav_n-1):1.0;
@@ -2479,48 +2522,48 @@ namespace Maneuver
           double d_sin_heading = std::sin(md_uav_state(8, ind_uav+1));
 
           double t_rot_ground2yaw[4] = {d_cos_heading, d_sin_heading, -d_sin_heading, d_cos_heading};
-          Matrix md_rot_ground2yaw = Matrix(t_rot_ground2yaw, 2, 2);
-          Matrix vd_body_x = transpose(md_rot_ground2yaw.row(0));
-          Matrix vd_body_y = transpose(md_rot_ground2yaw.row(1));
+          Matrix2 md_rot_ground2yaw(t_rot_ground2yaw);
+          Vector2 vd_body_x(t_rot_ground2yaw);
+          Vector2 vd_body_y(t_rot_ground2yaw + 2);
 
           // Maneuvering constrains
-          Matrix vd_body_accel_lim_x = m_accel_lim_x*vd_body_x;
-          Matrix vd_body_accel_lim_y = m_g * std::tan(m_bank_lim*0.75)*vd_body_y;
+          Vector2 vd_body_accel_lim_x = m_accel_lim_x*vd_body_x;
+          Vector2 vd_body_accel_lim_y = m_g * std::tan(m_bank_lim*0.75)*vd_body_y;
 
           //! Miscellaneous
           double t_uav_turnrad;
           double t_cos_gamma;
           double t_sin_gamma;
           double vt_form_dir[2];
-          Matrix vd_form_pos1 = Matrix(2, 1, 0.0);
+          Vector2 vd_form_pos1;
           double t_dist_gain;
 
-          Matrix vd_inter_uav_state = Matrix(6, 1);
-          Matrix vd_inter_uav_pos = Matrix(2, 1);
+          Vector6 vd_inter_uav_state;
+          Vector2 vd_inter_uav_pos;
           double d_inter_uav_dist;
           double d_inter_uav_angle;
           double d_cos_inter_uav_angle;
           double d_sin_inter_uav_angle;
           double mt_rot[4];
-          Matrix md_rot = Matrix(2, 2);
-          Matrix vd_inter_uav_x = Matrix(2, 1);
-          Matrix vd_inter_uav_y = Matrix(2, 1);
+          Matrix2 md_rot;
+          Vector2 vd_inter_uav_x;
+          Vector2 vd_inter_uav_y;
 
           double vt_form_pos2[2] = {0, 0};
-          Matrix vd_form_pos2 = Matrix(2, 1, 0.0);
-          Matrix vd_inter_uav_des_pos = Matrix(2, 1, 0.0);
-          Matrix vd_inter_uav_des_vel = Matrix(2, 1, 0.0);
-          Matrix vd_inter_uav_des_acc = Matrix(2, 1, 0.0);
+          Vector2 vd_form_pos2;
+          Vector2 vd_inter_uav_des_pos;
+          Vector2 vd_inter_uav_des_vel;
+          Vector2 vd_inter_uav_des_acc;
 
-          Matrix vd_err = Matrix(2, 1);
-          Matrix vd_orig_err = Matrix(2, 1);
+          Vector2 vd_err;
+          Vector2 vd_orig_err;
           double t_err_y;
           double d_err_x;
           double d_err_y;
           double d_err_x_s_conv;
           // double d_err_y_s_conv;
           int int_Max;
-          Matrix vd_deriv_err = Matrix(2, 1);
+          Vector2 vd_deriv_err;
           double d_deriv_err_x;
           double d_deriv_err_y;
 
@@ -2543,7 +2586,7 @@ namespace Maneuver
           double t_surf_y;
 
           double d_inter_uav_angle_dot;
-          Matrix vt_surf_deriv =  Matrix(2, 1, 0.0);
+          Vector2 vt_surf_deriv;
 
           Matrix vd_surf_uav = Matrix(2, m_uav_n+1, 0.0);
           Matrix vt_virt_err_uav = Matrix(2, m_uav_n+1, 0.0);
@@ -2565,7 +2608,7 @@ namespace Maneuver
         vd_Pert = 10*std::cos(d_Time/20*2*pi)*[-1; 1];
         //     vd_Pert = 10*[-std::cos(d_Time/20*2*pi); std::sin(d_Time/20*2*pi)];
         //     vd_Pert = [0; 0];
-            m_formation_pos.set(0, 1, ind_uav, ind_uav, m_formation_pos.get(0, 1, ind_uav, ind_uav) + vd_Pert);
+            m_formation_pos.set(0, 1, ind_uav, ind_uav, segment<2>(m_formation_pos, 0, ind_uav) + vd_Pert);
         end
         // ======== Formation perturbation test - Mesh stability =======
            */
@@ -2575,13 +2618,13 @@ namespace Maneuver
           //-------------------------------------------
           //debug("formationControl - 1");
 
-          Matrix vd_leader_hor_vel = md_uav_state.get(3, 4, 0, 0);
+          Vector2 vd_leader_hor_vel = segment<2>(md_uav_state, 3, 0);
           double d_leader_gndspeed = vd_leader_hor_vel.norm_2();
           double d_cos_form_course = md_uav_state(3, 0)/d_leader_gndspeed;
           double d_sin_form_course = md_uav_state(4, 0)/d_leader_gndspeed;
           double t_rot_formation[4] = {d_cos_form_course, -d_sin_form_course,
               d_sin_form_course,  d_cos_form_course};
-          Matrix md_rot_formation = Matrix(t_rot_formation, 2, 2);
+          Matrix2 md_rot_formation(t_rot_formation);
 
           //! Formation current rotation radius, speed, and turn-rate
           double d_form_turnrate = m_g * std::tan(md_uav_state(6, 0))/d_leader_gndspeed*
@@ -2601,7 +2644,7 @@ namespace Maneuver
             {
               //! Formation following in a straight line
               d_form_turnrate = 0;
-              vd_form_pos1 = m_formation_pos.get(0, 1, ind_uav, ind_uav);
+              vd_form_pos1 = segment<2>(m_formation_pos, 0, ind_uav);
               /*
             Matrix vd_form_vel1[2] = {0, 0};
             Matrix vd_form_acc1[2] = {0, 0};
@@ -2618,8 +2661,8 @@ namespace Maneuver
               vt_form_dir[0] = t_sin_gamma;
               vt_form_dir[1] = 1 - t_cos_gamma;
               double vt_form_pos1[2] = {0, m_formation_pos(1, ind_uav)};
-              vd_form_pos1 = t_uav_turnrad * Matrix(vt_form_dir, 2, 1) +
-                  Matrix(vt_form_pos1, 2, 1);
+              vd_form_pos1 = t_uav_turnrad * Vector2(vt_form_dir) +
+                  Vector2(vt_form_pos1);
               /*
             //! - Velocity
             double vt_form_vel1[2] = {-vd_form_pos1(1), vd_form_pos1(0)};
@@ -2631,7 +2674,7 @@ namespace Maneuver
             else
             {
               //! Ground reference frame
-              vd_form_pos1 = m_formation_pos.get(0, 1, ind_uav, ind_uav);
+              vd_form_pos1 = segment<2>(m_formation_pos, 0, ind_uav);
               /*
             //! - Velocity
             double vt_form_vel1[2] = {-vd_form_pos1(1), vd_form_pos1(0)};
@@ -2657,9 +2700,9 @@ namespace Maneuver
 
             //debug("formationControl - 2.1");
             //! Computing relative state, from current UAV to "ind_uav2" UAV
-            vd_inter_uav_state = md_uav_state.get(0, 5, ind_uav2+1, ind_uav2+1) -
-                md_uav_state.get(0, 5, ind_uav+1, ind_uav+1);
-            vd_inter_uav_pos = vd_inter_uav_state.get(0, 1, 0, 0);
+            vd_inter_uav_state = segment<6>(md_uav_state, 0, ind_uav2+1) -
+                segment<6>(md_uav_state, 0, ind_uav+1);
+            vd_inter_uav_pos = segment<2>(vd_inter_uav_state, 0);
             d_inter_uav_dist = vd_inter_uav_pos.norm_2();
             //! Computing the rotation matrix - From inter-UAV frame to ground frame
             d_inter_uav_angle = std::atan2(vd_inter_uav_pos(1),
@@ -2670,9 +2713,11 @@ namespace Maneuver
             mt_rot[1] = -d_sin_inter_uav_angle;
             mt_rot[2] = d_sin_inter_uav_angle;
             mt_rot[3] = d_cos_inter_uav_angle;
-            md_rot = Matrix(mt_rot, 2, 2);
-            vd_inter_uav_x = md_rot.column(0);
-            vd_inter_uav_y = md_rot.column(1);
+            md_rot = Matrix2(mt_rot);
+            vd_inter_uav_x(0) = md_rot(0, 0);
+            vd_inter_uav_x(1) = md_rot(1, 0);
+            vd_inter_uav_y(0) = md_rot(0, 1);
+            vd_inter_uav_y(1) = md_rot(1, 1);
 
             //debug("formationControl - 2.2");
             //! Computation of the desired formation state:
@@ -2683,14 +2728,14 @@ namespace Maneuver
             {
               //! Ground reference frame
               //! - Position
-              vd_inter_uav_des_pos = m_formation_pos.get(0, 1, ind_uav, ind_uav) -
-                  m_formation_pos.get(0, 1, ind_uav2, ind_uav2);
+              vd_inter_uav_des_pos = segment<2>(m_formation_pos, 0, ind_uav) -
+                  segment<2>(m_formation_pos, 0, ind_uav2);
               //! - Velocity
-              vd_inter_uav_des_vel = Matrix(2, 1, 0.0);
+              vd_inter_uav_des_vel.fill(0.0);
               //! - Acceleration
-              vd_inter_uav_des_acc = Matrix(2, 1, 0.0);
+              vd_inter_uav_des_acc.fill(0.0);
               /* Alternative computation
-            vd_err = -vd_inter_uav_state.get(0, 1, 0, 0) - vd_inter_uav_des_pos;
+            vd_err = -segment<2>(vd_inter_uav_state, 0) - vd_inter_uav_des_pos;
             //! - Velocity
             vd_inter_uav_des_vel = [-vd_err(1); vd_err(0)] * d_form_turnrate;
             //! - Acceleration
@@ -2712,8 +2757,8 @@ namespace Maneuver
                 vt_form_dir[1] = 1 - t_cos_gamma;
                 vt_form_pos2[0] = 0;
                 vt_form_pos2[1] = m_formation_pos(1, ind_uav);
-                vd_form_pos2 = t_uav_turnrad * Matrix(vt_form_dir, 2, 1) +
-                    Matrix(vt_form_pos2, 2, 1);
+                vd_form_pos2 = t_uav_turnrad * Vector2(vt_form_dir) +
+                    Vector2(vt_form_pos2);
                 /*
               //! - Velocity
               vd_form_vel2 = [-vd_form_pos2(2); vd_form_pos2(1)] * d_form_turnrate;
@@ -2724,7 +2769,7 @@ namespace Maneuver
               else
               {
                 //! Original shape - Simpler formation shape rotation (below)
-                vd_form_pos2 = m_formation_pos.get(0, 1, ind_uav2, ind_uav2);
+                vd_form_pos2 = segment<2>(m_formation_pos, 0, ind_uav2);
                 /*
               vd_form_vel2 = [-vd_form_pos2(2); vd_form_pos2(1)] * d_form_turnrate;
               vd_form_acc2 = -vd_form_pos2 * d_form_turnrate*d_form_turnrate;
@@ -2732,21 +2777,21 @@ namespace Maneuver
               }
 
               vd_inter_uav_des_pos = md_rot_formation * (vd_form_pos1 - vd_form_pos2);
-              //vd_err = -vd_inter_uav_state.get(0, 1, 0, 0) - vd_inter_uav_des_pos;
+              //vd_err = -segment<2>(vd_inter_uav_state, 0) - vd_inter_uav_des_pos;
               //! - Velocity
               vd_inter_uav_des_vel(0) = vd_inter_uav_state(1) * d_form_turnrate;
               vd_inter_uav_des_vel(1) = -vd_inter_uav_state(0) * d_form_turnrate;
               //vd_inter_uav_des_vel = md_rot_formation * (vd_form_vel1 - vd_form_vel2);
               //! - Acceleration
-              vd_inter_uav_des_acc = vd_inter_uav_state.get(0, 1, 0, 0)  * d_form_turnrate*d_form_turnrate;
+              vd_inter_uav_des_acc = segment<2>(vd_inter_uav_state, 0)  * d_form_turnrate*d_form_turnrate;
               //vd_inter_uav_des_acc = md_rot_formation * (vd_form_acc1 - vd_form_acc2);
             }
 
             //debug("formationControl - 2.3");
             //! Relative position error vector
-            vd_err = -vd_inter_uav_state.get(0, 1, 0, 0) - vd_inter_uav_des_pos;
-            d_err_y = Matrix::dot(vd_err, vd_inter_uav_y);
-            d_err_x = Matrix::dot(vd_err, vd_inter_uav_x);
+            vd_err = -segment<2>(vd_inter_uav_state, 0) - vd_inter_uav_des_pos;
+            d_err_y = Math::dot(vd_err, vd_inter_uav_y);
+            d_err_x = Math::dot(vd_err, vd_inter_uav_x);
             // verificar uso de "Booleano" como alternativa a "int_Max",
             // para optimização do código e da facilidade de interpretação deste
             if (d_err_x < d_deconfliction_dist - d_inter_uav_dist)
@@ -2763,22 +2808,22 @@ namespace Maneuver
 
             //debug("formationControl - 2.4");
             //! Relative velocity error vector
-            vd_deriv_err = -vd_inter_uav_state.get(3, 4, 0, 0) - vd_inter_uav_des_vel;
-            d_deriv_err_x = Matrix::dot(vd_deriv_err, vd_inter_uav_x);
-            d_deriv_err_y = Matrix::dot(vd_deriv_err, vd_inter_uav_y);
+            vd_deriv_err = -segment<2>(vd_inter_uav_state, 3) - vd_inter_uav_des_vel;
+            d_deriv_err_x = Math::dot(vd_deriv_err, vd_inter_uav_x);
+            d_deriv_err_y = Math::dot(vd_deriv_err, vd_inter_uav_y);
 
             //! Maneuvering constrains - Projection onto the inter-UAV reference frame
-            d_vel_proj_x = Matrix::dot((md_uav_state.get(3, 4, ind_uav2+1, ind_uav2+1) - m_wind.get(0, 1, 0, 0)),
+            d_vel_proj_x = Math::dot((segment<2>(md_uav_state, 3, ind_uav2+1) - segment<2>(m_wind, 0, 0)),
                 vd_inter_uav_x);
             //debug("formationControl - 2.4.1");
-            d_accel_max_proj_x = std::abs(Matrix::dot(vd_body_accel_lim_x, vd_inter_uav_x)) +
-                std::abs(Matrix::dot(vd_body_accel_lim_y, vd_inter_uav_x));
+            d_accel_max_proj_x = std::abs(Math::dot(vd_body_accel_lim_x, vd_inter_uav_x)) +
+                std::abs(Math::dot(vd_body_accel_lim_y, vd_inter_uav_x));
             //debug("formationControl - 2.4.2");
-            d_vel_proj_y = Matrix::dot((md_uav_state.get(3, 4, ind_uav2+1, ind_uav2+1) - m_wind.get(0, 1, 0, 0)),
+            d_vel_proj_y = Math::dot((segment<2>(md_uav_state, 3, ind_uav2+1) - segment<2>(m_wind, 0, 0)),
                 vd_inter_uav_y);
             //debug("formationControl - 2.4.3");
-            d_accel_max_proj_y = std::abs(Matrix::dot(vd_body_accel_lim_x, vd_inter_uav_y)) +
-                std::abs(Matrix::dot(vd_body_accel_lim_y, vd_inter_uav_y));
+            d_accel_max_proj_y = std::abs(Math::dot(vd_body_accel_lim_x, vd_inter_uav_y)) +
+                std::abs(Math::dot(vd_body_accel_lim_y, vd_inter_uav_y));
 
             //debug("formationControl - 2.5");
             //! Sliding Surface parameters - Inter-UAV X axis
@@ -2886,20 +2931,20 @@ namespace Maneuver
             t_surf_x = d_c1 * d_err_x/(d_err_x - d_c2);
             t_surf_y = d_c3 * d_err_y/(d_err_y - d_c4);
             //! Sliding surface deviation
-            vd_surf_uav.set(0, 1, ind_uav2+1, ind_uav2+1,
-                            vd_deriv_err - t_surf_x * vd_inter_uav_x - t_surf_y * vd_inter_uav_y);
+            setSegment(vd_surf_uav, 0, ind_uav2+1,
+                       vd_deriv_err - t_surf_x * vd_inter_uav_x - t_surf_y * vd_inter_uav_y);
 
             //! ======= Virtual error and feedback linearization ================
-            d_inter_uav_angle_dot = Matrix::dot(vd_inter_uav_state.get(3, 4, 0, 0),
+            d_inter_uav_angle_dot = Math::dot(segment<2>(vd_inter_uav_state, 3),
                 vd_inter_uav_y/d_inter_uav_dist);
             // d_inter_uav_angle_dot = 0;
             vt_surf_deriv(0) = d_c1*d_c2*d_deriv_err_x/((d_err_x_s_conv - d_c2)*(d_err_x_s_conv - d_c2)) +
                 t_surf_y * d_inter_uav_angle_dot;
             vt_surf_deriv(1) = d_c3 * d_c4 * d_deriv_err_y/((d_err_y - d_c4)*(d_err_y - d_c4)) -
                 t_surf_x * d_inter_uav_angle_dot;
-            vt_virt_err_uav.set(0, 1, ind_uav2+1, ind_uav2+1,
-                                md_vehicle_accel.get(0, 1, ind_uav2+1, ind_uav2+1) +
-                                vd_inter_uav_des_acc - md_rot * vt_surf_deriv);
+            setSegment(vt_virt_err_uav, 0, ind_uav2+1,
+                       segment<2>(md_vehicle_accel, 0, ind_uav2+1) +
+                       vd_inter_uav_des_acc - md_rot * vt_surf_deriv);
 
             //debug("formationControl - 2.11");
             //! Tracking output
@@ -2931,17 +2976,17 @@ namespace Maneuver
               rel_state->err_y = vd_err(1);
               //rel_state->err_z = vd_err(2);
               //! Relative position error - Inter-vehicle reference frame
-              rel_state->rf_err_x = Matrix::dot(vd_err ,vd_inter_uav_x);
-              rel_state->rf_err_y = Matrix::dot(vd_err, vd_inter_uav_y);
-              //rel_state->rf_err_z = Matrix::dot(vd_err, vd_inter_uav_z);
+              rel_state->rf_err_x = Math::dot(vd_err ,vd_inter_uav_x);
+              rel_state->rf_err_y = Math::dot(vd_err, vd_inter_uav_y);
+              //rel_state->rf_err_z = Math::dot(vd_err, vd_inter_uav_z);
               //! Relative velocity error - Inter-vehicle reference frame
-              rel_state->rf_err_vx = Matrix::dot(vd_deriv_err, vd_inter_uav_x);
-              rel_state->rf_err_vy = Matrix::dot(vd_deriv_err, vd_inter_uav_y);
-              //rel_state->rf_err_vz = Matrix::dot(vd_deriv_err, vd_inter_uav_z);
+              rel_state->rf_err_vx = Math::dot(vd_deriv_err, vd_inter_uav_x);
+              rel_state->rf_err_vy = Math::dot(vd_deriv_err, vd_inter_uav_y);
+              //rel_state->rf_err_vz = Math::dot(vd_deriv_err, vd_inter_uav_z);
               //! Deviation from convergence (sliding surface) - Inter-vehicle reference frame
-              rel_state->ss_x = Matrix::dot(vd_surf_uav.get(0, 1, ind_uav2+1, ind_uav2+1), vd_inter_uav_x);
-              rel_state->ss_y = Matrix::dot(vd_surf_uav.get(0, 1, ind_uav2+1, ind_uav2+1), vd_inter_uav_y);
-              //rel_state->ss_z = Matrix::dot(vd_surf_uav.get(0, 1, ind_uav2+1, ind_uav2+1), vd_inter_uav_z);
+              rel_state->ss_x = Math::dot(segment<2>(vd_surf_uav, 0, ind_uav2+1), vd_inter_uav_x);
+              rel_state->ss_y = Math::dot(segment<2>(vd_surf_uav, 0, ind_uav2+1), vd_inter_uav_y);
+              //rel_state->ss_z = Math::dot(segment<2>(vd_surf_uav, 0, ind_uav2+1), vd_inter_uav_z);
               //! Inter-vehicle virtual error - Ground reference frame
               rel_state->virt_err_x = vt_virt_err_uav(0, ind_uav2+1);
               rel_state->virt_err_y = vt_virt_err_uav(1, ind_uav2+1);
@@ -2959,8 +3004,8 @@ namespace Maneuver
           vd_weight_gain(ind_uav_lead) = 1;
 
           //! Computing relative state, from current UAV to leader
-          vd_inter_uav_state = md_uav_state.get(0, 5, ind_uav_lead, ind_uav_lead) -
-              md_uav_state.get(0, 5, ind_uav+1, ind_uav+1);
+          vd_inter_uav_state = segment<6>(md_uav_state, 0, ind_uav_lead) -
+              segment<6>(md_uav_state, 0, ind_uav+1);
 
           /*
           // Debug
@@ -2976,8 +3021,8 @@ namespace Maneuver
           {
             //! Earth reference frame
             //! - Position
-            vd_inter_uav_des_pos = m_formation_pos.get(0, 1, ind_uav, ind_uav);
-            vd_err = -vd_inter_uav_state.get(0, 1, 0, 0) - vd_inter_uav_des_pos;
+            vd_inter_uav_des_pos = segment<2>(m_formation_pos, 0, ind_uav);
+            vd_err = -segment<2>(vd_inter_uav_state, 0) - vd_inter_uav_des_pos;
             //! - Velocity
             //     vd_inter_uav_des_vel = [0; 0];
             vd_inter_uav_des_vel(0) = -vd_err(1) * d_form_turnrate;
@@ -2991,13 +3036,13 @@ namespace Maneuver
             //! Path reference frame
             //! Position
             vd_inter_uav_des_pos = md_rot_formation * vd_form_pos1;
-            vd_err = -vd_inter_uav_state.get(0, 1, 0, 0) - vd_inter_uav_des_pos;
+            vd_err = -segment<2>(vd_inter_uav_state, 0) - vd_inter_uav_des_pos;
             //! - Velocity
             vd_inter_uav_des_vel(0) = vd_inter_uav_state(1) * d_form_turnrate;
             vd_inter_uav_des_vel(1) = -vd_inter_uav_state(0) * d_form_turnrate;
             // vd_inter_uav_des_vel = md_rot_formation * vd_form_vel1;
             //! - Acceleration
-            vd_inter_uav_des_acc = vd_inter_uav_state.get(0, 1, 0, 0) * d_form_turnrate*d_form_turnrate;
+            vd_inter_uav_des_acc = segment<2>(vd_inter_uav_state, 0) * d_form_turnrate*d_form_turnrate;
             // vd_inter_uav_des_acc = md_rot_formation * vd_form_acc1;
           }
 
@@ -3006,7 +3051,7 @@ namespace Maneuver
           d_err_y = vd_err(1);
 
           //! Relative position error vector
-          vd_deriv_err = -vd_inter_uav_state.get(3, 4, 0, 0) - vd_inter_uav_des_vel;
+          vd_deriv_err = -segment<2>(vd_inter_uav_state, 3) - vd_inter_uav_des_vel;
           d_deriv_err_x = vd_deriv_err(0);
           d_deriv_err_y = vd_deriv_err(1);
 
@@ -3055,13 +3100,13 @@ namespace Maneuver
           //! ======= Sliding surface ==============
 
           //! Sliding surface deviation
-          vd_surf_uav.set(0, 1, ind_uav_lead, ind_uav_lead, vd_deriv_err);
+          setSegment(vd_surf_uav, 0, ind_uav_lead, vd_deriv_err);
           vd_surf_uav(0, ind_uav_lead) -= d_c1 * d_err_x/(d_err_x - d_c2);
           vd_surf_uav(1, ind_uav_lead) -= d_c3 * d_err_y/(d_err_y - d_c4);
 
           //! ======= Virtual error and feedback linearization ================
-          vt_virt_err_uav.set(0, 1, ind_uav_lead, ind_uav_lead,
-                              vd_inter_uav_des_acc + md_vehicle_accel.get(0, 1, ind_uav_lead, ind_uav_lead));
+          setSegment(vt_virt_err_uav, 0, ind_uav_lead,
+                     vd_inter_uav_des_acc + segment<2>(md_vehicle_accel, 0, ind_uav_lead));
           vt_virt_err_uav(0, ind_uav_lead) -= d_c1 * d_c2 * d_deriv_err_x/((d_err_x - d_c2)*(d_err_x - d_c2));
           vt_virt_err_uav(1, ind_uav_lead) -= d_c3 * d_c4 * d_deriv_err_y/((d_err_y - d_c4)*(d_err_y - d_c4));
 
@@ -3106,7 +3151,7 @@ namespace Maneuver
           //! Tracking output
           if (b_debug)
           {
-            vd_inter_uav_pos = vd_inter_uav_state.get(0, 1, 0, 0);
+            vd_inter_uav_pos = segment<2>(vd_inter_uav_state, 0);
             d_inter_uav_dist = vd_inter_uav_pos.norm_2();
             //! Computing the rotation matrix - From inter-UAV frame to ground frame
             d_inter_uav_angle = std::atan2(vd_inter_uav_pos(1),
@@ -3117,9 +3162,11 @@ namespace Maneuver
             mt_rot[1] = -d_sin_inter_uav_angle;
             mt_rot[2] = d_sin_inter_uav_angle;
             mt_rot[3] = d_cos_inter_uav_angle;
-            md_rot = Matrix(mt_rot, 2, 2);
-            vd_inter_uav_x = md_rot.column(0);
-            vd_inter_uav_y = md_rot.column(1);
+            md_rot = Matrix2(mt_rot);
+            vd_inter_uav_x(0) = md_rot(0, 0);
+            vd_inter_uav_x(1) = md_rot(1, 0);
+            vd_inter_uav_y(0) = md_rot(0, 1);
+            vd_inter_uav_y(1) = md_rot(1, 1);
 
             rel_state = form_monitor->rel_state[ind_uav_lead];
             //! Vehicle identifier;
@@ -3142,17 +3189,17 @@ namespace Maneuver
             rel_state->err_y = vd_err(1);
             //rel_state->err_z = vd_err(2);
             //! Relative position error - Inter-vehicle reference frame
-            rel_state->rf_err_x = Matrix::dot(vd_err ,vd_inter_uav_x);
-            rel_state->rf_err_y = Matrix::dot(vd_err, vd_inter_uav_y);
-            //rel_state->rf_err_z = Matrix::dot(vd_err, vd_inter_uav_z);
+            rel_state->rf_err_x = Math::dot(vd_err ,vd_inter_uav_x);
+            rel_state->rf_err_y = Math::dot(vd_err, vd_inter_uav_y);
+            //rel_state->rf_err_z = Math::dot(vd_err, vd_inter_uav_z);
             //! Relative velocity error - Inter-vehicle reference frame
-            rel_state->rf_err_vx = Matrix::dot(vd_deriv_err, vd_inter_uav_x);
-            rel_state->rf_err_vy = Matrix::dot(vd_deriv_err, vd_inter_uav_y);
-            //rel_state->rf_err_vz = Matrix::dot(vd_deriv_err, vd_inter_uav_z);
+            rel_state->rf_err_vx = Math::dot(vd_deriv_err, vd_inter_uav_x);
+            rel_state->rf_err_vy = Math::dot(vd_deriv_err, vd_inter_uav_y);
+            //rel_state->rf_err_vz = Math::dot(vd_deriv_err, vd_inter_uav_z);
             //! Deviation from convergence (sliding surface) - Inter-vehicle reference frame
-            rel_state->ss_x = Matrix::dot(vd_surf_uav.get(0, 1, ind_uav_lead, ind_uav_lead), vd_inter_uav_x);
-            rel_state->ss_y = Matrix::dot(vd_surf_uav.get(0, 1, ind_uav_lead, ind_uav_lead), vd_inter_uav_y);
-            //rel_state->ss_z = Matrix::dot(vd_surf_uav.get(0, 1, ind_uav_lead, ind_uav_lead), vd_inter_uav_z);
+            rel_state->ss_x = Math::dot(segment<2>(vd_surf_uav, 0, ind_uav_lead), vd_inter_uav_x);
+            rel_state->ss_y = Math::dot(segment<2>(vd_surf_uav, 0, ind_uav_lead), vd_inter_uav_y);
+            //rel_state->ss_z = Math::dot(segment<2>(vd_surf_uav, 0, ind_uav_lead), vd_inter_uav_z);
             //! Inter-vehicle virtual error - Ground reference frame
             rel_state->virt_err_x = vt_virt_err_uav(0, ind_uav_lead);
             rel_state->virt_err_y = vt_virt_err_uav(1, ind_uav_lead);
@@ -3183,8 +3230,8 @@ namespace Maneuver
           }
 
           //! Sliding surface data mixing
-          Matrix vd_surf = vd_surf_uav * vd_ctrl_weight;
-          Matrix vt_virt_err = vt_virt_err_uav * vd_ctrl_weight;
+          Vector2 vd_surf(vd_surf_uav * vd_ctrl_weight);
+          Vector2 vt_virt_err(vt_virt_err_uav * vd_ctrl_weight);
 
           /*
           // Debug
@@ -3193,13 +3240,13 @@ namespace Maneuver
            */
 
           double d_surf_norm = vd_surf.norm_2();
-          Matrix vd_surf_unit = vd_surf/d_surf_norm;
+          Vector2 vd_surf_unit = vd_surf/d_surf_norm;
 
           //!-------------------------------------------
           //! Sliding surface convergence term
           //!-------------------------------------------
 
-          Matrix vd_sat_surf = Matrix(2, 1);
+          Vector2 vd_sat_surf;
           if (d_ss_bnd_layer < d_surf_norm)
           {
             vd_sat_surf = vd_surf_unit;
@@ -3213,7 +3260,7 @@ namespace Maneuver
           }
           else
             vd_sat_surf = vd_surf/d_ss_bnd_layer;
-          Matrix vd_surf_conv = transpose(md_rot_ground2yaw)*md_gain_mtx*md_rot_ground2yaw * vd_sat_surf;
+          Vector2 vd_surf_conv = transposeMultiply(md_rot_ground2yaw, md_gain_mtx*md_rot_ground2yaw) * vd_sat_surf;
 
           //!-------------------------------------------
           //! Sliding surface unknown disturbance term
@@ -3224,7 +3271,7 @@ namespace Maneuver
           // vd_surf_unkn1 = ((m_uav_n-1)/(m_uav_n-1+k_form_ref)+1)*...
           //     m_flow_accel_max*vd_surf_unit;
 
-          vd_surf_unit = Matrix(2, 1);
+          vd_surf_unit.fill(0.0);
 
           //! UAVs Uncertainty compensation
           double t_SurfSqr;
@@ -3237,15 +3284,15 @@ namespace Maneuver
             t_SurfSqr = vd_surf_uav(0, ind_uav2+1)*vd_surf_uav(0, ind_uav2+1) +
                 vd_surf_uav(1, ind_uav2+1)*vd_surf_uav(1, ind_uav2+1);
             if (t_SurfSqr > 0)
-              vd_surf_unit += 2*vd_surf_uav.get(0, 1, ind_uav2+1, ind_uav2+1)*
+              vd_surf_unit += 2*segment<2>(vd_surf_uav, 0, ind_uav2+1)*
                   vd_ctrl_weight(ind_uav2+1)/std::sqrt(t_SurfSqr);
           }
           //! Leader - Uncertainty compensation
           t_SurfSqr = vd_surf_uav(0, 0)*vd_surf_uav(0, 0) + vd_surf_uav(1, 0)*vd_surf_uav(1, 0);
           if (t_SurfSqr)
-            vd_surf_unit += k_form_ref*vd_surf_uav.get(0, 1, 0, 0)*vd_ctrl_weight(0)/std::sqrt(t_SurfSqr);
+            vd_surf_unit += k_form_ref*segment<2>(vd_surf_uav, 0, 0)*vd_ctrl_weight(0)/std::sqrt(t_SurfSqr);
           //! Formation - Uncertainty compensation
-          Matrix vd_surf_unkn = vd_surf_unit*m_flow_accel_max/(m_uav_n-1+k_form_ref);
+          Vector2 vd_surf_unkn = vd_surf_unit*m_flow_accel_max/(m_uav_n-1+k_form_ref);
           /*
         if (ind_uav == 0)
         {
@@ -3261,8 +3308,8 @@ namespace Maneuver
           // Control vector
           // vd_accel = (vt_virt_err - vd_surf_conv - vd_surf_unkn)/...
           //     (m_uav_n-1+k_form_ref);
-          Matrix vd_accel = vt_virt_err - vd_surf_conv - vd_surf_unkn;
-          Matrix vd_ctrl = md_rot_ground2yaw*vd_accel;
+          Vector2 vd_accel = vt_virt_err - vd_surf_conv - vd_surf_unkn;
+          Vector2 vd_ctrl = md_rot_ground2yaw*vd_accel;
           if (Math::isNaN(vd_accel(0)) || Math::isNaN(vd_accel(1)))
           {
             war("-------------------------------------------------------");
@@ -166,7 +166,7 @@ namespace Monitors
 
         m_ctx.config.get("General", "Absolute Maximum Depth", "50.0", m_max_depth);
 
-        bind<IMC::EstimatedState>(this);
+        bindLatest<IMC::EstimatedState>(this);
         bind<IMC::GetOperationalLimits>(this);
         bind<IMC::OperationalLimits>(this);
       }
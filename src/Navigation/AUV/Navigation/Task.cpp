@@ -68,6 +68,9 @@ namespace Navigation
         NUM_STATE = 9
       };
 
+      //! State transition matrix.
+      typedef Math::FixedMatrix<NUM_STATE, NUM_STATE> StateMatrix;
+
       //! Navigation Output states.
       enum OutputIndexes
       {
@@ -565,23 +568,31 @@ namespace Navigation
 
           // Kalman Filter
           // Reset and Discretize A matrix
-          Matrix a(NUM_STATE, NUM_STATE, 0.0);
+          StateMatrix a;
           setTransition(a);
 
-          Matrix x(NUM_STATE, 1, 0.0);
-          x = m_kal.getState();
-
-          m_kal.setStateTransition((a * tstep).expmts());
+          StateMatrix ax = expmts(a * tstep);
+          m_kal.setStateTransition(ax);
 
           // Modify covariance state transition matrix.
           double yaw = m_kal.getState(STATE_PSI);
+          double speed_u = m_kal.getState(STATE_U);
+          double speed_v = m_kal.getState(STATE_V);
+
+          // The covariance model adds the position sensitivity to heading
+          // (E). Since A * A, A * E and E * E are all zero, the exponential
+          // series stops early: exp((A + E) t) = exp(A t) + E t + E A t^2 / 2.
+          double ex = (- speed_u * std::sin(yaw) - speed_v * std::cos(yaw));
+          double ey = (speed_u * std::cos(yaw) - speed_v * std::sin(yaw));
+          double half_tstep2 = 0.5 * tstep * tstep;
 
-          a(STATE_X, STATE_PSI) = (- x(STATE_U) * std::sin(yaw)
-                                   - x(STATE_V) * std::cos(yaw));
-          a(STATE_Y, STATE_PSI) = (x(STATE_U) * std::cos(yaw)
-                                   - x(STATE_V) * std::sin(yaw));
+          StateMatrix ap(ax);
+          ap(STATE_X, STATE_PSI) += ex * tstep;
+          ap(STATE_Y, STATE_PSI) += ey * tstep;
+          ap(STATE_X, STATE_R) += ex * a(STATE_PSI, STATE_R) * half_tstep2;
+          ap(STATE_Y, STATE_R) += ey * a(STATE_PSI, STATE_R) * half_tstep2;
 
-          m_kal.setCovarianceTransition((a * tstep).expmts());
+          m_kal.setCovarianceTransition(ap);
 
           // Kalman Prediction.
           m_kal.predict();
@@ -764,7 +775,7 @@ namespace Navigation
 
         // Reinitialize Extended Kalman Filter transition matrix function.
         void
-        setTransition(Matrix& A)
+        setTransition(StateMatrix& A)
         {
           A.fill(0.0);
 
@@ -36,15 +36,18 @@
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
-// Local headers.
-#include "EstimatedStateList.hpp"
-
 namespace Sensors
 {
   namespace Edgetech2205
   {
     using DUNE_NAMESPACES;
 
+    //! Number of estimated states kept per subsystem.
+    static const unsigned c_estate_history = 1024;
+    //! Largest time between a ping and the states used to
+    //! georeference it (s).
+    static const double c_estate_max_gap = 2.0;
+
     //! Subsystem specific data used to rewrite the header of each ping.
     struct SubsystemData
     {
@@ -84,12 +87,13 @@ namespace Sensors
       int32_t altitude;
       //! Depth.
       int32_t depth;
-      //! Estimated state list.
-      EstimatedStateList estates;
+      //! Recent estimated states.
+      Navigation::StateHistory estates;
       //! True if subsystem is active.
       bool active;
 
-      SubsystemData(void)
+      SubsystemData(void):
+        estates(c_estate_history, c_estate_max_gap)
       {
         clear();
       }
@@ -469,7 +469,7 @@ namespace Sensors
         for (size_t i = 0; i < c_subsys_count; ++i)
         {
           if (m_subsys_data[i].active)
-            m_subsys_data[i].estates.push_back(*msg);
+            m_subsys_data[i].estates.push(*msg);
         }
       }
 
@@ -703,9 +703,16 @@ namespace Sensors
                                  + data->time_bdt.seconds) * 1000;
         data->time_msec_today += ss_time % 1000;
 
-        // Find closest estimated state.
-        int64_t estate_delta = 0;
-        const IMC::EstimatedState* estate = data->estates.find(ss_time, estate_delta);
+        // Interpolate the estimated state at ping time, falling back
+        // to the closest state.
+        double ss_time_sec = ss_time / 1000.0;
+        double estate_delta_sec = 0;
+        IMC::EstimatedState estate;
+        bool estate_valid = data->estates.interpolate(ss_time_sec, estate);
+        if (!estate_valid)
+          estate_valid = data->estates.nearest(ss_time_sec, estate, estate_delta_sec);
+
+        int64_t estate_delta = static_cast<int64_t>(estate_delta_sec * 1000);
 
         // Trace.
         int msec_delta = 0;
@@ -724,46 +731,46 @@ namespace Sensors
                                       estate_delta,
                                       data->msec_cpu - msec_cpu_old,
                                       msec_delta,
-                                      (estate == NULL) ? 0 : 1,
+                                      estate_valid ? 1 : 0,
                                       m_cmd->getEstimatedTimeDelta()));
-        if (estate == NULL)
+        if (!estate_valid)
           return;
 
         // Position.
-        Coordinates::toWGS84(*estate, data->latitude_rad, data->longitude_rad);
+        Coordinates::toWGS84(estate, data->latitude_rad, data->longitude_rad);
         data->latitude = static_cast<int32_t>(data->latitude_rad * 34377467.707849);
         data->longitude = static_cast<int32_t>(data->longitude_rad * 34377467.707849);
         data->validity |= (1 << 0);
 
         // Course.
-        data->course = Angles::degrees(std::atan2(estate->vy, estate->vx));
+        data->course = Angles::degrees(std::atan2(estate.vy, estate.vx));
         data->validity |= (1 << 1);
 
         // Speed.
-        data->speed = Math::norm(estate->vx, estate->vy) * DUNE::Units::c_ms_to_knot * 10;
+        data->speed = Math::norm(estate.vx, estate.vy) * DUNE::Units::c_ms_to_knot * 10;
         data->validity |= (1 << 2);
 
         // Heading.
-        double heading = Angles::degrees(estate->psi);
+        double heading = Angles::degrees(estate.psi);
         if (heading < 0)
           heading = 360.0 + heading;
         data->heading = heading * 100;
         data->validity |= (1 << 3);
 
         // Roll.
-        data->roll = (Angles::degrees(estate->phi) * 32768) / 180;
+        data->roll = (Angles::degrees(estate.phi) * 32768) / 180;
         data->validity |= (1 << 4);
 
         // Pitch.
-        data->pitch = (Angles::degrees(estate->theta) * 32768) / 180;
+        data->pitch = (Angles::degrees(estate.theta) * 32768) / 180;
         data->validity |= (1 << 5);
 
         // Altitude.
-        data->altitude = estate->alt * 1000;
+        data->altitude = estate.alt * 1000;
         data->validity |= (1 << 6);
 
         // Depth.
-        data->depth = estate->depth * 1000;
+        data->depth = estate.depth * 1000;
         data->validity |= (1 << 9);
       }
 
@@ -29,13 +29,12 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <cstdio>
 #include <iomanip>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
-
-// Local headers.
-#include "QuadTree.hpp"
+#include <DUNE/Simulation/Terrain.hpp>
 
 namespace Simulators
 {
@@ -49,9 +48,6 @@ namespace Simulators
     using std::sin;
     using std::cos;
 
-    //! Number of points in the forward direction for bottom intersection
-    static const unsigned c_forward_points = 10;
-
     class PencilBeam
     {
     public:
@@ -143,6 +139,8 @@ namespace Simulators
       double oob_depth;
       //! Interpolation radius.
       double interp_radius;
+      //! Terrain grid spacing.
+      double cell_size;
       // Forward distance arguments
       //! Standard deviation of the forward distance estimates
       double fd_std_dev;
@@ -195,8 +193,8 @@ namespace Simulators
       double m_a_n, m_a_e, m_b_n, m_b_e;
       //! PRNG handle.
       Random::Generator* m_prng;
-      //! The tree.
-      QuadTree* m_qtree;
+      //! Gridded bathymetry.
+      Simulation::Terrain* m_terrain;
       //! Reference latitude and longitude for data points.
       double m_ref_lat, m_ref_lon;
       //! NE offsets in regard to navigational reference.
@@ -209,7 +207,7 @@ namespace Simulators
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Periodic(name, ctx),
         m_prng(NULL),
-        m_qtree(NULL),
+        m_terrain(NULL),
         m_pb(NULL)
       {
         param("Simulate - Bottom Distance", m_args.simulate_bd)
@@ -250,6 +248,13 @@ namespace Simulators
         .units(Units::Meter)
         .defaultValue("10.0");
 
+        param("Terrain Cell Size", m_args.cell_size)
+        .units(Units::Meter)
+        .defaultValue("0.0")
+        .minimumValue("0.0")
+        .description("Spacing of the bathymetry grid built from scattered data,"
+                     " zero to derive it from the data density");
+
         param("Simulate Pier", m_args.simulate_pier)
         .defaultValue("false")
         .description("Simulate a pier using configured WGS84 locations");
@@ -354,7 +359,7 @@ namespace Simulators
       onResourceRelease(void)
       {
         Memory::clear(m_prng);
-        Memory::clear(m_qtree);
+        Memory::clear(m_terrain);
         Memory::clear(m_pb);
       }
 
@@ -397,54 +402,116 @@ namespace Simulators
         debug("pier point B lat: %0.6f, lon: %0.6f", m_args.pier[2], m_args.pier[3]);
       }
 
+      //! Load the bathymetry. A binary terrain file is mapped if it
+      //! exists, is not older than the INI file and was built with
+      //! the current parameters, otherwise the scattered data of the
+      //! INI file is gridded and cached next to it.
       void
-      onResourceInitialization(void)
+      loadTerrain(void)
       {
         Utils::String::toLowerCase(m_args.location);
-        Path path = m_ctx.dir_cfg / "simulation" / ("bathymetry-" + m_args.location + ".ini");
-        DUNE::Parsers::Config cfg(path.c_str());
+        Path base = m_ctx.dir_cfg / "simulation" / ("bathymetry-" + m_args.location);
+        Path bin = base + ".dtr";
+        Path ini = base + ".ini";
+
+        m_terrain = new Simulation::Terrain;
+
+        bool cached = bin.isFile() && (!ini.isFile() || bin.getLastModifiedTime() >= ini.getLastModifiedTime());
+        if (!cached || !loadCachedTerrain(bin, ini.isFile()))
+          buildTerrain(ini, bin);
+
+        debug("%s | %0.6f, %0.6f", m_args.location.c_str(),
+              Angles::degrees(m_ref_lat), Angles::degrees(m_ref_lon));
+        trace("grid: %u x %u, %0.2f m", m_terrain->getRows(),
+              m_terrain->getColumns(), m_terrain->getCellSize());
+      }
+
+      //! Map a binary terrain file.
+      //! @param[in] bin terrain file.
+      //! @param[in] rebuildable true if the terrain can be rebuilt
+      //! from the INI file.
+      //! @return true if the file was loaded, false if the terrain
+      //! must be rebuilt.
+      bool
+      loadCachedTerrain(const Path& bin, bool rebuildable)
+      {
+        try
+        {
+          m_terrain->load(bin.str());
+        }
+        catch (std::exception& e)
+        {
+          if (!rebuildable)
+            throw;
+
+          war(DTR("discarding terrain cache: %s"), e.what());
+          return false;
+        }
+
+        if (m_terrain->getRequestedCellSize() != m_args.cell_size
+            || m_terrain->getInterpolationRadius() != m_args.interp_radius)
+        {
+          if (rebuildable)
+          {
+            debug("%s | %s built with other parameters", m_args.location.c_str(), bin.c_str());
+            return false;
+          }
+
+          war(DTR("terrain cache built with other parameters, no data to rebuild it"));
+        }
+
+        m_ref_lat = m_terrain->getReferenceLatitude();
+        m_ref_lon = m_terrain->getReferenceLongitude();
+        debug("%s | %s (%s)", m_args.location.c_str(), bin.c_str(),
+              m_terrain->isMapped() ? "mapped" : "loaded");
+        return true;
+      }
+
+      //! Grid the scattered data of the INI file and cache the
+      //! result.
+      //! @param[in] ini bathymetry INI file.
+      //! @param[in] bin terrain file.
+      void
+      buildTerrain(const Path& ini, const Path& bin)
+      {
+        DUNE::Parsers::Config cfg(ini.c_str());
         std::vector<std::string> lines;
         cfg.get("Bathymetry", "Data", "", lines);
         cfg.get("Bathymetry", "Latitude (degrees)", "", m_ref_lat);
         cfg.get("Bathymetry", "Longitude (degrees)", "", m_ref_lon);
 
-        debug("%s | %0.6f, %0.6f", m_args.location.c_str(), m_ref_lat, m_ref_lon);
-        debug("%s | %s", m_args.location.c_str(), path.c_str());
+        debug("%s | %s", m_args.location.c_str(), ini.c_str());
         debug("%s | %lu %s", m_args.location.c_str(), (long unsigned int)lines.size(), "bathymetry values");
 
         m_ref_lat = Angles::radians(m_ref_lat);
         m_ref_lon = Angles::radians(m_ref_lon);
 
-        std::vector<QuadTree::Item> data;
-        QuadTree::Item item;
-        Bounds* bounds = 0;
-
+        std::vector<Simulation::Terrain::Sample> samples(lines.size());
         for (unsigned i = 0; i < lines.size(); ++i)
         {
-          std::vector<double> v;
-          DUNE::Utils::String::split(lines[i], " ", v);
-          if (!bounds)
-            bounds = new Bounds(Point(v[0], v[1]));
-          else
-            bounds->cover(Point(v[0], v[1]));
-          item.x = v[0]; item.y = v[1]; item.value = v[2];
-          data.push_back(item);
+          if (std::sscanf(lines[i].c_str(), "%lf %lf %lf", &samples[i].x,
+                          &samples[i].y, &samples[i].depth) != 3)
+            throw std::runtime_error(String::str(DTR("invalid bathymetry line: %s"), lines[i].c_str()));
         }
 
-        std::stringstream ss;
-        ss << *bounds;
-        trace("bounds: %s", ss.str().c_str());
-
-        // Fill the tree
-        m_qtree = new QuadTree(*bounds);
-        delete bounds;
+        m_terrain->build(samples, m_args.cell_size, m_args.interp_radius);
+        m_terrain->setReference(m_ref_lat, m_ref_lon);
 
-        for (unsigned i = 0; i < data.size(); ++i)
-          m_qtree->insert(data[i]);
+        try
+        {
+          m_terrain->save(bin.str());
+          debug("%s | cached in %s", m_args.location.c_str(), bin.c_str());
+        }
+        catch (std::exception& e)
+        {
+          debug("%s | not cached: %s", m_args.location.c_str(), e.what());
+        }
+      }
 
-        ss.clear();
-        ss << *m_qtree;
-        trace("tree elements: %s", ss.str().c_str());
+      void
+      onResourceInitialization(void)
+      {
+        loadTerrain();
 
         m_bd.beam_config.clear();
         m_bd.location.clear();
@@ -561,35 +628,13 @@ namespace Simulators
       double
       depthAt(double x, double y)
       {
-        Point p(x, y);
-        Bounds search_area(p, m_args.interp_radius);
-
-        std::vector<QuadTree::Item> items;
-
-        m_qtree->search(search_area, items);
-
-        if (items.size() == 0)
+        double depth;
+        if (!m_terrain->depthAt(x, y, depth))
         {
           trace("out of bounds");
           return m_args.oob_depth;
         }
 
-        trace("found %lu close data values", (long unsigned int)items.size());
-
-        // @todo interpolate rather than picking closest one
-        double dmin = p.distance(Point(items[0].x, items[0].y));
-        double depth = items[0].value;
-
-        for (unsigned int i = 1; i < items.size(); ++i)
-        {
-          double d = p.distance(Point(items[i].x, items[i].y));
-          if (d < dmin)
-          {
-            dmin = d;
-            depth = items[i].value;
-          }
-        }
-
         return depth + m_args.tide;
       }
 
@@ -699,57 +744,23 @@ namespace Simulators
         return range;
       }
 
-      //! Compute the depths of c_forward_points in front of the vehicle
-      //! Use connections between these points as line segments
-      //! and intersect them with lower beam part of the echo sounder.
+      //! Cast the lower edge of the forward beam against the bottom.
       //! @return range after intersection
       double
       bottomIntersection(void)
       {
-        double intersect_range = m_args.max_range;
-
-        double x_step = m_args.max_range / (double)c_forward_points;
-
-        std::vector<float> fwd_depths(c_forward_points);
-
-        fwd_depths[0] = depthAt(m_sstate.x + m_off_n, m_sstate.y + m_off_e);
-
-        // x and z coordinates of the end of the forward beam
-        double x_target, z_target;
-
-        x_target = m_args.max_range * cos(m_sstate.theta - m_args.forward_width / 2.0);
-        z_target = - m_args.max_range * sin(m_sstate.theta - m_args.forward_width / 2.0);
-        z_target += m_sstate.z; // SHOULD NOT BE Z BUT DEPTH
-
-        for (unsigned i = 1; i < c_forward_points; i++)
-        {
-          double xe = (double)i * x_step * cos(m_sstate.psi);
-          double ye = (double)i * x_step * sin(m_sstate.psi);
-
-          fwd_depths[i] = depthAt(m_sstate.x + m_off_n + xe, m_sstate.y + m_off_e + ye);
-
-          double bottom_x_1 = (double)(i - 1) * x_step;
-          double bottom_z_1 = fwd_depths[i - 1];
-
-          double bottom_x_2 = (double)i * x_step;
-          double bottom_z_2 = fwd_depths[i];
-
-          double x, z;
-
-          bool test_int = lineSegmentIntersect(LineSegParam<double>(0.0, m_sstate.z,
-                                                                    x_target, z_target,
-                                                                    bottom_x_1, bottom_z_1,
-                                                                    bottom_x_2, bottom_z_2),
-                                               &x, &z); // SHOULD NOT BE STATE.Z BUT DEPTH
-
-          if (test_int)
-          {
-            intersect_range = Math::norm(x, z - m_sstate.z); // SHOULD NOT BE Z BUT DEPTH
-            break;
-          }
-        }
-
-        return intersect_range;
+        double pitch = m_sstate.theta - m_args.forward_width / 2.0;
+        double range;
+
+        // Terrain depths do not include the tide.
+        if (m_terrain->rayCast(m_sstate.x + m_off_n, m_sstate.y + m_off_e,
+                               m_sstate.z - m_args.tide,
+                               cos(pitch) * cos(m_sstate.psi),
+                               cos(pitch) * sin(m_sstate.psi),
+                               -sin(pitch), m_args.max_range, range))
+          return range;
+
+        return m_args.max_range;
       }
     };
   }
@@ -24,48 +24,58 @@
 // https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
 // http://ec.europa.eu/idabc/eupl.html.                                     *
 //***************************************************************************
-// Author: Ricardo Martins                                                  *
+// Author: Pedro Seruca                                                     *
 //***************************************************************************
 
-#ifndef SENSORS_EDGETECH_2205_ESTIMATED_STATE_ENTRY_HPP_INCLUDED_
-#define SENSORS_EDGETECH_2205_ESTIMATED_STATE_ENTRY_HPP_INCLUDED_
+#ifndef SRC_TRANSPORTS_DATASTORE_DATASAMPLE_HPP_
+#define SRC_TRANSPORTS_DATASTORE_DATASAMPLE_HPP_
+
+#define MINIMUM_SAMPLE_SIZE 15
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
-namespace Sensors
+namespace Transports
 {
-  namespace Edgetech2205
+  namespace DataStore
   {
     using DUNE_NAMESPACES;
 
-    class EstimatedStateEntry
+    //! Class used to store a single sample.
+    //! All samples have a location, timestamp, priority and a message (IMC).
+    class DataSample
     {
     public:
-      EstimatedStateEntry(const IMC::EstimatedState& state):
-        m_state(state)
+      //! Sample global coordinates
+      double latDegs, lonDegs, zMeters, timestamp;
+
+      //! Priority of the sample (higher priority samples are transmitted first)
+      int priority;
+
+      //! The system that generated this sample
+      int source;
+
+      //! Actual data gathered at these coords
+      IMC::Message* sample;
+
+      DataSample(void)
       {
-        m_time = state.getTimeStamp();
-        int millisecond = (state.getTimeStamp() - m_time) * 1000;
-        m_time *= 1000;
-        m_time += millisecond;
+        latDegs = lonDegs = zMeters = timestamp = 0;
+        priority = source = -1;
+        sample = NULL;
       }
 
-      const IMC::EstimatedState*
-      getEstimatedState(void) const
+      ~DataSample(void)
       {
-        return &m_state;
+        if (sample != NULL)
+          delete sample;
       }
 
-      int64_t
-      getTime(void) const
+      int
+      serializationSize(void)
       {
-        return m_time;
+        return sample->getPayloadSerializationSize() + MINIMUM_SAMPLE_SIZE;
       }
-
-    private:
-      IMC::EstimatedState m_state;
-      int64_t m_time;
     };
   }
 }
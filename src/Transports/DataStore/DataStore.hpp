@@ -29,7 +29,6 @@
 #define SRC_TRANSPORTS_DATASTORE_DATASTORE_HPP_
 
 #define BASE_HISTORY_SIZE 36
-#define MINIMUM_SAMPLE_SIZE 15
 
 // ISO C++ 98 headers.
 #include <string>
@@ -37,58 +36,16 @@
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
+// Local headers.
+#include "DataSample.hpp"
+#include "Storage.hpp"
+
 namespace Transports
 {
   namespace DataStore
   {
     using DUNE_NAMESPACES;
 
-    //! Class used to store a single sample.
-    //! All samples have a location, timestamp, priority and a message (IMC).
-    class DataSample
-    {
-    public:
-      //! Sample global coordinates
-      double latDegs, lonDegs, zMeters, timestamp;
-
-      //! Priority of the sample (higher priority samples are transmitted first)
-      int priority;
-
-      //! The system that generated this sample
-      int source;
-
-      //! Actual data gathered at these coords
-      IMC::Message* sample;
-
-      DataSample(void)
-      {
-        latDegs = lonDegs = zMeters = timestamp = 0;
-        priority = source = -1;
-        sample = NULL;
-      }
-
-      ~DataSample(void)
-      {
-        if (sample != NULL)
-          delete sample;
-      }
-
-      int
-      serializationSize(void)
-      {
-        return sample->getPayloadSerializationSize() + MINIMUM_SAMPLE_SIZE;
-      }
-    };
-
-    class CompareSamples
-    {
-    public:
-      bool operator()(const DataSample* p1, const DataSample* p2) const
-      {
-        return p1->priority <= p2->priority && p1->timestamp < p2->timestamp;
-      }
-    };
-
     //! Translate a (global coordinates) Data Sample into an IMC HistoricSample message
     HistoricSample*
     parse(DataSample* sample, double base_lat, double base_lon, long base_time)
@@ -140,6 +97,7 @@ namespace Transports
           s->source = (sample)->sys_id;
           s->timestamp = data->base_time + (sample)->t;
           s->zMeters = (sample)->z / 10.0;
+          s->priority = (sample)->priority;
           s->sample = (sample)->sample.get()->clone();
           samples.push_back(s);
         }
@@ -154,23 +112,36 @@ namespace Transports
         m_task(task)
     { }
 
-      ~DataStore(void)
+      //! Open the persistent storage, recovering samples and commands
+      //! stored by previous runs.
+      //! @param[in] folder storage folder.
+      //! @param[in] max_size maximum amount of stored data, in bytes.
+      void
+      open(const Path& folder, uint64_t max_size)
       {
-        Concurrency::ScopedRWLock(m_lock, true);
-        while (!m_samples.empty())
-        {
-          delete m_samples.top();
-          m_samples.pop();
-        }
+        Concurrency::ScopedRWLock l(m_lock, true);
+        m_storage.open(folder, max_size);
+        m_task->debug("Recovered %u samples and %u commands from %s.",
+                      (unsigned)m_storage.getSampleCount(),
+                      (unsigned)m_storage.getCommandCount(), folder.c_str());
       }
 
-      //! Add sample to this store
+      //! Retrieve the number of stored samples.
+      size_t
+      getSampleCount(void)
+      {
+        Concurrency::ScopedRWLock l(m_lock, false);
+        return m_storage.getSampleCount();
+      }
+
+      //! Add sample to this store (the sample is consumed)
       void
       addSample(DataSample* sample)
       {
-        Concurrency::ScopedRWLock(m_lock, true);
+        Concurrency::ScopedRWLock l(m_lock, true);
         m_task->debug("Adding sample %d/%f", sample->sample->getId(), sample->timestamp);
-        m_samples.push(sample);
+        m_storage.addSample(sample);
+        delete sample;
       }
 
       //! Add a series of historic samples packed as an HistoricData message
@@ -193,11 +164,9 @@ namespace Transports
           if (Clock::getSinceEpoch() > timeout)
           {
             m_task->debug("Dropping expired remote command.");
-            continue;
           }
-
           // if message's destination is this system, dispatch it locally
-          if (dst == m_task->getSystemId())
+          else if (dst == m_task->getSystemId())
           {
             Message * msg = (*cmd)->cmd.get();
             msg->setDestination(dst);
@@ -211,8 +180,11 @@ namespace Transports
           else
           {
             m_task->debug("Adding (multi-hop) remote command.");
-            m_commands.push_back(*cmd);
+            Concurrency::ScopedRWLock l(m_lock, true);
+            m_storage.addCommand(*cmd);
           }
+
+          delete *cmd;
         }
       }
 
@@ -221,30 +193,24 @@ namespace Transports
       pollCommands(int destination, int size)
       {
         size -= BASE_HISTORY_SIZE; // base fields from HistoricData
-        IMC::HistoricData* ret = new IMC::HistoricData();
 
-        // add commands for that destination
-        std::vector<RemoteCommand*>::iterator cmd_it;
-
-        cmd_it = m_commands.begin();
-        while(cmd_it != m_commands.end()) {
-          if ((*cmd_it)->destination == destination) {
-            int ser_size = (*cmd_it)->getSerializationSize();
-            if (ser_size < size)
-            {
-              size -= ser_size;
-              ret->data.push_back(*cmd_it);
-              cmd_it = m_commands.erase(cmd_it);
-              continue;
-            }
-          }
-          cmd_it++;
+        std::vector<RemoteCommand*> commands;
+        {
+          Concurrency::ScopedRWLock l(m_lock, true);
+          m_storage.pollCommands(destination, size, commands);
         }
 
-        if (ret->data.size() == 0)
+        if (commands.empty())
           return NULL;
-        else
-          return ret;
+
+        IMC::HistoricData* ret = new IMC::HistoricData();
+        for (size_t i = 0; i < commands.size(); ++i)
+        {
+          ret->data.push_back(commands[i]);
+          delete commands[i];
+        }
+
+        return ret;
       }
 
       //! Retrieve a series of sample that take up to 'size'
@@ -252,50 +218,29 @@ namespace Transports
       pollSamples(int size)
       {
         size -= BASE_HISTORY_SIZE; // base fields from HistoricData
-        IMC::HistoricData* ret = new IMC::HistoricData();
-
-        std::vector<DataSample*> added, rejected;
-
-        Concurrency::ScopedRWLock(m_lock, true);
-        while (!m_samples.empty() && size > MINIMUM_SAMPLE_SIZE)
-        {
-          // pop next sample
-          DataSample* sample = m_samples.top();
-          m_samples.pop();
-
-          // check if there is space left for this sample
-          int sample_size = sample->serializationSize();
-          if (sample_size > size)
-          {
-            rejected.push_back(sample);
-          }
-          else
-          {
-            size -= sample_size;
-            added.push_back(sample);
-          }
-        }
 
-        // add back samples that didn't fit on the message
-        std::vector<DataSample *>::iterator it;
-        for (it = rejected.begin(); it != rejected.end(); it++)
+        std::vector<DataSample*> added;
         {
-          m_samples.push(*it);
+          Concurrency::ScopedRWLock l(m_lock, true);
+          m_storage.pollSamples(size, added);
         }
 
         // no data can be added
         if (added.empty())
           return NULL;
 
+        IMC::HistoricData* ret = new IMC::HistoricData();
         ret->base_lat = added.at(0)->latDegs;
         ret->base_lon = added.at(0)->lonDegs;
         ret->base_time = added.at(0)->timestamp;
 
+        std::vector<DataSample *>::iterator it;
         for (it = added.begin(); it != added.end(); it++)
         {
           DataSample * sample = *it;
-          ret->data.push_back(
-              parse(sample, ret->base_lat, ret->base_lon, ret->base_time));
+          HistoricSample* s = parse(sample, ret->base_lat, ret->base_lon, ret->base_time);
+          ret->data.push_back(s);
+          delete s;
           delete sample;
         }
 
@@ -303,8 +248,8 @@ namespace Transports
       }
 
     private:
-      std::priority_queue<DataSample *, std::vector<DataSample *> , CompareSamples> m_samples;
-      std::vector<RemoteCommand* > m_commands;
+      //! Persistent storage of samples and commands.
+      Storage m_storage;
       Concurrency::RWLock m_lock;
       Task* m_task;
     };
@@ -0,0 +1,862 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef SRC_TRANSPORTS_DATASTORE_STORAGE_HPP_
+#define SRC_TRANSPORTS_DATASTORE_STORAGE_HPP_
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "DataSample.hpp"
+
+namespace Transports
+{
+  namespace DataStore
+  {
+    using DUNE_NAMESPACES;
+
+    //! Segment file magic.
+    static const char c_segment_magic[] = "DSL1";
+    //! Segment file extension.
+    static const char c_segment_ext[] = ".dsl";
+    //! Size after which a new segment is started.
+    static const uint32_t c_segment_size = 1024 * 1024;
+    //! Maximum number of consecutive samples that don't fit a poll
+    //! before giving up on filling it.
+    static const unsigned c_max_rejections = 256;
+
+    //! Disk-backed storage of samples and remote commands.
+    //!
+    //! Items are appended to a log split in fixed size segments and
+    //! never modified: removing an item appends a tombstone. Only a
+    //! small index entry per item (location on disk, priority,
+    //! timestamp and size) is kept in memory; payloads are read back
+    //! when polled. On startup the segments are replayed to rebuild the
+    //! index, and a truncated tail (e.g. power loss) is ignored.
+    //!
+    //! Each segment remembers which older segments hold records it
+    //! cancels (with tombstones or newer copies), and is only removed
+    //! once those are gone, so a discarded tombstone can never bring a
+    //! record back on replay. Segments are visited oldest first: one
+    //! with little live data has its records moved to the current
+    //! segment and is removed, one that is mostly live is kept without
+    //! holding back the reclamation of newer segments. When the live
+    //! data exceeds the configured budget the lowest priority, oldest
+    //! samples are dropped.
+    class Storage
+    {
+    public:
+      Storage(void):
+        m_max_size(0),
+        m_segment_limit(c_segment_size),
+        m_live_bytes(0),
+        m_next_seq(0),
+        m_segment(0),
+        m_segment_size(0)
+      { }
+
+      ~Storage(void)
+      {
+        close();
+      }
+
+      //! Open (and replay) the storage located in a folder.
+      //! @param[in] folder storage folder (created if needed).
+      //! @param[in] max_size maximum amount of live data, in bytes.
+      //! @param[in] segment_limit size after which a new segment is
+      //! started, in bytes.
+      void
+      open(const Path& folder, uint64_t max_size, uint32_t segment_limit = c_segment_size)
+      {
+        close();
+
+        m_folder = folder;
+        m_max_size = max_size;
+        m_segment_limit = segment_limit;
+        m_folder.create();
+
+        std::vector<uint32_t> segments;
+        listSegments(segments);
+        for (size_t i = 0; i < segments.size(); ++i)
+          replay(segments[i]);
+
+        startSegment(segments.empty() ? 0 : segments.back() + 1);
+        enforceLimit();
+        compact();
+      }
+
+      //! Close the storage.
+      void
+      close(void)
+      {
+        if (m_ofs.is_open())
+          m_ofs.close();
+
+        m_samples.clear();
+        m_commands.clear();
+        m_index.clear();
+        m_segments.clear();
+        m_live_bytes = 0;
+      }
+
+      //! Test if the storage is open.
+      //! @return true if open, false otherwise.
+      bool
+      isOpen(void) const
+      {
+        return m_ofs.is_open();
+      }
+
+      //! Retrieve the number of stored samples.
+      //! @return number of samples.
+      size_t
+      getSampleCount(void) const
+      {
+        return m_samples.size();
+      }
+
+      //! Retrieve the number of stored commands.
+      //! @return number of commands.
+      size_t
+      getCommandCount(void) const
+      {
+        return m_commands.size();
+      }
+
+      //! Retrieve the amount of live data on disk.
+      //! @return number of bytes.
+      uint64_t
+      getLiveBytes(void) const
+      {
+        return m_live_bytes;
+      }
+
+      //! Store a sample.
+      //! @param[in] sample sample (not consumed).
+      void
+      addSample(DataSample* sample)
+      {
+        Utils::ByteBuffer bfr;
+        uint64_t seq = m_next_seq++;
+        put(bfr, seq);
+        put(bfr, sample->latDegs);
+        put(bfr, sample->lonDegs);
+        put(bfr, sample->zMeters);
+        put(bfr, sample->timestamp);
+        put(bfr, (int32_t)sample->priority);
+        put(bfr, (uint16_t)sample->source);
+        putMessage(bfr, sample->sample);
+
+        Entry e;
+        e.seq = seq;
+        e.priority = sample->priority;
+        e.timestamp = sample->timestamp;
+        e.size = sample->serializationSize();
+        e.destination = 0;
+        e.timeout = 0;
+        append(RT_SAMPLE, bfr, e);
+        m_ofs.flush();
+
+        insertSample(e);
+        enforceLimit();
+      }
+
+      //! Store a remote command.
+      //! @param[in] cmd command (not consumed).
+      void
+      addCommand(const IMC::RemoteCommand* cmd)
+      {
+        Utils::ByteBuffer bfr;
+        uint64_t seq = m_next_seq++;
+        put(bfr, seq);
+        putMessage(bfr, cmd);
+
+        Entry e;
+        e.seq = seq;
+        e.priority = 0;
+        e.timestamp = cmd->getTimeStamp();
+        e.size = cmd->getSerializationSize();
+        e.destination = cmd->destination;
+        e.timeout = cmd->timeout;
+        append(RT_COMMAND, bfr, e);
+        m_ofs.flush();
+
+        insertCommand(e);
+      }
+
+      //! Remove and retrieve the samples, by priority, that fit in a
+      //! given number of bytes.
+      //! @param[in] size available bytes.
+      //! @param[out] samples retrieved samples (caller owns them).
+      void
+      pollSamples(int size, std::vector<DataSample*>& samples)
+      {
+        std::vector<uint64_t> chosen;
+        unsigned rejections = 0;
+
+        std::set<Key>::const_iterator itr = m_index.begin();
+        for (; itr != m_index.end() && size > MINIMUM_SAMPLE_SIZE; ++itr)
+        {
+          const Entry& e = m_samples[itr->seq];
+          if ((int)e.size > size)
+          {
+            if (++rejections >= c_max_rejections)
+              break;
+            continue;
+          }
+
+          rejections = 0;
+          size -= e.size;
+          chosen.push_back(e.seq);
+        }
+
+        Utils::ByteBuffer bfr;
+        for (size_t i = 0; i < chosen.size(); ++i)
+        {
+          Entry e = m_samples[chosen[i]];
+
+          DataSample* sample = new DataSample();
+          if (read(e, bfr) && decodeSample(bfr, sample))
+            samples.push_back(sample);
+          else
+            delete sample;
+
+          removeSample(e);
+        }
+
+        m_ofs.flush();
+        compact();
+      }
+
+      //! Remove and retrieve the commands for a given destination that
+      //! fit in a given number of bytes. Expired commands are dropped.
+      //! @param[in] destination destination system.
+      //! @param[in] size available bytes.
+      //! @param[out] commands retrieved commands (caller owns them).
+      void
+      pollCommands(int destination, int size, std::vector<IMC::RemoteCommand*>& commands)
+      {
+        double now = Clock::getSinceEpoch();
+        std::vector<Entry> chosen;
+        std::vector<Entry> expired;
+
+        std::map<uint64_t, Entry>::const_iterator itr = m_commands.begin();
+        for (; itr != m_commands.end(); ++itr)
+        {
+          const Entry& e = itr->second;
+          if (e.timeout < now)
+          {
+            expired.push_back(e);
+            continue;
+          }
+
+          if (e.destination != destination || (int)e.size >= size)
+            continue;
+
+          size -= e.size;
+          chosen.push_back(e);
+        }
+
+        for (size_t i = 0; i < expired.size(); ++i)
+          removeCommand(expired[i]);
+
+        Utils::ByteBuffer bfr;
+        for (size_t i = 0; i < chosen.size(); ++i)
+        {
+          IMC::Message* msg = NULL;
+          if (read(chosen[i], bfr))
+            msg = decodeMessage(bfr, sizeof(uint64_t));
+
+          if (msg != NULL && msg->getId() == IMC::RemoteCommand::getIdStatic())
+            commands.push_back(static_cast<IMC::RemoteCommand*>(msg));
+          else
+            delete msg;
+
+          removeCommand(chosen[i]);
+        }
+
+        m_ofs.flush();
+        compact();
+      }
+
+    private:
+      //! Record types.
+      enum RecordType
+      {
+        RT_SAMPLE = 1,
+        RT_COMMAND = 2,
+        RT_TOMBSTONE = 3
+      };
+
+      //! In-memory index entry.
+      struct Entry
+      {
+        //! Sequence number.
+        uint64_t seq;
+        //! Segment holding the record.
+        uint32_t segment;
+        //! Offset of the record in the segment.
+        uint32_t offset;
+        //! Length of the record on disk.
+        uint32_t length;
+        //! Priority (samples).
+        int priority;
+        //! Timestamp.
+        double timestamp;
+        //! Serialization size when transmitted.
+        uint32_t size;
+        //! Destination (commands).
+        int destination;
+        //! Expiration time (commands).
+        double timeout;
+      };
+
+      //! Priority index key: higher priority first, then newer first.
+      struct Key
+      {
+        int priority;
+        double timestamp;
+        uint64_t seq;
+
+        bool
+        operator<(const Key& other) const
+        {
+          if (priority != other.priority)
+            return priority > other.priority;
+          if (timestamp != other.timestamp)
+            return timestamp > other.timestamp;
+          return seq > other.seq;
+        }
+      };
+
+      //! Segment bookkeeping.
+      struct Segment
+      {
+        //! Bytes written.
+        uint64_t bytes;
+        //! Bytes of live records.
+        uint64_t live_bytes;
+        //! Number of live records.
+        unsigned live;
+        //! Older segments holding records cancelled by this one.
+        std::set<uint32_t> targets;
+
+        Segment(void):
+          bytes(0),
+          live_bytes(0),
+          live(0)
+        { }
+      };
+
+      //! Storage folder.
+      Path m_folder;
+      //! Maximum amount of live data.
+      uint64_t m_max_size;
+      //! Size after which a new segment is started.
+      uint32_t m_segment_limit;
+      //! Amount of live data.
+      uint64_t m_live_bytes;
+      //! Next sequence number.
+      uint64_t m_next_seq;
+      //! Current segment.
+      uint32_t m_segment;
+      //! Size of the current segment.
+      uint32_t m_segment_size;
+      //! Current segment file.
+      std::ofstream m_ofs;
+      //! Samples by sequence number.
+      std::map<uint64_t, Entry> m_samples;
+      //! Commands by sequence number.
+      std::map<uint64_t, Entry> m_commands;
+      //! Samples by priority.
+      std::set<Key> m_index;
+      //! Segments by number.
+      std::map<uint32_t, Segment> m_segments;
+
+      //! Append a scalar in host byte order.
+      template <typename T>
+      static void
+      put(Utils::ByteBuffer& bfr, const T& value)
+      {
+        bfr.append((const uint8_t*)&value, sizeof(T));
+      }
+
+      //! Read a scalar in host byte order.
+      template <typename T>
+      static bool
+      get(Utils::ByteBuffer& bfr, size_t& offset, T& value)
+      {
+        if (offset + sizeof(T) > bfr.getSize())
+          return false;
+
+        std::memcpy(&value, bfr.getBuffer() + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+      }
+
+      //! Append a serialized IMC message.
+      static void
+      putMessage(Utils::ByteBuffer& bfr, const IMC::Message* msg)
+      {
+        Utils::ByteBuffer pkt;
+        IMC::Packet::serialize(msg, pkt);
+        bfr.append(pkt.getBuffer(), pkt.getSize());
+      }
+
+      //! Deserialize an IMC message.
+      //! @return message or NULL if the data is corrupted.
+      static IMC::Message*
+      decodeMessage(Utils::ByteBuffer& bfr, size_t offset)
+      {
+        if (offset >= bfr.getSize())
+          return NULL;
+
+        try
+        {
+          return IMC::Packet::deserialize(bfr.getBuffer() + offset,
+                                          bfr.getSize() - offset);
+        }
+        catch (std::exception&)
+        {
+          return NULL;
+        }
+      }
+
+      //! Decode a sample record body.
+      //! @return true if successful, false otherwise.
+      static bool
+      decodeSample(Utils::ByteBuffer& bfr, DataSample* sample)
+      {
+        size_t offset = 0;
+        uint64_t seq = 0;
+        int32_t priority = 0;
+        uint16_t source = 0;
+
+        if (!get(bfr, offset, seq) || !get(bfr, offset, sample->latDegs)
+            || !get(bfr, offset, sample->lonDegs) || !get(bfr, offset, sample->zMeters)
+            || !get(bfr, offset, sample->timestamp) || !get(bfr, offset, priority)
+            || !get(bfr, offset, source))
+          return false;
+
+        sample->priority = priority;
+        sample->source = source;
+        sample->sample = decodeMessage(bfr, offset);
+        return sample->sample != NULL;
+      }
+
+      //! Path of a segment file.
+      Path
+      getSegmentPath(uint32_t segment) const
+      {
+        return m_folder / Utils::String::str("%08u%s", segment, c_segment_ext);
+      }
+
+      //! List existing segments, in ascending order.
+      void
+      listSegments(std::vector<uint32_t>& segments)
+      {
+        FileSystem::Directory dir(m_folder);
+        const char* name = NULL;
+        while ((name = dir.readEntry()) != NULL)
+        {
+          unsigned number = 0;
+          char ext[8] = {0};
+          if (std::sscanf(name, "%8u%7s", &number, ext) == 2
+              && std::strcmp(ext, c_segment_ext) == 0)
+            segments.push_back(number);
+        }
+
+        std::sort(segments.begin(), segments.end());
+      }
+
+      //! Start a new segment.
+      void
+      startSegment(uint32_t segment)
+      {
+        if (m_ofs.is_open())
+          m_ofs.close();
+
+        Path path = getSegmentPath(segment);
+        m_ofs.open(path.c_str(), std::ios::binary | std::ios::trunc);
+        if (!m_ofs.is_open())
+          throw std::runtime_error(Utils::String::str(DTR("unable to create %s"), path.c_str()));
+
+        m_ofs.write(c_segment_magic, 4);
+        m_ofs.flush();
+        m_segment = segment;
+        m_segment_size = 4;
+        m_segments[segment].bytes = 4;
+      }
+
+      //! Append a record to the current segment.
+      //! @param[in] type record type.
+      //! @param[in] body record body.
+      //! @param[out] e entry updated with the record location.
+      void
+      append(uint8_t type, Utils::ByteBuffer& body, Entry& e)
+      {
+        if (m_segment_size >= m_segment_limit)
+          startSegment(m_segment + 1);
+
+        uint32_t length = body.getSize() + 1;
+        m_ofs.write((const char*)&length, sizeof(length));
+        m_ofs.write((const char*)&type, sizeof(type));
+        m_ofs.write(body.getBufferSigned(), body.getSize());
+        if (!m_ofs.good())
+          throw std::runtime_error(DTR("unable to write to data store"));
+
+        e.segment = m_segment;
+        e.offset = m_segment_size;
+        e.length = length + sizeof(length);
+        m_segment_size += e.length;
+        m_segments[m_segment].bytes += e.length;
+      }
+
+      //! Append a tombstone.
+      //! @param[in] dead entry being cancelled.
+      void
+      appendTombstone(const Entry& dead)
+      {
+        Utils::ByteBuffer bfr;
+        put(bfr, dead.seq);
+
+        Entry e;
+        append(RT_TOMBSTONE, bfr, e);
+        addTarget(e.segment, dead.segment);
+      }
+
+      //! Record that a segment cancels records of another one.
+      void
+      addTarget(uint32_t segment, uint32_t target)
+      {
+        if (target != segment)
+          m_segments[segment].targets.insert(target);
+      }
+
+      //! Test if a segment still cancels records that are on disk.
+      //! @return true if the segment must be kept, false otherwise.
+      bool
+      hasTargets(const Segment& seg) const
+      {
+        std::set<uint32_t>::const_iterator itr = seg.targets.begin();
+        for (; itr != seg.targets.end(); ++itr)
+        {
+          if (m_segments.find(*itr) != m_segments.end())
+            return true;
+        }
+
+        return false;
+      }
+
+      //! Read the body of a record.
+      //! @return true if successful, false otherwise.
+      bool
+      read(const Entry& e, Utils::ByteBuffer& bfr)
+      {
+        if (e.segment == m_segment)
+          m_ofs.flush();
+
+        std::ifstream ifs(getSegmentPath(e.segment).c_str(), std::ios::binary);
+        ifs.seekg(e.offset + sizeof(uint32_t) + 1);
+
+        bfr.setSize(e.length - sizeof(uint32_t) - 1);
+        ifs.read(bfr.getBufferSigned(), bfr.getSize());
+        return ifs.gcount() == (std::streamsize)bfr.getSize();
+      }
+
+      //! Rebuild the index from a segment.
+      void
+      replay(uint32_t segment)
+      {
+        std::ifstream ifs(getSegmentPath(segment).c_str(), std::ios::binary);
+        char magic[4];
+        ifs.read(magic, sizeof(magic));
+        if (ifs.gcount() != sizeof(magic) || std::memcmp(magic, c_segment_magic, 4) != 0)
+          return;
+
+        Segment& seg = m_segments[segment];
+        seg.bytes = 4;
+
+        Utils::ByteBuffer bfr;
+        while (true)
+        {
+          uint32_t length = 0;
+          uint8_t type = 0;
+          ifs.read((char*)&length, sizeof(length));
+          if (ifs.gcount() != sizeof(length) || length < 1 + sizeof(uint64_t))
+            break;
+
+          ifs.read((char*)&type, sizeof(type));
+          bfr.setSize(length - 1);
+          ifs.read(bfr.getBufferSigned(), bfr.getSize());
+          if (ifs.gcount() != (std::streamsize)bfr.getSize())
+            break;
+
+          Entry e;
+          e.segment = segment;
+          e.offset = seg.bytes;
+          e.length = length + sizeof(length);
+          seg.bytes += e.length;
+
+          size_t offset = 0;
+          get(bfr, offset, e.seq);
+          if (e.seq >= m_next_seq)
+            m_next_seq = e.seq + 1;
+
+          if (type == RT_TOMBSTONE)
+          {
+            std::map<uint64_t, Entry>::iterator itr = m_samples.find(e.seq);
+            if (itr != m_samples.end())
+            {
+              Entry dead = itr->second;
+              addTarget(segment, dead.segment);
+              eraseSample(dead);
+            }
+
+            itr = m_commands.find(e.seq);
+            if (itr != m_commands.end())
+            {
+              Entry dead = itr->second;
+              addTarget(segment, dead.segment);
+              eraseCommand(dead);
+            }
+          }
+          else if (type == RT_SAMPLE)
+          {
+            DataSample sample;
+            if (!decodeSample(bfr, &sample))
+              break;
+
+            e.priority = sample.priority;
+            e.timestamp = sample.timestamp;
+            e.size = sample.serializationSize();
+            e.destination = 0;
+            e.timeout = 0;
+            insertSample(e);
+          }
+          else if (type == RT_COMMAND)
+          {
+            IMC::Message* msg = decodeMessage(bfr, offset);
+            if (msg == NULL || msg->getId() != IMC::RemoteCommand::getIdStatic())
+            {
+              delete msg;
+              break;
+            }
+
+            IMC::RemoteCommand* cmd = static_cast<IMC::RemoteCommand*>(msg);
+            e.priority = 0;
+            e.timestamp = cmd->getTimeStamp();
+            e.size = cmd->getSerializationSize();
+            e.destination = cmd->destination;
+            e.timeout = cmd->timeout;
+            insertCommand(e);
+            delete cmd;
+          }
+          else
+          {
+            break;
+          }
+        }
+      }
+
+      //! Index a sample.
+      void
+      insertSample(const Entry& e)
+      {
+        // A record copied by an interrupted compaction.
+        std::map<uint64_t, Entry>::iterator itr = m_samples.find(e.seq);
+        if (itr != m_samples.end())
+        {
+          Entry old = itr->second;
+          addTarget(e.segment, old.segment);
+          eraseSample(old);
+        }
+
+        m_samples[e.seq] = e;
+
+        Key k = {e.priority, e.timestamp, e.seq};
+        m_index.insert(k);
+        account(e, true);
+      }
+
+      //! Index a command.
+      void
+      insertCommand(const Entry& e)
+      {
+        std::map<uint64_t, Entry>::iterator itr = m_commands.find(e.seq);
+        if (itr != m_commands.end())
+        {
+          Entry old = itr->second;
+          addTarget(e.segment, old.segment);
+          eraseCommand(old);
+        }
+
+        m_commands[e.seq] = e;
+        account(e, true);
+      }
+
+      //! Drop a sample from the index.
+      void
+      eraseSample(const Entry& e)
+      {
+        Key k = {e.priority, e.timestamp, e.seq};
+        m_index.erase(k);
+        m_samples.erase(e.seq);
+        account(e, false);
+      }
+
+      //! Drop a command from the index.
+      void
+      eraseCommand(const Entry& e)
+      {
+        m_commands.erase(e.seq);
+        account(e, false);
+      }
+
+      //! Remove a sample (index and disk).
+      void
+      removeSample(const Entry& e)
+      {
+        appendTombstone(e);
+        eraseSample(e);
+      }
+
+      //! Remove a command (index and disk).
+      void
+      removeCommand(const Entry& e)
+      {
+        appendTombstone(e);
+        eraseCommand(e);
+      }
+
+      //! Update live data bookkeeping.
+      void
+      account(const Entry& e, bool live)
+      {
+        Segment& seg = m_segments[e.segment];
+        if (live)
+        {
+          ++seg.live;
+          seg.live_bytes += e.length;
+          m_live_bytes += e.length;
+        }
+        else
+        {
+          --seg.live;
+          seg.live_bytes -= e.length;
+          m_live_bytes -= e.length;
+        }
+      }
+
+      //! Drop the lowest priority, oldest samples while over budget.
+      void
+      enforceLimit(void)
+      {
+        if (m_max_size == 0)
+          return;
+
+        if (m_live_bytes <= m_max_size)
+          return;
+
+        while (m_live_bytes > m_max_size && !m_index.empty())
+        {
+          Entry e = m_samples[(--m_index.end())->seq];
+          removeSample(e);
+        }
+
+        m_ofs.flush();
+        compact();
+      }
+
+      //! Move the live records of a segment to the current one.
+      void
+      relocate(uint32_t segment, std::map<uint64_t, Entry>& entries, uint8_t type)
+      {
+        Utils::ByteBuffer bfr;
+        std::map<uint64_t, Entry>::iterator itr = entries.begin();
+        for (; itr != entries.end(); ++itr)
+        {
+          Entry& e = itr->second;
+          if (e.segment != segment)
+            continue;
+
+          if (!read(e, bfr))
+            throw std::runtime_error(DTR("unable to read from data store"));
+
+          account(e, false);
+          append(type, bfr, e);
+          account(e, true);
+        }
+      }
+
+      //! Reclaim old segments.
+      void
+      compact(void)
+      {
+        std::map<uint32_t, Segment>::iterator itr = m_segments.begin();
+        while (itr != m_segments.end() && itr->first < m_segment)
+        {
+          uint32_t segment = itr->first;
+          const Segment& seg = itr->second;
+
+          // Keep the segment if most of it is still in use, or if its
+          // tombstones are needed to cancel records still on disk.
+          if ((seg.live > 0 && seg.live_bytes * 2 > seg.bytes) || hasTargets(seg))
+          {
+            ++itr;
+            continue;
+          }
+
+          if (seg.live > 0)
+          {
+            relocate(segment, m_samples, RT_SAMPLE);
+            relocate(segment, m_commands, RT_COMMAND);
+            m_ofs.flush();
+          }
+
+          getSegmentPath(segment).remove();
+          m_segments.erase(itr++);
+        }
+      }
+    };
+  }
+}
+
+#endif
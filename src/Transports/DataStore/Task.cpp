@@ -68,6 +68,9 @@ namespace Transports
       //! Variable priorities will result in older
       //! data being sent through low bandwidth connections
       bool variable_priorities;
+
+      //! Maximum amount of stored data, in MiB.
+      unsigned max_storage;
     };
 
     struct Task: public DUNE::Tasks::Task
@@ -149,6 +152,12 @@ namespace Transports
         .description("Apply variable priorities to local samples")
         .defaultValue("true");
 
+        param("Maximum Storage Size", m_args.max_storage)
+        .units(Units::Mebibyte)
+        .defaultValue("64")
+        .description("Maximum amount of data kept on disk. When exceeded the "
+                     "lowest priority, oldest samples are discarded");
+
         m_wifi_forward_timer.setTop(m_args.wifi_forward_period);
         m_acoustic_forward_timer.setTop(m_args.acoustic_forward_period);
         m_any_forward_timer.setTop(m_args.any_forward_period);
@@ -201,6 +210,12 @@ namespace Transports
         m_iridium_upload_timer.setTop(m_args.iridium_upload_period);
       }
 
+      void
+      onResourceAcquisition(void)
+      {
+        m_store.open(m_ctx.dir_db / "DataStore", (uint64_t)m_args.max_storage * 1024 * 1024);
+      }
+
       void
       onResourceInitialization(void)
       {
@@ -409,6 +424,8 @@ namespace Transports
         inf("forwarding to gateway over any mean");
 
         IMC::HistoricData* data = m_store.pollSamples(1000);
+        if (data == NULL)
+          return;
 
         uint16_t newId = m_router.createInternalId();
 
@@ -417,7 +434,9 @@ namespace Transports
         tr.setSourceEntity(getEntityId());
         tr.setDestination(getSystemId());
 
-        tr.comm_mean         = IMC::TransmissionRequest::CMEAN_ANY;
+        // This IMC version has no "any" mean: the satellite link is the
+        // one that reaches the gateway regardless of range.
+        tr.comm_mean         = IMC::TransmissionRequest::CMEAN_SATELLITE;
         tr.data_mode         = IMC::TransmissionRequest::DMODE_INLINEMSG;
         tr.destination       = m_args.any_gateway;
         tr.req_id            = newId;
@@ -436,6 +455,8 @@ namespace Transports
         inf("forwarding to gateway over acoustic");
 
         IMC::HistoricData* data = m_store.pollSamples(1000);
+        if (data == NULL)
+          return;
         if (!m_router.routeOverAcoustic(m_args.acoustic_gateway, data))
         {
           war("not possible to forward data through %s acoustically at this time.", m_args.acoustic_gateway.c_str());
@@ -0,0 +1,295 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <sstream>
+#include <iomanip>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "EventStream.hpp"
+
+namespace Transports
+{
+  namespace HTTP
+  {
+    using DUNE_NAMESPACES;
+
+    //! Interval between keep-alive comments (s).
+    static const double c_keepalive = 15.0;
+    //! Time after which a client that does not accept data is dropped (s).
+    static const double c_client_timeout = 30.0;
+
+    EventStream::EventStream(double rate, double max_rate, unsigned max_clients):
+      m_rate(rate),
+      m_max_rate(max_rate),
+      m_max_clients(max_clients),
+      m_client_count(0),
+      m_version(1)
+    {
+      if (m_max_rate <= 0)
+        m_max_rate = 1.0;
+
+      if (m_rate <= 0 || m_rate > m_max_rate)
+        m_rate = m_max_rate;
+    }
+
+    EventStream::~EventStream(void)
+    {
+      for (unsigned i = 0; i < m_clients.size(); ++i)
+      {
+        delete m_clients[i]->sock;
+        delete m_clients[i];
+      }
+
+      for (unsigned i = 0; i < m_new_clients.size(); ++i)
+      {
+        delete m_new_clients[i]->sock;
+        delete m_new_clients[i];
+      }
+
+      for (EntryMap::iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr)
+        delete itr->second.msg;
+    }
+
+    void
+    EventStream::setEntities(const std::map<unsigned, std::string>& entities)
+    {
+      std::ostringstream os;
+      os << "event: entities\ndata: {";
+
+      std::map<unsigned, std::string>::const_iterator itr = entities.begin();
+      for (; itr != entities.end(); ++itr)
+      {
+        if (itr != entities.begin())
+          os << ',';
+
+        os << '"' << itr->first << "\":\"";
+        for (unsigned i = 0; i < itr->second.size(); ++i)
+        {
+          char c = itr->second[i];
+          if (c == '"' || c == '\\')
+            os << '\\';
+          os << c;
+        }
+        os << '"';
+      }
+
+      os << "}\n\n";
+
+      ScopedMutex l(m_lock);
+      m_entities = os.str();
+    }
+
+    void
+    EventStream::updateMessage(const IMC::Message* msg)
+    {
+      Key key(msg->getId() << 24 | msg->getSubId() << 8 | msg->getSourceEntity(), "");
+      if (msg->getId() == DUNE_IMC_POWERCHANNELSTATE)
+        key.second = static_cast<const IMC::PowerChannelState*>(msg)->name;
+
+      IMC::Message* tmsg = msg->clone();
+
+      ScopedMutex l(m_lock);
+
+      Entry& entry = m_entries[key];
+      delete entry.msg;
+      entry.msg = tmsg;
+      entry.version = ++m_version;
+      entry.json.clear();
+    }
+
+    bool
+    EventStream::addClient(TCPSocket* sock, double rate, const std::string& header)
+    {
+      ScopedMutex l(m_lock);
+
+      if (m_client_count >= m_max_clients)
+        return false;
+
+      if (rate <= 0)
+        rate = m_rate;
+      else if (rate > m_max_rate)
+        rate = m_max_rate;
+
+      Client* client = new Client;
+      client->sock = sock;
+      client->period = 1.0 / rate;
+      client->next = 0;
+      client->last = Clock::get();
+      client->version = 0;
+      client->data = header;
+      client->offset = 0;
+
+      m_new_clients.push_back(client);
+      ++m_client_count;
+      return true;
+    }
+
+    void
+    EventStream::buildFrame(uint64_t since, std::string& frame)
+    {
+      std::ostringstream os;
+      os << "id: " << m_version << "\ndata: {\"time\":"
+         << std::fixed << std::setprecision(3) << Clock::getSinceEpoch()
+         << ",\"messages\":[";
+
+      std::string json;
+      bool empty = true;
+      for (EntryMap::iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr)
+      {
+        Entry& entry = itr->second;
+        if (entry.version <= since)
+          continue;
+
+        if (entry.json.empty())
+        {
+          m_writer.clear();
+          entry.msg->toJSON(m_writer);
+          entry.json.assign(m_writer.data(), m_writer.size());
+        }
+
+        if (!empty)
+          os << ',';
+        os << entry.json;
+        empty = false;
+      }
+
+      os << "]}\n\n";
+
+      // New clients always get a frame, even if there are no messages.
+      if (empty && since != 0)
+      {
+        frame.clear();
+        return;
+      }
+
+      frame = (since == 0) ? m_entities + os.str() : os.str();
+    }
+
+    bool
+    EventStream::flush(Client* client, double now)
+    {
+      if (client->offset >= client->data.size())
+        return true;
+
+      const uint8_t* bfr = reinterpret_cast<const uint8_t*>(client->data.data()) + client->offset;
+      size_t size = client->data.size() - client->offset;
+
+      try
+      {
+        size_t rv = client->sock->writeNonBlocking(&bfr, &size, 1);
+        if (rv > 0)
+          client->last = now;
+        client->offset += rv;
+      }
+      catch (...)
+      {
+        return false;
+      }
+
+      if (client->offset >= client->data.size())
+      {
+        client->data.clear();
+        client->offset = 0;
+        return true;
+      }
+
+      return (now - client->last) < c_client_timeout;
+    }
+
+    void
+    EventStream::run(void)
+    {
+      double tick = 1.0 / m_max_rate;
+
+      while (!isStopping())
+      {
+        Delay::wait(tick);
+
+        double now = Clock::get();
+
+        {
+          ScopedMutex l(m_lock);
+
+          m_clients.insert(m_clients.end(), m_new_clients.begin(), m_new_clients.end());
+          m_new_clients.clear();
+
+          // Clients that still have data to write are skipped, their
+          // next frame will carry all changes in the meantime.
+          m_frames.clear();
+          for (unsigned i = 0; i < m_clients.size(); ++i)
+          {
+            Client* client = m_clients[i];
+            if (!client->data.empty() || now < client->next)
+              continue;
+
+            client->next = now + client->period;
+
+            FrameMap::iterator itr = m_frames.find(client->version);
+            if (itr == m_frames.end())
+            {
+              itr = m_frames.insert(std::make_pair(client->version, std::string())).first;
+              buildFrame(client->version, itr->second);
+            }
+
+            if (!itr->second.empty())
+            {
+              client->data = itr->second;
+              client->version = m_version;
+            }
+            else if ((now - client->last) >= c_keepalive)
+            {
+              client->data = ":\n\n";
+            }
+          }
+        }
+
+        std::vector<Client*>::iterator itr = m_clients.begin();
+        while (itr != m_clients.end())
+        {
+          if (flush(*itr, now))
+          {
+            ++itr;
+            continue;
+          }
+
+          delete (*itr)->sock;
+          delete *itr;
+          itr = m_clients.erase(itr);
+
+          ScopedMutex l(m_lock);
+          --m_client_count;
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,173 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef TRANSPORTS_HTTP_EVENT_STREAM_HPP_INCLUDED_
+#define TRANSPORTS_HTTP_EVENT_STREAM_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <map>
+#include <string>
+#include <vector>
+#include <utility>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Transports
+{
+  namespace HTTP
+  {
+    //! Push based feed of the latest messages, using Server-Sent
+    //! Events. Each client receives, at its own rate, only the
+    //! messages that changed since its previous update. Messages are
+    //! serialized once, no matter how many clients are connected.
+    class EventStream: public DUNE::Concurrency::Thread
+    {
+    public:
+      //! Constructor.
+      //! @param[in] rate default update rate of clients (Hz).
+      //! @param[in] max_rate maximum update rate of clients (Hz).
+      //! @param[in] max_clients maximum number of clients.
+      EventStream(double rate, double max_rate, unsigned max_clients);
+
+      //! Destructor.
+      ~EventStream(void);
+
+      //! Set the entity labels sent to new clients.
+      //! @param[in] entities map of entity identifiers to labels.
+      void
+      setEntities(const std::map<unsigned, std::string>& entities);
+
+      //! Update the latest value of a message.
+      //! @param[in] msg message.
+      void
+      updateMessage(const DUNE::IMC::Message* msg);
+
+      //! Add a client.
+      //! @param[in] sock client socket, owned by the stream if the
+      //! client is accepted.
+      //! @param[in] rate requested update rate (Hz), zero to use the
+      //! default rate.
+      //! @param[in] header response header, written before any event.
+      //! @return true if the client was accepted, false if the
+      //! maximum number of clients was reached.
+      bool
+      addClient(DUNE::Network::TCPSocket* sock, double rate, const std::string& header);
+
+    private:
+      //! Latest value of a message.
+      struct Entry
+      {
+        Entry(void):
+          msg(NULL),
+          version(0)
+        { }
+
+        //! Message.
+        DUNE::IMC::Message* msg;
+        //! Version of the stream when the message was updated.
+        uint64_t version;
+        //! JSON representation, empty if not serialized yet.
+        std::string json;
+      };
+
+      //! Stream client.
+      struct Client
+      {
+        //! Socket.
+        DUNE::Network::TCPSocket* sock;
+        //! Update period (s).
+        double period;
+        //! Time of the next update.
+        double next;
+        //! Time of the last successful write.
+        double last;
+        //! Version of the stream last sent to the client.
+        uint64_t version;
+        //! Data waiting to be written.
+        std::string data;
+        //! Number of bytes of data already written.
+        size_t offset;
+      };
+
+      //! Entries are keyed by message identifier, sub-identifier and
+      //! source entity. Power channels are told apart by name.
+      typedef std::pair<unsigned, std::string> Key;
+      //! Map of entries.
+      typedef std::map<Key, Entry> EntryMap;
+      //! Frames by version of the stream already known by clients.
+      typedef std::map<uint64_t, std::string> FrameMap;
+
+      //! Default client rate (Hz).
+      double m_rate;
+      //! Maximum client rate (Hz).
+      double m_max_rate;
+      //! Maximum number of clients.
+      unsigned m_max_clients;
+      //! Number of connected clients.
+      unsigned m_client_count;
+      //! Current version of the stream, version zero is never sent
+      //! to clients and marks new clients.
+      uint64_t m_version;
+      //! Latest messages.
+      EntryMap m_entries;
+      //! Entities event.
+      std::string m_entities;
+      //! Clients waiting to be handled by the stream thread.
+      std::vector<Client*> m_new_clients;
+      //! Clients, only accessed by the stream thread.
+      std::vector<Client*> m_clients;
+      //! Frames of the current iteration.
+      FrameMap m_frames;
+      //! JSON writer.
+      DUNE::IMC::JSONWriter m_writer;
+      //! Lock of shared data.
+      DUNE::Concurrency::Mutex m_lock;
+
+      //! Build the frame sent to clients that know a given version
+      //! of the stream. Must be called with the lock held.
+      //! @param[in] since version known by clients.
+      //! @param[out] frame frame, empty if nothing changed.
+      void
+      buildFrame(uint64_t since, std::string& frame);
+
+      //! Write pending data of a client.
+      //! @param[in] client client.
+      //! @param[in] now current time.
+      //! @return false if the client must be dropped, true otherwise.
+      bool
+      flush(Client* client, double now);
+
+      void
+      run(void);
+    };
+  }
+}
+
+#endif
@@ -92,6 +92,26 @@ namespace Transports
       sock->write(res.c_str(), res.size());
     }
 
+    std::string
+    RequestHandler::getStreamHeader(HeaderFieldsMap* hdr_fields)
+    {
+      std::stringstream ss;
+      ss << STATUS_LINE_200
+         << SERVER_VERSION
+         << "Cache-Control: " << "no-cache" << "\r\n"
+         << "Connection: " << "close" << "\r\n";
+
+      if (hdr_fields)
+      {
+        HeaderFieldsMap::iterator itr = hdr_fields->begin();
+        for (; itr != hdr_fields->end(); ++itr)
+          ss << itr->first << ": " << itr->second << "\r\n";
+      }
+
+      ss << "\r\n";
+      return ss.str();
+    }
+
     void
     RequestHandler::sendResponse100(TCPSocket* sock)
     {
@@ -241,7 +261,7 @@ namespace Transports
       sendResponse404(sock);
     }
 
-    void
+    bool
     RequestHandler::handleRequest(TCPSocket* sock)
     {
       char mtd[16];
@@ -281,7 +301,7 @@ namespace Transports
       if (size <= 0)
       {
         DUNE_WRN("HTTP", "request too short");
-        return;
+        return false;
       }
 
       char* hdr = new char[size + 1];
@@ -289,6 +309,7 @@ namespace Transports
       hdr[size] = 0;
 
       Utils::TupleList headers(hdr, ":", "\r\n", true);
+      bool kept = false;
 
       // Parse request line.
       if (std::sscanf(hdr, "%s %s %*s", mtd, uri) == 2)
@@ -298,7 +319,10 @@ namespace Transports
 
         if (std::strcmp(mtd, "GET") == 0)
         {
-          handleGET(sock, headers, uri_clean);
+          StreamResult result = handleStream(sock, headers, uri_clean);
+          if (result == STREAM_IGNORED)
+            handleGET(sock, headers, uri_clean);
+          kept = (result == STREAM_KEPT);
         }
         else if (std::strcmp(mtd, "POST") == 0)
         {
@@ -311,6 +335,7 @@ namespace Transports
       }
 
       delete[] hdr;
+      return kept;
     }
   }
 }
@@ -49,6 +49,17 @@ namespace Transports
     public:
       typedef std::map<std::string, std::string> HeaderFieldsMap;
 
+      //! Outcome of handleStream().
+      enum StreamResult
+      {
+        //! Not a stream request, handleGET() must answer it.
+        STREAM_IGNORED,
+        //! Answered (e.g. refused), the connection can be closed.
+        STREAM_ANSWERED,
+        //! The handler took ownership of the socket.
+        STREAM_KEPT
+      };
+
       RequestHandler(void)
       { }
 
@@ -56,6 +67,23 @@ namespace Transports
       ~RequestHandler(void)
       { }
 
+      //! Handle a GET request whose response is streamed for as long
+      //! as the connection is open.
+      //! @param[in] sock client socket.
+      //! @param[in] headers request header fields.
+      //! @param[in] uri request URI.
+      //! @return STREAM_IGNORED if the request must be handled by
+      //! handleGET(), STREAM_ANSWERED if a response was sent and
+      //! STREAM_KEPT if the handler took ownership of the socket.
+      virtual StreamResult
+      handleStream(TCPSocket* sock, Utils::TupleList& headers, const char* uri)
+      {
+        (void)sock;
+        (void)headers;
+        (void)uri;
+        return STREAM_IGNORED;
+      }
+
       virtual void
       handleGET(TCPSocket* sock, Utils::TupleList& headers, const char* uri);
 
@@ -68,6 +96,13 @@ namespace Transports
       void
       sendHeader(TCPSocket* sock, const char* status_line, int64_t length, HeaderFieldsMap* hdr_fields = 0);
 
+      //! Build the header of a response without length, whose body
+      //! ends when the connection is closed.
+      //! @param[in] hdr_fields extra header fields.
+      //! @return response header.
+      std::string
+      getStreamHeader(HeaderFieldsMap* hdr_fields = 0);
+
       void
       sendResponse100(TCPSocket* sock);
 
@@ -110,7 +145,11 @@ namespace Transports
       void
       sendFile(TCPSocket* sock, const std::string& file, HeaderFieldsMap& hdr_fields, int64_t off_beg = -1, int64_t off_end = -1);
 
-      void
+      //! Read and handle a request.
+      //! @param[in] sock client socket.
+      //! @return true if the handler took ownership of the socket,
+      //! false otherwise.
+      bool
       handleRequest(TCPSocket* sock);
     };
   }
@@ -74,14 +74,16 @@ namespace Transports
           if (!sock)
             continue;
 
+          bool kept = false;
           try
           {
-            m_handler.handleRequest(sock);
+            kept = m_handler.handleRequest(sock);
           }
           catch (...)
           { }
 
-          delete sock;
+          if (!kept)
+            delete sock;
         }
       }
     };
@@ -40,6 +40,7 @@
 #include <DUNE/DUNE.hpp>
 
 // Local headers.
+#include "EventStream.hpp"
 #include "MessageMonitor.hpp"
 #include "RequestHandler.hpp"
 #include "Server.hpp"
@@ -61,6 +62,12 @@ namespace Transports
       unsigned threads;
       //! List of messages to transport.
       std::vector<std::string> messages;
+      //! Default update rate of stream clients.
+      double stream_rate;
+      //! Maximum update rate of stream clients.
+      double stream_max_rate;
+      //! Maximum number of stream clients.
+      unsigned stream_max_clients;
     };
 
     //! Buffer length.
@@ -78,6 +85,8 @@ namespace Transports
       std::string m_agent;
       //! Message Monitor.
       MessageMonitor m_msg_mon;
+      //! Stream of message updates.
+      EventStream* m_stream;
       //! Task arguments.
       Arguments m_args;
 
@@ -85,7 +94,8 @@ namespace Transports
         Tasks::Task(name, ctx),
         RequestHandler(),
         m_server(NULL),
-        m_msg_mon(getSystemName(), ctx.uid)
+        m_msg_mon(getSystemName(), ctx.uid),
+        m_stream(NULL)
       {
         // Define configuration parameters.
         param("Port", m_args.port)
@@ -100,6 +110,20 @@ namespace Transports
         .defaultValue("")
         .description("List of messages to transport");
 
+        param("Stream Rate", m_args.stream_rate)
+        .defaultValue("2.0")
+        .units(Units::Hertz)
+        .description("Default rate of updates sent to stream clients");
+
+        param("Maximum Stream Rate", m_args.stream_max_rate)
+        .defaultValue("10.0")
+        .units(Units::Hertz)
+        .description("Maximum rate of updates that stream clients may request");
+
+        param("Maximum Stream Clients", m_args.stream_max_clients)
+        .defaultValue("8")
+        .description("Maximum number of simultaneous stream clients");
+
         m_cfg_dir = ctx.dir_cfg.str();
         m_agent = getSystemName();
 
@@ -111,6 +135,24 @@ namespace Transports
       {
         bind(this, m_args.messages);
 
+        // Only the latest message of each entity is shown, unless
+        // messages are told apart by their sub-identifier.
+        for (unsigned i = 0; i < m_args.messages.size(); ++i)
+        {
+          IMC::Message* msg = IMC::Factory::produce(m_args.messages[i]);
+          if (msg == NULL)
+            continue;
+
+          if (!msg->hasSubId())
+            setOverflowPolicy(msg->getId(), Tasks::Mailbox::OP_COALESCE_LATEST_BY_SOURCE);
+
+          delete msg;
+        }
+
+        m_stream = new EventStream(m_args.stream_rate, m_args.stream_max_rate, m_args.stream_max_clients);
+        m_stream->setEntities(m_ctx.entities.entries());
+        m_stream->start();
+
         uint16_t last_port = m_args.port + c_max_port_tries;
 
         for (uint16_t port = m_args.port; port < last_port; ++port)
@@ -152,6 +194,12 @@ namespace Transports
       onResourceRelease(void)
       {
         Memory::clear(m_server);
+
+        if (m_stream != NULL)
+        {
+          m_stream->stopAndJoin();
+          Memory::clear(m_stream);
+        }
       }
 
       void
@@ -163,8 +211,12 @@ namespace Transports
       void
       consume(const IMC::Message* msg)
       {
-        if (msg->getSource() == getSystemId())
-          m_msg_mon.updateMessage(msg);
+        if (msg->getSource() != getSystemId())
+          return;
+
+        m_msg_mon.updateMessage(msg);
+        if (m_stream != NULL)
+          m_stream->updateMessage(msg);
       }
 
       void
@@ -191,6 +243,43 @@ namespace Transports
         return (std::strcmp(url, str) == 0);
       }
 
+      //! Test if the path of an URL (without query string) is exactly
+      //! a given path.
+      static bool
+      matchPath(const char* url, const char* str)
+      {
+        int size = std::strlen(str);
+        return (std::strncmp(url, str, size) == 0)
+          && (url[size] == '\0' || url[size] == '?');
+      }
+
+      StreamResult
+      handleStream(TCPSocket* sock, TupleList& headers, const char* uri)
+      {
+        (void)headers;
+
+        if (!matchPath(uri, "/dune/state/stream"))
+          return STREAM_IGNORED;
+
+        debug("stream request: %s", uri);
+
+        double rate = 0;
+        const char* query = std::strstr(uri, "rate=");
+        if (query != NULL)
+          rate = std::atof(query + 5);
+
+        RequestHandler::HeaderFieldsMap hdr;
+        hdr["Content-Type"] = "text/event-stream";
+
+        if (m_stream == NULL || !m_stream->addClient(sock, rate, getStreamHeader(&hdr)))
+        {
+          sendResponse503(sock);
+          return STREAM_ANSWERED;
+        }
+
+        return STREAM_KEPT;
+      }
+
       void
       handleGET(TCPSocket* sock, TupleList& headers, const char* uri)
       {
@@ -299,6 +388,14 @@ namespace Transports
         unsigned int size = headers.get("content-length", 0);
         char* bfr = new char[size];
         sock->read(bfr, size);
+
+        if (headers.get("content-type").compare(0, 16, "application/json") == 0)
+        {
+          dispatchJSON(sock, bfr, size);
+          delete [] bfr;
+          return;
+        }
+
         IMC::Message* msg = IMC::Packet::deserialize((uint8_t*)bfr, size);
         dispatch(msg, DF_KEEP_TIME);
         std::ostringstream ss;
@@ -306,6 +403,55 @@ namespace Transports
         sendData(sock, ss.str());
       }
 
+      //! Dispatch one or more messages in JSON format and reply with
+      //! the messages that were dispatched.
+      void
+      dispatchJSON(TCPSocket* sock, const char* data, size_t size)
+      {
+        std::vector<IMC::Message*> msgs;
+
+        try
+        {
+          IMC::JSONReader reader(data, size);
+          while (!reader.isDone())
+          {
+            IMC::Message* msg = reader.readMessage();
+            if (msg != NULL)
+              msgs.push_back(msg);
+          }
+        }
+        catch (std::runtime_error& e)
+        {
+          war("%s", e.what());
+          for (unsigned i = 0; i < msgs.size(); ++i)
+            delete msgs[i];
+          sendResponse500(sock);
+          return;
+        }
+
+        IMC::JSONWriter writer;
+        writer.put('[');
+        for (unsigned i = 0; i < msgs.size(); ++i)
+        {
+          if (msgs[i]->getTimeStamp() < 0)
+            dispatch(msgs[i]);
+          else
+            dispatch(msgs[i], DF_KEEP_TIME);
+
+          if (i != 0)
+            writer.put(',');
+          msgs[i]->toJSON(writer);
+        }
+        writer.put(']');
+
+        for (unsigned i = 0; i < msgs.size(); ++i)
+          delete msgs[i];
+
+        RequestHandler::HeaderFieldsMap hdr;
+        hdr["Content-Type"] = "application/json";
+        sendData(sock, writer.data(), (int)writer.size(), &hdr);
+      }
+
       void
       setTime(TCPSocket* sock, TupleList& headers, const char* uri)
       {
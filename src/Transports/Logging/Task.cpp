@@ -33,10 +33,14 @@
 #include <fstream>
 #include <algorithm>
 #include <cstddef>
+#include <iterator>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
+// Local headers.
+#include "Writer.hpp"
+
 namespace Transports
 {
   namespace Logging
@@ -45,6 +49,10 @@ namespace Transports
 
     // Bytes per Mebibyte.
     static const unsigned c_bytes_per_mib = 1048576U;
+    // Bytes per Kibibyte.
+    static const unsigned c_bytes_per_kib = 1024U;
+    // Default mailbox capacity, a few seconds of bus traffic.
+    static const unsigned c_mailbox_capacity = 16384U;
 
     struct Arguments
     {
@@ -58,6 +66,14 @@ namespace Transports
       unsigned lsf_volume_size;
       // Compression method.
       std::string lsf_compression;
+      // True to write a chunk index.
+      bool lsf_index;
+      // Write block size.
+      unsigned block_size;
+      // Number of pre-allocated write blocks.
+      unsigned block_count;
+      // Maximum number of write blocks.
+      unsigned block_max;
     };
 
     struct Task: public Tasks::Task
@@ -72,16 +88,18 @@ namespace Transports
       std::string m_volume_dir;
       // Compression format.
       Compression::Methods m_compression;
-      // Output file stream for LSF/LSF_GZ formats.
-      std::ostream* m_lsf;
+      // Asynchronous LSF writer.
+      Writer* m_lsf;
       // Path to LSF file.
       Path m_lsf_file;
-      // Serialization buffer.
-      ByteBuffer m_buffer;
       // Logging control message.
       IMC::LoggingControl m_log_ctl;
       // True if logging is enabled.
       bool m_active;
+      // Bytes dropped by the writer since the task started.
+      uint64_t m_lost_bytes;
+      // True while the writer is dropping data.
+      bool m_dropping;
       // Task arguments.
       Arguments m_args;
 
@@ -89,8 +107,13 @@ namespace Transports
         Tasks::Task(name, ctx),
         m_last_flush(0),
         m_lsf(NULL),
-        m_active(true)
+        m_active(true),
+        m_lost_bytes(0),
+        m_dropping(false)
       {
+        // Every message on the bus is logged.
+        setDefaultMailboxCapacity(c_mailbox_capacity);
+
         // Define configuration parameters.
         param("Flush Interval", m_args.flush_interval)
         .defaultValue("5.0")
@@ -101,6 +124,10 @@ namespace Transports
         .defaultValue("none")
         .description("Compression method");
 
+        param("LSF Index", m_args.lsf_index)
+        .defaultValue("true")
+        .description("Write a sidecar index of the LSF chunks");
+
         param("LSF Volume Size", m_args.lsf_volume_size)
         .units(Units::Mebibyte)
         .defaultValue("0");
@@ -108,6 +135,24 @@ namespace Transports
         param("LSF Volume Directories", m_args.lsf_volumes)
         .defaultValue("");
 
+        param("Write Block Size", m_args.block_size)
+        .units(Units::Kibibyte)
+        .defaultValue("1024")
+        .minimumValue("64")
+        .description("Size of each block handed to the writer thread");
+
+        param("Write Blocks", m_args.block_count)
+        .defaultValue("2")
+        .minimumValue("2")
+        .description("Number of pre-allocated write blocks");
+
+        param("Maximum Write Blocks", m_args.block_max)
+        .defaultValue("16")
+        .minimumValue("2")
+        .description("Maximum number of write blocks, including the ones"
+                     " allocated when the writer falls behind. Further data"
+                     " is dropped and the entity is put in error");
+
         param("Transports", m_args.messages)
         .defaultValue("");
 
@@ -124,6 +169,13 @@ namespace Transports
         onResourceRelease();
       }
 
+      void
+      onResourceAcquisition(void)
+      {
+        m_lsf = new Writer(m_args.block_size * c_bytes_per_kib, m_args.block_count, m_args.block_max);
+        m_lsf->start();
+      }
+
       void
       onResourceInitialization(void)
       {
@@ -199,6 +251,7 @@ namespace Transports
         if (msg->op == IMC::PowerOperation::POP_PWR_DOWN_IP)
         {
           stopLog(false);
+          m_lsf->sync();
           dune_term.close();
         }
         else if (msg->op == IMC::PowerOperation::POP_PWR_DOWN_ABORTED)
@@ -288,12 +341,11 @@ namespace Transports
         if (!ifs.is_open())
           return;
 
-        char bfr[16 * 1024];
-        while (!ifs.eof())
-        {
-          ifs.read(bfr, sizeof(bfr));
-          m_lsf->write(bfr, ifs.gcount());
-        }
+        // Write the snapshot at once so that no message is split
+        // between chunks.
+        std::vector<char> bfr((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+        if (!bfr.empty())
+          m_lsf->write(&bfr[0], bfr.size());
       }
 
       void
@@ -303,7 +355,7 @@ namespace Transports
         if (!m_active)
           return;
 
-        if (m_lsf == NULL)
+        if (m_lsf == NULL || !m_lsf->isOpen())
           return;
 
         m_active = keep_logging;
@@ -320,7 +372,7 @@ namespace Transports
         inf(DTR("log stopped '%s'"), m_log_ctl.name.c_str());
         m_log_ctl.name.clear();
 
-        onResourceRelease();
+        m_lsf->close();
       }
 
       void
@@ -350,10 +402,7 @@ namespace Transports
 
         m_lsf_file = m_dir / "Data.lsf" + Compression::Factory::extension(m_compression);
 
-        if (m_compression == METHOD_UNKNOWN)
-          m_lsf = new std::ofstream(m_lsf_file.c_str(), std::ios::binary);
-        else
-          m_lsf = new Compression::FileOutput(m_lsf_file.c_str(), m_compression);
+        m_lsf->open(m_lsf_file, m_compression, m_args.lsf_index);
 
         // Log LoggingControl to facilitate posterior conversion to LLF.
         m_log_ctl.op = IMC::LoggingControl::COP_STARTED;
@@ -384,9 +433,35 @@ namespace Transports
       void
       tryRotate(void)
       {
-        if (m_lsf == NULL)
+        if (m_lsf == NULL || !m_lsf->isOpen())
           return;
 
+        std::string error;
+        if (m_lsf->takeError(error))
+          throw std::runtime_error(error);
+
+        unsigned overruns = m_lsf->takeOverruns();
+        if (overruns > 0)
+          war(DTR("writer fell behind, allocated %u extra blocks"), overruns);
+
+        uint64_t lost = 0;
+        unsigned drops = m_lsf->takeDrops(lost);
+        if (drops > 0)
+        {
+          m_lost_bytes += lost;
+          m_dropping = true;
+          err(DTR("writer fell behind, dropped %u blocks (%llu bytes)"),
+              drops, (unsigned long long)lost);
+          setEntityState(IMC::EntityState::ESTA_ERROR,
+                         String::str(DTR("writer fell behind, %llu bytes lost"),
+                                     (unsigned long long)m_lost_bytes));
+        }
+        else if (m_dropping)
+        {
+          m_dropping = false;
+          setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
+        }
+
         int64_t mib = Path(m_lsf_file).size();
         mib /= c_bytes_per_mib;
 
@@ -424,8 +499,7 @@ namespace Transports
         if (m_lsf == NULL)
           return;
 
-        IMC::Packet::serialize(msg, m_buffer);
-        m_lsf->write(m_buffer.getBufferSigned(), m_buffer.getSize());
+        m_lsf->write(msg);
       }
 
       void
@@ -0,0 +1,631 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef TRANSPORTS_LOGGING_WRITER_HPP_INCLUDED_
+#define TRANSPORTS_LOGGING_WRITER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <set>
+#include <deque>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Transports
+{
+  namespace Logging
+  {
+    using DUNE_NAMESPACES;
+
+    //! Asynchronous LSF writer. Messages are serialized by the
+    //! producer straight into a pre-allocated block; full blocks are
+    //! handed to a background thread, which compresses each block as
+    //! an independent chunk and writes it to disk, optionally
+    //! recording it in an IMC::LogIndex. Opening, flushing and
+    //! closing files are queued with the data, so rotating a log
+    //! never blocks the producer. If the writer thread falls behind,
+    //! extra blocks are allocated up to a limit; beyond that the
+    //! producer waits briefly for a free block and then drops the
+    //! current one, counting the lost blocks and bytes. The writer
+    //! thread attaches to the installed clock source, so virtual time
+    //! does not advance while it is writing. All public methods must
+    //! be called from the same thread.
+    class Writer: public Concurrency::Thread
+    {
+    public:
+      //! Constructor.
+      //! @param[in] block_size size of each block in bytes.
+      //! @param[in] block_count number of pre-allocated blocks.
+      //! @param[in] max_blocks maximum number of blocks.
+      Writer(size_t block_size, unsigned block_count, unsigned max_blocks):
+        m_block_size(block_size),
+        m_max_blocks(max_blocks),
+        m_open(false),
+        m_output(NULL),
+        m_busy(false),
+        m_overruns(0),
+        m_drops(0),
+        m_lost_bytes(0)
+      {
+        if (block_count < 2)
+          block_count = 2;
+
+        if (m_max_blocks < block_count)
+          m_max_blocks = block_count;
+
+        for (unsigned i = 0; i < block_count; ++i)
+          m_blocks.push_back(new Block(block_size));
+
+        m_block = m_blocks.back();
+        m_free.assign(m_blocks.begin(), m_blocks.end() - 1);
+      }
+
+      //! Destructor. Pending data is written before returning.
+      ~Writer(void)
+      {
+        close();
+
+        if (isCreated())
+        {
+          stop();
+          wake();
+          join();
+        }
+
+        process();
+        Memory::clear(m_output);
+
+        for (size_t i = 0; i < m_blocks.size(); ++i)
+          delete m_blocks[i];
+      }
+
+      //! Start writing to a new file. Any previous file is closed
+      //! first. The file is created immediately so that errors are
+      //! reported to the caller.
+      //! @param[in] path data file.
+      //! @param[in] method compression method.
+      //! @param[in] indexed true to write a sidecar index.
+      void
+      open(const Path& path, Compression::Methods method, bool indexed)
+      {
+        Output* output = new Output(path, method, indexed);
+
+        if (m_open)
+          close();
+
+        Request rq(RQ_OPEN);
+        rq.output = output;
+        enqueue(rq);
+        m_open = true;
+      }
+
+      //! Close the current file after all queued data is written.
+      void
+      close(void)
+      {
+        if (!m_open)
+          return;
+
+        submit();
+        enqueue(Request(RQ_CLOSE));
+        m_open = false;
+      }
+
+      //! Check if a file is open.
+      //! @return true if a file is open, false otherwise.
+      bool
+      isOpen(void) const
+      {
+        return m_open;
+      }
+
+      //! Hand the current block to the writer thread and request the
+      //! file to be flushed.
+      void
+      flush(void)
+      {
+        if (!m_open)
+          return;
+
+        submit();
+        enqueue(Request(RQ_FLUSH));
+      }
+
+      //! Wait until all queued requests have been executed.
+      void
+      sync(void)
+      {
+        if (!isCreated())
+        {
+          process();
+          return;
+        }
+
+        Concurrency::ScopedCondition l(m_cond);
+        while ((!m_requests.empty() || m_busy) && !isDead())
+          m_cond.wait(1.0);
+      }
+
+      //! Serialize a message into the current block.
+      //! @param[in] msg message.
+      void
+      write(const IMC::Message* msg)
+      {
+        if (!m_open)
+          return;
+
+        size_t size = msg->getSerializationSize();
+        reserve(size);
+
+        ByteBuffer& data = m_block->data;
+        size_t offset = data.getSize();
+        data.setSize(offset + size);
+
+        try
+        {
+          IMC::Packet::serialize(msg, data.getBuffer() + offset, size);
+        }
+        catch (...)
+        {
+          data.setSize(offset);
+          throw;
+        }
+
+        IMC::LogIndex::Chunk& chunk = m_block->chunk;
+        double time = msg->getTimeStamp();
+        if (chunk.count == 0 || time < chunk.time_start)
+          chunk.time_start = time;
+        if (chunk.count == 0 || time > chunk.time_end)
+          chunk.time_end = time;
+        ++chunk.count;
+
+        m_ids.insert(msg->getId());
+        m_sources.insert(IMC::LogIndex::Source(msg->getSource(), msg->getSourceEntity()));
+      }
+
+      //! Copy serialized messages into the current block. The data
+      //! must hold whole messages; the resulting chunk is marked as
+      //! opaque in the index.
+      //! @param[in] data data.
+      //! @param[in] size data size.
+      void
+      write(const char* data, size_t size)
+      {
+        if (!m_open || size == 0)
+          return;
+
+        reserve(size);
+        m_block->data.appendSigned(data, size);
+        m_block->chunk.flags |= IMC::LogIndex::CF_OPAQUE;
+      }
+
+      //! Retrieve and clear the last error of the writer thread.
+      //! @param[out] msg error message.
+      //! @return true if an error occurred, false otherwise.
+      bool
+      takeError(std::string& msg)
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        if (m_error.empty())
+          return false;
+
+        msg = m_error;
+        m_error.clear();
+        return true;
+      }
+
+      //! Retrieve and clear the number of blocks that had to be
+      //! allocated because the writer thread fell behind.
+      //! @return number of overruns.
+      unsigned
+      takeOverruns(void)
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        unsigned overruns = m_overruns;
+        m_overruns = 0;
+        return overruns;
+      }
+
+      //! Retrieve and clear the number of blocks that were dropped
+      //! because the maximum number of blocks was in use.
+      //! @param[out] bytes number of bytes in the dropped blocks.
+      //! @return number of dropped blocks.
+      unsigned
+      takeDrops(uint64_t& bytes)
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        unsigned drops = m_drops;
+        bytes = m_lost_bytes;
+        m_drops = 0;
+        m_lost_bytes = 0;
+        return drops;
+      }
+
+    protected:
+      void
+      startImpl(void)
+      {
+        Clock::reserve();
+        Concurrency::Thread::startImpl();
+      }
+
+    private:
+      //! Request types.
+      enum RequestType
+      {
+        //! Start writing to a new file.
+        RQ_OPEN,
+        //! Write a block.
+        RQ_DATA,
+        //! Flush files.
+        RQ_FLUSH,
+        //! Close files.
+        RQ_CLOSE
+      };
+
+      //! Block of serialized messages and its index entry.
+      struct Block
+      {
+        ByteBuffer data;
+        IMC::LogIndex::Chunk chunk;
+
+        Block(size_t size):
+          data(size)
+        { }
+      };
+
+      //! Files being written by the writer thread.
+      struct Output
+      {
+        //! Data file.
+        std::ofstream data;
+        //! Index file, NULL if not indexed.
+        std::ofstream* index;
+        //! Compressor, NULL if not compressed.
+        Compression::Compressor* compressor;
+        //! Compressed block.
+        ByteBuffer packed;
+        //! Current size of the data file.
+        uint64_t offset;
+
+        Output(const Path& path, Compression::Methods method, bool indexed):
+          data(path.c_str(), std::ios::binary),
+          index(NULL),
+          compressor(Compression::Factory::compressor(method)),
+          offset(0)
+        {
+          if (data.fail())
+          {
+            delete compressor;
+            throw std::runtime_error(String::str(DTR("unable to open '%s'"), path.c_str()));
+          }
+
+          if (indexed)
+          {
+            std::string index_path = IMC::LogIndex::getPath(path.str());
+            index = new std::ofstream(index_path.c_str(), std::ios::binary);
+            IMC::LogIndex::writeHeader(*index, method);
+          }
+        }
+
+        ~Output(void)
+        {
+          delete index;
+          delete compressor;
+        }
+
+        //! Write one block as an independent chunk.
+        //! @param[in] block block.
+        void
+        write(Block* block)
+        {
+          ByteBuffer* out = &block->data;
+          if (compressor != NULL)
+          {
+            compressor->compress(packed, block->data);
+            out = &packed;
+          }
+
+          data.write(out->getBufferSigned(), out->getSize());
+
+          IMC::LogIndex::Chunk& chunk = block->chunk;
+          chunk.offset = offset;
+          chunk.length = out->getSize();
+          chunk.size = block->data.getSize();
+          offset += out->getSize();
+
+          if (index != NULL)
+            IMC::LogIndex::writeChunk(*index, chunk);
+        }
+
+        void
+        flush(void)
+        {
+          data.flush();
+          if (index != NULL)
+            index->flush();
+        }
+
+        bool
+        fail(void) const
+        {
+          return data.fail() || (index != NULL && index->fail());
+        }
+      };
+
+      //! Writer request.
+      struct Request
+      {
+        RequestType type;
+        Output* output;
+        Block* block;
+
+        Request(RequestType a_type):
+          type(a_type),
+          output(NULL),
+          block(NULL)
+        { }
+      };
+
+      //! Nominal block size.
+      size_t m_block_size;
+      //! Maximum number of blocks.
+      unsigned m_max_blocks;
+      //! All blocks ever allocated.
+      std::vector<Block*> m_blocks;
+      //! Block being filled by the producer.
+      Block* m_block;
+      //! Message identifiers in the current block.
+      std::set<uint16_t> m_ids;
+      //! Message sources in the current block.
+      std::set<IMC::LogIndex::Source> m_sources;
+      //! True if the producer has a file open.
+      bool m_open;
+      //! Blocks available to the producer.
+      std::vector<Block*> m_free;
+      //! Pending requests.
+      std::deque<Request> m_requests;
+      //! Files being written by the writer thread.
+      Output* m_output;
+      //! True while the writer thread is executing a request.
+      bool m_busy;
+      //! Last error.
+      std::string m_error;
+      //! Number of blocks allocated on demand.
+      unsigned m_overruns;
+      //! Number of dropped blocks.
+      unsigned m_drops;
+      //! Number of bytes in dropped blocks.
+      uint64_t m_lost_bytes;
+      //! Guards the request queue, free blocks and status.
+      Concurrency::Condition m_cond;
+
+      //! Make sure the current block can hold a given amount of data,
+      //! handing it over if it cannot.
+      //! @param[in] size data size.
+      void
+      reserve(size_t size)
+      {
+        if (m_block->data.getSize() > 0 && m_block->data.getSize() + size > m_block_size)
+          submit();
+      }
+
+      //! Hand the current block to the writer thread and fetch a free
+      //! one, allocating a new block if the writer is lagging behind.
+      //! Only when the maximum number of blocks is in use, wait for
+      //! one to be released and drop the current block if none is.
+      void
+      submit(void)
+      {
+        // Maximum time to wait for a free block.
+        const double c_wait_timeout = 1.0;
+
+        if (m_block->data.getSize() == 0)
+          return;
+
+        IMC::LogIndex::Chunk& chunk = m_block->chunk;
+        chunk.ids.assign(m_ids.begin(), m_ids.end());
+        chunk.sources.assign(m_sources.begin(), m_sources.end());
+        m_ids.clear();
+        m_sources.clear();
+
+        Request rq(RQ_DATA);
+        rq.block = m_block;
+
+        Concurrency::ScopedCondition l(m_cond);
+
+        // Grow the pool before waiting for the writer thread.
+        if (m_free.empty() && m_blocks.size() < m_max_blocks)
+        {
+          m_blocks.push_back(new Block(m_block_size));
+          m_free.push_back(m_blocks.back());
+          ++m_overruns;
+        }
+
+        double deadline = Clock::get() + c_wait_timeout;
+        while (m_free.empty() && isCreated() && !isDead())
+        {
+          double left = deadline - Clock::get();
+          if (left <= 0)
+            break;
+
+          m_cond.wait(left);
+        }
+
+        if (m_free.empty())
+        {
+          m_lost_bytes += m_block->data.getSize();
+          ++m_drops;
+          recycle(m_block);
+          return;
+        }
+
+        m_requests.push_back(rq);
+        m_block = m_free.back();
+        m_free.pop_back();
+        m_cond.signal();
+      }
+
+      //! Wake up the writer thread.
+      void
+      wake(void)
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        m_cond.signal();
+      }
+
+      //! Queue a request for the writer thread.
+      //! @param[in] rq request.
+      void
+      enqueue(const Request& rq)
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        m_requests.push_back(rq);
+        m_cond.signal();
+      }
+
+      //! Execute a request on the writer thread.
+      //! @param[in] rq request.
+      void
+      execute(const Request& rq)
+      {
+        try
+        {
+          switch (rq.type)
+          {
+            case RQ_OPEN:
+              Memory::clear(m_output);
+              m_output = rq.output;
+              break;
+
+            case RQ_DATA:
+              if (m_output != NULL)
+                m_output->write(rq.block);
+              break;
+
+            case RQ_FLUSH:
+              if (m_output != NULL)
+                m_output->flush();
+              break;
+
+            case RQ_CLOSE:
+              Memory::clear(m_output);
+              break;
+          }
+
+          if (m_output != NULL && m_output->fail())
+            throw std::runtime_error(DTR("failed to write log file"));
+        }
+        catch (std::exception& e)
+        {
+          Concurrency::ScopedCondition l(m_cond);
+          m_error = e.what();
+        }
+      }
+
+      //! Reset a block before reuse.
+      //! @param[in] block block.
+      void
+      recycle(Block* block)
+      {
+        block->data.setSize(0);
+        block->chunk = IMC::LogIndex::Chunk();
+      }
+
+      //! Execute all pending requests.
+      //! @return true if at least one request was executed.
+      bool
+      process(void)
+      {
+        bool executed = false;
+
+        while (true)
+        {
+          m_cond.lock();
+          if (m_requests.empty())
+          {
+            m_cond.unlock();
+            return executed;
+          }
+
+          Request rq = m_requests.front();
+          m_requests.pop_front();
+          m_busy = true;
+          m_cond.unlock();
+
+          execute(rq);
+          executed = true;
+
+          if (rq.block != NULL)
+            recycle(rq.block);
+
+          Concurrency::ScopedCondition l(m_cond);
+          m_busy = false;
+
+          // Wake up the producer waiting for a free block or sync().
+          if (rq.block != NULL)
+          {
+            m_free.push_back(rq.block);
+            m_cond.broadcast();
+          }
+          else if (m_requests.empty())
+          {
+            m_cond.broadcast();
+          }
+        }
+      }
+
+      void
+      run(void)
+      {
+        Clock::attach();
+
+        while (!isStopping())
+        {
+          if (process())
+            continue;
+
+          m_cond.lock();
+          if (m_requests.empty() && !isStopping())
+            m_cond.wait(1.0);
+          m_cond.unlock();
+        }
+
+        process();
+        Clock::detach();
+      }
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,504 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef TRANSPORTS_REPLAY_READER_HPP_INCLUDED_
+#define TRANSPORTS_REPLAY_READER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <deque>
+#include <fstream>
+#include <map>
+#include <queue>
+#include <set>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Transports
+{
+  namespace Replay
+  {
+    using DUNE_NAMESPACES;
+
+    //! Message read from the log.
+    struct Item
+    {
+      //! Message, owned by the holder of the item.
+      IMC::Message* msg;
+      //! Timestamp in log time.
+      double time;
+      //! Position in the log, breaks timestamp ties.
+      uint64_t seq;
+      //! True if the message is to be dispatched, false if it is
+      //! only of interest to the replay task itself.
+      bool replay;
+
+      Item(void):
+        msg(NULL),
+        time(0),
+        seq(0),
+        replay(false)
+      { }
+
+      //! Reverse ordering, so that std::priority_queue yields the
+      //! earliest message first and messages with equal timestamps
+      //! in log order.
+      bool
+      operator<(const Item& other) const
+      {
+        if (time != other.time)
+          return time > other.time;
+
+        return seq > other.seq;
+      }
+    };
+
+    //! Reads a log on a background thread and hands its messages
+    //! over in timestamp order. Decompression, framing and decoding
+    //! happen on the reader thread; only messages that are replayed
+    //! or needed to map entities are decoded at all. Messages are
+    //! held in a reorder window before they are released, so
+    //! messages logged out of order are replayed by timestamp and
+    //! the replay order depends only on the contents of the log.
+    //! The reader thread attaches to the installed clock source, so
+    //! virtual time does not advance while it is reading.
+    class Reader: public Concurrency::Thread
+    {
+    public:
+      //! Constructor.
+      //! @param[in] task parent task.
+      //! @param[in] file log file.
+      //! @param[in] replay identifiers of the messages to replay.
+      //! @param[in] entities local entity identifiers by label.
+      //! @param[in] capacity maximum number of decoded messages
+      //! waiting to be retrieved.
+      //! @param[in] window reorder window in seconds.
+      Reader(Tasks::Task* task, const std::string& file,
+             const std::set<uint16_t>& replay,
+             const std::map<std::string, uint8_t>& entities,
+             unsigned capacity, double window):
+        m_task(task),
+        m_file(file),
+        m_entities(entities),
+        m_decode(c_id_count, false),
+        m_replay(c_id_count, false),
+        m_capacity(capacity),
+        m_window(window),
+        m_is(NULL),
+        m_log_start(0),
+        m_newest(0),
+        m_seq(0),
+        m_skip(0),
+        m_done(false)
+      {
+        std::set<uint16_t>::const_iterator itr = replay.begin();
+        for (; itr != replay.end(); ++itr)
+        {
+          m_decode[*itr] = true;
+          m_replay[*itr] = true;
+        }
+
+        m_decode[DUNE_IMC_ESTIMATEDSTATE] = true;
+        m_decode[DUNE_IMC_ENTITYINFO] = true;
+        m_decode[DUNE_IMC_ENTITYSTATE] = true;
+      }
+
+      //! Destructor.
+      ~Reader(void)
+      {
+        while (!m_queue.empty())
+        {
+          delete m_queue.front().msg;
+          m_queue.pop_front();
+        }
+
+        while (!m_heap.empty())
+        {
+          delete m_heap.top().msg;
+          m_heap.pop();
+        }
+
+        delete m_is;
+      }
+
+      //! Open the log and read its first message, which must be a
+      //! LoggingControl message. Must be called before start().
+      //! @return first message, owned by the caller.
+      //! @throw std::runtime_error if the log cannot be replayed.
+      IMC::LoggingControl*
+      open(void)
+      {
+        std::string index_file = IMC::LogIndex::getPath(m_file);
+        Compression::Methods method = Compression::Factory::detect(m_file.c_str());
+        if (Path(index_file).isFile())
+          m_is = openIndexed(index_file);
+        else if (method == Compression::METHOD_UNKNOWN)
+          m_is = new std::ifstream(m_file.c_str(), std::ios::binary);
+        else
+          m_is = new Compression::FileInput(m_file.c_str(), method);
+
+        IMC::Message* m = IMC::Packet::deserialize(*m_is);
+        if (m == NULL)
+          throw std::runtime_error(DTR("empty LSF file"));
+
+        if (m->getId() != DUNE_IMC_LOGGINGCONTROL)
+        {
+          delete m;
+          throw std::runtime_error(DTR("invalid LSF file for replay"));
+        }
+
+        m_log_start = m->getTimeStamp();
+        m_newest = m_log_start;
+        return static_cast<IMC::LoggingControl*>(m);
+      }
+
+      //! Discard messages older than a given time, including those
+      //! already waiting to be retrieved.
+      //! @param[in] time log time.
+      void
+      skip(double time)
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        bool full = m_queue.size() >= m_capacity;
+        m_skip = time;
+
+        std::deque<Item> keep;
+        for (size_t i = 0; i < m_queue.size(); ++i)
+        {
+          if (isSkipped(m_queue[i]))
+            delete m_queue[i].msg;
+          else
+            keep.push_back(m_queue[i]);
+        }
+        m_queue.swap(keep);
+
+        if (full)
+          m_cond.broadcast();
+      }
+
+      //! Retrieve the next message.
+      //! @param[out] item message.
+      //! @param[in] timeout maximum time to wait for a message.
+      //! @return true if a message was retrieved, false otherwise.
+      bool
+      pop(Item& item, double timeout)
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        if (m_queue.empty() && !m_done)
+          m_cond.wait(timeout);
+
+        if (m_queue.empty())
+          return false;
+
+        bool full = m_queue.size() >= m_capacity;
+        item = m_queue.front();
+        m_queue.pop_front();
+
+        if (full)
+          m_cond.broadcast();
+
+        return true;
+      }
+
+      //! Test if the whole log was read and retrieved.
+      //! @return true if there are no more messages, false otherwise.
+      bool
+      isDone(void)
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        return m_done && m_queue.empty();
+      }
+
+      //! Retrieve the error that stopped the reader.
+      //! @return error description, empty if there was no error.
+      std::string
+      getError(void)
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        return m_error;
+      }
+
+    protected:
+      void
+      startImpl(void)
+      {
+        Clock::reserve();
+        Concurrency::Thread::startImpl();
+      }
+
+      void
+      stopImpl(void)
+      {
+        Concurrency::Thread::stopImpl();
+
+        Concurrency::ScopedCondition l(m_cond);
+        m_cond.broadcast();
+      }
+
+    private:
+      //! Number of message identifiers.
+      static const unsigned c_id_count = 65536;
+      //! Parent task.
+      Tasks::Task* m_task;
+      //! Log file.
+      std::string m_file;
+      //! Local entity identifiers by label.
+      std::map<std::string, uint8_t> m_entities;
+      //! Local entity identifiers by log entity identifier.
+      std::map<uint8_t, uint8_t> m_eid2eid;
+      //! Messages that must be decoded, by identifier.
+      std::vector<bool> m_decode;
+      //! Messages that are replayed, by identifier.
+      std::vector<bool> m_replay;
+      //! Maximum number of messages waiting to be retrieved.
+      unsigned m_capacity;
+      //! Reorder window.
+      double m_window;
+      //! Log stream.
+      std::istream* m_is;
+      //! Serialized packet.
+      Utils::ByteBuffer m_bfr;
+      //! Timestamp of the first message.
+      double m_log_start;
+      //! Latest timestamp read so far.
+      double m_newest;
+      //! Number of packets read.
+      uint64_t m_seq;
+      //! Messages inside the reorder window.
+      std::priority_queue<Item> m_heap;
+      //! Messages waiting to be retrieved.
+      std::deque<Item> m_queue;
+      //! Condition protecting the following members and m_queue.
+      Concurrency::Condition m_cond;
+      //! Messages older than this time are discarded.
+      double m_skip;
+      //! True if the reader has finished.
+      bool m_done;
+      //! Error that stopped the reader.
+      std::string m_error;
+
+      //! Open an indexed log, skipping chunks that hold none of the
+      //! messages the reader decodes.
+      //! @param[in] index_file index file.
+      //! @return log stream.
+      std::istream*
+      openIndexed(const std::string& index_file)
+      {
+        IMC::LogIndex index;
+        index.load(index_file);
+
+        IMC::LogIndex::Query query;
+        query.ids.insert(DUNE_IMC_LOGGINGCONTROL);
+        for (unsigned i = 0; i < c_id_count; ++i)
+        {
+          if (m_decode[i])
+            query.ids.insert(i);
+        }
+
+        IMC::IndexedInput* is = new IMC::IndexedInput(m_file, index, query);
+        m_task->debug("reading %u of %u chunks", (unsigned)is->getChunkCount(),
+                      (unsigned)index.getChunks().size());
+        return is;
+      }
+
+      //! Test if a message falls before the seek time. Must be
+      //! called with the condition locked.
+      //! @param[in] item message.
+      //! @return true if the message is to be discarded.
+      bool
+      isSkipped(const Item& item) const
+      {
+        // Configurations are timestamped at the start of the log
+        // and still apply after seeking.
+        return item.time < m_skip && item.msg->getId() != DUNE_IMC_LBLCONFIG;
+      }
+
+      //! Retrieve the seek time.
+      //! @return log time.
+      double
+      getSkip(void)
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        return m_skip;
+      }
+
+      //! Convert an entity identifier read from the log to the
+      //! local one.
+      //! @param[in] eid log entity identifier.
+      //! @return local entity identifier.
+      uint8_t
+      mapEntity(uint8_t eid) const
+      {
+        std::map<uint8_t, uint8_t>::const_iterator itr = m_eid2eid.find(eid);
+        if (itr == m_eid2eid.end())
+          return DUNE_IMC_CONST_UNK_EID;
+
+        return itr->second;
+      }
+
+      //! Read one packet.
+      //! @return true if a packet was read, false at the end of the log.
+      bool
+      read(void)
+      {
+        m_bfr.setSize(DUNE_IMC_CONST_HEADER_SIZE);
+        m_is->read(m_bfr.getBufferSigned(), DUNE_IMC_CONST_HEADER_SIZE);
+        if (m_is->gcount() == 0)
+          return false;
+
+        if (m_is->gcount() < DUNE_IMC_CONST_HEADER_SIZE)
+          throw IMC::BufferTooShort();
+
+        IMC::Header hdr;
+        IMC::Packet::deserializeHeader(hdr, m_bfr.getBuffer(), DUNE_IMC_CONST_HEADER_SIZE);
+
+        unsigned remaining = hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+        unsigned size = DUNE_IMC_CONST_HEADER_SIZE + remaining;
+        m_bfr.setSize(size);
+        m_is->read(m_bfr.getBufferSigned() + DUNE_IMC_CONST_HEADER_SIZE, remaining);
+        if ((unsigned)m_is->gcount() < remaining)
+          throw IMC::BufferTooShort();
+
+        ++m_seq;
+
+        if (!m_decode[hdr.mgid])
+          return true;
+
+        // Entity information is needed to map entities after a seek.
+        if (hdr.mgid != DUNE_IMC_ENTITYINFO && hdr.mgid != DUNE_IMC_LBLCONFIG
+            && hdr.timestamp < getSkip())
+          return true;
+
+        IMC::Message* m = IMC::Packet::deserializePayload(hdr, m_bfr.getBuffer(), size, NULL);
+
+        if (m->getId() == DUNE_IMC_ENTITYINFO)
+        {
+          IMC::EntityInfo* ei = static_cast<IMC::EntityInfo*>(m);
+          std::map<std::string, uint8_t>::const_iterator itr = m_entities.find(ei->label);
+          if (itr != m_entities.end())
+          {
+            m_eid2eid[ei->id] = itr->second;
+            m_task->trace("entity %s %d --> %d", ei->label.c_str(), (int)ei->id, (int)itr->second);
+          }
+        }
+
+        m->setSourceEntity(mapEntity(m->getSourceEntity()));
+        m->setDestinationEntity(mapEntity(m->getDestinationEntity()));
+
+        Item item;
+        item.msg = m;
+        item.seq = m_seq;
+        item.replay = m_replay[m->getId()];
+
+        // States of the configured entities are always replayed.
+        if (m->getId() == DUNE_IMC_ENTITYSTATE && m->getSourceEntity() != DUNE_IMC_CONST_UNK_EID)
+          item.replay = true;
+
+        if (!item.replay && m->getId() != DUNE_IMC_ESTIMATEDSTATE)
+        {
+          delete m;
+          return true;
+        }
+
+        if (m->getId() == DUNE_IMC_LBLCONFIG)
+          m->setTimeStamp(m_log_start);
+
+        item.time = m->getTimeStamp();
+        if (item.time > m_newest)
+          m_newest = item.time;
+
+        m_heap.push(item);
+
+        while (!m_heap.empty() && m_heap.top().time <= m_newest - m_window)
+        {
+          release(m_heap.top());
+          m_heap.pop();
+        }
+
+        return true;
+      }
+
+      //! Hand a message over to the replay task, waiting while the
+      //! queue is full.
+      //! @param[in] item message.
+      void
+      release(const Item& item)
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        while (m_queue.size() >= m_capacity && !isStopping())
+          m_cond.wait();
+
+        if (isStopping() || isSkipped(item))
+        {
+          delete item.msg;
+          return;
+        }
+
+        m_queue.push_back(item);
+        if (m_queue.size() == 1)
+          m_cond.broadcast();
+      }
+
+      void
+      run(void)
+      {
+        Clock::attach();
+
+        try
+        {
+          while (!isStopping() && read())
+          { }
+
+          while (!isStopping() && !m_heap.empty())
+          {
+            release(m_heap.top());
+            m_heap.pop();
+          }
+        }
+        catch (std::exception& e)
+        {
+          Concurrency::ScopedCondition l(m_cond);
+          m_error = e.what();
+        }
+
+        {
+          Concurrency::ScopedCondition l(m_cond);
+          m_done = true;
+          m_cond.broadcast();
+        }
+
+        Clock::detach();
+      }
+    };
+  }
+}
+
+#endif
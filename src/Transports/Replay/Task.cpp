@@ -27,15 +27,19 @@
 // Author: Eduardo Marques                                                  *
 //***************************************************************************
 
+
 // ISO C++ 98 headers.
 #include <string>
 #include <vector>
 #include <map>
-#include <fstream>
+#include <set>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
+// Local headers.
+#include "Reader.hpp"
+
 namespace Transports
 {
   namespace Replay
@@ -47,9 +51,26 @@ namespace Transports
       std::string startup_file;
       std::vector<std::string> msgs;
       std::vector<std::string> ents;
+      //! Replay speed, zero to replay as fast as consumers allow.
+      double speed;
+      //! Log time where replay starts, relative to the log start.
+      double start_time;
+      //! Maximum number of messages queued by any consumer.
+      unsigned backlog;
+      //! Maximum time to wait for consumers.
+      double backlog_timeout;
+      //! Number of messages decoded ahead.
+      unsigned read_ahead;
+      //! Reorder window.
+      double window;
     };
 
     static const int c_stats_period = 10;
+    //! Longest uninterrupted wait, so that requests are handled while
+    //! waiting for distant deadlines.
+    static const double c_wait_slice = 0.1;
+    //! Period to check the backlog of consumers.
+    static const double c_backlog_period = 0.001;
 
     struct Task: public DUNE::Tasks::Task
     {
@@ -61,17 +82,36 @@ namespace Transports
       typedef std::map<uint8_t, std::string> Eid2Name;
       Eid2Name m_eid2name;
 
-      typedef std::map<uint8_t, uint8_t> Eid2Eid;
-      Eid2Eid m_eid2eid;
-
       typedef std::map<std::string, bool> ReplayMsg;
       ReplayMsg m_replay;
 
+      // Identifiers of replayed messages
+      std::set<uint16_t> m_replay_ids;
+
       double m_ts_delta;
       double m_start_time;
 
-      // Replay file handle
-      std::istream* m_is;
+      // Replay file
+      std::string m_file;
+      // Background log reader
+      Reader* m_reader;
+      // Message waiting to be dispatched
+      Item m_item;
+      // Timestamp of the first message in the replay file
+      double m_log_start;
+      // Log time and wall-clock time where the timeline is anchored
+      double m_log_ref;
+      double m_wall_ref;
+      // Log time of the latest dispatched message
+      double m_position;
+      // Latest dispatched timestamp
+      double m_last_ts;
+      // Start of the wait for consumers, negative if not waiting
+      double m_backlog_since;
+      // Messages dispatched before consumers caught up
+      unsigned m_stalls;
+      // True if replay is paused
+      bool m_paused;
       // last state from replay file
       IMC::EstimatedState m_estate;
 
@@ -96,7 +136,8 @@ namespace Transports
 
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Task(name, ctx),
-        m_is(0)
+        m_reader(NULL),
+        m_paused(false)
       {
         param("Load At Start", m_args.startup_file)
         .defaultValue("")
@@ -110,19 +151,85 @@ namespace Transports
         .defaultValue("")
         .description("Entities for which state should be reported");
 
+        param("Speed", m_args.speed)
+        .defaultValue("1.0")
+        .minimumValue("0.0")
+        .visibility(Tasks::Parameter::VISIBILITY_USER)
+        .scope(Tasks::Parameter::SCOPE_GLOBAL)
+        .description("Replay speed relative to real time. Zero replays messages "
+                     "as fast as their consumers are able to handle them");
+
+        param("Start Time", m_args.start_time)
+        .defaultValue("0.0")
+        .minimumValue("0.0")
+        .units(Units::Second)
+        .visibility(Tasks::Parameter::VISIBILITY_USER)
+        .scope(Tasks::Parameter::SCOPE_GLOBAL)
+        .description("Time, since the start of the log, where replay begins. "
+                     "Changing it during replay seeks to the new time");
+
+        param("Consumer Backlog", m_args.backlog)
+        .defaultValue("0")
+        .description("When replaying as fast as consumers allow, largest number "
+                     "of messages a consumer may have queued before the next "
+                     "message is dispatched");
+
+        param("Consumer Timeout", m_args.backlog_timeout)
+        .defaultValue("1.0")
+        .minimumValue("0.0")
+        .units(Units::Second)
+        .description("Maximum time to wait for consumers to catch up");
+
+        param("Read Ahead", m_args.read_ahead)
+        .defaultValue("4096")
+        .minimumValue("16")
+        .description("Number of messages decoded ahead of replay");
+
+        param("Reorder Window", m_args.window)
+        .defaultValue("0.5")
+        .minimumValue("0.0")
+        .units(Units::Second)
+        .description("Messages are replayed by timestamp, in log order when "
+                     "timestamps are equal. Messages logged up to this long "
+                     "after a later one are moved before it");
+
         bind<IMC::ReplayControl>(this);
       }
 
       void
       onUpdateParameters(void)
       {
+        m_replay_ids.clear();
         for (unsigned i = 0; i < m_args.msgs.size(); ++i)
+        {
           m_replay[m_args.msgs[i]] = true;
 
+          if (m_args.msgs[i].empty())
+            continue;
+
+          try
+          {
+            m_replay_ids.insert(IMC::Factory::getIdFromAbbrev(m_args.msgs[i]));
+          }
+          catch (std::exception& e)
+          {
+            war("%s", e.what());
+          }
+        }
+
         if (m_replay.find("EstimatedState") == m_replay.end())
           bind<IMC::EstimatedState>(this);
 
-        reset();
+        if (m_reader == NULL)
+        {
+          reset();
+          return;
+        }
+
+        if (paramChanged(m_args.start_time))
+          seek(m_log_start + m_args.start_time);
+        else if (paramChanged(m_args.speed))
+          restartTimeline(m_position);
       }
 
       ~Task(void)
@@ -178,80 +285,85 @@ namespace Transports
           case IMC::ReplayControl::ROP_STOP:
             stopReplay();
             break;
+          case IMC::ReplayControl::ROP_PAUSE:
+            pauseReplay();
+            break;
+          case IMC::ReplayControl::ROP_RESUME:
+            resumeReplay();
+            break;
           default:
             err(DTR("operation not supported"));
         }
       }
 
-      uint8_t
-      mapEntity(uint8_t eid)
-      {
-        // Convert ent. id read from file to local context
-        Eid2Eid::iterator itr = m_eid2eid.find(eid);
-
-        if (itr == m_eid2eid.end())
-          return DUNE_IMC_CONST_UNK_EID;
-
-        return itr->second;
-      }
-
-      void
-      startReplay(const std::string& file)
+      //! Create the log reader and start reading.
+      //! @param[in] offset time since the start of the log of the
+      //! first message to read.
+      //! @return first message of the log, owned by the caller, or
+      //! NULL on failure.
+      IMC::LoggingControl*
+      createReader(double offset)
       {
-        if (isActive())
-          stopReplay();
-
-        if (!Path(file).isFile())
-        {
-          err("'%s' %s", file.c_str(), DTR("is not a regular file"));
-          return;
-        }
+        m_reader = new Reader(this, m_file, m_replay_ids, m_name2eid,
+                              m_args.read_ahead, m_args.window);
 
         try
         {
-          Compression::Methods method = Compression::Factory::detect(file.c_str());
-          if (method == Compression::METHOD_UNKNOWN)
-            m_is = new std::ifstream(file.c_str(), std::ios::binary);
-          else
-            m_is = new Compression::FileInput(file.c_str(), method);
+          IMC::LoggingControl* lc = m_reader->open();
+          m_reader->skip(lc->getTimeStamp() + offset);
+          m_reader->start();
+          return lc;
         }
         catch (std::exception& e)
         {
-          err("%s '%s': %s", DTR("could not open"), file.c_str(), e.what());
-          return;
+          err("%s '%s': %s", DTR("could not open"), m_file.c_str(), e.what());
+          delete m_reader;
+          m_reader = NULL;
+          return NULL;
         }
+      }
 
-        IMC::Message* m = 0;
+      void
+      deleteReader(void)
+      {
+        discardItem();
 
-        try
-        {
-          m = IMC::Packet::deserialize(*m_is);
-        }
-        catch (std::exception& e)
+        if (m_reader != NULL)
         {
-          err("%s: %s", DTR("deserialization error"), e.what());
-          reset();
-          return;
+          m_reader->stopAndJoin();
+          delete m_reader;
+          m_reader = NULL;
         }
+      }
+
+      void
+      discardItem(void)
+      {
+        delete m_item.msg;
+        m_item = Item();
+      }
+
+      void
+      startReplay(const std::string& file)
+      {
+        if (m_reader != NULL)
+          stopReplay();
 
-        if (!m)
+        if (!Path(file).isFile())
         {
-          err(DTR("empty LSF file"));
-          reset();
+          err("'%s' %s", file.c_str(), DTR("is not a regular file"));
           return;
         }
 
-        if (m->getId() != DUNE_IMC_LOGGINGCONTROL)
+        m_file = file;
+        IMC::LoggingControl* lc = createReader(m_args.start_time);
+        if (lc == NULL)
         {
-          err(DTR("invalid LSF file for replay"));
-          delete m;
           reset();
           return;
         }
 
-        IMC::LoggingControl* lc = static_cast<IMC::LoggingControl*>(m);
-
-        m_ts_delta = lc->getTimeStamp();
+        m_log_start = lc->getTimeStamp();
 
         size_t spos = lc->name.find_last_of('/');
         if (spos != std::string::npos)
@@ -261,10 +373,13 @@ namespace Transports
         lc->op = IMC::LoggingControl::COP_REQUEST_START;
         dispatch(lc); // change log (if Logging task happens to be active)
 
-        m_ts_delta = lc->getTimeStamp() - m_ts_delta;
         m_start_time = lc->getTimeStamp();
         m_next_stats = m_start_time + c_stats_period;
-        delete m;
+        m_last_ts = 0;
+        m_stalls = 0;
+        m_paused = false;
+        restartTimeline(m_log_start + m_args.start_time);
+        delete lc;
 
         requestActivation();
 
@@ -276,6 +391,9 @@ namespace Transports
       {
         war(DTR("stopped replay"));
 
+        if (m_stalls > 0)
+          war(DTR("%u messages dispatched before consumers caught up"), m_stalls);
+
         displayStats();
         reset();
 
@@ -286,6 +404,80 @@ namespace Transports
         dispatch(lc);
       }
 
+      void
+      pauseReplay(void)
+      {
+        if (m_reader == NULL || m_paused)
+          return;
+
+        m_paused = true;
+        war(DTR("paused replay"));
+      }
+
+      void
+      resumeReplay(void)
+      {
+        if (m_reader == NULL || !m_paused)
+          return;
+
+        m_paused = false;
+        restartTimeline(m_position);
+        war(DTR("resumed replay"));
+      }
+
+      //! Move replay to a given log time. Seeking forward lets the
+      //! reader skip messages without decoding them, seeking
+      //! backward reads the log again from its start.
+      //! @param[in] target log time.
+      void
+      seek(double target)
+      {
+        if (target >= m_position)
+        {
+          m_reader->skip(target);
+          if (m_item.msg != NULL && m_item.time < target
+              && m_item.msg->getId() != DUNE_IMC_LBLCONFIG)
+            discardItem();
+        }
+        else
+        {
+          deleteReader();
+          IMC::LoggingControl* lc = createReader(target - m_log_start);
+          if (lc == NULL)
+          {
+            stopReplay();
+            return;
+          }
+
+          delete lc;
+        }
+
+        restartTimeline(target);
+        inf("%s %0.3f s", DTR("replaying from"), target - m_log_start);
+      }
+
+      //! Anchor deadlines at a given log time. Timestamps of
+      //! dispatched messages continue from the current time and
+      //! never go backward.
+      //! @param[in] position log time.
+      void
+      restartTimeline(double position)
+      {
+        double now = Clock::getSinceEpoch();
+        m_position = position;
+        m_log_ref = position;
+        m_wall_ref = now;
+        m_ts_delta = std::max(now, m_last_ts) - position;
+      }
+
+      //! Compute when the pending message is due.
+      //! @return wall-clock time.
+      double
+      getDeadline(void) const
+      {
+        return m_wall_ref + (m_item.time - m_log_ref) / m_args.speed;
+      }
+
       void
       displayStats(void)
       {
@@ -316,16 +508,131 @@ namespace Transports
       {
         requestDeactivation();
 
-        if (m_is)
-        {
-          delete m_is;
-          m_is = 0;
-        }
-        m_eid2eid.clear();
+        deleteReader();
+        m_paused = false;
         m_tstats.clear();
         m_tgstats = Stats();
       }
 
+      //! Retrieve the next message to dispatch.
+      //! @return true if a message is pending, false otherwise.
+      bool
+      fetch(void)
+      {
+        while (m_reader->pop(m_item, c_wait_slice))
+        {
+          if (m_item.msg->getId() == DUNE_IMC_ESTIMATEDSTATE)
+            m_estate = *static_cast<IMC::EstimatedState*>(m_item.msg);
+
+          if (m_item.replay)
+          {
+            m_backlog_since = -1.0;
+            return true;
+          }
+
+          discardItem();
+        }
+
+        if (m_reader->isDone())
+        {
+          std::string error = m_reader->getError();
+          if (!error.empty())
+            err("%s: %s", DTR("deserialization error"), error.c_str());
+
+          stopReplay();
+        }
+
+        return false;
+      }
+
+      //! Test if the pending message may be dispatched, waiting a
+      //! little for it otherwise.
+      //! @return true if the message is due, false otherwise.
+      bool
+      isDue(void)
+      {
+        if (m_args.speed <= 0.0)
+          return consumersReady();
+
+        double delta = getDeadline() - Clock::getSinceEpoch();
+        if (delta < 1e-03)
+          return true;
+
+        // Delay::wait does not behave satisfactorily otherwise
+        // in some systems
+        if (delta > c_wait_slice)
+        {
+          Delay::wait(c_wait_slice);
+          return false;
+        }
+
+        Delay::wait(delta);
+        return true;
+      }
+
+      //! Test if the consumers of the pending message have caught
+      //! up, waiting a little for them otherwise.
+      //! @return true if the message may be dispatched, false
+      //! otherwise.
+      bool
+      consumersReady(void)
+      {
+        if (m_ctx.mbus.getBacklog(m_item.msg->getId(), this) <= m_args.backlog)
+          return true;
+
+        double now = Clock::get();
+        if (m_backlog_since < 0)
+        {
+          m_backlog_since = now;
+        }
+        else if (now - m_backlog_since >= m_args.backlog_timeout)
+        {
+          ++m_stalls;
+          return true;
+        }
+
+        Delay::wait(c_backlog_period);
+        return false;
+      }
+
+      //! Dispatch the pending message.
+      void
+      replay(void)
+      {
+        IMC::Message* m = m_item.msg;
+
+        double now = Clock::getSinceEpoch();
+        double delay = 0;
+        if (m_args.speed > 0.0)
+          delay = std::max(0.0, now - getDeadline());
+
+        if (m_item.time > m_position)
+          m_position = m_item.time;
+
+        double new_ts = m_item.time + m_ts_delta;
+        m->setTimeStamp(new_ts);
+        if (new_ts > m_last_ts)
+          m_last_ts = new_ts;
+
+        // Counter for delay before bus delivery
+        updateStats(m_tstats[m->getName()], delay);
+        updateStats(m_tgstats, delay);
+
+        // Dispatch message
+        dispatch(m, DF_KEEP_TIME);
+
+        if (now >= m_next_stats)
+        {
+          displayStats();
+          m_next_stats += c_stats_period;
+        }
+
+        spew("%s %0.4f %s", m->getName(), (new_ts - m_start_time),
+             m_eid2name[m->getSourceEntity()].c_str());
+
+        discardItem();
+      }
+
       void
       onMain(void)
       {
@@ -334,7 +641,7 @@ namespace Transports
 
         while (!stopping())
         {
-          if (!isActive())
+          if (m_reader == NULL || m_paused)
           {
             waitForMessages(1.0);
             continue;
@@ -342,89 +649,14 @@ namespace Transports
 
           consumeMessages(); // for possible ReplayControl requests
 
-          if (!isActive())
+          if (m_reader == NULL || m_paused)
             continue;
 
-          IMC::Message* m = 0;
-
-          while (!stopping() && (m = DUNE::IMC::Packet::deserialize(*m_is)) != 0 && !m_is->eof())
-          {
-            consumeMessages();
-
-            if (m->getId() == DUNE_IMC_ESTIMATEDSTATE)
-            {
-              m_estate = *static_cast<IMC::EstimatedState*>(m);
-            }
-            else if (m->getId() == DUNE_IMC_ENTITYINFO)
-            {
-              // Update entity id map
-              IMC::EntityInfo* ei = static_cast<IMC::EntityInfo*>(m);
-              Name2Eid::iterator itr = m_name2eid.find(ei->label);
-
-              if (itr != m_name2eid.end())
-              {
-                m_eid2eid[ei->id] = itr->second;
-
-                trace("entity %s %d --> %d", ei->label.c_str(), (int)ei->id, (int)itr->second);
-              }
-            }
-
-            m->setSourceEntity(mapEntity(m->getSourceEntity()));
-            m->setDestinationEntity(mapEntity(m->getDestinationEntity()));
-
-            if ((m->getId() == DUNE_IMC_ENTITYSTATE && m->getSourceEntity() != DUNE_IMC_CONST_UNK_EID) || m_replay.find(m->getName()) != m_replay.end())
-            {
-              double original_ts;
-
-              if (m->getId() == DUNE_IMC_LBLCONFIG)
-                original_ts = m_start_time - m_ts_delta;
-              else
-                original_ts = m->getTimeStamp();
-
-              double new_ts = original_ts + m_ts_delta;
-              m->setTimeStamp(new_ts);
-
-              // Wait till the time is right
-              double now = Clock::getSinceEpoch();
-              double delta = new_ts - now;
-
-              double delay;
-
-              if (delta >= 1e-03)
-              {
-                // Delay::wait does not behave satisfactorily otherwise
-                // in some systems
-                Delay::wait(delta);
-                delay = Clock::getSinceEpoch() - new_ts;
-              }
-              else
-              {
-                delay = 0;
-                delta = 0;
-              }
-
-              // Counter for delay before bus delivery
-              updateStats(m_tstats[m->getName()], delay);
-              updateStats(m_tgstats, delay);
-
-              // Dispatch message
-              dispatch(m, DF_KEEP_TIME);
-
-              if (now >= m_next_stats)
-              {
-                displayStats();
-                m_next_stats += c_stats_period;
-              }
-
-              spew("%s %0.4f %s", m->getName(), (new_ts - m_start_time),
-                   m_eid2name[m->getSourceEntity()].c_str());
-            }
-          }
-
-          stopReplay();
+          if (m_item.msg == NULL && !fetch())
+            continue;
 
-          // Clean up
-          delete m;
+          if (isDue())
+            replay();
         }
       }
 
@@ -59,8 +59,8 @@ namespace Transports
       SerialPort* m_uart;
       // Task arguments.
       Arguments m_args;
-      // I/O Multiplexer.
-      Poll m_poll;
+      // I/O Multiplexer, also woken up when the task is stopped.
+      IO::Reactor m_poll;
       // Clients.
       std::list<TCPSocket*> m_clients;
 
@@ -233,15 +233,19 @@ namespace Transports
       void
       onMain(void)
       {
+        attachReactor(m_poll);
+
         while (!stopping())
         {
-          if (m_poll.poll(1.0))
+          if (m_poll.wait(1.0) && m_poll.getTriggeredCount() > 0)
           {
             checkSerialPort();
             checkMainSocket();
             checkClientSockets();
           }
         }
+
+        detachReactor();
       }
     };
   }
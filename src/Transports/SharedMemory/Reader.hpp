@@ -0,0 +1,207 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+#ifndef TRANSPORTS_SHARED_MEMORY_READER_HPP_INCLUDED_
+#define TRANSPORTS_SHARED_MEMORY_READER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Transports
+{
+  namespace SharedMemory
+  {
+    using DUNE_NAMESPACES;
+
+    //! Interval between attempts to attach to a missing ring (s).
+    static const double c_retry_period = 1.0;
+    //! Maximum time a reader sleeps waiting for messages (s).
+    static const double c_wait_timeout = 1.0;
+    //! Time without messages after which the reader checks if the
+    //! peer replaced its ring (s).
+    static const double c_idle_timeout = 5.0;
+
+    //! Reads the ring of one peer and dispatches its messages.
+    class Reader: public Concurrency::Thread
+    {
+    public:
+      //! Constructor.
+      //! @param[in] task parent task.
+      //! @param[in] name name of the peer's ring.
+      Reader(Tasks::Task& task, const std::string& name):
+        m_task(task),
+        m_name(name),
+        m_ring(NULL),
+        m_last(0),
+        m_overruns(0)
+      { }
+
+      //! Destructor.
+      ~Reader(void)
+      {
+        Memory::clear(m_ring);
+      }
+
+    private:
+      //! Buffer capacity.
+      static const unsigned c_bfr_size = 65536;
+      //! Parent task.
+      Tasks::Task& m_task;
+      //! Name of the peer's ring.
+      std::string m_name;
+      //! Peer's ring.
+      SharedRing* m_ring;
+      //! Time of the last message or attach attempt.
+      double m_last;
+      //! Number of overruns already reported.
+      unsigned m_overruns;
+      //! Record buffer.
+      uint8_t m_bfr[c_bfr_size];
+
+      //! Attach to the peer's ring. If already attached, switch to
+      //! a new ring only if the peer created one.
+      void
+      attach(void)
+      {
+        m_last = Clock::get();
+
+        SharedRing* ring = new SharedRing(m_name.c_str());
+        try
+        {
+          ring->open();
+        }
+        catch (std::exception& e)
+        {
+          delete ring;
+          ring = NULL;
+        }
+
+        if (m_ring != NULL)
+        {
+          // Peer is alive but quiet.
+          if (ring == NULL && !m_ring->isClosed())
+            return;
+
+          if (ring != NULL && ring->getSession() == m_ring->getSession())
+          {
+            delete ring;
+            return;
+          }
+
+          m_task.inf(DTR("detached from %s"), m_name.c_str());
+          Memory::clear(m_ring);
+        }
+
+        if (ring != NULL)
+        {
+          m_task.inf(DTR("attached to %s"), m_name.c_str());
+          m_ring = ring;
+          m_overruns = 0;
+        }
+      }
+
+      //! Deserialize a record. Rings are in memory, so there is no
+      //! CRC to validate.
+      //! @param[in] size size of record.
+      //! @return message or NULL if the record is invalid.
+      IMC::Message*
+      unpack(unsigned size)
+      {
+        try
+        {
+          IMC::Header hdr;
+          IMC::Packet::deserializeHeader(hdr, m_bfr, size);
+          if ((unsigned)(DUNE_IMC_CONST_HEADER_SIZE + hdr.size) > size)
+            return NULL;
+
+          return IMC::Packet::deserializePayload(hdr, m_bfr, size, NULL, false);
+        }
+        catch (std::exception& e)
+        {
+          m_task.debug("%s: %s", m_name.c_str(), e.what());
+        }
+
+        return NULL;
+      }
+
+      //! Dispatch all pending messages.
+      void
+      receive(void)
+      {
+        unsigned size = 0;
+        while ((size = m_ring->read(m_bfr, c_bfr_size)) > 0)
+        {
+          IMC::Message* msg = unpack(size);
+          if (msg == NULL)
+            continue;
+
+          m_task.dispatch(msg, DF_KEEP_TIME | DF_KEEP_SRC_EID);
+          delete msg;
+        }
+
+        m_last = Clock::get();
+
+        if (m_ring->getOverruns() != m_overruns)
+        {
+          m_task.war(DTR("%s: lost messages (%u)"), m_name.c_str(), m_ring->getOverruns() - m_overruns);
+          m_overruns = m_ring->getOverruns();
+        }
+      }
+
+      void
+      run(void)
+      {
+        while (!isStopping())
+        {
+          if (m_ring == NULL)
+          {
+            attach();
+            if (m_ring == NULL)
+              Delay::wait(c_retry_period);
+            continue;
+          }
+
+          if (m_ring->wait(c_wait_timeout))
+          {
+            receive();
+            continue;
+          }
+
+          if (m_ring->isClosed() || (Clock::get() - m_last) > c_idle_timeout)
+            attach();
+        }
+      }
+    };
+  }
+}
+
+#endif
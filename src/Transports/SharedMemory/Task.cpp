@@ -0,0 +1,175 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Seruca                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Reader.hpp"
+
+namespace Transports
+{
+  //! Transport of IMC messages between DUNE instances running on
+  //! the same computer, through shared memory rings.
+  //!
+  //! Each instance writes the messages it transports to its own
+  //! ring and reads the rings of its peers. Packets are written in
+  //! place, without CRC, and readers sleep until the writer commits
+  //! a packet. Any number of instances may read the same ring.
+  //!
+  //! @author Pedro Seruca
+  namespace SharedMemory
+  {
+    using DUNE_NAMESPACES;
+
+    //! Minimum ring size (KiB), so that the largest IMC packet fits.
+    static const unsigned c_min_ring_size = 512;
+
+    //! %Task arguments.
+    struct Arguments
+    {
+      //! Name of this instance's ring.
+      std::string name;
+      //! Ring size (KiB).
+      unsigned size;
+      //! Names of the rings of peers.
+      std::vector<std::string> peers;
+      //! List of messages to transport.
+      std::vector<std::string> messages;
+    };
+
+    struct Task: public DUNE::Tasks::Task
+    {
+      //! Task arguments.
+      Arguments m_args;
+      //! Ring of this instance.
+      SharedRing* m_ring;
+      //! Readers of the peers' rings.
+      std::vector<Reader*> m_readers;
+
+      Task(const std::string& name, Tasks::Context& ctx):
+        DUNE::Tasks::Task(name, ctx),
+        m_ring(NULL)
+      {
+        param("Ring Name", m_args.name)
+        .defaultValue("")
+        .description("Name of this instance's ring, the system name if empty");
+
+        param("Ring Size", m_args.size)
+        .defaultValue("1024")
+        .minimumValue("512")
+        .description("Size of this instance's ring in KiB");
+
+        param("Peers", m_args.peers)
+        .defaultValue("")
+        .description("Names of the rings of other instances on this computer");
+
+        param("Transports", m_args.messages)
+        .defaultValue("")
+        .description("List of messages to transport");
+      }
+
+      void
+      onResourceAcquisition(void)
+      {
+        std::string name = m_args.name.empty() ? getSystemName() : m_args.name;
+
+        m_ring = new SharedRing(name.c_str());
+        m_ring->create(std::max(m_args.size, c_min_ring_size) * 1024);
+        inf(DTR("created ring %s"), name.c_str());
+
+        for (unsigned i = 0; i < m_args.peers.size(); ++i)
+        {
+          if (m_args.peers[i].empty() || m_args.peers[i] == name)
+            continue;
+
+          m_readers.push_back(new Reader(*this, m_args.peers[i]));
+        }
+
+        bind(this, m_args.messages);
+      }
+
+      void
+      onResourceInitialization(void)
+      {
+        for (unsigned i = 0; i < m_readers.size(); ++i)
+          m_readers[i]->start();
+
+        setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
+      }
+
+      void
+      onResourceRelease(void)
+      {
+        for (unsigned i = 0; i < m_readers.size(); ++i)
+        {
+          m_readers[i]->stopAndJoin();
+          delete m_readers[i];
+        }
+        m_readers.clear();
+
+        Memory::clear(m_ring);
+      }
+
+      void
+      consume(const IMC::Message* msg)
+      {
+        if (m_ring == NULL)
+          return;
+
+        // Packets are written in place and without footer.
+        unsigned size = msg->getSerializationSize() - DUNE_IMC_CONST_FOOTER_SIZE;
+        if (size > m_ring->getMaximumRecordSize())
+        {
+          war(DTR("message %s is too large for the ring"), msg->getName());
+          return;
+        }
+
+        uint8_t* bfr = m_ring->reserve(size);
+        IMC::Packet::serializeHeader(msg, bfr, size);
+        msg->serializeFields(bfr + DUNE_IMC_CONST_HEADER_SIZE);
+        m_ring->commit(size);
+      }
+
+      void
+      onMain(void)
+      {
+        while (!stopping())
+          waitForMessages(1.0);
+      }
+    };
+  }
+}
+
+DUNE_TASK
@@ -27,6 +27,11 @@
 // Author: Eduardo Marques                                                  *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <deque>
+#include <list>
+#include <vector>
+
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
@@ -38,6 +43,15 @@ namespace Transports
     {
       using DUNE_NAMESPACES;
 
+      //! Policy applied to clients whose write queue is full.
+      enum BackpressurePolicy
+      {
+        //! Drop new data for that client.
+        BP_DROP,
+        //! Disconnect the client.
+        BP_DISCONNECT
+      };
+
       //! Task arguments
       struct Arguments
       {
@@ -45,6 +59,19 @@ namespace Transports
         uint16_t port;
         //! True to announce service.
         bool announce;
+        //! Maximum amount of queued data per client.
+        unsigned queue_size;
+        //! Backpressure policy.
+        std::string policy;
+      };
+
+      //! Serialized message shared by the write queues of all clients.
+      struct Frame
+      {
+        //! Serialized message.
+        std::vector<uint8_t> data;
+        //! Number of queues referencing the frame.
+        unsigned refs;
       };
 
       struct Task: public Tasks::SimpleTransport
@@ -55,8 +82,10 @@ namespace Transports
         static const int c_port_retries = 5;
         // Server socket handle.
         TCPSocket* m_sock;
-        // I/O selector.
-        Poll m_poll;
+        // Maximum number of queued bytes per client.
+        size_t m_queue_limit;
+        // Backpressure policy.
+        BackpressurePolicy m_policy;
 
         // Client data.
         struct Client
@@ -65,6 +94,11 @@ namespace Transports
           Address address; // Client address.
           uint16_t port; // Client port.
           IMC::Parser parser; // Parser handle
+          std::deque<Frame*> queue; // Frames waiting to be written.
+          size_t offset; // Bytes of the first frame already written.
+          size_t queued; // Number of queued bytes.
+          bool blocked; // True if waiting for the socket to be writable.
+          unsigned drops; // Frames dropped since the queue was last empty.
         };
 
         // Client list.
@@ -73,7 +107,9 @@ namespace Transports
 
         Task(const std::string& name, Tasks::Context& ctx):
           Tasks::SimpleTransport(name, ctx),
-          m_sock(0)
+          m_sock(0),
+          m_queue_limit(0),
+          m_policy(BP_DROP)
         {
           param("Port", m_args.port)
           .defaultValue("7001")
@@ -82,6 +118,17 @@ namespace Transports
           param("Announce Service", m_args.announce)
           .defaultValue("true")
           .description("Set to true to announce the service");
+
+          param("Client Queue Size", m_args.queue_size)
+          .units(Units::Kibibyte)
+          .defaultValue("1024")
+          .minimumValue("1")
+          .description("Maximum amount of data waiting to be written to each client");
+
+          param("Backpressure Policy", m_args.policy)
+          .values("Drop, Disconnect")
+          .defaultValue("Drop")
+          .description("Action taken when the queue of a slow client is full");
         }
 
         ~Task(void)
@@ -89,6 +136,13 @@ namespace Transports
           onResourceRelease();
         }
 
+        void
+        onUpdateParameters(void)
+        {
+          m_queue_limit = m_args.queue_size * 1024;
+          m_policy = (m_args.policy == "Disconnect") ? BP_DISCONNECT : BP_DROP;
+        }
+
         void
         onResourceAcquisition(void)
         {
@@ -118,7 +172,7 @@ namespace Transports
           }
 
           m_sock->listen(5);
-          m_poll.add(*m_sock);
+          addDataHandle(*m_sock);
           inf(DTR("listening on %s:%u"), Address(Address::Any).c_str(), m_args.port);
 
           if (m_args.announce)
@@ -162,6 +216,21 @@ namespace Transports
           }
         }
 
+        //! Release the frames queued for a client.
+        void
+        clearQueue(Client& c)
+        {
+          for (size_t i = 0; i < c.queue.size(); ++i)
+          {
+            if (--c.queue[i]->refs == 0)
+              delete c.queue[i];
+          }
+
+          c.queue.clear();
+          c.offset = 0;
+          c.queued = 0;
+        }
+
         void
         closeConnection(Client& c, std::exception& e)
         {
@@ -171,7 +240,8 @@ namespace Transports
           debug("closing connection to %s:%u (%s), client count is %lu",
                 c.address.c_str(), c.port, e.what(), client_count);
 
-          m_poll.remove(*c.socket);
+          clearQueue(c);
+          removeDataHandle(*c.socket);
           delete c.socket;
         }
 
@@ -180,7 +250,8 @@ namespace Transports
         {
           for (ClientList::iterator itr = m_clients.begin(); itr != m_clients.end(); ++itr)
           {
-            m_poll.remove(*itr->socket);
+            clearQueue(*itr);
+            removeDataHandle(*itr->socket);
             delete itr->socket;
           }
 
@@ -188,22 +259,133 @@ namespace Transports
 
           if (m_sock)
           {
-            m_poll.remove(*m_sock);
+            removeDataHandle(*m_sock);
             delete m_sock;
             m_sock = 0;
           }
         }
 
+        //! Queue a frame for a client.
+        //! @return false if the client must be disconnected.
+        bool
+        enqueue(Client& c, Frame* frame)
+        {
+          if (c.queued + frame->data.size() > m_queue_limit)
+          {
+            if (m_policy == BP_DISCONNECT)
+              return false;
+
+            if (c.drops++ == 0)
+              war(DTR("client %s:%u is too slow, dropping data"), c.address.c_str(), c.port);
+
+            return true;
+          }
+
+          c.queue.push_back(frame);
+          c.queued += frame->data.size();
+          ++frame->refs;
+          return true;
+        }
+
+        //! Write as much queued data as the socket accepts, gathering
+        //! several frames in each system call.
+        void
+        flush(Client& c)
+        {
+          const uint8_t* bfrs[TCPSocket::c_max_write_buffers];
+          size_t sizes[TCPSocket::c_max_write_buffers];
+
+          while (!c.queue.empty())
+          {
+            unsigned count = 0;
+            size_t total = 0;
+            for (; count < TCPSocket::c_max_write_buffers && count < c.queue.size(); ++count)
+            {
+              size_t skip = (count == 0) ? c.offset : 0;
+              bfrs[count] = &c.queue[count]->data[0] + skip;
+              sizes[count] = c.queue[count]->data.size() - skip;
+              total += sizes[count];
+            }
+
+            size_t written = c.socket->writeNonBlocking(bfrs, sizes, count);
+            c.queued -= written;
+
+            size_t done = c.offset + written;
+            while (!c.queue.empty() && done >= c.queue.front()->data.size())
+            {
+              Frame* frame = c.queue.front();
+              done -= frame->data.size();
+              c.queue.pop_front();
+              if (--frame->refs == 0)
+                delete frame;
+            }
+
+            c.offset = done;
+
+            // Partial write, the socket send buffer is full.
+            if (written < total)
+              break;
+          }
+
+          bool blocked = !c.queue.empty();
+          if (blocked != c.blocked)
+          {
+            setWriteInterest(*c.socket, blocked);
+            c.blocked = blocked;
+          }
+
+          if (!blocked && c.drops > 0)
+          {
+            debug("client %s:%u recovered, %u frames dropped", c.address.c_str(), c.port, c.drops);
+            c.drops = 0;
+          }
+        }
+
         void
         onDataTransmission(const uint8_t* p, unsigned int n)
         {
+          if (m_clients.empty())
+            return;
+
+          // Serialized once, shared by all client queues.
+          Frame* frame = new Frame;
+          frame->data.assign(p, p + n);
+          frame->refs = 0;
+
           ClientList::iterator itr = m_clients.begin();
+          while (itr != m_clients.end())
+          {
+            if (!enqueue(*itr, frame))
+            {
+              std::runtime_error e(DTR("write queue full"));
+              closeConnection(*itr, e);
+              itr = m_clients.erase(itr);
+              continue;
+            }
+
+            ++itr;
+          }
 
+          if (frame->refs == 0)
+            delete frame;
+        }
+
+        void
+        onDataFlush(void)
+        {
+          ClientList::iterator itr = m_clients.begin();
           while (itr != m_clients.end())
           {
+            // Blocked clients are flushed when their socket is writable.
+            if (itr->blocked || itr->queue.empty())
+            {
+              ++itr;
+              continue;
+            }
+
             try
             {
-              itr->socket->write((char*)p, n);
+              flush(*itr);
             }
             catch (std::runtime_error& e)
             {
@@ -211,6 +393,7 @@ namespace Transports
               itr = m_clients.erase(itr);
               continue;
             }
+
             ++itr;
           }
         }
@@ -218,12 +401,10 @@ namespace Transports
         void
         onDataReception(uint8_t* buf, unsigned int cap, double timeout)
         {
-          // Poll for connections and client data
-          if (!m_poll.poll(timeout))
-            return;
+          (void)timeout;
 
           // Check for new clients.
-          if (m_poll.wasTriggered(*m_sock))
+          if (isReadable(*m_sock))
             acceptNewClient();
 
           // Check for client data
@@ -235,6 +416,11 @@ namespace Transports
         {
           Client c;
           c.socket = 0;
+          c.offset = 0;
+          c.queued = 0;
+          c.blocked = false;
+          c.drops = 0;
+
           try
           {
             c.socket = m_sock->accept(&c.address, &c.port);
@@ -242,7 +428,7 @@ namespace Transports
             c.socket->setNoDelay(true);
             c.socket->setReceiveTimeout(5);
             c.socket->setSendTimeout(5);
-            m_poll.add(*c.socket);
+            addDataHandle(*c.socket);
             m_clients.push_back(c);
             updateEntityState(m_clients.size());
 
@@ -260,22 +446,23 @@ namespace Transports
         void
         handleClients(uint8_t* buf, unsigned int cap)
         {
-          // Check for new data from clients.
           ClientList::iterator itr = m_clients.begin();
 
           while (itr != m_clients.end())
           {
-            if (!m_poll.wasTriggered(*itr->socket))
-            {
-              ++itr;
-              continue;
-            }
-
-            int n;
-
             try
             {
-              n = itr->socket->read((char*)buf, cap);
+              // Resume writing to clients that were blocked.
+              if (isWritable(*itr->socket))
+                flush(*itr);
+
+              // Check for new data from clients.
+              if (isReadable(*itr->socket))
+              {
+                int n = itr->socket->read((char*)buf, cap);
+                if (n > 0)
+                  handleData(itr->parser, buf, n);
+              }
             }
             catch (std::runtime_error& e)
             {
@@ -284,9 +471,6 @@ namespace Transports
               continue;
             }
 
-            if (n > 0)
-              handleData(itr->parser, buf, n);
-
             ++itr;
           }
         }
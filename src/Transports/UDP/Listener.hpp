@@ -47,14 +47,37 @@ namespace Transports
   {
     using DUNE_NAMESPACES;
 
+    //! Receives datagrams and dispatches the messages they carry. The
+    //! listener thread does not attach to the installed clock source:
+    //! its input comes from outside the process, and an attached
+    //! thread blocked in a socket poll would hold virtual time back
+    //! until the poll times out in real time.
     class Listener: public Concurrency::Thread
     {
     public:
+      //! Incoming datagram statistics.
+      struct Statistics
+      {
+        //! Number of received datagrams.
+        unsigned received;
+        //! Number of datagrams that could not be deserialized.
+        unsigned invalid;
+        //! Number of datagrams dropped by the system.
+        unsigned dropped;
+
+        Statistics(void):
+          received(0),
+          invalid(0),
+          dropped(0)
+        { }
+      };
+
       Listener(Tasks::Task& task, UDPSocket& sock, LimitedComms* lcomms,
-               float contact_timeout, bool trace = false):
+               float contact_timeout, bool trace = false, bool batched = true):
         m_task(task),
         m_sock(sock),
         m_trace(trace),
+        m_batch(batched ? c_batch_size : 1),
         m_contacts(contact_timeout),
         m_lcomms(lcomms)
       {  }
@@ -65,6 +88,15 @@ namespace Transports
         m_contacts.getContacts(list);
       }
 
+      //! Retrieve incoming datagram statistics. Must be called
+      //! between lockContacts() and unlockContacts().
+      //! @return statistics.
+      Statistics
+      getStatistics(void)
+      {
+        return m_stats;
+      }
+
       void
       lockContacts(void)
       {
@@ -80,6 +112,8 @@ namespace Transports
     private:
       // Buffer capacity.
       static const int c_bfr_size = 65535;
+      // Maximum number of datagrams received at once.
+      static const unsigned c_batch_size = 16;
       // Poll timeout in milliseconds.
       static const int c_poll_tout = 1000;
       // Parent task.
@@ -88,62 +122,113 @@ namespace Transports
       UDPSocket& m_sock;
       // True to print incoming messages.
       bool m_trace;
+      // Number of datagrams received at once.
+      unsigned m_batch;
       // Table of contacts.
       ContactTable m_contacts;
-      // Lock to serialize access to m_contacts.
+      // Lock to serialize access to m_contacts and m_stats.
       RWLock m_contacts_lock;
       // LimitedComms object
       LimitedComms* m_lcomms;
+      // Incoming datagram statistics.
+      Statistics m_stats;
+
+      //! Deserialize a datagram.
+      //! @return message or NULL if the datagram must be ignored.
+      IMC::Message*
+      unpack(const uint8_t* bfr, size_t size, unsigned& invalid)
+      {
+        IMC::Message* msg = NULL;
+
+        try
+        {
+          msg = IMC::Packet::deserialize(bfr, size);
+        }
+        catch (std::exception& e)
+        {
+          m_task.debug("error while unpacking message: %s", e.what());
+          ++invalid;
+          return NULL;
+        }
+
+        if (m_lcomms->isActive())
+        {
+          if (msg->getId() == DUNE_IMC_ANNOUNCE)
+          {
+            m_lcomms->setAnnounce(static_cast<IMC::Announce*>(msg));
+          }
+
+          if (!m_lcomms->isNodeWithinRange(msg->getSource(), msg->getId()))
+          {
+            delete msg;
+            return NULL;
+          }
+        }
+
+        return msg;
+      }
 
       void
       run(void)
       {
-        Address addr;
-        uint8_t* bfr = new uint8_t[c_bfr_size];
+        // Receive buffers are allocated once and reused.
+        std::vector<uint8_t> storage(c_batch_size * c_bfr_size);
+        uint8_t* bfrs[c_batch_size];
+        size_t sizes[c_batch_size];
+        Address addrs[c_batch_size];
+        IMC::Message* msgs[c_batch_size];
         double poll_tout = c_poll_tout / 1000.0;
 
+        for (unsigned i = 0; i < c_batch_size; ++i)
+          bfrs[i] = &storage[i * c_bfr_size];
+
         while (!isStopping())
         {
+          unsigned count = 0;
+
           try
           {
             if (!Poll::poll(m_sock, poll_tout))
               continue;
 
-            uint16_t rv = m_sock.read(bfr, c_bfr_size, &addr);
-            IMC::Message* msg = IMC::Packet::deserialize(bfr, rv);
+            count = m_sock.readMultiple(bfrs, c_bfr_size, sizes, addrs, NULL, m_batch);
+          }
+          catch (std::exception& e)
+          {
+            m_task.debug("error while receiving datagrams: %s", e.what());
+            continue;
+          }
 
-            if (m_lcomms->isActive())
-            {
-              if (msg->getId() == DUNE_IMC_ANNOUNCE)
-              {
-                m_lcomms->setAnnounce(static_cast<IMC::Announce*>(msg));
-              }
+          unsigned invalid = 0;
+          for (unsigned i = 0; i < count; ++i)
+            msgs[i] = unpack(bfrs[i], sizes[i], invalid);
 
-              if (!m_lcomms->isNodeWithinRange(msg->getSource(), msg->getId()))
-              {
-                delete msg;
-                continue;
-              }
-            }
+          m_contacts_lock.lockWrite();
 
-            m_contacts_lock.lockWrite();
-            m_contacts.update(msg->getSource(), addr);
-            m_contacts_lock.unlock();
+          for (unsigned i = 0; i < count; ++i)
+          {
+            if (msgs[i] != NULL)
+              m_contacts.update(msgs[i]->getSource(), addrs[i]);
+          }
+
+          m_stats.received += count;
+          m_stats.invalid += invalid;
+          m_stats.dropped = m_sock.getDropCount();
+          m_contacts_lock.unlock();
+
+          for (unsigned i = 0; i < count; ++i)
+          {
+            if (msgs[i] == NULL)
+              continue;
 
-            m_task.dispatch(msg, DF_KEEP_TIME | DF_KEEP_SRC_EID);
+            m_task.dispatch(msgs[i], DF_KEEP_TIME | DF_KEEP_SRC_EID);
 
             if (m_trace)
-              msg->toText(std::cerr);
+              msgs[i]->toText(std::cerr);
 
-            delete msg;
-          }
-          catch (std::exception & e)
-          {
-            m_task.debug("error while unpacking message: %s",e.what());
+            delete msgs[i];
           }
         }
-
-        delete [] bfr;
       }
     };
   }
@@ -137,22 +137,20 @@ namespace Transports
         return true;
       }
 
-      //! Send data to node.
-      //! @param[in] sock UDP destination socket.
-      //! @param[in] data data to be transmitted.
-      //! @param[in] data_len length of data to be transmitted.
-      void
-      send(UDPSocket& sock, const uint8_t* data, unsigned data_len)
+      //! Get the active destination of this node.
+      //! @param[out] addr destination address.
+      //! @param[out] port destination port.
+      //! @return true if the node has an active destination, false
+      //! otherwise.
+      bool
+      getDestination(Address& addr, uint16_t& port) const
       {
         if (m_active == m_addrs.end())
-          return;
+          return false;
 
-        try
-        {
-          sock.write(data, data_len, m_active->first, m_active->second);
-        }
-        catch (...)
-        { }
+        addr = m_active->first;
+        port = m_active->second;
+        return true;
       }
 
     private:
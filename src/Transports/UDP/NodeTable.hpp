@@ -33,6 +33,7 @@
 // ISO C++ 98 headers.
 #include <string>
 #include <map>
+#include <vector>
 #include <cstdio>
 
 // DUNE headers.
@@ -96,25 +97,29 @@ namespace Transports
         return m_active_count;
       }
 
+      //! Append the destinations of active nodes allowed to
+      //! receive a given message.
+      //! @param[in] msgid message identifier.
+      //! @param[out] addrs destination addresses.
+      //! @param[out] ports destination ports.
       void
-      send(UDPSocket& sock, const uint8_t* data, unsigned data_len, unsigned msgid)
+      getDestinations(unsigned msgid, std::vector<Address>& addrs, std::vector<uint16_t>& ports)
       {
-        if (m_lcomms != NULL)
-        {
-          if (m_lcomms->isActive())
-          {
-            for (Table::iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
-            {
-              if (m_lcomms->isNodeWithinRange(itr->first, msgid))
-                itr->second.send(sock, data, data_len);
-            }
-
-            return;
-          }
-        }
+        bool limited = (m_lcomms != NULL) && m_lcomms->isActive();
+        Address addr;
+        uint16_t port = 0;
 
         for (Table::iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
-          itr->second.send(sock, data, data_len);
+        {
+          if (limited && !m_lcomms->isNodeWithinRange(itr->first, msgid))
+            continue;
+
+          if (!itr->second.getDestination(addr, port))
+            continue;
+
+          addrs.push_back(addr);
+          ports.push_back(port);
+        }
       }
 
       void
@@ -84,6 +84,8 @@ namespace Transports
       bool only_local;
       // Optional custom service type
       std::string custom_service;
+      // Send and receive datagrams in batches.
+      bool batched;
     };
 
     // Internal buffer size.
@@ -115,12 +117,21 @@ namespace Transports
       LimitedComms* m_lcomms;
       //! Message Filter
       MessageFilter m_filter;
+      //! Destination addresses of the message being sent.
+      std::vector<Address> m_dst_addrs;
+      //! Destination ports of the message being sent.
+      std::vector<uint16_t> m_dst_ports;
+      //! Number of datagrams that could not be sent.
+      unsigned m_send_failures;
+      //! Incoming datagram statistics already reported.
+      Listener::Statistics m_stats;
 
       Task(const std::string& name, Tasks::Context& ctx):
         DUNE::Tasks::Task(name, ctx),
         m_bfr(NULL),
         m_listener(NULL),
-        m_lcomms(NULL)
+        m_lcomms(NULL),
+        m_send_failures(0)
       {
         param("Local Port", m_args.port)
         .defaultValue("6002")
@@ -184,6 +195,10 @@ namespace Transports
         .defaultValue("")
         .description("Optional custom service type (imc+udp+<Custom Service Type>), empty entry gives default service (imc+udp)");
 
+        param("Batched I/O", m_args.batched)
+        .defaultValue("true")
+        .description("Send and receive several datagrams per system call where supported");
+
         // Allocate space for internal buffer.
         m_bfr = new uint8_t[c_bfr_size];
 
@@ -260,6 +275,9 @@ namespace Transports
 
         inf(DTR("listening on %s:%u"), Address(Address::Any).c_str(), m_args.port);
 
+        if (!m_sock.enableDropCounter())
+          debug("counting of datagrams dropped by the system is not supported");
+
         if (m_args.announce_service)
         {
           // Initialize and dispatch AnnounceService.
@@ -299,7 +317,8 @@ namespace Transports
 
         // Start listener thread.
         m_listener = new Listener(*this, m_sock, m_lcomms,
-                                  m_args.contact_timeout, m_args.trace_in);
+                                  m_args.contact_timeout, m_args.trace_in,
+                                  m_args.batched);
         m_listener->start();
 
         setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
@@ -341,23 +360,45 @@ namespace Transports
 
         uint16_t rv = IMC::Packet::serialize(msg, m_bfr, c_bfr_size);
 
-        // Send to static nodes.
+        // The same datagram is sent to all destinations.
+        m_dst_addrs.clear();
+        m_dst_ports.clear();
+
         std::set<NodeAddress>::iterator itr = m_static_dsts.begin();
         for (; itr != m_static_dsts.end(); ++itr)
         {
-          try
-          {
-            m_sock.write(m_bfr, rv, itr->getAddress(), itr->getPort());
-          }
-          catch (...)
-          { }
+          m_dst_addrs.push_back(itr->getAddress());
+          m_dst_ports.push_back(itr->getPort());
         }
 
         if (m_args.dynamic_nodes)
+          m_node_table.getDestinations(msg->getId(), m_dst_addrs, m_dst_ports);
+
+        if (m_dst_addrs.empty())
+          return;
+
+        unsigned count = m_dst_addrs.size();
+        unsigned sent = 0;
+
+        if (m_args.batched)
         {
-          // Send to dynamic nodes.
-          m_node_table.send(m_sock, m_bfr, rv, msg->getId());
+          sent = m_sock.writeMultiple(m_bfr, rv, &m_dst_addrs[0], &m_dst_ports[0], count);
         }
+        else
+        {
+          for (unsigned i = 0; i < count; ++i)
+          {
+            try
+            {
+              m_sock.write(m_bfr, rv, m_dst_addrs[i], m_dst_ports[i]);
+              ++sent;
+            }
+            catch (...)
+            { }
+          }
+        }
+
+        m_send_failures += count - sent;
       }
 
       void
@@ -401,7 +442,31 @@ namespace Transports
           }
         }
 
+        Listener::Statistics stats = m_listener->getStatistics();
         m_listener->unlockContacts();
+
+        reportStatistics(stats);
+      }
+
+      void
+      reportStatistics(const Listener::Statistics& stats)
+      {
+        unsigned invalid = stats.invalid - m_stats.invalid;
+        unsigned dropped = stats.dropped - m_stats.dropped;
+
+        if (invalid > 0 || dropped > 0)
+        {
+          war(DTR("lost %u incoming datagrams (%u invalid, %u dropped by the system)"),
+              invalid + dropped, invalid, dropped);
+        }
+
+        if (m_send_failures > 0)
+        {
+          debug("failed to send %u datagrams", m_send_failures);
+          m_send_failures = 0;
+        }
+
+        m_stats = stats;
       }
 
       void